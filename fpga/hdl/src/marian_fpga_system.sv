@@ -67,6 +67,8 @@ module marian_fpga_system
   logic              [AxiAddrWidth-1:0] inval_addr;
   logic                                 inval_valid;
   logic                                 inval_ready;
+  // Ara's performance events, no counters on the FPGA system
+  ara_perf_t                            ara_perf;
 
   // Support max 8 cores, for now
   logic [63:0] hart_id;
@@ -151,13 +153,15 @@ module marian_fpga_system
     .acc_resp_valid_o(acc_resp_valid),
     .acc_resp_ready_i(acc_resp_ready),
     .axi_req_o       (ara_axi_req   ),
-    .axi_resp_i      (ara_axi_resp  )
+    .axi_resp_i      (ara_axi_resp  ),
+    .perf_o          (ara_perf      )
   );
 `else
   assign acc_req_ready  = '0;
   assign acc_resp       = '0;
   assign acc_resp_valid = '0;
   assign ara_axi_req    = '0;
+  assign ara_perf       = '0;
 `endif
 
   axi_mux #(
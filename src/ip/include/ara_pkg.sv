@@ -2166,4 +2166,44 @@ package ara_pkg;
     VS1 = 2
   } operand_e;
 
+  ////////////////////////////////
+  // Performance Monitor Events //
+  ////////////////////////////////
+
+  // operation types counted separately by the crypto unit
+  localparam int unsigned NrCryptoOpTypes = 5;
+
+  typedef enum logic [2:0] {
+    CryptoOpAES   = 0,
+    CryptoOpGHASH = 1,
+    CryptoOpSHA2  = 2,
+    CryptoOpSM4   = 3,
+    CryptoOpSM3   = 4
+  } crypto_op_type_e;
+
+  function automatic crypto_op_type_e crypto_op_type(ara_op_e op);
+    unique case (op) inside
+      [VAESK1:VAESZ_VS]:  crypto_op_type = CryptoOpAES;
+      [VGMUL:VGHSH]:      crypto_op_type = CryptoOpGHASH;
+      [VSHA2CH:VSHA2MS]:  crypto_op_type = CryptoOpSHA2;
+      [VSM4K:VSM4R_VS]:   crypto_op_type = CryptoOpSM4;
+      default:            crypto_op_type = CryptoOpSM3;
+    endcase
+  endfunction : crypto_op_type
+
+  // per cycle crypto unit events, one bit per operation type
+  typedef struct packed {
+    logic [NrCryptoOpTypes-1:0] busy;         // an instruction of this type is in the unit
+    logic [NrCryptoOpTypes-1:0] operand_wait; // collector ready, but operands missing from the VRF
+    logic [NrCryptoOpTypes-1:0] wb_stall;     // result held back by the VRF write grant
+  } crypto_perf_t;
+
+  // per cycle Ara events, counted in ctrl_registers
+  typedef struct packed {
+    crypto_perf_t              crypto;
+    logic [NrVFUs-1:0]         vinsn_issued; // instruction issued to each VFU (by vfu_e)
+    logic [15:0]               load_bytes;   // beat bytes: whole R beats accepted by the VLSU
+    logic [15:0]               store_bytes;  // strobed bytes of W beats sent by the VLSU
+  } ara_perf_t;
+
 endpackage : ara_pkg
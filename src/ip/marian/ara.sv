@@ -46,9 +46,11 @@
 //  - acc_resp_o: Accelerator response (accelerator_resp_t) going to Ariane
 //  - acc_resp_valid_o: Handshaking valid for accelerator response
 //  - axi_req_o: AXI S interface output signals
+//  - perf_o: Performance events of the crypto unit, the sequencer and the VLSU
 //
 // Revision History:
 //  - Version 1.0: Initial release
+//  - Version 1.1: Added performance events [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -88,7 +90,9 @@ module ara import ara_pkg::*; #(
     input  logic              acc_resp_ready_i,
     // AXI interface
     output axi_req_t          axi_req_o,
-    input  axi_resp_t         axi_resp_i
+    input  axi_resp_t         axi_resp_i,
+    // Performance events
+    output ara_perf_t         perf_o
   );
 
   import cf_math_pkg::idx_width;
@@ -520,6 +524,8 @@ module ara import ara_pkg::*; #(
   //  Crypto unit  //
   ///////////////////
 
+  crypto_perf_t crypto_perf;
+
   crypto_unit #(
     .NrLanes ( NrLanes ),
     .vaddr_t ( vaddr_t )
@@ -543,9 +549,38 @@ module ara import ara_pkg::*; #(
     .crypto_result_wdata_o     ( crypto_result_wdata                ),
     .crypto_result_be_o        ( crypto_result_be                   ),
     .crypto_result_gnt_i       ( crypto_result_gnt                  ),
-    .crypto_result_final_gnt_i ( crypto_result_final_gnt            )
+    .crypto_result_final_gnt_i ( crypto_result_final_gnt            ),
+    // performance events
+    .perf_o                    ( crypto_perf                        )
   );
 
+  //////////////////////////
+  //  Performance events  //
+  //////////////////////////
+
+  // An instruction leaves the sequencer once the operand requesters of all
+  // lanes take it (unmasked loads need no operands, see ara_sequencer)
+  logic pe_req_issued;
+
+  assign pe_req_issued = pe_req_valid &
+                         (&pe_req_ready[NrLanes-1:0] || (is_load(pe_req.op) && pe_req.vm));
+
+  always_comb begin
+    perf_o        = '0;
+    perf_o.crypto = crypto_perf;
+
+    if (pe_req_issued && pe_req.vfu != VFU_None)
+      perf_o.vinsn_issued[pe_req.vfu] = 1'b1;
+
+    // Bytes moved over the VLSU's AXI port. Loads count whole R beats, so
+    // narrow or unaligned loads count the bytes they discard too; stores
+    // count the strobed bytes
+    if (axi_resp_i.r_valid && axi_req_o.r_ready)
+      perf_o.load_bytes = AxiDataWidth / 8;
+    if (axi_req_o.w_valid && axi_resp_i.w_ready)
+      perf_o.store_bytes = $countones(axi_req_o.w.strb);
+  end
+
   //////////////////
   //  Assertions  //
   //////////////////
@@ -60,9 +60,11 @@
 //
 // Outputs:
 //  - axi_req_o: AXI request signals to System
+//  - ara_perf_o: Performance events of Ara, counted in ctrl_registers
 //
 // Revision History:
 //  - Version 1.0: Initial release
+//  - Version 1.1: Added Ara performance events [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -118,7 +120,9 @@ module ara_system import axi_pkg::*; import ara_pkg::*;
   input  system_axi_resp_t        axi_resp_i,
   input  logic                    timer_irq_i,
   input  logic                    ipi_i,
-  input  logic [(2*NB_CORES)-1:0] plic_irq_i
+  input  logic [(2*NB_CORES)-1:0] plic_irq_i,
+  // performance events
+  output ara_perf_t               ara_perf_o
 );
 
   `include "axi/assign.svh"
@@ -278,7 +282,8 @@ module ara_system import axi_pkg::*; import ara_pkg::*;
     .acc_resp_valid_o(acc_resp_valid),
     .acc_resp_ready_i(acc_resp_ready),
     .axi_req_o       (ara_axi_req   ),
-    .axi_resp_i      (ara_axi_resp  )
+    .axi_resp_i      (ara_axi_resp  ),
+    .perf_o          (ara_perf_o    )
   );
 
   axi_mux #(
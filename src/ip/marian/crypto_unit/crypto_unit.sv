@@ -37,10 +37,12 @@
 //  - crypto_result_addr_o: VRF address of result to be written
 //  - crypto_result_wdata_o: Data of result to be written to VRF
 //  - crypto_result_be_o: Byte enable (strobe) for writing result to VRF
+//  - perf_o: Busy, operand wait and back-pressure events per operation type
 //
 // Revision History:
 //  - Version 1.0: Initial release
 //  - Version 1.1: Fixed bug in pe_req filtering logic [TZS 02-jul-2024]
+//  - Version 1.2: Added performance events [19-oct-2026]
 //------------------------------------------------------------------------------
 
 module crypto_unit
@@ -76,7 +78,9 @@ module crypto_unit
   output elen_t     [NrLanes-1:0]      crypto_result_wdata_o,
   output strb_t     [NrLanes-1:0]      crypto_result_be_o,
   input  logic      [NrLanes-1:0]      crypto_result_gnt_i,
-  input  logic      [NrLanes-1:0]      crypto_result_final_gnt_i
+  input  logic      [NrLanes-1:0]      crypto_result_final_gnt_i,
+  // performance events
+  output crypto_perf_t                   perf_o
 );
 
 /**********
@@ -118,6 +122,9 @@ module crypto_unit
   // wb complete
   logic wb_done_s;
 
+  // performance events of the operand collector and write back
+  logic operand_wait_s, wb_stall_s;
+
 /**********************************
  * REGISTERS FOR STORING OPERANDS *
  **********************************/
@@ -277,7 +284,8 @@ end: gen_regs_vs1
     .crypto_operand_ready_o ( crypto_operand_ready  ),
     .crypto_args_buff_o     ( crypto_args_buff_s    ),
     .crypto_args_valid_o    ( crypto_args_valid_s   ),
-    .crypto_args_ready_i    ( crypto_args_ready_s   )
+    .crypto_args_ready_i    ( crypto_args_ready_s   ),
+    .operand_wait_o         ( operand_wait_s        )
   );
 
 /*******************
@@ -319,7 +327,8 @@ end: gen_regs_vs1
     .crypto_result_addr_o      ( crypto_result_addr_o      ),
     .crypto_result_wdata_o     ( crypto_result_wdata_o     ),
     .crypto_result_be_o        ( crypto_result_be_o        ),
-    .wb_done_o                 ( wb_done_s                 )
+    .wb_done_o                 ( wb_done_s                 ),
+    .wb_stall_o                ( wb_stall_s                )
   );
 
   // temporary logic to control when to send the pe_resp
@@ -340,4 +349,32 @@ end: gen_regs_vs1
     end
   end
 
+/**********************
+ * PERFORMANCE EVENTS *
+ **********************/
+
+  // the unit is busy with the oldest request that still occupies a stage:
+  // write back, then execution, then operand collection
+  always_comb begin
+
+    // default assignment
+    perf_o = '0;
+
+    if (wb_valid_s) begin
+      perf_o.busy[crypto_op_type(pe_crypto_req_wb_q.op)] = 1'b1;
+    end else if (crypto_args_valid_s) begin
+      perf_o.busy[crypto_op_type(pe_crypto_req_exec_s.op)] = 1'b1;
+    end else if (pe_crypto_req_valid_s) begin
+      perf_o.busy[crypto_op_type(pe_crypto_req_coll_s.op)] = 1'b1;
+    end
+
+    if (pe_crypto_req_valid_s && operand_wait_s) begin
+      perf_o.operand_wait[crypto_op_type(pe_crypto_req_coll_s.op)] = 1'b1;
+    end
+
+    if (wb_stall_s) begin
+      perf_o.wb_stall[crypto_op_type(pe_crypto_req_wb_q.op)] = 1'b1;
+    end
+  end
+
 endmodule
@@ -29,6 +29,8 @@
 //  - crypto_operand_ready_o: Handshaking read for incoming operand data
 //  - crypto_args_buff_o: Arguments to be sent to crypto execution unit
 //  - crypto_args_valid_o: Handshaking for arguments to crypto execution unit
+//  - operand_wait_o: Performance event, collector is free to fill the arguments
+//    but an active operand has no valid data from the lanes
 //
 // Revision History:
 //  - Version 1.0: Initial release
@@ -36,6 +38,7 @@
 //  - Version 1.2: Refactored to enable support for multiple lanes/vlen + tidy
 //                 logic [TZS: 15-jul-2024]
 //  - Version 1.3: Update scalar width for SM algos [TZS:26-Jul-2024]
+//  - Version 1.4: Added operand wait event for performance counters [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -58,7 +61,9 @@ module operand_collector
   // operand buffer output + control signals
   output operand_buff_t            crypto_args_buff_o,
   output logic                     crypto_args_valid_o,
-  input  logic                     crypto_args_ready_i
+  input  logic                     crypto_args_ready_i,
+  // performance event
+  output logic                     operand_wait_o
 );
 
 /***********************
@@ -94,6 +99,8 @@ module operand_collector
   // enable signal used to control operand processing pipeline and prevent new
   // arg data being written to output before it is read
   logic operand_logic_en_s;
+  // active operand with an argument still to fill but no data from all lanes
+  logic [NumOperands-1:0] operand_starved_s;
   // control signal used to indicate that all args are valid
   logic arg_buff_valid_d, arg_buff_valid_q;
   // register to hold crypto args and scalar val
@@ -196,6 +203,15 @@ module operand_collector
   assign operand_logic_en_s = pe_req_valid_i &
                               ((crypto_args_ready_i & arg_buff_valid_q) | (~arg_buff_valid_q));
 
+  // the collector could take operand data this cycle, but an operand that is
+  // still needed for the current argument buffer is not valid in every lane
+  for (operand = 0; operand < NumOperands; operand++) begin : gen_operand_starved
+    assign operand_starved_s[operand] = operand_active_s[operand] & ~arg_full_d[operand] &
+                                        ~(&crypto_operand_valid_trans_s[operand]);
+  end
+
+  assign operand_wait_o = operand_logic_en_s & (|operand_starved_s);
+
   // block to contain counter limit calculation logic
   always_comb begin : comb_limit_calc
 
@@ -33,6 +33,8 @@
 //  - crypto_result_wdata_o: Data of result to be written to VRF
 //  - crypto_result_be_o: Byte enable (strobe) for writing result to VRF
 //  - wb_done_o: Flag to determine that write back complete for request
+//  - wb_stall_o: Performance event, a result is waiting but the write buffer
+//    is held by a VRF write that has not been granted
 //
 // Revision History:
 //  - Version 1.0: Initial release
@@ -40,6 +42,7 @@
 //    with an SEW other than EW32 [TZS:19-May-2024]
 //  - Fixed bug in vrf address calculation [TZS:24-Jun-2024]
 //  - Replaced integers with bit-width specific types [TZS:15-Jul-2024]
+//  - Added back-pressure event for performance counters [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -68,7 +71,8 @@ module write_back
   output vaddr_t         [NrLanes-1:0] crypto_result_addr_o,
   output elen_t          [NrLanes-1:0] crypto_result_wdata_o,
   output strb_t          [NrLanes-1:0] crypto_result_be_o,
-  output logic                         wb_done_o
+  output logic                         wb_done_o,
+  output logic                         wb_stall_o
 );
 
 /***********
@@ -150,6 +154,10 @@ module write_back
   assign wb_en_s = ((result_valid_i == 1'b1) &&
                     (vrf_rdy_s == 1'b1 || vrf_vld_q == 1'b0)) ? 1'b1 : 1'b0;
 
+  // back-pressure: a result is waiting but the VRF has not granted the write
+  // buffer yet
+  assign wb_stall_o = result_valid_i & vrf_vld_q & ~vrf_rdy_s;
+
   always_comb begin
 
     // default assignments
@@ -7,7 +7,8 @@
 // Created  : 13-jun-2024
 //
 // Description: Marian control registers. Modified version of Ara control
-//              registers. Original comments preserved below.
+//              registers, extended with the performance counters of the
+//              crypto unit and Ara. Original comments preserved below.
 //------------------------------------------------------------------------------
 // Copyright 2021 ETH Zurich and University of Bologna.
 // Solderpad Hardware License, Version 0.51, see LICENSE for details.
@@ -17,7 +18,11 @@
 // Description: AXI-LITE accessible control registers, holding
 // static information about Ara's SoC.
 
-module ctrl_registers #(
+module ctrl_registers
+  import ara_pkg::ara_perf_t;
+  import ara_pkg::NrCryptoOpTypes;
+  import ara_pkg::NrVFUs;
+#(
     parameter int   unsigned                 DataWidth       = 32,
     parameter int   unsigned                 AddrWidth       = 32,
     // Parameters
@@ -37,7 +42,9 @@ module ctrl_registers #(
     output logic           [DataWidth-1:0] dram_base_addr_o,
     output logic           [DataWidth-1:0] dram_end_addr_o,
     output logic           [DataWidth-1:0] event_trigger_o,
-    output logic           [DataWidth-1:0] hw_cnt_en_o
+    output logic           [DataWidth-1:0] hw_cnt_en_o,
+    // Performance events
+    input  ara_perf_t                      ara_perf_i
   );
 
   `include "common_cells/registers.svh"
@@ -46,7 +53,13 @@ module ctrl_registers #(
   //  Definitions  //
   ///////////////////
 
-  localparam int unsigned NumRegs          = 7;
+  // Performance counters, in register order:
+  //   cycles, then per crypto operation type (crypto_op_type_e) the busy,
+  //   operand wait and write back stall cycles, then the instructions issued
+  //   to each VFU except VFU_None (vfu_e), then the VLSU load and store bytes
+  localparam int unsigned NrPerfCounters   = 1 + 3 * NrCryptoOpTypes + (NrVFUs - 1) + 2;
+  localparam int unsigned NumCtrlRegs      = 7;
+  localparam int unsigned NumRegs          = NumCtrlRegs + NrPerfCounters;
   localparam int unsigned DataWidthInBytes = (DataWidth + 7) / 8;
   localparam int unsigned RegNumBytes      = NumRegs * DataWidthInBytes;
 
@@ -54,23 +67,26 @@ module ctrl_registers #(
   localparam logic [DataWidthInBytes-1:0] ReadWriteReg = {DataWidthInBytes{1'b0}};
 
   // Memory map
+  // [255:56]: perf counters (ro, NrPerfCounters of them, see above)
   // [55:48]: bootram_rdy    (rw)
   // [47:40]: bootram_addr   (rw)
-  // [39:32]: hw_cnt_en      (rw)
+  // [39:32]: hw_cnt_en      (rw, bit 0 counts, bit 1 clears the perf counters)
   // [31:24]: event_trigger  (rw)
   // [23:16]: dram_end_addr  (ro)
   // [15:08]: dram_base_addr (ro)
   // [ 7: 0]: exit           (rw)
-  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = '{
-    0,
-    DRAMBaseAddr,
-    0,
-    0,
-    DRAMBaseAddr + DRAMLength,
-    DRAMBaseAddr,
-    0
+  localparam logic [NumRegs-1:0][DataWidth-1:0] RegRstVal = {
+    {NrPerfCounters{DataWidth'(0)}},
+    DataWidth'(0),
+    DataWidth'(DRAMBaseAddr),
+    DataWidth'(0),
+    DataWidth'(0),
+    DataWidth'(DRAMBaseAddr + DRAMLength),
+    DataWidth'(DRAMBaseAddr),
+    DataWidth'(0)
   };
-  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = '{
+  localparam logic [NumRegs-1:0][DataWidthInBytes-1:0] AxiReadOnly = {
+    {NrPerfCounters{ReadOnlyReg}},
     ReadWriteReg,
     ReadWriteReg,
     ReadWriteReg,
@@ -94,6 +110,11 @@ module ctrl_registers #(
   logic [DataWidth-1:0] dram_end_address;
   logic [DataWidth-1:0] exit;
 
+  // performance counters, loaded by hardware
+  logic [NrPerfCounters-1:0][DataWidth-1:0] perf_cnt_q, perf_cnt_d;
+  logic [NrPerfCounters-1:0][DataWidth-1:0] perf_inc;
+  logic                                     perf_load;
+
   axi_lite_regs #(
     .RegNumBytes (RegNumBytes    ),
     .AxiAddrWidth(AddrWidth      ),
@@ -109,13 +130,48 @@ module ctrl_registers #(
     .axi_resp_o (axi_lite_slave_resp_o                      ),
     .wr_active_o(wr_active_d                                ),
     .rd_active_o(/* Unused */                               ),
-    .reg_d_i    ('0                                         ),
-    .reg_load_i ('0                                         ),
-    .reg_q_o    ({bootram_rdy, bootram_addr, hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
+    .reg_d_i    ({perf_cnt_d, {NumCtrlRegs*DataWidth{1'b0}}}  ),
+    .reg_load_i ({{NrPerfCounters*DataWidthInBytes{perf_load}}, {NumCtrlRegs*DataWidthInBytes{1'b0}}}),
+    .reg_q_o    ({perf_cnt_q, bootram_rdy, bootram_addr, hw_cnt_en, event_trigger, dram_end_address, dram_base_address, exit})
   );
 
   `FF(wr_active_q, wr_active_d, '0);
 
+  ////////////////////////////
+  //  Performance counters  //
+  ////////////////////////////
+
+  // first counter of each group, in register order
+  localparam int unsigned PerfCycles     = 0;
+  localparam int unsigned PerfBusy       = 1;
+  localparam int unsigned PerfOpWait     = PerfBusy + NrCryptoOpTypes;
+  localparam int unsigned PerfWbStall    = PerfOpWait + NrCryptoOpTypes;
+  localparam int unsigned PerfVinsn      = PerfWbStall + NrCryptoOpTypes;
+  localparam int unsigned PerfLoadBytes  = PerfVinsn + NrVFUs - 1;
+  localparam int unsigned PerfStoreBytes = PerfLoadBytes + 1;
+
+  // one increment per counter and cycle
+  always_comb begin
+    perf_inc             = '0;
+    perf_inc[PerfCycles] = DataWidth'(1);
+    for (int t = 0; t < NrCryptoOpTypes; t++) begin
+      perf_inc[PerfBusy + t]    = DataWidth'(ara_perf_i.crypto.busy[t]);
+      perf_inc[PerfOpWait + t]  = DataWidth'(ara_perf_i.crypto.operand_wait[t]);
+      perf_inc[PerfWbStall + t] = DataWidth'(ara_perf_i.crypto.wb_stall[t]);
+    end
+    for (int u = 0; u < NrVFUs - 1; u++)
+      perf_inc[PerfVinsn + u] = DataWidth'(ara_perf_i.vinsn_issued[u]);
+    perf_inc[PerfLoadBytes]  = DataWidth'(ara_perf_i.load_bytes);
+    perf_inc[PerfStoreBytes] = DataWidth'(ara_perf_i.store_bytes);
+  end
+
+  // count while hw_cnt_en[0] is set, hold at zero while hw_cnt_en[1] is set
+  assign perf_load = hw_cnt_en[0] | hw_cnt_en[1];
+
+  for (genvar i = 0; i < NrPerfCounters; i++) begin : gen_perf_cnt
+    assign perf_cnt_d[i] = hw_cnt_en[1] ? '0 : perf_cnt_q[i] + perf_inc[i];
+  end
+
   /////////////////
   //   Signals   //
   /////////////////
@@ -126,4 +182,14 @@ module ctrl_registers #(
   assign dram_end_addr_o  = dram_end_address;
   assign exit_o           = {exit, logic'(|wr_active_q[7:0])};
 
+  //////////////////
+  //  Assertions  //
+  //////////////////
+
+  if (DataWidth != 64)
+    $error("[ctrl_registers] The performance counters assume 64-bit registers.");
+
+  if (PerfStoreBytes != NrPerfCounters - 1)
+    $error("[ctrl_registers] The performance counter groups do not fill NrPerfCounters.");
+
 endmodule : ctrl_registers
@@ -49,6 +49,8 @@
 //                 [tzs:24-apr-2024]
 //  - Version 1.2: Added ifdef to select whether verilator version is used
 //                 [tzs:02-sep-2024]
+//  - Version 1.3: Routed Ara performance events to the control registers
+//                 [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -108,6 +110,7 @@ module marian_top
   logic                    timer_irq_s;
   logic                    ipi_s;
   logic [          64-1:0] exit_s;
+  ara_pkg::ara_perf_t      ara_perf_s;
   logic [(2*NB_CORES)-1:0] plic_irq_s;
   logic [           2-1:0] spi_mode_s;
 
@@ -247,6 +250,7 @@ module marian_top
   .periph_wide_axi_req_i  ( periph_wide_axi_req[PERIPHS_S]  ),
   .periph_wide_axi_resp_o ( periph_wide_axi_resp[PERIPHS_S] ),
   .exit_o                 ( exit_s                          ),
+  .ara_perf_i             ( ara_perf_s                      ),
   .timer_irq              ( timer_irq_s                     ),
   .ipi_o                  ( ipi_s                           )
 
@@ -567,7 +571,8 @@ apb_peripherals i_apb_peripherals(
     .axi_resp_i   ( system_axi_resp[SYS_M] ),
     .timer_irq_i  ( timer_irq_s            ),
     .ipi_i        ( ipi_s                  ),
-    .plic_irq_i   ( plic_irq_s             )
+    .plic_irq_i   ( plic_irq_s             ),
+    .ara_perf_o   ( ara_perf_s             )
   );
 
   //////////////////
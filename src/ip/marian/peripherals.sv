@@ -14,6 +14,7 @@
 //  - rst_ni:                 Asynchronous active-low reset
 //  - periph_wide_axi_req_i:  AXI bus request channel
 //  - irq_s:                  Global interrupt sources
+//  - ara_perf_i:             Ara performance events for the CTRL counters
 // Outputs:
 //  - periph_wide_axi_resp_o: AXI bus response channel
 //  - exit_o:                 CTRL register EOC signal
@@ -23,6 +24,7 @@
 //
 // Revision History:
 //  - Version 1.0: Initial release
+//  - Version 1.1: Performance counters in the CTRL registers [19-oct-2026]
 //
 //------------------------------------------------------------------------------
 
@@ -33,6 +35,7 @@ module peripherals
     input  soc_wide_req_t                  periph_wide_axi_req_i,
     output soc_wide_resp_t                 periph_wide_axi_resp_o,
     output logic [PeriphWideDataWidth-1:0] exit_o,
+    input  ara_pkg::ara_perf_t             ara_perf_i,
     output logic                           timer_irq,
     output logic                           ipi_o
   );
@@ -190,7 +193,8 @@ module peripherals
     .dram_end_addr_o       ( /* Unused*/                ),
     .exit_o                ( exit_o                     ),
     .event_trigger_o       ( /* Unused  */              ),
-    .hw_cnt_en_o           ( /* Unused  */              )
+    .hw_cnt_en_o           ( /* Unused  */              ),
+    .ara_perf_i            ( ara_perf_i                 )
   );
 
 
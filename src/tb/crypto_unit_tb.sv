@@ -89,6 +89,9 @@ module crypto_unit_tb;
     .rstn_i ( tb_rstn )
   );
 
+  // Performance events, not checked by this testbench
+  crypto_perf_t dut_perf;
+
   crypto_unit #(
     .NrLanes( NrLanes ),
     .vaddr_t( vaddr_t )
@@ -109,7 +112,8 @@ module crypto_unit_tb;
   .crypto_result_wdata_o     ( dut_if.crypto_result_wdata_o     ),
   .crypto_result_be_o        ( dut_if.crypto_result_be_o        ),
   .crypto_result_gnt_i       ( dut_if.crypto_result_gnt_i       ),
-  .crypto_result_final_gnt_i ( dut_if.crypto_result_final_gnt_i )
+  .crypto_result_final_gnt_i ( dut_if.crypto_result_final_gnt_i ),
+  .perf_o                    ( dut_perf                         )
   );
 
 /************
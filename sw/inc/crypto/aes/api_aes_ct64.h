@@ -0,0 +1,53 @@
+/*
+ * File      : api_aes_ct64.h
+ * Test      : aes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Constant-time bitsliced AES on 64-bit scalar registers, in
+ * the style of Kaesper-Schwabe. Eight 64-bit words hold one bit plane each
+ * of AES_CT64_BLOCKS blocks. There are no table lookups and no
+ * data-dependent branches, and no vector instructions are issued, so the
+ * core can run while Ara is still busy with earlier vector work.
+ */
+
+#ifndef __API_AES_CT64_H__
+#define __API_AES_CT64_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/aes/api_aes.h"
+
+//! Blocks encrypted by one bitsliced pass
+#define AES_CT64_BLOCKS       4
+
+//! Bitsliced round keys, eight words per round key
+#define AES_CT64_SKEY_WORDS   (8 * (AES_256_NR + 1))
+
+//! Return codes
+#define AES_CT64_OK           0
+#define AES_CT64_ERR_KEY     -1   //!< key size is not 128, 192 or 256 bits
+
+/*!
+Round keys in the bitsliced layout, replicated for every block of a pass.
+*/
+typedef struct {
+  uint64_t sk [AES_CT64_SKEY_WORDS];
+  uint32_t nr;
+} aes_ct64_key_t;
+
+/*!
+@brief Expand a key of key_bits bits (128, 192 or 256), in constant time.
+@return AES_CT64_OK or AES_CT64_ERR_KEY
+*/
+int aes_ct64_key_init(aes_ct64_key_t* k, const uint8_t* key, size_t key_bits);
+
+/*!
+@brief ECB encryption of n blocks, out may equal in. A last pass with
+fewer than AES_CT64_BLOCKS blocks costs as much as a full one.
+*/
+void aes_ct64_encrypt(const aes_ct64_key_t* k, uint8_t* out, const uint8_t* in, size_t n);
+
+//! ECB decryption with the same round keys, out may equal in
+void aes_ct64_decrypt(const aes_ct64_key_t* k, uint8_t* out, const uint8_t* in, size_t n);
+
+#endif // __API_AES_CT64_H__
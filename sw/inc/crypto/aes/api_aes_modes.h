@@ -0,0 +1,159 @@
+/*
+ * File      : api_aes_modes.h
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: AES-CMAC (RFC 4493), AES-CCM (RFC 3610, SP 800-38C) and AES
+ * key wrap KW/KWP (RFC 3394, RFC 5649) on the Zvkned round instructions.
+ * The chained halves of these modes are serial, so independent blocks are
+ * put into the other element groups of the same register group: several
+ * messages for CMAC, CTR keystream next to CBC-MAC for CCM, several keys
+ * for key wrap.
+ */
+
+#ifndef __API_AES_MODES_H__
+#define __API_AES_MODES_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/api_aes_ct64.h"
+
+#define AES_CCM_NONCE_MIN   7
+#define AES_CCM_NONCE_MAX   13
+
+//! Upper bound of blocks per pass (e32m4 at VLEN = 512)
+#define AES_MODES_LANES     16
+
+//! ECB requests up to this many blocks go to the bitsliced scalar core
+#define AES_DISPATCH_SCALAR_MAX_BLOCKS  2
+
+//! Key wrap works on 64-bit semiblocks
+#define AES_KW_SEMIBLOCK    8
+
+//! Return codes
+#define AES_MODES_OK         0
+#define AES_MODES_ERR_KEY   -1  //!< unsupported key size
+#define AES_MODES_ERR_PARAM -2  //!< nonce, tag or message length out of range
+#define AES_MODES_ERR_AUTH  -3  //!< tag or integrity check value mismatch
+
+/*!
+Expanded key in the layout of the Zvkned key schedule, computed once per
+key and shared by all modes.
+*/
+typedef struct {
+  uint32_t rk [AES_256_RK_WORDS];
+  uint32_t nr;
+} aes_vec_key_t;
+
+//! CMAC key with its two subkeys
+typedef struct {
+  aes_vec_key_t key;
+  uint8_t       k1 [AES_BLOCK_BYTES];
+  uint8_t       k2 [AES_BLOCK_BYTES];
+} aes_cmac_key_t;
+
+/*!
+@brief Expand an AES key of key_bits bits (128 or 256).
+@return AES_MODES_OK or AES_MODES_ERR_KEY
+*/
+int aes_vec_key_init(aes_vec_key_t* k, const uint8_t* key, size_t key_bits);
+
+//! Blocks per pass of aes_vec_blocks, at most AES_MODES_LANES
+size_t aes_vec_lanes(void);
+
+/*!
+@brief Encrypt (decrypt != 0: decrypt) n blocks in place, one block per
+element group of e32m4.
+*/
+void aes_vec_blocks(const aes_vec_key_t* k, uint32_t (*x)[4], size_t n, int decrypt);
+
+/*!
+ECB key for both tiers: short requests, where the vector setup dominates,
+run on the bitsliced scalar core, longer ones on Zvkned.
+*/
+typedef struct {
+  aes_vec_key_t  vec;
+  aes_ct64_key_t ct64;
+} aes_dispatch_key_t;
+
+/*!
+@brief Expand a 128 or 256-bit key for both tiers.
+@return AES_MODES_OK or AES_MODES_ERR_KEY
+*/
+int aes_dispatch_key_init(aes_dispatch_key_t* k, const uint8_t* key, size_t key_bits);
+
+//! ECB encryption of n blocks, out may equal in
+void aes_dispatch_encrypt(const aes_dispatch_key_t* k, uint8_t* out, const uint8_t* in, size_t n);
+
+void aes_dispatch_decrypt(const aes_dispatch_key_t* k, uint8_t* out, const uint8_t* in, size_t n);
+
+/*!
+@brief Expand the key and derive the CMAC subkeys K1 and K2.
+@return AES_MODES_OK or AES_MODES_ERR_KEY
+*/
+int aes_cmac_init(aes_cmac_key_t* ck, const uint8_t* key, size_t key_bits);
+
+void aes_cmac(uint8_t tag[AES_BLOCK_BYTES], const aes_cmac_key_t* ck,
+              const uint8_t* msg, size_t len);
+
+/*!
+@brief CMAC of n messages under one key, one message per element group.
+*/
+void aes_cmac_batch(uint8_t (*tag)[AES_BLOCK_BYTES], const aes_cmac_key_t* ck,
+                    const uint8_t* const* msg, const size_t* len, size_t n);
+
+/*!
+@brief CCM encryption of len bytes, ct may equal pt.
+@param [in] nonce_len - AES_CCM_NONCE_MIN to AES_CCM_NONCE_MAX bytes
+@param [in] tag_len   - even, 4 to 16 bytes
+@return AES_MODES_OK or AES_MODES_ERR_PARAM
+*/
+int aes_ccm_encrypt(const aes_vec_key_t* k, uint8_t* ct, uint8_t* tag, size_t tag_len,
+                    const uint8_t* nonce, size_t nonce_len,
+                    const uint8_t* aad, size_t aad_len,
+                    const uint8_t* pt, size_t len);
+
+/*!
+@brief CCM decryption, pt may equal ct. On a tag mismatch pt is cleared.
+@return AES_MODES_OK, AES_MODES_ERR_PARAM or AES_MODES_ERR_AUTH
+*/
+int aes_ccm_decrypt(const aes_vec_key_t* k, uint8_t* pt, const uint8_t* tag, size_t tag_len,
+                    const uint8_t* nonce, size_t nonce_len,
+                    const uint8_t* aad, size_t aad_len,
+                    const uint8_t* ct, size_t len);
+
+/*!
+@brief Wrap n keys of len bytes each (a multiple of AES_KW_SEMIBLOCK, at
+least 16) under one KEK, one key per element group. Key i is read from
+in + i * len and written to out + i * (len + AES_KW_SEMIBLOCK).
+@return AES_MODES_OK or AES_MODES_ERR_PARAM
+*/
+int aes_kw_wrap_batch(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in,
+                      size_t len, size_t n);
+
+/*!
+@brief Unwrap n keys of len bytes each, the inverse of aes_kw_wrap_batch.
+Keys failing the integrity check are cleared. If status is not NULL,
+status[i] is set to AES_MODES_OK or AES_MODES_ERR_AUTH.
+@return number of keys that failed, or AES_MODES_ERR_PARAM
+*/
+int aes_kw_unwrap_batch(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in,
+                        size_t len, size_t n, int* status);
+
+int aes_kw_wrap(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in, size_t len);
+
+//! @param [in] len - length of the wrapped key
+int aes_kw_unwrap(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in, size_t len);
+
+/*!
+@brief Wrap with padding, any key of 1 to 2^32 - 1 bytes.
+@param [out] out_len - wrapped length, len rounded up to a semiblock plus one
+*/
+int aes_kwp_wrap(const aes_vec_key_t* kek, uint8_t* out, size_t* out_len,
+                 const uint8_t* in, size_t len);
+
+int aes_kwp_unwrap(const aes_vec_key_t* kek, uint8_t* out, size_t* out_len,
+                   const uint8_t* in, size_t len);
+
+#endif // __API_AES_MODES_H__
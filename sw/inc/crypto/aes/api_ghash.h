@@ -0,0 +1,50 @@
+/*
+ * File      : api_ghash.h
+ * Test      : crypto_sweep_benchmark
+ * Date      : 19-oct-2026
+ * Description: GHASH, the authentication half of AES-GCM, on its own: a
+ * scalar version with 4-bit tables as in OpenSSL's gcm_gmult_4bit, and
+ * Zvkg versions that fold one block per element group with vghsh, each lane
+ * multiplying by the power of H that matches its distance from the end.
+ */
+
+#ifndef __API_GHASH_H__
+#define __API_GHASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define GHASH_BLOCK_BYTES   16
+
+//! Upper bound of blocks folded side by side (e32m4 at VLEN = 512)
+#define GHASH_LANES         16
+
+/*!
+Hash subkey H with what both kinds of kernel precompute from it: the 4-bit
+multiples of the scalar code, and H^GHASH_LANES down to H^1 in the byte
+order of vghsh.
+*/
+typedef struct {
+  uint64_t htable [16][2];
+  uint32_t hpow   [GHASH_LANES][4];  //!< hpow[i] = H^(GHASH_LANES - i)
+} ghash_key_t;
+
+//! Precompute the tables of the hash subkey h
+void ghash_key_init(ghash_key_t* k, const uint8_t h[GHASH_BLOCK_BYTES]);
+
+/*!
+@brief y = (...((y ^ x_1) H ^ x_2) H ... ^ x_n) H over the n = len / 16
+    whole blocks of in, len must be a multiple of GHASH_BLOCK_BYTES.
+*/
+void ghash_scalar(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES], const uint8_t* in,
+                  size_t len);
+
+//! As ghash_scalar() with vghsh at LMUL = 1, 2 and 4, in must be 4-byte aligned
+void ghash_zvkg_lmul1(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES], const uint8_t* in,
+                      size_t len);
+void ghash_zvkg_lmul2(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES], const uint8_t* in,
+                      size_t len);
+void ghash_zvkg_lmul4(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES], const uint8_t* in,
+                      size_t len);
+
+#endif // __API_GHASH_H__
@@ -16,21 +16,27 @@
 #define ZVKNED_H_
 
 #include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/share/iovec.h"
 
 // Key scheduling / expansion.
 
 extern void
 zvkned_aes128_expand_key(
     uint32_t* dest,      // char[176], 32b aligned
-    const void* key  // char[16], 32b aligned
+    const void* key  // char[16], any alignment
 );
 
 extern void
 zvkned_aes256_expand_key(
     uint32_t* dest,       // char[240], 32b aligned
-    const void* key   // char[32], 32b aligned
+    const void* key   // char[32], any alignment
 );
 
+// The bulk kernels below move text with byte loads and stores, dest and
+// src may have any alignment.
+
 // AES-128 Encoding
 
 extern uint64_t
@@ -153,4 +159,38 @@ zvkned_aes256_decode_vv_lmul1(
    const uint32_t* expanded_key
 );
 
+// Scatter-gather variants. dst and src may be segmented differently but
+// must hold the same number of bytes, a multiple of 16. Whole-block runs go
+// to the vs_lmul4 (encode) and vs_lmul2 (decode) kernels, blocks straddling
+// segments are gathered and scattered through vector registers.
+// Return CRYPTO_IOV_OK or CRYPTO_IOV_ERR_LEN.
+
+extern int
+zvkned_aes128_encode_iov(
+   const crypto_iovec_t* dst, size_t dst_cnt,
+   const crypto_iovec_t* src, size_t src_cnt,
+   const uint32_t* expanded_key
+);
+
+extern int
+zvkned_aes128_decode_iov(
+   const crypto_iovec_t* dst, size_t dst_cnt,
+   const crypto_iovec_t* src, size_t src_cnt,
+   const uint32_t* expanded_key
+);
+
+extern int
+zvkned_aes256_encode_iov(
+   const crypto_iovec_t* dst, size_t dst_cnt,
+   const crypto_iovec_t* src, size_t src_cnt,
+   const uint32_t* expanded_key
+);
+
+extern int
+zvkned_aes256_decode_iov(
+   const crypto_iovec_t* dst, size_t dst_cnt,
+   const crypto_iovec_t* src, size_t src_cnt,
+   const uint32_t* expanded_key
+);
+
 #endif  // ZVKNED_H_
@@ -0,0 +1,66 @@
+/*
+ * File      : api_blake2.h
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE2s and BLAKE2b (RFC 7693), sequential mode with an
+ * optional key. The four G functions of a column or diagonal step run in
+ * parallel, one per vector element.
+ */
+
+#ifndef __API_BLAKE2_H__
+#define __API_BLAKE2_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/share/hash.h"
+
+#define BLAKE2S_BLOCK_BYTES    64
+#define BLAKE2S_OUT_BYTES      32  //!< also the longest key
+#define BLAKE2B_BLOCK_BYTES   128
+#define BLAKE2B_OUT_BYTES      64  //!< also the longest key
+
+//! Return codes
+#define BLAKE2_OK          0
+#define BLAKE2_ERR_PARAM  -1  //!< digest length 0 or above the maximum, or key too long
+
+typedef struct {
+  uint32_t h   [8];
+  uint32_t t   [2];                    //!< bytes hashed so far
+  uint8_t  buf [BLAKE2S_BLOCK_BYTES];  //!< pending block, compressed once more input follows
+  size_t   buflen;
+  size_t   outlen;
+} blake2s_ctx_t;
+
+typedef struct {
+  uint64_t h   [8];
+  uint64_t t   [2];
+  uint8_t  buf [BLAKE2B_BLOCK_BYTES];
+  size_t   buflen;
+  size_t   outlen;
+} blake2b_ctx_t;
+
+/*!
+@brief Start a hash of outlen bytes, keyed (MAC) if keylen > 0.
+@return BLAKE2_OK or BLAKE2_ERR_PARAM
+*/
+int  blake2s_init  (blake2s_ctx_t* s, size_t outlen, const void* key, size_t keylen);
+void blake2s_update(blake2s_ctx_t* s, const void* in, size_t len);
+void blake2s_final (blake2s_ctx_t* s, uint8_t* md);
+
+//! One-shot BLAKE2s, returns BLAKE2_OK or BLAKE2_ERR_PARAM
+int  blake2s(uint8_t* md, size_t outlen, const void* key, size_t keylen, const void* in,
+             size_t len);
+
+int  blake2b_init  (blake2b_ctx_t* s, size_t outlen, const void* key, size_t keylen);
+void blake2b_update(blake2b_ctx_t* s, const void* in, size_t len);
+void blake2b_final (blake2b_ctx_t* s, uint8_t* md);
+
+int  blake2b(uint8_t* md, size_t outlen, const void* key, size_t keylen, const void* in,
+             size_t len);
+
+//! Unkeyed BLAKE2s/BLAKE2b behind the common hash interface
+extern const crypto_hash_desc_t crypto_hash_blake2s;
+extern const crypto_hash_desc_t crypto_hash_blake2b;
+
+#endif // __API_BLAKE2_H__
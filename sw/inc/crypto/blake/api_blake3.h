@@ -0,0 +1,57 @@
+/*
+ * File      : api_blake3.h
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE3 hash, keyed hash and XOF. Runs of whole chunks are
+ * compressed one chunk per vector element, and the parents of such a run
+ * level by level in the same way, before they join the chaining value stack.
+ */
+
+#ifndef __API_BLAKE3_H__
+#define __API_BLAKE3_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/share/hash.h"
+
+#define BLAKE3_OUT_BYTES     32  //!< default output, any length can be read
+#define BLAKE3_KEY_BYTES     32
+#define BLAKE3_BLOCK_BYTES   64
+#define BLAKE3_CHUNK_BYTES 1024
+
+//! Chunks compressed side by side at most (e32, LMUL=1 at VLEN=512)
+#define BLAKE3_MAX_LANES     16
+
+//! Height of the chaining value stack, enough for 2^64 bytes of input
+#define BLAKE3_MAX_DEPTH     54
+
+typedef struct {
+  uint32_t key      [8];
+  uint32_t cv       [8];                   //!< chaining value of the current chunk
+  uint64_t chunk_counter;
+  uint8_t  buf      [BLAKE3_BLOCK_BYTES];  //!< pending block of the current chunk
+  uint8_t  buflen;
+  uint8_t  blocks_compressed;
+  uint8_t  flags;                          //!< KEYED_HASH for blake3_init_keyed
+  uint8_t  cv_stack_len;
+  uint8_t  cv_stack [BLAKE3_MAX_DEPTH * 32];
+} blake3_ctx_t;
+
+void blake3_init      (blake3_ctx_t* s);
+void blake3_init_keyed(blake3_ctx_t* s, const uint8_t key[BLAKE3_KEY_BYTES]);
+void blake3_update    (blake3_ctx_t* s, const void* in, size_t len);
+
+//! Read outlen bytes of output, any length; the context is left unchanged
+void blake3_final     (const blake3_ctx_t* s, uint8_t* out, size_t outlen);
+
+//! One-shot BLAKE3 with outlen bytes of output
+void blake3(uint8_t* out, size_t outlen, const void* in, size_t len);
+
+//! Number of chunks compressed side by side (at most BLAKE3_MAX_LANES)
+size_t blake3_lanes(void);
+
+//! BLAKE3 behind the common hash interface, digests of any length
+extern const crypto_hash_desc_t crypto_hash_blake3;
+
+#endif // __API_BLAKE3_H__
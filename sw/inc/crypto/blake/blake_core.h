@@ -0,0 +1,41 @@
+/*
+ * File      : blake_core.h
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: Round functions shared by BLAKE2s, BLAKE2b and BLAKE3. The
+ * 16 word state is held as four rows of four words; the G functions of a
+ * column step work on the elements of the rows, the rows are rotated by
+ * vrgather for the diagonal step and back.
+ */
+
+#ifndef __BLAKE_CORE_H__
+#define __BLAKE_CORE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*
+ * Message schedule of a round as byte offsets into the block: the first
+ * inputs of the 4 column G functions, their second inputs, then the same
+ * for the diagonal step.
+ */
+typedef uint32_t blake_sched32_t [16];
+
+//! BLAKE2s message schedule, also the first 10 rounds of BLAKE2b
+extern const blake_sched32_t kBlake2sSched [10];
+
+//! Round r of BLAKE3, its message permutation applied r times
+extern const blake_sched32_t kBlake3Sched  [7];
+
+/*!
+@brief The rounds of the BLAKE2s / BLAKE3 permutation on v.
+@param [in] m     - the message block, 16 words
+@param [in] sched - schedule of every round
+*/
+void blake2s_rounds(uint32_t v[16], const uint32_t m[16], const blake_sched32_t* sched,
+                    size_t rounds);
+
+//! The 12 rounds of BLAKE2b on v, with kBlake2sSched scaled to 64b words
+void blake2b_rounds(uint64_t v[16], const uint64_t m[16]);
+
+#endif // __BLAKE_CORE_H__
@@ -0,0 +1,46 @@
+/*
+ * File      : api_ed25519.h
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Ed25519 signature verification (RFC 8032), single and batched
+ * with one signature per vector lane.
+ */
+
+#ifndef __API_ED25519_H__
+#define __API_ED25519_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ED25519_PUBLIC_KEY_BYTES  32
+#define ED25519_SIGNATURE_BYTES   64
+
+//! Return codes
+#define ED25519_OK             0
+#define ED25519_ERR_ENCODING  -1  //!< malformed public key, R or S
+#define ED25519_ERR_MISMATCH  -2  //!< signature does not verify
+
+typedef struct {
+  const uint8_t* pk;       //!< public key, 32 bytes
+  const uint8_t* sig;      //!< signature R || S, 64 bytes
+  const uint8_t* msg;      //!< message
+  size_t         msg_len;  //!< message length in bytes
+} ed25519_item_t;
+
+/*!
+@brief Verify a single signature, [S]B == R + [SHA-512(R || A || M)]A.
+@return ED25519_OK or a negative error code
+*/
+int ed25519_verify(const uint8_t sig[ED25519_SIGNATURE_BYTES], const uint8_t* msg,
+                   size_t msg_len, const uint8_t pk[ED25519_PUBLIC_KEY_BYTES]);
+
+/*!
+@brief Verify n signatures, in batches of one signature per vector lane.
+@details Every signature is checked individually, so an invalid signature
+is pinpointed in `result` instead of failing the whole batch.
+@param [out] result - result[i] is the return code of items[i]
+@return number of signatures which did not verify
+*/
+size_t ed25519_verify_batch(const ed25519_item_t* items, int* result, size_t n);
+
+#endif // __API_ED25519_H__
@@ -0,0 +1,40 @@
+/*
+ * File      : api_x25519.h
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: X25519 Diffie-Hellman (RFC 7748), single and batched.
+ */
+
+#ifndef __API_X25519_H__
+#define __API_X25519_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define X25519_BYTES  32
+
+//! Return codes
+#define X25519_OK          0
+#define X25519_ERR_ZERO   -1  //!< all-zero output, i.e. a small order point
+
+/*!
+@brief Compute out = X25519(scalar, point).
+@return X25519_OK or X25519_ERR_ZERO
+*/
+int x25519(uint8_t out[X25519_BYTES], const uint8_t scalar[X25519_BYTES],
+           const uint8_t point[X25519_BYTES]);
+
+/*!
+@brief Compute the public key out = X25519(scalar, 9).
+*/
+void x25519_base(uint8_t out[X25519_BYTES], const uint8_t scalar[X25519_BYTES]);
+
+/*!
+@brief Compute n independent X25519 functions, one Montgomery ladder per
+vector lane.
+@return number of outputs which are all-zero
+*/
+size_t x25519_batch(uint8_t (*out)[X25519_BYTES], const uint8_t (*scalar)[X25519_BYTES],
+                    const uint8_t (*point)[X25519_BYTES], size_t n);
+
+#endif // __API_X25519_H__
@@ -0,0 +1,75 @@
+/*
+ * File      : fe25519.h
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched arithmetic in GF(2^255-19). Every vector lane holds an
+ * independent field element, so a batch of X25519 ladders or Ed25519
+ * verifications runs in lock step, one operation per lane.
+ */
+
+#ifndef __FE25519_H__
+#define __FE25519_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Limbs of a field element (radix 2^25.5)
+#define FE25519_LIMBS  10
+//! Maximum number of lanes of a batch (e32, LMUL=1 at VLEN=512)
+#define FE25519_LANES  16
+
+/*
+ * Field elements use the radix 2^25.5 representation of ref10:
+ *   f = f[0] + f[1]*2^26 + f[2]*2^51 + f[3]*2^77 + ... + f[9]*2^230
+ * i.e. even limbs carry 26 bits and odd limbs 25 bits.
+ *
+ * A batch is stored limb-major: v[i][lane] is limb i of the element in
+ * `lane`, so that every limb of the batch is a single e32/m1 vector load.
+ * Products are accumulated in e64/m2 with vwmulu/vwmaccu.
+ *
+ * All operations return carried limbs (< 2^26 for even, < 2^25 + 2^17 for
+ * odd limbs), which may be fed into any other operation. Outputs may alias
+ * inputs. `vl` is the number of active lanes, see fe25519_lanes().
+ */
+typedef struct {
+  uint32_t v[FE25519_LIMBS][FE25519_LANES];
+} fe25519_t;
+
+//! Number of lanes a batch can use on this hart (at most FE25519_LANES)
+size_t fe25519_lanes(void);
+
+void fe25519_set(fe25519_t* h, const uint32_t c[FE25519_LIMBS], size_t vl);  //!< h = c in all lanes
+void fe25519_0  (fe25519_t* h, size_t vl);                                    //!< h = 0
+void fe25519_1  (fe25519_t* h, size_t vl);                                    //!< h = 1
+void fe25519_copy(fe25519_t* h, const fe25519_t* f, size_t vl);               //!< h = f
+
+void fe25519_add(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl);  //!< h = f + g
+void fe25519_sub(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl);  //!< h = f - g
+void fe25519_neg(fe25519_t* h, const fe25519_t* f, size_t vl);                      //!< h = -f
+void fe25519_mul(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl);  //!< h = f * g
+void fe25519_sq (fe25519_t* h, const fe25519_t* f, size_t vl);                      //!< h = f^2
+void fe25519_mul_small(fe25519_t* h, const fe25519_t* f, uint32_t c, size_t vl);    //!< h = f * c, c < 2^17
+void fe25519_invert(fe25519_t* h, const fe25519_t* f, size_t vl);                   //!< h = f^(p-2)
+void fe25519_pow22523(fe25519_t* h, const fe25519_t* f, size_t vl);                 //!< h = f^((p-5)/8)
+
+/*!
+@brief Lane-wise select, h = f in every lane i with sel[i] != 0.
+*/
+void fe25519_cmov(fe25519_t* h, const fe25519_t* f, const uint32_t* sel, size_t vl);
+
+/*!
+@brief Lane-wise conditional swap of f and g in every lane i with sel[i] != 0.
+*/
+void fe25519_cswap(fe25519_t* f, fe25519_t* g, const uint32_t* sel, size_t vl);
+
+/*!
+@brief Load lane `lane` from 32 little endian bytes, bit 255 is ignored.
+*/
+void fe25519_frombytes(fe25519_t* h, size_t lane, const uint8_t s[32]);
+
+/*!
+@brief Store the fully reduced element of lane `lane` as 32 little endian bytes.
+*/
+void fe25519_tobytes(uint8_t s[32], const fe25519_t* f, size_t lane);
+
+#endif // __FE25519_H__
@@ -0,0 +1,60 @@
+/*
+ * File      : ge25519.h
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched group operations on the twisted Edwards curve
+ * -x^2 + y^2 = 1 + d*x^2*y^2 (edwards25519), one point per vector lane.
+ */
+
+#ifndef __GE25519_H__
+#define __GE25519_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/curve25519/fe25519.h"
+
+//! Extended coordinates, x = X/Z, y = Y/Z, x*y = T/Z
+typedef struct {
+  fe25519_t X;
+  fe25519_t Y;
+  fe25519_t Z;
+  fe25519_t T;
+} ge25519_t;
+
+//! Precomputed form of an addend (Y+X, Y-X, 2*Z, 2*d*T)
+typedef struct {
+  fe25519_t YpX;
+  fe25519_t YmX;
+  fe25519_t Z2;
+  fe25519_t T2d;
+} ge25519_cached_t;
+
+void ge25519_0   (ge25519_t* r, size_t vl);                       //!< r = identity
+void ge25519_base(ge25519_t* r, size_t vl);                       //!< r = base point B
+void ge25519_neg (ge25519_t* r, const ge25519_t* p, size_t vl);   //!< r = -p
+void ge25519_dbl (ge25519_t* r, const ge25519_t* p, size_t vl);   //!< r = 2*p
+
+//! Convert p into the cached form used as addend
+void ge25519_to_cached(ge25519_cached_t* r, const ge25519_t* p, size_t vl);
+
+//! r = p + q, complete for all inputs (including identity and p == q)
+void ge25519_add(ge25519_t* r, const ge25519_t* p, const ge25519_cached_t* q, size_t vl);
+
+//! Lane-wise select, r = p in every lane i with sel[i] != 0
+void ge25519_cmov_cached(ge25519_cached_t* r, const ge25519_cached_t* p,
+                         const uint32_t* sel, size_t vl);
+
+/*!
+@brief Decode one 32 byte point encoding per lane (RFC 8032, 5.1.3).
+@param [out] r     - decoded points
+@param [out] valid - valid[i] is set to 1 if the encoding of lane i is a
+                     canonical encoding of a curve point, 0 otherwise
+@param [in]  s     - s[i] points to the encoding for lane i
+*/
+void ge25519_frombytes(ge25519_t* r, uint32_t* valid, const uint8_t* const* s, size_t vl);
+
+//! Encode the point of every lane into s[i] (32 bytes)
+void ge25519_tobytes(uint8_t (*s)[32], const ge25519_t* p, size_t vl);
+
+#endif // __GE25519_H__
@@ -0,0 +1,47 @@
+/*
+ * File      : api_ecdsa_p256.h
+ * Test      : ecdsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: ECDSA P-256 / SHA-256 signature verification (FIPS 186-5),
+ * single and batched with one signature per vector lane.
+ */
+
+#ifndef __API_ECDSA_P256_H__
+#define __API_ECDSA_P256_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define ECDSA_P256_PUBLIC_KEY_BYTES  64  //!< uncompressed x || y, without the 0x04 prefix
+#define ECDSA_P256_SIGNATURE_BYTES   64  //!< r || s
+
+//! Return codes
+#define ECDSA_P256_OK             0
+#define ECDSA_P256_ERR_ENCODING  -1  //!< malformed public key, r or s
+#define ECDSA_P256_ERR_MISMATCH  -2  //!< signature does not verify
+
+typedef struct {
+  const uint8_t* pk;       //!< public key, 64 bytes
+  const uint8_t* sig;      //!< signature r || s, 64 bytes
+  const uint8_t* msg;      //!< message
+  size_t         msg_len;  //!< message length in bytes
+} ecdsa_p256_item_t;
+
+/*!
+@brief Verify a single signature, x([e/s]G + [r/s]Q) == r mod n with
+e = SHA-256(M).
+@return ECDSA_P256_OK or a negative error code
+*/
+int ecdsa_p256_verify(const uint8_t sig[ECDSA_P256_SIGNATURE_BYTES], const uint8_t* msg,
+                      size_t msg_len, const uint8_t pk[ECDSA_P256_PUBLIC_KEY_BYTES]);
+
+/*!
+@brief Verify n signatures, in batches of one signature per vector lane.
+@details Every signature is checked individually, so an invalid signature
+is pinpointed in `result` instead of failing the whole batch.
+@param [out] result - result[i] is the return code of items[i]
+@return number of signatures which did not verify
+*/
+size_t ecdsa_p256_verify_batch(const ecdsa_p256_item_t* items, int* result, size_t n);
+
+#endif // __API_ECDSA_P256_H__
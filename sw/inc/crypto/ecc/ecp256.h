@@ -0,0 +1,126 @@
+/*
+ * File      : ecp256.h
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched group operations on short Weierstrass curves
+ * y^2 = x^3 - 3x + b over a 256b prime field (SM2, NIST P-256), one point
+ * per vector lane.
+ */
+
+#ifndef __ECP256_H__
+#define __ECP256_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/ecc/fp256.h"
+
+//! Return codes
+#define ECP256_OK          0
+#define ECP256_ERR_PARAM  -1  //!< the curve does not have a = -3
+
+//! Curve parameters, with the field and the group order moduli
+typedef struct {
+  fp256_mod_t p;                  //!< field modulus
+  fp256_mod_t n;                  //!< order of the base point
+  uint32_t    b    [FP256_LIMBS]; //!< b, Montgomery domain
+  uint32_t    gx   [FP256_LIMBS]; //!< base point, Montgomery domain
+  uint32_t    gy   [FP256_LIMBS];
+  uint8_t     a_be [32];          //!< a, b, G as big endian bytes (for SM2 ZA)
+  uint8_t     b_be [32];
+  uint8_t     gx_be[32];
+  uint8_t     gy_be[32];
+  uint8_t     pn_be[32];          //!< p - n, 0 if n > p
+} ecp256_curve_t;
+
+//! Jacobian coordinates, x = X/Z^2, y = Y/Z^3, Z = 0 is the point at infinity
+typedef struct {
+  fp256_t X;
+  fp256_t Y;
+  fp256_t Z;
+} ecp256_t;
+
+//! Affine point of a constant table, Montgomery domain
+typedef struct {
+  uint32_t x [FP256_LIMBS];
+  uint32_t y [FP256_LIMBS];
+} ecp256_precomp_t;
+
+/*!
+@brief Set up a curve from its parameters p, a, b, Gx, Gy, n (in this order,
+32 big endian bytes each).
+@return ECP256_OK, or ECP256_ERR_PARAM if a != p - 3
+*/
+int ecp256_curve_init(ecp256_curve_t* c, const uint8_t params[6][32]);
+
+void ecp256_0   (const ecp256_curve_t* c, ecp256_t* r, size_t vl);                     //!< r = O
+void ecp256_base(const ecp256_curve_t* c, ecp256_t* r, size_t vl);                     //!< r = G
+void ecp256_copy(ecp256_t* r, const ecp256_t* p, size_t vl);                           //!< r = p
+void ecp256_dbl (const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, size_t vl);  //!< r = 2*p
+
+//! r = p + q, for all inputs (including O and p == q)
+void ecp256_add(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, const ecp256_t* q,
+                size_t vl);
+
+//! Lane-wise select, r = p in every lane i with sel[i] != 0
+void ecp256_cmov(ecp256_t* r, const ecp256_t* p, const uint32_t* sel, size_t vl);
+
+//! r = table[idx[i]] in every lane i, with one indexed load per limb
+void ecp256_select(ecp256_t* r, const ecp256_t* table, const uint32_t* idx, size_t vl);
+
+/*!
+@brief Mixed addition r = p + table[idx[i]] in every lane i.
+@details The lanes with idx[i] == 0 keep p, entry 0 of the table is never
+read. p may be O and may equal the table entry.
+*/
+void ecp256_add_precomp(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p,
+                        const ecp256_precomp_t* table, const uint32_t* idx, size_t vl);
+
+/*!
+@brief Decode one uncompressed point x || y (64 bytes) per lane.
+@param [out] r     - decoded points
+@param [out] valid - valid[i] is set to 1 if x, y < p and the point of lane
+                     i is on the curve, 0 otherwise
+@param [in]  s     - s[i] points to the encoding for lane i
+*/
+void ecp256_frombytes(const ecp256_curve_t* c, ecp256_t* r, uint32_t* valid,
+                      const uint8_t* const* s, size_t vl);
+
+/*!
+@brief Encode the affine point of every lane as x || y into s[i].
+@details finite[i] is set to 0 (and s[i] to zero) for the point at infinity.
+*/
+void ecp256_tobytes(const ecp256_curve_t* c, uint8_t (*s)[64], uint32_t* finite,
+                    const ecp256_t* p, size_t vl);
+
+/*!
+@brief r = [k1[i]]p + [k2[i]]q in every lane i (Shamir's trick).
+@details The scalars are 32 big endian bytes. The loop is uniform, the
+table index of every step is selected per lane, but the addition handles
+the exceptional cases with a branch, so the timing is not independent of
+the scalars.
+*/
+void ecp256_mul2(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, const uint8_t (*k1)[32],
+                 const ecp256_t* q, const uint8_t (*k2)[32], size_t vl);
+
+/*!
+@brief r = [k1[i]]G + [k2[i]]q in every lane i, with a fixed-base comb for G.
+@details comb[b] = sum over k < 4 of bit k of b times [2^(64k)]G, for
+0 < b < 16. [k1]G then costs 64 mixed additions from the constant table,
+interleaved with the last 64 doublings of a 4 bit fixed window over k2.
+The same timing caveat as for ecp256_mul2() applies.
+*/
+void ecp256_mul2_comb(const ecp256_curve_t* c, ecp256_t* r, const ecp256_precomp_t* comb,
+                      const uint8_t (*k1)[32], const ecp256_t* q, const uint8_t (*k2)[32],
+                      size_t vl);
+
+/*!
+@brief Check the x coordinate of p against an integer r mod n.
+@details eq[i] is set to 1 if p is finite and x(p) mod n == r[i], without
+inverting Z: x is compared with r * Z^2 and, when r + n < p, with
+(r + n) * Z^2.
+*/
+void ecp256_x_equals(const ecp256_curve_t* c, uint32_t* eq, const ecp256_t* p,
+                     const uint8_t (*r)[32], size_t vl);
+
+#endif // __ECP256_H__
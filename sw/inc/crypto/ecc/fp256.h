@@ -0,0 +1,97 @@
+/*
+ * File      : fp256.h
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched Montgomery arithmetic modulo an odd prime below
+ * 2^256 (the SM2 and NIST P-256 fields and group orders). Every vector lane
+ * holds an independent element, so a batch of point operations runs in
+ * lock step, one operation per lane.
+ */
+
+#ifndef __FP256_H__
+#define __FP256_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Limbs of an element (radix 2^29)
+#define FP256_LIMBS  9
+//! Bits per limb
+#define FP256_RADIX  29
+//! Maximum number of lanes of a batch (e32, LMUL=1 at VLEN=512)
+#define FP256_LANES  16
+
+/*
+ * Elements are 9 limbs of 29 bits, least significant limb first, so that
+ * the Montgomery multiplication can defer all carries: a product of two
+ * limbs is below 2^58 and the e64 accumulators take the 18 products added
+ * into a column during the 9 rounds without overflowing. R = 2^261.
+ *
+ * A batch is stored limb-major: v[i][lane] is limb i of the element in
+ * `lane`, so that every limb of the batch is a single e32/m1 vector load.
+ *
+ * Unless stated otherwise the operations take and return fully reduced
+ * elements (< m) in the Montgomery domain. Outputs may alias inputs. `vl`
+ * is the number of active lanes, see fp256_lanes().
+ */
+typedef struct {
+  uint32_t v[FP256_LIMBS][FP256_LANES];
+} fp256_t;
+
+//! Modulus with its Montgomery constants
+typedef struct {
+  uint32_t p   [FP256_LIMBS];  //!< the modulus
+  uint32_t rr  [FP256_LIMBS];  //!< R^2 mod p
+  uint32_t one [FP256_LIMBS];  //!< R mod p, 1 in the Montgomery domain
+  uint32_t n0;                 //!< -p^-1 mod 2^29
+  uint8_t  be  [32];           //!< the modulus, big endian
+} fp256_mod_t;
+
+//! Number of lanes a batch can use on this hart (at most FP256_LANES)
+size_t fp256_lanes(void);
+
+//! Set up the constants of the odd modulus given as 32 big endian bytes
+void fp256_mod_init(fp256_mod_t* m, const uint8_t p[32]);
+
+void fp256_set (fp256_t* h, const uint32_t c[FP256_LIMBS], size_t vl);  //!< h = c in all lanes
+void fp256_copy(fp256_t* h, const fp256_t* f, size_t vl);               //!< h = f
+
+void fp256_add(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl);  //!< h = f + g
+void fp256_sub(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl);  //!< h = f - g
+
+/*!
+@brief Montgomery product h = f * g * R^-1 mod p.
+@details f may be any value below 2^261 as long as g < p.
+*/
+void fp256_mul(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl);
+void fp256_sq (const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl);                    //!< h = f^2
+void fp256_invert(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl);                 //!< h = f^(p-2)
+
+//! h = f * R mod p, f may be any value below 2^256
+void fp256_to_mont  (const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl);
+//! h = f * R^-1 mod p, the canonical value of a Montgomery element
+void fp256_from_mont(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl);
+
+/*!
+@brief Lane-wise select, h = f in every lane i with sel[i] != 0.
+*/
+void fp256_cmov(fp256_t* h, const fp256_t* f, const uint32_t* sel, size_t vl);
+
+/*!
+@brief Per-lane table lookup with indexed loads: limb i of lane j is the
+32b word at (const uint8_t*)base + off[j] + i * stride.
+*/
+void fp256_gather(fp256_t* h, const void* base, const uint32_t* off, size_t stride, size_t vl);
+
+//! zero[i] = 1 if the element of lane i is 0, 0 otherwise
+void fp256_is_zero(uint32_t* zero, const fp256_t* f, size_t vl);
+
+/*!
+@brief Load lane `lane` from 32 big endian bytes, without any reduction.
+*/
+void fp256_frombytes(fp256_t* h, size_t lane, const uint8_t s[32]);
+
+//! Store lane `lane` as 32 big endian bytes, f must be below 2^256
+void fp256_tobytes(uint8_t s[32], const fp256_t* f, size_t lane);
+
+#endif // __FP256_H__
@@ -0,0 +1,103 @@
+/*
+ * File      : api_esp.h
+ * Test      : esp_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched IPsec ESP (RFC 4303) with AES-GCM (RFC 4106).
+ * A batch of packet descriptors is processed at once: the counter blocks
+ * of all packets are packed into shared vector strips, and GHASH runs one
+ * packet per element group.
+ */
+
+#ifndef __API_ESP_H__
+#define __API_ESP_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/aes/api_aes.h"
+
+#define ESP_HDR_BYTES       8   //!< SPI and sequence number
+#define ESP_IV_BYTES        8   //!< explicit IV, follows the ESP header
+#define ESP_ICV_BYTES       16  //!< GCM tag, follows the encrypted payload
+#define ESP_SALT_BYTES      4
+
+//! Room needed behind the payload for the trailer (padding, pad length,
+//! next header) and the ICV
+#define ESP_TAIL_MAX        (3 + 2 + ESP_ICV_BYTES)
+
+//! Maximum number of packets whose GHASH runs in parallel
+#define ESP_LANES           16
+
+//! Size of the anti-replay window in packets
+#define ESP_REPLAY_WINDOW   64
+
+//! Return codes
+#define ESP_OK              0
+#define ESP_ERR_KEY        -1  //!< unsupported key size
+#define ESP_ERR_SPI        -2  //!< SPI of the packet does not match the SA
+#define ESP_ERR_REPLAY     -3  //!< sequence number outside or already seen in the window
+#define ESP_ERR_ICV        -4  //!< authentication failed
+#define ESP_ERR_PAD        -5  //!< malformed trailer
+#define ESP_ERR_SEQ        -6  //!< outbound sequence number space exhausted
+
+/*!
+Security association, holding the expanded key and hash subkey so that
+neither is recomputed per packet. Outbound SAs count sent packets in seq,
+inbound SAs keep the highest authenticated sequence number in seq and the
+anti-replay window in replay (bit i set: seq - i was received).
+*/
+typedef struct {
+  uint32_t rk     [AES_256_RK_WORDS];
+  uint32_t h      [AES_BLOCK_BYTES / 4];
+  uint32_t nr;
+  uint32_t spi;
+  uint8_t  salt   [ESP_SALT_BYTES];
+  uint32_t seq;
+  uint64_t replay;
+} esp_sa_t;
+
+/*!
+Packet descriptor. hdr points to the ESP header followed by the IV
+(ESP_HDR_BYTES + ESP_IV_BYTES), payload to the inner packet, which must be
+followed by ESP_TAIL_MAX bytes of room. Buffers need no particular
+alignment.
+*/
+typedef struct {
+  uint8_t*  hdr;
+  uint8_t*  payload;
+  uint32_t  len;       //!< inner packet length, or encrypted length with trailer on the wire side
+  uint16_t  sa;        //!< index of the SA in the SA table
+  uint8_t   next_hdr;  //!< protocol of the inner packet (encap in, decap out)
+  int8_t    status;    //!< ESP_OK or an ESP_ERR_* code
+} esp_pkt_t;
+
+/*!
+@brief Initialise an SA for AES-GCM.
+@param [in] key      - AES key of key_bits bits (128 or 256)
+@param [in] salt     - implicit part of the nonce (RFC 4106, KEYMAT salt)
+@return ESP_OK or ESP_ERR_KEY
+*/
+int esp_sa_init(esp_sa_t* sa, uint32_t spi, const uint8_t* key, size_t key_bits,
+                const uint8_t salt[ESP_SALT_BYTES]);
+
+/*!
+@brief Encapsulate a batch of packets in place. Each packet gets the next
+sequence number of its SA (also used as the explicit IV), the ESP trailer
+and the ICV. On return len is the length of the encrypted payload including
+the trailer, the ICV follows at payload + len.
+@param [in,out] sad  - SA table indexed by esp_pkt_t.sa
+@return number of packets with status != ESP_OK
+*/
+size_t esp_encap_batch(esp_sa_t* sad, esp_pkt_t* pkts, size_t n);
+
+/*!
+@brief Authenticate and decrypt a batch of packets in place. On input len
+is the length of the encrypted payload including trailer (without ICV), on
+success it is the inner packet length and next_hdr is set. The anti-replay
+window of each SA is checked before and updated after authentication, so a
+duplicate within one batch is rejected too.
+@return number of packets with status != ESP_OK
+*/
+size_t esp_decap_batch(esp_sa_t* sad, esp_pkt_t* pkts, size_t n);
+
+#endif // __API_ESP_H__
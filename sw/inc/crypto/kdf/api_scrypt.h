@@ -0,0 +1,41 @@
+/*
+ * File      : api_scrypt.h
+ * Test      : scrypt_benchmark
+ * Date      : 19-oct-2026
+ * Description: scrypt (RFC 7914) and PBKDF2-HMAC-SHA256. The ROMix
+ * instances of a derivation run side by side, one per group of 4 vector
+ * elements, and their large working set is taken from a memory arena.
+ */
+
+#ifndef __API_SCRYPT_H__
+#define __API_SCRYPT_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/share/arena.h"
+
+//! Return codes
+#define SCRYPT_OK           0
+#define SCRYPT_ERR_PARAM   -1  //!< N not a power of 2 above 1, r or p zero, or too large
+#define SCRYPT_ERR_MEMORY  -2  //!< the arena cannot hold a single ROMix instance
+
+//! dk = PBKDF2-HMAC-SHA256(pw, salt, c, dk_len) (RFC 8018)
+void pbkdf2_hmac_sha256(uint8_t* dk, size_t dk_len, const uint8_t* pw, size_t pw_len,
+                        const uint8_t* salt, size_t salt_len, uint32_t c);
+
+/*!
+@brief dk = scrypt(pw, salt, N, r, p, dk_len).
+@details Up to scrypt_lanes() of the p ROMix instances run at once, as many
+as fit into the arena next to each other, 128 * r * N bytes each. All the
+memory taken from the arena is released before returning.
+@return SCRYPT_OK or a negative error code
+*/
+int scrypt(uint8_t* dk, size_t dk_len, const uint8_t* pw, size_t pw_len,
+           const uint8_t* salt, size_t salt_len, uint64_t N, uint32_t r, uint32_t p,
+           crypto_arena_t* arena);
+
+//! Number of ROMix instances processed side by side
+size_t scrypt_lanes(void);
+
+#endif // __API_SCRYPT_H__
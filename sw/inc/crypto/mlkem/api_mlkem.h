@@ -0,0 +1,65 @@
+/*
+ * File      : api_mlkem.h
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: ML-KEM-768 key encapsulation (FIPS 203). Randomness is
+ * passed in by the caller, which keeps the functions deterministic for
+ * testing.
+ */
+
+#ifndef __API_MLKEM_H__
+#define __API_MLKEM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! ML-KEM-768 parameter set
+#define MLKEM_N         256
+#define MLKEM_Q         3329
+#define MLKEM_K         3
+#define MLKEM_ETA1      2
+#define MLKEM_ETA2      2
+#define MLKEM_DU        10
+#define MLKEM_DV        4
+
+#define MLKEM_SYMBYTES          32  //!< size of seeds, hashes and shared keys
+#define MLKEM_SSBYTES           32
+#define MLKEM_POLYBYTES         384
+#define MLKEM_POLYVECBYTES      (MLKEM_K * MLKEM_POLYBYTES)
+#define MLKEM_POLYCOMPBYTES     (MLKEM_DV * MLKEM_N / 8)
+#define MLKEM_POLYVECCOMPBYTES  (MLKEM_K * MLKEM_DU * MLKEM_N / 8)
+
+#define MLKEM768_PUBLICKEYBYTES   (MLKEM_POLYVECBYTES + MLKEM_SYMBYTES)
+#define MLKEM768_SECRETKEYBYTES   (MLKEM_POLYVECBYTES + MLKEM768_PUBLICKEYBYTES + 2 * MLKEM_SYMBYTES)
+#define MLKEM768_CIPHERTEXTBYTES  (MLKEM_POLYVECCOMPBYTES + MLKEM_POLYCOMPBYTES)
+
+//! Return codes
+#define MLKEM_OK        0
+#define MLKEM_ERR_KEY  -1  //!< encapsulation or decapsulation key fails its input check
+
+/*!
+@brief Generate a key pair (ML-KEM.KeyGen_internal).
+@param [out] pk    - encapsulation key, MLKEM768_PUBLICKEYBYTES
+@param [out] sk    - decapsulation key, MLKEM768_SECRETKEYBYTES
+@param [in]  coins - 64 random bytes d || z
+*/
+int mlkem768_keypair(uint8_t* pk, uint8_t* sk, const uint8_t coins[2 * MLKEM_SYMBYTES]);
+
+/*!
+@brief Encapsulate a shared key to pk (ML-KEM.Encaps_internal).
+@param [out] ct    - ciphertext, MLKEM768_CIPHERTEXTBYTES
+@param [out] ss    - shared key
+@param [in]  coins - 32 random bytes m
+@return MLKEM_OK or MLKEM_ERR_KEY if pk fails the modulus check
+*/
+int mlkem768_enc(uint8_t* ct, uint8_t ss[MLKEM_SSBYTES], const uint8_t* pk,
+                 const uint8_t coins[MLKEM_SYMBYTES]);
+
+/*!
+@brief Decapsulate the shared key of ct (ML-KEM.Decaps_internal), an
+invalid ciphertext results in the implicit rejection key J(z || ct).
+@return MLKEM_OK or MLKEM_ERR_KEY if sk fails the hash check
+*/
+int mlkem768_dec(uint8_t ss[MLKEM_SSBYTES], const uint8_t* ct, const uint8_t* sk);
+
+#endif // __API_MLKEM_H__
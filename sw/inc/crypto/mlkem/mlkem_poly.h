@@ -0,0 +1,60 @@
+/*
+ * File      : mlkem_poly.h
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: Polynomial arithmetic in Z_q[X]/(X^256+1), q = 3329, for
+ * ML-KEM. The NTT and the coefficient-wise arithmetic use e16 vectors with
+ * Montgomery/Barrett reduction on vmul/vmulh.
+ */
+
+#ifndef __MLKEM_POLY_H__
+#define __MLKEM_POLY_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/mlkem/api_mlkem.h"
+
+/*
+ * Coefficients are signed 16b values. Outputs of the NTT are in bit
+ * reversed order, and Montgomery products carry a factor 2^-16 which is
+ * removed by mlkem_poly_tomont/mlkem_poly_invntt_tomont.
+ */
+typedef struct {
+  int16_t coeffs[MLKEM_N];
+} mlkem_poly_t;
+
+typedef struct {
+  mlkem_poly_t vec[MLKEM_K];
+} mlkem_polyvec_t;
+
+// arithmetic (e16 vector)
+void mlkem_poly_ntt          (mlkem_poly_t* r);                    //!< forward NTT, |r| < q on output
+void mlkem_poly_invntt_tomont(mlkem_poly_t* r);                    //!< inverse NTT times 2^16
+void mlkem_poly_reduce       (mlkem_poly_t* r);                    //!< Barrett reduction, |r| <= q/2
+void mlkem_poly_tomont       (mlkem_poly_t* r);                    //!< r = r * 2^16 mod q
+void mlkem_poly_add          (mlkem_poly_t* r, const mlkem_poly_t* a, const mlkem_poly_t* b);
+void mlkem_poly_sub          (mlkem_poly_t* r, const mlkem_poly_t* a, const mlkem_poly_t* b);
+
+//! r = sum(a[i] * b[i]) * 2^-16 in the NTT domain, reduced
+void mlkem_polyvec_basemul_acc(mlkem_poly_t* r, const mlkem_polyvec_t* a, const mlkem_polyvec_t* b);
+
+// serialisation and compression (scalar)
+void mlkem_poly_tobytes       (uint8_t r[MLKEM_POLYBYTES], const mlkem_poly_t* a);
+void mlkem_poly_frombytes     (mlkem_poly_t* r, const uint8_t a[MLKEM_POLYBYTES]);
+void mlkem_poly_compress      (uint8_t r[MLKEM_POLYCOMPBYTES], const mlkem_poly_t* a);
+void mlkem_poly_decompress    (mlkem_poly_t* r, const uint8_t a[MLKEM_POLYCOMPBYTES]);
+void mlkem_polyvec_compress   (uint8_t r[MLKEM_POLYVECCOMPBYTES], const mlkem_polyvec_t* a);
+void mlkem_polyvec_decompress (mlkem_polyvec_t* r, const uint8_t a[MLKEM_POLYVECCOMPBYTES]);
+void mlkem_poly_frommsg       (mlkem_poly_t* r, const uint8_t msg[MLKEM_SYMBYTES]);
+void mlkem_poly_tomsg         (uint8_t msg[MLKEM_SYMBYTES], const mlkem_poly_t* a);
+
+// sampling (batched SHAKE)
+
+//! a[i][j] = SampleNTT(rho || j || i), or its transpose
+void mlkem_gen_matrix(mlkem_polyvec_t a[MLKEM_K], const uint8_t rho[MLKEM_SYMBYTES], int transposed);
+
+//! r[i] = CBD_eta(PRF(seed, nonce + i)) for i < n, eta = 2
+void mlkem_poly_getnoise(mlkem_poly_t* r, size_t n, const uint8_t seed[MLKEM_SYMBYTES], uint8_t nonce);
+
+#endif // __MLKEM_POLY_H__
@@ -0,0 +1,69 @@
+/*
+ * File      : api_rsa.h
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: RSA-2048/3072 PKCS#1 v1.5 (SHA-256) signature verification on
+ * top of the Montgomery arithmetic in bignum.h.
+ */
+
+#ifndef __API_RSA_H__
+#define __API_RSA_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/rsa/bignum.h"
+
+#define RSA_2048_BYTES  256
+#define RSA_3072_BYTES  384
+
+//! Public exponent F4
+#define RSA_F4          65537
+
+//! Return codes
+#define RSA_OK               0
+#define RSA_ERR_KEY         -1  //!< unsupported modulus or exponent
+#define RSA_ERR_SIGNATURE   -2  //!< signature out of range or malformed
+#define RSA_ERR_MISMATCH    -3  //!< encoded message does not match digest
+
+typedef struct {
+  bn_mont_ctx_t mont;  //!< Montgomery context of the modulus
+  uint32_t      e;     //!< public exponent
+  size_t        bytes; //!< modulus size in bytes
+} rsa_pubkey_t;
+
+/*!
+@brief Set up a public key (precomputes the Montgomery constants once).
+@param [out] key     - public key
+@param [in]  modulus - big endian modulus
+@param [in]  len     - modulus length in bytes (256 or 384)
+@param [in]  e       - public exponent (odd, > 1)
+@return RSA_OK or RSA_ERR_KEY
+*/
+int rsa_pubkey_init(rsa_pubkey_t* key, const uint8_t* modulus, size_t len, uint32_t e);
+
+/*!
+@brief Raw public key operation em = sig^e mod N.
+@param [out] em  - big endian result, key->bytes long
+@param [in]  sig - big endian signature, key->bytes long
+@return RSA_OK or RSA_ERR_SIGNATURE if sig >= N
+*/
+int rsa_public(const rsa_pubkey_t* key, uint8_t* em, const uint8_t* sig);
+
+/*!
+@brief Verify an RSASSA-PKCS1-v1_5 signature over a SHA-256 digest.
+@param [in] digest - 32 byte SHA-256 digest of the message
+@param [in] sig    - big endian signature, sig_len bytes
+@return RSA_OK if the signature is valid, a negative error code otherwise
+*/
+int rsa_verify_pkcs1_sha256_digest(const rsa_pubkey_t* key, const uint8_t digest[32],
+                                   const uint8_t* sig, size_t sig_len);
+
+/*!
+@brief Hash a message with the vector SHA-256 and verify its RSASSA-PKCS1-v1_5
+signature.
+*/
+int rsa_verify_pkcs1_sha256(const rsa_pubkey_t* key, const uint8_t* msg, size_t msg_len,
+                            const uint8_t* sig, size_t sig_len);
+
+#endif // __API_RSA_H__
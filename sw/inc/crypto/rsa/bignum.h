@@ -0,0 +1,95 @@
+/*
+ * File      : bignum.h
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: Multi-precision Montgomery arithmetic (radix 2^32) with a
+ * scalar reference and a vector implementation built on vmul/vmulhu.
+ */
+
+#ifndef __BIGNUM_H__
+#define __BIGNUM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Bits in a single limb
+#define BN_LIMB_BITS   32
+//! Maximum number of limbs of a modulus (RSA-3072)
+#define BN_MAX_LIMBS   96
+//! Window size used by the sliding-window exponentiation
+#define BN_EXP_WINDOW  4
+
+//! Limbs required to hold a number of bits
+#define BN_LIMBS(bits) (((bits) + BN_LIMB_BITS - 1) / BN_LIMB_BITS)
+
+/*
+ * Numbers are stored as arrays of 32b limbs, least significant limb first.
+ *
+ * The vector kernels keep a whole operand in a single e32/m8 register group,
+ * with one limb per element plus one element of headroom for the
+ * intermediate result. A modulus of `limbs` limbs therefore requires
+ * VLEN*8/32 >= limbs+1, i.e. VLEN >= 512 for RSA-3072 (96 limbs).
+ */
+typedef struct {
+  uint32_t n  [BN_MAX_LIMBS]; //!< modulus N (odd)
+  uint32_t rr [BN_MAX_LIMBS]; //!< R^2 mod N, R = 2^(32*limbs)
+  uint32_t n0;                //!< -N^-1 mod 2^32
+  size_t   limbs;             //!< number of limbs of N
+} bn_mont_ctx_t;
+
+/*!
+@brief Montgomery multiplication r = a*b*R^-1 mod N.
+@details a and b must be smaller than N, r may alias a or b.
+*/
+typedef void (*bn_mont_mul_func)(
+  const bn_mont_ctx_t* ctx,
+  uint32_t*            r,
+  const uint32_t*      a,
+  const uint32_t*      b
+);
+
+//  function pointers to the Montgomery multiply/square used by bn_mod_exp
+//  (default to the vector implementations)
+extern bn_mont_mul_func bn_mont_mul;
+extern void (*bn_mont_sqr)(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a);
+
+//  scalar CIOS implementation
+void bn_mont_mul_scalar(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a, const uint32_t* b);
+void bn_mont_sqr_scalar(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a);
+
+//  vector implementation, one limb per e32 element (vmul/vmulhu.vx)
+void bn_mont_mul_vec(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a, const uint32_t* b);
+void bn_mont_sqr_vec(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a);
+
+/*!
+@brief Initialise a Montgomery context for an odd modulus.
+@param [out] ctx   - context to initialise
+@param [in]  n     - modulus, `limbs` limbs, most significant limb non-zero
+@param [in]  limbs - number of limbs of n (at most BN_MAX_LIMBS)
+@return 0 on success, -1 if the modulus is unsupported
+*/
+int bn_mont_init(bn_mont_ctx_t* ctx, const uint32_t* n, size_t limbs);
+
+//  r = a*R mod N
+void bn_to_mont(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a);
+
+//  r = a*R^-1 mod N
+void bn_from_mont(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a);
+
+/*!
+@brief Sliding-window modular exponentiation r = a^e mod N.
+@details Not constant time, intended for public exponents/verification.
+@param [in] e       - exponent, least significant limb first
+@param [in] e_limbs - number of limbs of e
+*/
+void bn_mod_exp(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a,
+                const uint32_t* e, size_t e_limbs);
+
+//  compare a and b (limbs each): -1, 0 or 1
+int bn_cmp(const uint32_t* a, const uint32_t* b, size_t limbs);
+
+//  big endian byte string <-> limbs (len bytes, limbs*4 >= len)
+void bn_from_bytes_be(uint32_t* r, size_t limbs, const uint8_t* in, size_t len);
+void bn_to_bytes_be(uint8_t* out, size_t len, const uint32_t* a, size_t limbs);
+
+#endif // __BIGNUM_H__
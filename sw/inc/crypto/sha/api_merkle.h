@@ -0,0 +1,82 @@
+/*
+ * File      : api_merkle.h
+ * Test      : merkle_benchmark
+ * Date      : 19-oct-2026
+ * Description: Binary SHA-256 Merkle trees with the leaf and node prefixes
+ * of RFC 6962 (MTH, PATH). All nodes of a level are independent and are
+ * hashed with the multi-buffer compression, as are the steps of a batch of
+ * inclusion proofs.
+ */
+
+#ifndef __API_MERKLE_H__
+#define __API_MERKLE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define MERKLE_HASH_BYTES   32
+
+//! Upper bound of the proof length (tree height) for size_t leaf counts
+#define MERKLE_MAX_DEPTH    64
+
+//! Return codes
+#define MERKLE_OK           0
+#define MERKLE_ERR_EMPTY   -1  //!< a tree needs at least one leaf
+#define MERKLE_ERR_INDEX   -2  //!< leaf index outside the tree
+#define MERKLE_ERR_PROOF   -3  //!< the path does not lead to the root
+
+typedef uint8_t merkle_hash_t [MERKLE_HASH_BYTES];
+
+/*!
+All levels of a tree, leaf hashes first and the root last. An odd node at
+the end of a level is carried up unchanged, which gives the same root as
+the recursive split of RFC 6962.
+*/
+typedef struct {
+  merkle_hash_t*  nodes;     //!< merkle_tree_nodes(n_leaves) hashes
+  size_t          n_leaves;
+} merkle_tree_t;
+
+//! One inclusion proof of a batch
+typedef struct {
+  const uint8_t*        leaf;      //!< leaf hash, see merkle_hash_leaves
+  const merkle_hash_t*  path;
+  size_t                path_len;
+  size_t                index;
+  int                   status;    //!< set by merkle_verify_batch
+} merkle_proof_t;
+
+//! Number of hashes needed to store a tree over n_leaves leaves
+size_t merkle_tree_nodes(size_t n_leaves);
+
+/*!
+@brief Leaf hashes SHA-256(0x00 || leaf) of n leaves of leaf_bytes each.
+*/
+void merkle_hash_leaves(merkle_hash_t* md, const uint8_t* leaves, size_t leaf_bytes, size_t n);
+
+/*!
+@brief Build the tree over n consecutive leaves of leaf_bytes each.
+@param [out] nodes - storage for merkle_tree_nodes(n) hashes
+@return MERKLE_OK or MERKLE_ERR_EMPTY
+*/
+int merkle_build(merkle_tree_t* t, merkle_hash_t* nodes, const uint8_t* leaves,
+                 size_t leaf_bytes, size_t n);
+
+const uint8_t* merkle_root(const merkle_tree_t* t);
+
+/*!
+@brief Audit path of a leaf, nearest sibling first.
+@param [out] path - room for the tree height (at most MERKLE_MAX_DEPTH) hashes
+@return length of the path
+*/
+size_t merkle_proof(merkle_hash_t* path, const merkle_tree_t* t, size_t index);
+
+/*!
+@brief Verify n inclusion proofs against one root in lockstep (RFC 9162,
+2.1.3.2). Sets the status of every proof.
+@return number of proofs with status != MERKLE_OK
+*/
+size_t merkle_verify_batch(const uint8_t root[MERKLE_HASH_BYTES], size_t tree_size,
+                           merkle_proof_t* proofs, size_t n);
+
+#endif // __API_MERKLE_H__
@@ -6,6 +6,7 @@
 #include <stddef.h>
 
 #include "crypto/share/util.h"
+#include "crypto/share/iovec.h"
 
 // Add a single message block to the current hash digest.
 void sha256_hash (
@@ -21,6 +22,67 @@ void sha256_hash_vec (
   size_t    len    // Length of the message in *bytes*.
 );
 
+// Hash a message scattered over cnt segments (using zvknh). Whole blocks
+// inside a segment are hashed in place, no staging copy is made.
+void sha256_hash_vec_iov (
+  uint32_t              H[8], // out - message digest
+  const crypto_iovec_t* iov , // in - message segments
+  size_t                cnt   // number of segments
+);
+
+// Multi-buffer compression (using zvknh): add block B[i] to hash H[i] for
+// every i < n, one message per element group. The hashes are in the word
+// order of the zvknh kernels (kSha256InitialHash).
+void sha256_block_mb (
+  uint32_t      (*H)[8] , // in,out - n message block hashes
+  const uint8_t (*B)[64], // in - n message blocks
+  size_t          n
+);
+
+// Number of messages compressed by one pass of sha256_block_mb.
+size_t sha256_mb_lanes (void);
+
+// Digest bytes of a hash in the zvknh word order.
+void sha256_mb_digest (
+  uint8_t         md[32], // out - message digest
+  const uint32_t  H [8]   // in - final hash
+);
+
+// State after a fixed message prefix. Only the whole prefix blocks are
+// compressed, the remainder is kept and put in front of every suffix.
+typedef struct {
+  uint32_t  H[ 8];  // hash state, in the word order of the zvknh kernels
+  uint32_t  B[16];  // prefix bytes past the last whole block
+  size_t    num  ;  // bytes in B
+  uint64_t  len  ;  // prefix length in bytes
+} sha256_midstate_t;
+
+// Compress the prefix once (using zvknh).
+void sha256_midstate_init (
+  sha256_midstate_t*  ms    , // out - snapshot after the prefix
+  const uint8_t*      prefix, // in - the common prefix
+  size_t              len     // Length of the prefix in *bytes*.
+);
+
+// Hash prefix || M from the snapshot, same digest layout as sha256_hash_vec.
+void sha256_midstate_hash (
+  uint32_t                  H[8], // out - message digest
+  const sha256_midstate_t*  ms  , // in - snapshot after the prefix
+  const uint8_t*            M   , // in - the suffix
+  size_t                    len   // Length of the suffix in *bytes*.
+);
+
+// Hash prefix || M + i * stride for i < n, all suffixes of len bytes, with
+// sha256_block_mb.
+void sha256_midstate_hash_batch (
+  uint8_t                 (*md)[32], // out - n message digests
+  const sha256_midstate_t*  ms     , // in - snapshot after the prefix
+  const uint8_t*            M      , // in - the first suffix
+  size_t                    len    , // Length of every suffix in *bytes*.
+  size_t                    stride , // distance between the suffixes
+  size_t                    n
+);
+
 void sha256_hash_init (
     uint32_t    H [8]  // out - message block hash
 );
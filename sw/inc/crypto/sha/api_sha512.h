@@ -7,6 +7,7 @@
 #include <stddef.h>
 
 #include "crypto/share/util.h"
+#include "crypto/share/iovec.h"
 
 // Hash a message using SHA512
 void sha512_hash (
@@ -22,6 +23,56 @@ void sha512_hash_vec (
   size_t    len   // Length of the message in *bytes*.
 );
 
+// Incremental SHA512 (using the zvknh sha512_block_lmul2 kernel), for
+// messages which are not contiguous in memory.
+typedef struct {
+  uint64_t  H[ 8];  // hash state, in the word order of the zvknh kernels
+  uint64_t  B[16];  // partial message block
+  size_t    num  ;  // bytes in the partial block
+  uint64_t  len  ;  // total message length in bytes
+} sha512_vec_ctx_t;
+
+void sha512_vec_init (
+  sha512_vec_ctx_t* ctx
+);
+
+void sha512_vec_update (
+  sha512_vec_ctx_t* ctx,
+  const uint8_t*    M  , // in - next part of the message
+  size_t            len  // Length of the part in *bytes*.
+);
+
+// As sha512_vec_update for a part scattered over cnt segments. Whole blocks
+// inside a segment are hashed in place.
+void sha512_vec_update_iov (
+  sha512_vec_ctx_t*     ctx,
+  const crypto_iovec_t* iov, // in - next parts of the message
+  size_t                cnt  // number of segments
+);
+
+void sha512_vec_final (
+  sha512_vec_ctx_t* ctx,
+  uint8_t           md[64] // out - message digest
+);
+
+// A context after a fixed message prefix. The whole prefix blocks are
+// compressed once, every hash from the snapshot works on a copy.
+typedef sha512_vec_ctx_t sha512_midstate_t;
+
+void sha512_midstate_init (
+  sha512_midstate_t*  ms    , // out - snapshot after the prefix
+  const uint8_t*      prefix, // in - the common prefix
+  size_t              len     // Length of the prefix in *bytes*.
+);
+
+// Hash prefix || M from the snapshot, which is left unchanged.
+void sha512_midstate_hash (
+  uint8_t                   md[64], // out - message digest
+  const sha512_midstate_t*  ms    , // in - snapshot after the prefix
+  const uint8_t*            M     , // in - the suffix
+  size_t                    len     // Length of the suffix in *bytes*.
+);
+
 void sha512_hash_init (
     uint64_t    H [8]  // out - message block hash
 );
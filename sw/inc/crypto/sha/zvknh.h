@@ -89,6 +89,7 @@ static const uint64_t kSha512InitialHash[SHA512_DIGEST_SIZE / sizeof(uint64_t)]
     0x3c6ef372fe94f82b,  // [7]: H2 = c
 };
 
+// The block is read with byte loads and may have any alignment.
 extern void
 sha256_block_lmul1(
     uint8_t* hash,
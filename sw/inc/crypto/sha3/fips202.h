@@ -0,0 +1,68 @@
+/*
+ * File      : fips202.h
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: SHA-3 and SHAKE (FIPS 202). Single messages use a scalar
+ * Keccak-f[1600]; independent streams (e.g. the matrix and noise sampling of
+ * ML-KEM) run one Keccak state per e64 vector lane.
+ */
+
+#ifndef __FIPS202_H__
+#define __FIPS202_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SHAKE128_RATE   168
+#define SHAKE256_RATE   136
+#define SHA3_256_RATE   136
+#define SHA3_512_RATE    72
+
+//! Domain separation and first padding bit
+#define SHA3_PAD       0x06
+#define SHAKE_PAD      0x1f
+
+//! Maximum number of lanes of a batch (e64, LMUL=2 at VLEN=512)
+#define KECCAK_LANES     16
+
+void keccakf1600(uint64_t s[25]);
+
+void sha3_256(uint8_t h[32], const uint8_t* in, size_t inlen);
+void sha3_512(uint8_t h[64], const uint8_t* in, size_t inlen);
+void shake128(uint8_t* out, size_t outlen, const uint8_t* in, size_t inlen);
+void shake256(uint8_t* out, size_t outlen, const uint8_t* in, size_t inlen);
+
+/*
+ * Batched Keccak: s[i][lane] is the 64b lane i of the state in `lane`, so
+ * every state word of the batch is a single e64 vector load. Message and
+ * output bytes of the streams are interleaved with a fixed byte stride.
+ */
+typedef struct {
+  uint64_t s[25][KECCAK_LANES];
+} keccak_x_t;
+
+//! Number of lanes a batch can use on this hart (at most KECCAK_LANES)
+size_t keccak_x_lanes(void);
+
+//! Keccak-f[1600] on the states of vl lanes
+void keccakf1600_x(keccak_x_t* st, size_t vl);
+
+/*!
+@brief Initialise vl states and absorb one complete message per lane.
+@param [in] rate   - rate of the sponge in bytes
+@param [in] pad    - SHA3_PAD or SHAKE_PAD
+@param [in] in     - message of lane i starts at in + i*stride
+@param [in] inlen  - length of every message in bytes
+*/
+void keccak_x_absorb_once(keccak_x_t* st, size_t rate, uint8_t pad, const uint8_t* in,
+                          size_t stride, size_t inlen, size_t vl);
+
+/*!
+@brief Squeeze nblocks blocks of `rate` bytes from every lane.
+@param [out] out    - output of lane i starts at out + i*stride, 8 byte aligned
+@param [in]  stride - multiple of 8
+*/
+void keccak_x_squeezeblocks(uint8_t* out, size_t stride, size_t nblocks, keccak_x_t* st,
+                            size_t rate, size_t vl);
+
+#endif // __FIPS202_H__
@@ -0,0 +1,56 @@
+/*
+ * File      : arena.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Bump allocator for large working sets (memory-hard KDFs),
+ * by default over the free L2 between l2_alloc_base and l2_alloc_end of the
+ * linker script. Allocations are released in LIFO order by rewinding to a
+ * mark, there is no per-block free.
+ */
+
+#ifndef __ARENA_H__
+#define __ARENA_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Default alignment of crypto_arena_alloc, a whole L2 beat
+#define CRYPTO_ARENA_ALIGN  16
+
+typedef struct {
+  uintptr_t base;  //!< first byte of the region
+  uintptr_t top;   //!< next free byte
+  uintptr_t end;   //!< one past the last byte
+} crypto_arena_t;
+
+//! Arena over [base, base + len)
+void crypto_arena_init(crypto_arena_t* a, void* base, size_t len);
+
+/*!
+Arena over the free L2 of the linker script, [l2_alloc_base, l2_alloc_end):
+the image ends at the base, the stack reserve starts at the end. The end is
+lowered further if the DRAM window of the CTRL registers is smaller than
+the memory the linker script assumes.
+*/
+void crypto_arena_init_l2(crypto_arena_t* a);
+
+/*!
+@brief Allocate n bytes aligned to CRYPTO_ARENA_ALIGN.
+@return the block, or NULL if the arena is exhausted
+*/
+void* crypto_arena_alloc(crypto_arena_t* a, size_t n);
+
+//! Bytes left for the next allocation
+size_t crypto_arena_avail(const crypto_arena_t* a);
+
+//! Current top, to be passed to crypto_arena_release()
+static inline uintptr_t crypto_arena_mark(const crypto_arena_t* a) {
+  return a->top;
+}
+
+//! Free everything allocated since the mark was taken
+static inline void crypto_arena_release(crypto_arena_t* a, uintptr_t mark) {
+  a->top = mark;
+}
+
+#endif // __ARENA_H__
@@ -13,11 +13,16 @@
 
 #include "printf.h"
 
+#include "crypto/share/arena.h"
+#include "crypto/share/hpm.h"
+
 //! Length of test input for a hash function.
 #define TEST_HASH_INPUT_LENGTH 1024
 
 //! Number of times test will be repeated
+#ifndef TEST_COUNT
 #define TEST_COUNT 1
+#endif
 
 typedef struct {
     uint64_t icount [TEST_COUNT]; // insns count
@@ -34,6 +39,207 @@ typedef struct {
  */
 uint64_t average_count(uint64_t* count_arr);
 
+//
+// Result records
+// ----------------------------------------------------------------------
+
+/*
+Next to its readable report every benchmark prints each result as one tagged
+CSV line, which tools/bench_collect.py picks out of a simulator or UART log:
+
+  @bench,<kernel>,<len>,<lmul>,<icount>,<ccount>
+
+The kernel name must not contain a comma. lmul is 0 for scalar code, len is
+0 for an operation without a message length (a signature, a key agreement).
+*/
+
+#define BENCH_RECORD_TAG "@bench"
+
+//! Print one result record
+void bench_record(const char* kernel, size_t len, unsigned lmul, uint64_t icount,
+                  uint64_t ccount);
+
+//! Print the averages of a perf_log_t as a result record
+void bench_record_log(const char* kernel, size_t len, unsigned lmul, const perf_log_t* log);
+
+//
+// Kernel registry
+// ----------------------------------------------------------------------
+
+/*
+A test registers its kernels (a name, an optional setup and a run callback)
+and bench_run() times every one of them over a doubling size sweep, with
+warm-up runs ahead of the timed repetitions, and prints the minimum, median,
+mean and standard deviation of the cycle counts and the cycles per byte.
+Each timed run is also a measurement region of the core's event counters
+(hpm.h), sampled outside the cycle count, and the mean events per run are
+kept and printed with it.
+
+Every length is measured in two modes, reported separately:
+- warm: the warm-up runs, then the timed runs back to back, so code, input
+  and tables (round keys) are cached;
+- cold: each timed run follows bench_evict_caches(), which invalidates the
+  instruction and data caches. The cold results are also recorded under the
+  kernel name with BENCH_COLD_SUFFIX.
+*/
+
+/*
+bench_init() takes 2 * BENCH_MAX_BYTES + BENCH_EVICT_BYTES (64 KiB) from the
+arena, and bench_run() a result table of one bench_stats_t (72 B) per kernel
+and length. All of it must fit the L2 that the image, the trace buffer and
+the stack reserve leave of the default 256 KiB, see link.ld.
+*/
+
+//! Size sweep, doubling from the first to the last message length
+#ifndef BENCH_MIN_BYTES
+#define BENCH_MIN_BYTES   16
+#endif
+#ifndef BENCH_MAX_BYTES
+#define BENCH_MAX_BYTES   16384
+#endif
+
+//! Untimed runs ahead of the timed ones, and timed runs per size
+#ifndef BENCH_WARMUP
+#define BENCH_WARMUP      1
+#endif
+#ifndef BENCH_REPS
+#define BENCH_REPS        5
+#endif
+
+//! Events printed per length, 0 for none (they are recorded either way)
+#ifndef BENCH_HPM_EVENTS
+#define BENCH_HPM_EVENTS  HPM_ALL
+#endif
+
+//! Timed runs per size on evicted caches, 0 for no cold runs
+#ifndef BENCH_COLD_REPS
+#define BENCH_COLD_REPS   3
+#endif
+
+//! Buffer read ahead of a cold run, the size of the D-cache (32 KiB), swept
+//! BENCH_EVICT_PASSES times so that the replacement policy of a set
+//! associative cache keeps few kernel lines
+#ifndef BENCH_EVICT_BYTES
+#define BENCH_EVICT_BYTES  32768
+#endif
+#define BENCH_EVICT_PASSES 2
+#define BENCH_CACHE_LINE   16
+
+//! CVA6 D-cache control CSR, bit 0 enables the cache
+#define BENCH_CSR_DCACHE   0x701
+
+#define BENCH_COLD_SUFFIX " cold"
+
+#define BENCH_MAX_KERNELS 32
+#define BENCH_MAX_REPS    16
+
+#define BENCH_OK          0
+#define BENCH_ERR_FULL   -1  //!< registry full
+#define BENCH_ERR_MEMORY -2  //!< buffers do not fit the arena
+
+//! Arguments of the kernel callbacks
+typedef struct {
+    const uint8_t* in;   //!< BENCH_MAX_BYTES of random input
+    uint8_t*       out;  //!< BENCH_MAX_BYTES for the output
+    size_t         len;  //!< message length of this run
+    void*          arg;  //!< bench_kernel_t.arg
+} bench_io_t;
+
+typedef struct {
+    const char* name;
+    unsigned    lmul;       //!< LMUL of a vector kernel, 0 for scalar code
+    size_t      granule;    //!< lengths are rounded down to a multiple, 0 for any
+    size_t      fixed_len;  //!< if non-zero, only this length (e.g. key schedules),
+                            //!< kernels above BENCH_MAX_BYTES are skipped
+    void      (*setup)(const bench_io_t* io); //!< optional, untimed, once per length
+    void      (*run)  (const bench_io_t* io);
+    void*       arg;
+} bench_kernel_t;
+
+//! Statistics of the timed runs of one kernel at one length
+typedef struct {
+    size_t   len;
+    uint64_t min;     //!< cycles
+    uint64_t median;
+    uint64_t mean;
+    uint64_t stddev;
+    uint64_t icount;  //!< fewest instructions retired
+    uint64_t cold_min;     //!< cycles of the cold runs, 0 without
+    uint64_t cold_median;
+    uint64_t cold_icount;  //!< fewest instructions retired by a cold run
+} bench_stats_t;
+
+typedef struct {
+    size_t   min_len;
+    size_t   max_len; //!< at most BENCH_MAX_BYTES
+    unsigned warmup;
+    unsigned reps;    //!< 1 to BENCH_MAX_REPS, 0 runs once
+    unsigned cold;    //!< cold runs, at most BENCH_MAX_REPS
+    uint32_t hpm;     //!< mask of the events printed, see hpm_event_t
+} bench_config_t;
+
+/*!
+@brief Take the sweep and eviction buffers from the arena, fill the input
+    with random bytes and measure the overhead of the counter reads. The
+    arena is kept for the result tables of bench_run().
+@return BENCH_OK or BENCH_ERR_MEMORY
+*/
+int bench_init(crypto_arena_t* arena);
+
+//! Add a kernel, which must stay valid until bench_run() returns
+int bench_register(const bench_kernel_t* k);
+
+//! Drop the registered kernels and their results, to run another group
+void bench_reset(void);
+
+//! BENCH_MIN_BYTES to BENCH_MAX_BYTES, BENCH_WARMUP, BENCH_REPS, BENCH_COLD_REPS
+//! and BENCH_HPM_EVENTS
+void bench_config_default(bench_config_t* c);
+
+/*!
+@brief Time every registered kernel and print the results and a summary.
+    The results go to a table taken from the arena for the lengths of this
+    sweep. It replaces the table of the previous run, whose memory is given
+    back if nothing was allocated above it. Nothing is run if the table
+    does not fit.
+*/
+void bench_run(const bench_config_t* c);
+
+/*!
+@brief Evict the caches. The D-cache is write-through in every build here
+    (WT_DCACHE), and CVA6 flushes only a write-back D-cache on fence, so the
+    D-cache is disabled and re-enabled through BENCH_CSR_DCACHE instead, on
+    which the write-through cache invalidates all lines. The eviction
+    buffer of bench_init() is read line by line ahead of that, as a fallback
+    for a core that keeps its lines. fence.i invalidates the I-cache. Usable
+    by tests outside the registry after bench_init().
+*/
+void bench_evict_caches(void);
+
+/*!
+@brief Results of the last bench_run() for kernel k, in registration order.
+@param [out] n - number of lengths
+*/
+const bench_stats_t* bench_results(size_t k, size_t* n);
+
+//! Statistics of n cycle counts, sorted in place
+void bench_stats(bench_stats_t* s, uint64_t* cycles, unsigned n);
+
+/*!
+@brief Print the median cycles per byte of n kernels of the last bench_run()
+    side by side, one row per message length, as a throughput table.
+@param [in] ks - registration indices of the columns
+*/
+void bench_print_table(const char* title, const size_t* ks, size_t n);
+
+/*!
+@brief Crossover of kernel b over kernel a in the last bench_run(): the
+    shortest length from which b needs at most the median cycles of a at
+    every longer length both were run at.
+@return the length, 0 if b is slower at the longest common length
+*/
+size_t bench_crossover(size_t a, size_t b);
+
 //
 // Misc
 // ----------------------------------------------------------------------
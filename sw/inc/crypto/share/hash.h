@@ -0,0 +1,61 @@
+/*
+ * File      : hash.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Common streaming interface of the hash functions. Every
+ * algorithm exports a descriptor with its own init/update/final; a context
+ * pairs the descriptor with caller provided state, so a benchmark or a
+ * protocol can switch hashes without knowing their state layout.
+ */
+
+#ifndef __HASH_H__
+#define __HASH_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Algorithm descriptor
+typedef struct {
+  const char* name;
+  size_t      md_bytes;     //!< default digest length
+  size_t      max_md_bytes; //!< longest digest supported by final()
+  size_t      block_bytes;  //!< input block of the compression function
+  size_t      state_bytes;  //!< size of the algorithm state
+  void (*init)  (void* state, size_t md_len);
+  void (*update)(void* state, const void* in, size_t len);
+  void (*final) (void* state, uint8_t* md);
+} crypto_hash_desc_t;
+
+//! Streaming context, state points to desc->state_bytes bytes
+typedef struct {
+  const crypto_hash_desc_t* desc;
+  void*                     state;
+} crypto_hash_ctx_t;
+
+//! Start a hash of md_len bytes (at most desc->max_md_bytes)
+static inline void crypto_hash_init(crypto_hash_ctx_t* c, const crypto_hash_desc_t* desc,
+                                    void* state, size_t md_len) {
+  c->desc  = desc;
+  c->state = state;
+  desc->init(state, md_len);
+}
+
+static inline void crypto_hash_update(crypto_hash_ctx_t* c, const void* in, size_t len) {
+  c->desc->update(c->state, in, len);
+}
+
+static inline void crypto_hash_final(crypto_hash_ctx_t* c, uint8_t* md) {
+  c->desc->final(c->state, md);
+}
+
+//! One-shot hash through a descriptor
+static inline void crypto_hash(const crypto_hash_desc_t* desc, void* state, uint8_t* md,
+                               size_t md_len, const void* in, size_t len) {
+  crypto_hash_ctx_t c;
+
+  crypto_hash_init(&c, desc, state, md_len);
+  crypto_hash_update(&c, in, len);
+  crypto_hash_final(&c, md);
+}
+
+#endif // __HASH_H__
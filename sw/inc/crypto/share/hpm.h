@@ -0,0 +1,142 @@
+/*
+ * File      : hpm.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Hardware performance monitor of the CVA6 core. Its event
+ * counters are hard wired, mhpmcounter3 to mhpmcounter16 each count one
+ * event of perf_counters.sv (there are no mhpmevent selectors, 17 to 31 are
+ * reserved), so a measurement region reads all of them on entry and exit
+ * and keeps the differences. The benchmarks run in machine mode and read the
+ * machine counters, which needs no mcounteren setup.
+ */
+
+#ifndef __SHARE_HPM_H__
+#define __SHARE_HPM_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Events in counter order, hpm_event_t + HPM_FIRST_COUNTER is the counter index
+typedef enum {
+  HPM_L1_ICACHE_MISS = 0,  //!< L1 instruction cache misses
+  HPM_L1_DCACHE_MISS,      //!< L1 data cache misses
+  HPM_ITLB_MISS,
+  HPM_DTLB_MISS,
+  HPM_LOAD,                //!< scalar loads
+  HPM_STORE,               //!< scalar stores
+  HPM_EXCEPTION,           //!< taken exceptions and interrupts
+  HPM_EXCEPTION_RET,       //!< mret/sret
+  HPM_BRANCH_JUMP,         //!< branches and jumps
+  HPM_CALL,
+  HPM_RET,
+  HPM_MIS_PREDICT,         //!< mispredicted branches
+  HPM_SB_FULL,             //!< cycles the scoreboard was full (issue stall)
+  HPM_IF_EMPTY,            //!< cycles the fetch queue was empty (frontend stall)
+  HPM_EVENTS
+} hpm_event_t;
+
+#define HPM_FIRST_COUNTER 3
+
+//! All events, the default mask of hpm_print()
+#define HPM_ALL           ((1u << HPM_EVENTS) - 1)
+
+//! The memory side: cache and TLB misses, loads and stores
+#define HPM_MEMORY        (1u << HPM_L1_ICACHE_MISS | 1u << HPM_L1_DCACHE_MISS | \
+                           1u << HPM_ITLB_MISS | 1u << HPM_DTLB_MISS |           \
+                           1u << HPM_LOAD | 1u << HPM_STORE)
+
+typedef struct {
+  uint64_t count [HPM_EVENTS];
+} hpm_sample_t;
+
+/*!
+A measurement region: hpm_begin() samples the counters into start and
+hpm_end() leaves the counts since then in delta. A region may be entered
+again, hpm_end() then overwrites delta.
+*/
+typedef struct {
+  const char*  name;
+  hpm_sample_t start;
+  hpm_sample_t delta;
+} hpm_region_t;
+
+//! Short name of an event, as used in the result records
+const char* hpm_event_name(hpm_event_t e);
+
+/*!
+@brief Take the cost of hpm_begin()/hpm_end() themselves, their own loads
+    and stores, off the counts of a region.
+@details hpm_calibrate() measures it once, before that nothing is taken off.
+*/
+void hpm_calibrate(void);
+void hpm_discount(hpm_sample_t* delta);
+
+//! Print the counts of the events in mask that are not zero, on one line
+void hpm_print(const hpm_sample_t* s, uint32_t mask);
+
+/*!
+@brief Print the counts as one tagged CSV line, all events in hpm_event_t
+    order, for tools/bench_collect.py:
+
+  @hpm,<kernel>,<len>,<lmul>,<count 0>,...,<count HPM_EVENTS-1>
+*/
+void hpm_record(const char* kernel, size_t len, unsigned lmul, const hpm_sample_t* s);
+
+#define HPM_RECORD_TAG "@hpm"
+
+//
+// Low level register access.
+// ------------------------------------------------------------------
+
+#define HPM_CSRR(s, n, csr) __asm__ volatile ("csrr %0, " #csr : "=r"((s)->count[n]))
+
+//! Read every event counter, the CSR number has to be an immediate
+inline static void hpm_read(hpm_sample_t* s) {
+#if ( __riscv_xlen == 64 )
+  HPM_CSRR(s, HPM_L1_ICACHE_MISS, 0xb03);
+  HPM_CSRR(s, HPM_L1_DCACHE_MISS, 0xb04);
+  HPM_CSRR(s, HPM_ITLB_MISS,      0xb05);
+  HPM_CSRR(s, HPM_DTLB_MISS,      0xb06);
+  HPM_CSRR(s, HPM_LOAD,           0xb07);
+  HPM_CSRR(s, HPM_STORE,          0xb08);
+  HPM_CSRR(s, HPM_EXCEPTION,      0xb09);
+  HPM_CSRR(s, HPM_EXCEPTION_RET,  0xb0a);
+  HPM_CSRR(s, HPM_BRANCH_JUMP,    0xb0b);
+  HPM_CSRR(s, HPM_CALL,           0xb0c);
+  HPM_CSRR(s, HPM_RET,            0xb0d);
+  HPM_CSRR(s, HPM_MIS_PREDICT,    0xb0e);
+  HPM_CSRR(s, HPM_SB_FULL,        0xb0f);
+  HPM_CSRR(s, HPM_IF_EMPTY,       0xb10);
+#else
+  #error "Unsupported RISC-V XLEN: __riscv_xlen, expected 64"
+#endif
+}
+
+inline static void hpm_begin(hpm_region_t* r) {
+  hpm_read(&r->start);
+}
+
+inline static void hpm_end(hpm_region_t* r) {
+  hpm_sample_t now;
+
+  hpm_read(&now);
+  for (int i = 0; i < HPM_EVENTS; i++) {
+    r->delta.count[i] = now.count[i] - r->start.count[i];
+  }
+  hpm_discount(&r->delta);
+}
+
+/*!
+@brief Scoped region, the statement or block that follows runs between
+    hpm_begin(r) and hpm_end(r):
+
+  HPM_REGION(&r) {
+    kernel(...);
+  }
+
+It must not be left with break, goto or return.
+*/
+#define HPM_REGION(r) \
+  for (int hpm_once_ = (hpm_begin(r), 1); hpm_once_; hpm_once_ = (hpm_end(r), 0))
+
+#endif // __SHARE_HPM_H__
@@ -0,0 +1,76 @@
+/*
+ * File      : iovec.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Scatter-gather buffers for the bulk cipher and hash kernels.
+ * Full-block runs inside a segment go straight to the kernels at any
+ * alignment, only blocks that straddle segment boundaries are assembled in a
+ * vector register group.
+ */
+
+#ifndef __IOVEC_H__
+#define __IOVEC_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Largest block that can straddle segments (SHA-512)
+#define CRYPTO_IOV_MAX_BLOCK  128
+
+//! Return codes
+#define CRYPTO_IOV_OK         0
+#define CRYPTO_IOV_ERR_LEN   -1  //!< lengths differ or are not a multiple of the block
+
+//! One segment of a scattered buffer
+typedef struct {
+  void*     base;
+  size_t    len;
+} crypto_iovec_t;
+
+//! Position within an iovec array, never left on an exhausted segment
+typedef struct {
+  const crypto_iovec_t* iov;
+  size_t    cnt;
+  size_t    idx;   //!< current segment
+  size_t    off;   //!< offset within the current segment
+} crypto_iov_cursor_t;
+
+//! Block cipher kernel over n bytes, n a multiple of the block size
+typedef void (*crypto_iov_ecb_fn)(void* dest, const void* src, uint64_t n, const void* key);
+
+//! Hash compression over n bytes, n a multiple of the block size
+typedef void (*crypto_iov_hash_fn)(void* state, const void* src, uint64_t n);
+
+//! Total length of an iovec array in bytes
+size_t crypto_iov_len(const crypto_iovec_t* iov, size_t cnt);
+
+void crypto_iov_init(crypto_iov_cursor_t* c, const crypto_iovec_t* iov, size_t cnt);
+
+/*!
+@brief Gather the next n bytes (at most CRYPTO_IOV_MAX_BLOCK) into block.
+@return number of bytes gathered, less than n if the iovec ends
+*/
+size_t crypto_iov_gather(uint8_t* block, crypto_iov_cursor_t* c, size_t n);
+
+/*!
+@brief Scatter n bytes (at most CRYPTO_IOV_MAX_BLOCK) of block to the cursor.
+*/
+void crypto_iov_scatter(crypto_iov_cursor_t* c, const uint8_t* block, size_t n);
+
+/*!
+@brief Run a block cipher kernel from src to dst. The two arrays may be
+segmented differently but must hold the same number of bytes; dst == src
+processes in place.
+@return CRYPTO_IOV_OK or CRYPTO_IOV_ERR_LEN
+*/
+int crypto_iov_ecb(const crypto_iovec_t* dst, size_t dst_cnt,
+                   const crypto_iovec_t* src, size_t src_cnt,
+                   size_t block_bytes, crypto_iov_ecb_fn fn, const void* key);
+
+/*!
+@brief Hash the next n bytes of the cursor, n a multiple of block_bytes.
+*/
+void crypto_iov_hash(void* state, crypto_iov_cursor_t* c, size_t n,
+                     size_t block_bytes, crypto_iov_hash_fn fn);
+
+#endif // __IOVEC_H__
@@ -0,0 +1,42 @@
+/*
+ * File      : mdpad.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Merkle-Damgard padding and big-endian digest output for the
+ * SHA-2 and SM3 wrappers. The final blocks are assembled in a vector
+ * register group and the length and digest words are byte-swapped with
+ * vrev8 (Zvbb), so there is no scalar per-byte loop in the finalization.
+ */
+
+#ifndef __MDPAD_H__
+#define __MDPAD_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! Largest block padded by crypto_md_pad (SHA-512)
+#define CRYPTO_MD_MAX_BLOCK  128
+
+//! Byte offsets of the digest words a..h in the zvknh state {f,e,b,a,h,g,d,c}
+extern const uint32_t crypto_md_zvknh_off32 [8];
+extern const uint64_t crypto_md_zvknh_off64 [8];
+
+/*!
+@brief Pad the last num < block bytes of a message of len_bits bits. One or
+two blocks are written to out, which must hold 2 * block bytes; out may
+equal tail. The length field takes block / 8 bytes, only its low 64 bits
+are written.
+@return bytes written, block or 2 * block
+*/
+size_t crypto_md_pad(uint8_t* out, const uint8_t* tail, size_t num, size_t block,
+                     uint64_t len_bits);
+
+//! Store len_bits big-endian to the 8 bytes at p
+void crypto_md_store_len(uint8_t* p, uint64_t len_bits);
+
+//! md = the words of H at byte offsets off[0..n), each big-endian
+void crypto_md_store_be32(uint8_t* md, const uint32_t* H, const uint32_t* off, size_t n);
+
+void crypto_md_store_be64(uint8_t* md, const uint64_t* H, const uint64_t* off, size_t n);
+
+#endif // __MDPAD_H__
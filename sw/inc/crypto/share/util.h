@@ -23,10 +23,10 @@
   (r)[ (i) + 3 ] = ( (x) >> 24 ) & 0xFF;       \
 }
 
-#define REV8_BE32(x)((x & 0xFF000000) >> 24) | \
-                    ((x & 0x00FF0000) >> 8)  | \
-		                ((x & 0x0000FF00) << 8)  | \
-                    ((x & 0x000000FF) << 24  )
+#define REV8_BE32(x) ((((x) & 0xFF000000) >> 24) | \
+                      (((x) & 0x00FF0000) >>  8) | \
+                      (((x) & 0x0000FF00) <<  8) | \
+                      (((x) & 0x000000FF) << 24))
 
 #endif
 
@@ -0,0 +1,87 @@
+/*
+ * File      : api_sm2.h
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: SM2 signature verification (GB/T 32918.2), single and batched
+ * with one signature per vector lane, and the SM2 key exchange
+ * (GB/T 32918.3). Hashing uses SM3 on the Zvksh kernels.
+ */
+
+#ifndef __API_SM2_H__
+#define __API_SM2_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define SM2_PUBLIC_KEY_BYTES  64  //!< uncompressed x || y, without the 0x04 prefix
+#define SM2_SIGNATURE_BYTES   64  //!< r || s
+#define SM2_DIGEST_BYTES      32
+
+//! Return codes
+#define SM2_OK             0
+#define SM2_ERR_ENCODING  -1  //!< malformed public key, r or s
+#define SM2_ERR_MISMATCH  -2  //!< signature does not verify, or the exchange failed
+#define SM2_ERR_PARAM     -3  //!< private key or identity out of range
+
+typedef struct {
+  const uint8_t* pk;       //!< public key, 64 bytes
+  const uint8_t* sig;      //!< signature r || s, 64 bytes
+  const uint8_t* id;       //!< signer identity (distinguishing identifier)
+  size_t         id_len;   //!< identity length in bytes, below 8192
+  const uint8_t* msg;      //!< message
+  size_t         msg_len;  //!< message length in bytes
+} sm2_item_t;
+
+/*!
+@brief ZA = SM3(ENTL || ID || a || b || xG || yG || xA || yA).
+@return SM2_OK, or SM2_ERR_PARAM if the identity is too long
+*/
+int sm2_compute_za(uint8_t za[SM2_DIGEST_BYTES], const uint8_t* id, size_t id_len,
+                   const uint8_t pk[SM2_PUBLIC_KEY_BYTES]);
+
+/*!
+@brief Verify a single signature, x([s]G + [r + s]P) + SM3(ZA || M) == r mod n.
+@return SM2_OK or a negative error code
+*/
+int sm2_verify(const uint8_t sig[SM2_SIGNATURE_BYTES], const uint8_t* msg, size_t msg_len,
+               const uint8_t* id, size_t id_len, const uint8_t pk[SM2_PUBLIC_KEY_BYTES]);
+
+/*!
+@brief Verify n signatures, in batches of one signature per vector lane.
+@details Every signature is checked individually, so an invalid signature
+is pinpointed in `result` instead of failing the whole batch.
+@param [out] result - result[i] is the return code of items[i]
+@return number of signatures which did not verify
+*/
+size_t sm2_verify_batch(const sm2_item_t* items, int* result, size_t n);
+
+/*!
+@brief pk = [d]G for the private key d (32 big endian bytes, 1 <= d < n - 1).
+@return SM2_OK or SM2_ERR_PARAM
+*/
+int sm2_public_key(uint8_t pk[SM2_PUBLIC_KEY_BYTES], const uint8_t d[32]);
+
+//! One side of a key exchange, the private fields are only read for `self`
+typedef struct {
+  const uint8_t* d;        //!< static private key, 32 bytes
+  const uint8_t* pk;       //!< static public key, 64 bytes
+  const uint8_t* r;        //!< ephemeral private key, 32 bytes
+  const uint8_t* r_pub;    //!< ephemeral public key [r]G, 64 bytes
+  const uint8_t* id;       //!< identity
+  size_t         id_len;
+} sm2_kx_party_t;
+
+/*!
+@brief Key agreement of GB/T 32918.3 (cofactor 1).
+@details Both sides compute U = [t_self](P_peer + [x_peer]R_peer) and
+K = KDF(xU || yU || ZA || ZB, key_len), with A the initiator. The optional
+confirmation values are confirm[0] = SM3(0x02 || yU || inner), sent by the
+responder, and confirm[1] = SM3(0x03 || yU || inner), sent by the
+initiator, with inner = SM3(xU || ZA || ZB || xRA || yRA || xRB || yRB).
+@param [out] confirm - may be NULL
+@return SM2_OK or a negative error code
+*/
+int sm2_kx(uint8_t* key, size_t key_len, uint8_t confirm[2][SM2_DIGEST_BYTES],
+           const sm2_kx_party_t* self, const sm2_kx_party_t* peer, int initiator);
+
+#endif // __API_SM2_H__
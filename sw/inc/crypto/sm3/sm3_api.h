@@ -16,9 +16,14 @@ extern "C" {
 #include <stdint.h>
 #include <stddef.h>
 
+#include "crypto/share/iovec.h"
+
 //	SM3-256: Compute 32-byte hash to "md" from "in" which has "inlen" bytes.
 void sm3_256(uint8_t * md, const void *in, size_t inlen);
 
+//	SM3-256 of a message scattered over "cnt" segments
+void sm3_256_iov(uint8_t *md, const crypto_iovec_t *iov, size_t cnt);
+
 //	function pointer to the compression function used by the test wrappers
 extern void (*sm3_compress)(uint32_t *sp, const uint32_t *mp, size_t n);
 
@@ -19,7 +19,7 @@
 * Generated key expansion from sm4 specs example 1
 * With input cipher key: 01 23 45 67 89 AB CD EF FE DC BA 98 76 54 32 10
 */
-const uint32_t round_keys_0 [32] = {
+static const uint32_t round_keys_0 [32] = {
    0xF12186F9, 0x41662B61, 0x5A6AB19A, 0x7BA92077,
    0x367360F4, 0x776A0C61, 0xB6BB89B3, 0x24763151,
    0xA520307C, 0xB7584DBD, 0xC30753ED, 0x7EE55B57,
@@ -33,7 +33,7 @@ const uint32_t round_keys_0 [32] = {
 /*
 * Generated key expansion from sm4 specs example 1 but reversed for decoding.
 */
-const uint32_t round_keys_rev [32] = {
+static const uint32_t round_keys_rev [32] = {
    0x9124A012, 0x01CF72E5, 0x62293496, 0x428D3654,
    0xF1780C81, 0x0E228AEB, 0x1D2115B0, 0xB79BD80C,
    0x99E1FD2E, 0xC7159060, 0x98CA015A, 0xE89E641F,
@@ -45,7 +45,7 @@ const uint32_t round_keys_rev [32] = {
 };
 
 /*input cipher text from sp4 spec example 1*/
-const uint8_t spec_input[16] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
+static const uint8_t spec_input[16] = {0x01, 0x23, 0x45, 0x67, 0x89, 0xAB, 0xCD, 0xEF,
                                 0xFE, 0xDC, 0xBA, 0x98, 0x76, 0x54, 0x32, 0x10};
 
 
@@ -16,7 +16,11 @@
 #define ZVKSED_H_
 
 #include <stdint.h>
+#include <stddef.h>
 
+#include "crypto/share/iovec.h"
+
+// dest and src are accessed with byte loads and stores, any alignment.
 extern void
 zvksed_sm4_encode_vv(
     void* dest,
@@ -33,4 +37,23 @@ zvksed_sm4_decode_vv(
     const void* masterKey
 );
 
+// Scatter-gather variants with the pre-expanded round keys of the _vv
+// kernels (reversed for decoding). dst and src may be segmented differently
+// but must hold the same number of bytes, a multiple of 16.
+// Return CRYPTO_IOV_OK or CRYPTO_IOV_ERR_LEN.
+
+extern int
+zvksed_sm4_encode_iov(
+    const crypto_iovec_t* dst, size_t dst_cnt,
+    const crypto_iovec_t* src, size_t src_cnt,
+    const void* round_keys
+);
+
+extern int
+zvksed_sm4_decode_iov(
+    const crypto_iovec_t* dst, size_t dst_cnt,
+    const crypto_iovec_t* src, size_t src_cnt,
+    const void* round_keys
+);
+
 #endif  // ZVKSED_H_
\ No newline at end of file
@@ -0,0 +1,104 @@
+#ifndef _PERF_COUNTERS_H_
+#define _PERF_COUNTERS_H_
+
+/*
+ * File      : perf_counters.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Driver of the crypto unit and Ara performance counters in the
+ * CTRL registers (ctrl_registers.sv). The 64-bit counters are read only and
+ * count while bit 0 of HW_CNT_EN is set; bit 1 holds them at zero.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+/*Addresses*/
+#define CTRL_BASE_ADDR        0x2000UL
+#define CTRL_HW_CNT_EN_REG    *(volatile uint64_t*) (CTRL_BASE_ADDR + 0x20UL)
+#define CTRL_PERF_CNT_BASE    (CTRL_BASE_ADDR + 0x38UL)
+#define CTRL_PERF_CNT_REG(i)  *(volatile uint64_t*) (CTRL_PERF_CNT_BASE + 8UL * (i))
+
+#define HW_CNT_EN_COUNT       0x1u
+#define HW_CNT_EN_CLEAR       0x2u
+
+//! Operation types of the crypto unit, crypto_op_type_e in ara_pkg.sv
+typedef enum {
+  PERF_CRYPTO_AES = 0,
+  PERF_CRYPTO_GHASH,
+  PERF_CRYPTO_SHA2,
+  PERF_CRYPTO_SM4,
+  PERF_CRYPTO_SM3,
+  PERF_CRYPTO_TYPES
+} perf_crypto_type_t;
+
+//! Vector functional units, vfu_e in ara_pkg.sv
+typedef enum {
+  PERF_VFU_ALU = 0,
+  PERF_VFU_MFPU,
+  PERF_VFU_SLIDE,
+  PERF_VFU_MASK,
+  PERF_VFU_LOAD,
+  PERF_VFU_CRYPTO,
+  PERF_VFU_STORE,
+  PERF_VFUS
+} perf_vfu_t;
+
+//! Counter indices, in the register order of ctrl_registers.sv
+#define PERF_CNT_CYCLES             0
+#define PERF_CNT_CRYPTO_BUSY(t)     (1 + (t))
+#define PERF_CNT_CRYPTO_WAIT(t)     (1 + PERF_CRYPTO_TYPES + (t))
+#define PERF_CNT_CRYPTO_STALL(t)    (1 + 2 * PERF_CRYPTO_TYPES + (t))
+#define PERF_CNT_VINSN_ISSUED(u)    (1 + 3 * PERF_CRYPTO_TYPES + (u))
+//! Load bytes are beat bytes: every R beat counts AxiDataWidth/8 bytes, also
+//! the lanes a narrow or unaligned load drops. Store bytes are strobed bytes.
+#define PERF_CNT_LOAD_BYTES         (1 + 3 * PERF_CRYPTO_TYPES + PERF_VFUS)
+#define PERF_CNT_STORE_BYTES        (PERF_CNT_LOAD_BYTES + 1)
+#define PERF_COUNTERS               (PERF_CNT_STORE_BYTES + 1)
+
+typedef struct {
+  uint64_t count [PERF_COUNTERS];
+} perf_counters_t;
+
+/*********************
+*Function definitions*
+**********************/
+
+/*
+@brief Clears the counters and starts them.
+*/
+void perf_counters_start(void);
+
+/*
+@brief Stops the counters, their values are kept.
+*/
+void perf_counters_stop(void);
+
+/*
+@brief Reads one counter.
+@param i - counter index, one of the PERF_CNT_* values
+*/
+static inline uint64_t perf_counters_read(unsigned i) {
+  return CTRL_PERF_CNT_REG(i);
+}
+
+/*
+@brief Reads all counters.
+*/
+void perf_counters_sample(perf_counters_t* s);
+
+/*
+@brief Differences end - start of two samples.
+*/
+void perf_counters_delta(perf_counters_t* d, const perf_counters_t* end,
+                         const perf_counters_t* start);
+
+/*
+@brief Prints the counters: per crypto operation type the busy cycles and the
+    share of them spent waiting for operands and held back by the write back,
+    then the instructions issued per VFU and the VLSU bytes.
+*/
+void perf_counters_print(const perf_counters_t* s);
+
+#endif
@@ -0,0 +1,107 @@
+#ifndef _TRACE_H_
+#define _TRACE_H_
+
+/*
+ * File      : trace.h
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Binary event trace. trace_event() writes a fixed size
+ * (cycle, id, arg) record into a ring buffer reserved in the .l2 section of
+ * link.ld. It takes a few instructions and never prints, so it can be used in
+ * interrupt handlers and around timed kernels. The buffer is read after the
+ * run from a memory dump or drained over the UART by trace_drain(), and
+ * tools/trace_decode.py turns either into a timeline.
+ *
+ * Tracing is compiled in with TRACE=1 (-DTRACE_ENABLE), otherwise the
+ * trace_event() calls compile to nothing.
+ *
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+//! "TRCE", marks the trace header in a memory dump
+#define TRACE_MAGIC           0x45435254u
+//! Number of records of the ring buffer, a power of two. The .l2 reserve of
+//! link.ld (trace_buffer_size) must hold TRACE_RECORDS * 16 bytes.
+#define TRACE_RECORDS         1024u
+
+#define TRACE_RECORD_TAG      "@trace"
+
+/*
+ * Event ids. trace_decode.py takes the event names from the TRACE_EV_
+ * defines below, ids from TRACE_EV_USER on are free for tests.
+ */
+#define TRACE_EV_TRAP_ENTER    0x01 // arg: mcause id, bit 31 set for interrupts
+#define TRACE_EV_TRAP_EXIT     0x02 // arg: as TRAP_ENTER, interrupts only
+#define TRACE_EV_PLIC_CLAIM    0x03 // arg: claimed PLIC source
+#define TRACE_EV_KERNEL_ENTER  0x10 // arg: kernel index
+#define TRACE_EV_KERNEL_EXIT   0x11 // arg: kernel index
+#define TRACE_EV_CLINT_SET     0x20 // arg: low 32 bits of mtimecmp
+#define TRACE_EV_TIMER_ENABLE  0x21 // arg: APB timer compare value
+#define TRACE_EV_TIMER_DISABLE 0x22
+#define TRACE_EV_QSPI_START    0x23 // arg: QSPI status register
+#define TRACE_EV_QSPI_IDLE     0x24
+#define TRACE_EV_USER          0x100
+
+typedef struct {
+  uint64_t cycle;
+  uint32_t id;
+  uint32_t arg;
+} trace_record_t;
+
+//! Trace header. head counts all events, the buffer keeps the last
+//! TRACE_RECORDS of them at head modulo TRACE_RECORDS.
+typedef struct {
+  uint32_t        magic;
+  uint32_t        records;
+  trace_record_t* buffer;
+  uint64_t        head;
+} trace_log_t;
+
+extern trace_log_t    trace_log;
+extern trace_record_t trace_buffer [];
+
+/*********************
+*Function definitions*
+**********************/
+
+/*
+@brief Writes one event record. Interrupts are masked for the few
+    instructions of the write so handlers can trace as well.
+@param id - event id, one of the TRACE_EV_* values
+@param arg - event argument
+*/
+static inline void trace_event(uint32_t id, uint32_t arg) {
+#ifdef TRACE_ENABLE
+  uint64_t mstatus, cycle;
+
+  asm volatile("csrrci %0, mstatus, 8" : "=r"(mstatus) :: "memory");
+  asm volatile("rdcycle %0" : "=r"(cycle));
+
+  trace_record_t* r = &trace_buffer[trace_log.head++ & (TRACE_RECORDS - 1)];
+  r->cycle = cycle;
+  r->id    = id;
+  r->arg   = arg;
+
+  asm volatile("csrs mstatus, %0" :: "r"(mstatus & 8) : "memory");
+#else
+  (void)id;
+  (void)arg;
+#endif
+}
+
+/*
+@brief Empties the trace.
+*/
+void trace_reset(void);
+
+/*
+@brief Prints the header and the buffered records, oldest first, as
+    @trace records for trace_decode.py:
+    @trace,head,<events>,<records>
+    @trace,<cycle>,<id>,<arg>
+*/
+void trace_drain(void);
+
+#endif
@@ -0,0 +1,445 @@
+/*
+ * File      : aes_ct64.c
+ * Test      : aes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Bitsliced constant-time AES on 64-bit words. Bit b of the
+ * state bytes of AES_CT64_BLOCKS blocks lives in q[b], at bit position
+ * 16 * row + 4 * column + block, so ShiftRows rotates 16-bit lanes and
+ * MixColumns rotates whole words. The S-box is the Boyar-Peralta circuit.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/aes/api_aes_ct64.h"
+
+#define SWAPN(cl, ch, s, x, y) do {                         \
+    uint64_t a_ = (x), b_ = (y);                            \
+    (x) = (a_ & (uint64_t)(cl)) | ((b_ & (uint64_t)(cl)) << (s));  \
+    (y) = ((a_ & (uint64_t)(ch)) >> (s)) | (b_ & (uint64_t)(ch));  \
+  } while (0)
+
+#define SWAP2(x, y)  SWAPN(0x5555555555555555, 0xAAAAAAAAAAAAAAAA, 1, x, y)
+#define SWAP4(x, y)  SWAPN(0x3333333333333333, 0xCCCCCCCCCCCCCCCC, 2, x, y)
+#define SWAP8(x, y)  SWAPN(0x0F0F0F0F0F0F0F0F, 0xF0F0F0F0F0F0F0F0, 4, x, y)
+
+// 8x8 bit transpose across the eight words, its own inverse
+static void ct64_ortho(uint64_t q[8]) {
+  SWAP2(q[0], q[1]); SWAP2(q[2], q[3]); SWAP2(q[4], q[5]); SWAP2(q[6], q[7]);
+  SWAP4(q[0], q[2]); SWAP4(q[1], q[3]); SWAP4(q[4], q[6]); SWAP4(q[5], q[7]);
+  SWAP8(q[0], q[4]); SWAP8(q[1], q[5]); SWAP8(q[2], q[6]); SWAP8(q[3], q[7]);
+}
+
+// spread the four column words of one block over two words, 16 bits apart
+static void ct64_interleave_in(uint64_t* q0, uint64_t* q1, const uint32_t w[4]) {
+  uint64_t x0 = w[0], x1 = w[1], x2 = w[2], x3 = w[3];
+
+  x0 |= x0 << 16; x1 |= x1 << 16; x2 |= x2 << 16; x3 |= x3 << 16;
+  x0 &= 0x0000FFFF0000FFFF; x1 &= 0x0000FFFF0000FFFF;
+  x2 &= 0x0000FFFF0000FFFF; x3 &= 0x0000FFFF0000FFFF;
+  x0 |= x0 << 8; x1 |= x1 << 8; x2 |= x2 << 8; x3 |= x3 << 8;
+  x0 &= 0x00FF00FF00FF00FF; x1 &= 0x00FF00FF00FF00FF;
+  x2 &= 0x00FF00FF00FF00FF; x3 &= 0x00FF00FF00FF00FF;
+
+  *q0 = x0 | (x2 << 8);
+  *q1 = x1 | (x3 << 8);
+}
+
+static void ct64_interleave_out(uint32_t w[4], uint64_t q0, uint64_t q1) {
+  uint64_t x0 = q0 & 0x00FF00FF00FF00FF;
+  uint64_t x1 = q1 & 0x00FF00FF00FF00FF;
+  uint64_t x2 = (q0 >> 8) & 0x00FF00FF00FF00FF;
+  uint64_t x3 = (q1 >> 8) & 0x00FF00FF00FF00FF;
+
+  x0 |= x0 >> 8; x1 |= x1 >> 8; x2 |= x2 >> 8; x3 |= x3 >> 8;
+  x0 &= 0x0000FFFF0000FFFF; x1 &= 0x0000FFFF0000FFFF;
+  x2 &= 0x0000FFFF0000FFFF; x3 &= 0x0000FFFF0000FFFF;
+
+  w[0] = (uint32_t)x0 | (uint32_t)(x0 >> 16);
+  w[1] = (uint32_t)x1 | (uint32_t)(x1 >> 16);
+  w[2] = (uint32_t)x2 | (uint32_t)(x2 >> 16);
+  w[3] = (uint32_t)x3 | (uint32_t)(x3 >> 16);
+}
+
+// w holds AES_CT64_BLOCKS blocks as little-endian column words
+static void ct64_load(uint64_t q[8], const uint32_t w[4 * AES_CT64_BLOCKS]) {
+  for (int i = 0; i < AES_CT64_BLOCKS; i++) {
+    ct64_interleave_in(&q[i], &q[i + 4], w + 4 * i);
+  }
+  ct64_ortho(q);
+}
+
+static void ct64_store(uint32_t w[4 * AES_CT64_BLOCKS], uint64_t q[8]) {
+  ct64_ortho(q);
+  for (int i = 0; i < AES_CT64_BLOCKS; i++) {
+    ct64_interleave_out(w + 4 * i, q[i], q[i + 4]);
+  }
+}
+
+// Boyar-Peralta S-box circuit, 113 gates
+static void ct64_sbox(uint64_t q[8]) {
+  uint64_t x0, x1, x2, x3, x4, x5, x6, x7;
+  uint64_t y1, y2, y3, y4, y5, y6, y7, y8, y9;
+  uint64_t y10, y11, y12, y13, y14, y15, y16, y17, y18, y19;
+  uint64_t y20, y21;
+  uint64_t z0, z1, z2, z3, z4, z5, z6, z7, z8, z9;
+  uint64_t z10, z11, z12, z13, z14, z15, z16, z17;
+  uint64_t t0, t1, t2, t3, t4, t5, t6, t7, t8, t9;
+  uint64_t t10, t11, t12, t13, t14, t15, t16, t17, t18, t19;
+  uint64_t t20, t21, t22, t23, t24, t25, t26, t27, t28, t29;
+  uint64_t t30, t31, t32, t33, t34, t35, t36, t37, t38, t39;
+  uint64_t t40, t41, t42, t43, t44, t45, t46, t47, t48, t49;
+  uint64_t t50, t51, t52, t53, t54, t55, t56, t57, t58, t59;
+  uint64_t t60, t61, t62, t63, t64, t65, t66, t67;
+  uint64_t s0, s1, s2, s3, s4, s5, s6, s7;
+
+  x0 = q[7]; x1 = q[6]; x2 = q[5]; x3 = q[4];
+  x4 = q[3]; x5 = q[2]; x6 = q[1]; x7 = q[0];
+
+  // top linear transformation
+  y14 = x3 ^ x5;
+  y13 = x0 ^ x6;
+  y9  = x0 ^ x3;
+  y8  = x0 ^ x5;
+  t0  = x1 ^ x2;
+  y1  = t0 ^ x7;
+  y4  = y1 ^ x3;
+  y12 = y13 ^ y14;
+  y2  = y1 ^ x0;
+  y5  = y1 ^ x6;
+  y3  = y5 ^ y8;
+  t1  = x4 ^ y12;
+  y15 = t1 ^ x5;
+  y20 = t1 ^ x1;
+  y6  = y15 ^ x7;
+  y10 = y15 ^ t0;
+  y11 = y20 ^ y9;
+  y7  = x7 ^ y11;
+  y17 = y10 ^ y11;
+  y19 = y10 ^ y8;
+  y16 = t0 ^ y11;
+  y21 = y13 ^ y16;
+  y18 = x0 ^ y16;
+
+  // non-linear section
+  t2  = y12 & y15;
+  t3  = y3 & y6;
+  t4  = t3 ^ t2;
+  t5  = y4 & x7;
+  t6  = t5 ^ t2;
+  t7  = y13 & y16;
+  t8  = y5 & y1;
+  t9  = t8 ^ t7;
+  t10 = y2 & y7;
+  t11 = t10 ^ t7;
+  t12 = y9 & y11;
+  t13 = y14 & y17;
+  t14 = t13 ^ t12;
+  t15 = y8 & y10;
+  t16 = t15 ^ t12;
+  t17 = t4 ^ t14;
+  t18 = t6 ^ t16;
+  t19 = t9 ^ t14;
+  t20 = t11 ^ t16;
+  t21 = t17 ^ y20;
+  t22 = t18 ^ y19;
+  t23 = t19 ^ y21;
+  t24 = t20 ^ y18;
+
+  t25 = t21 ^ t22;
+  t26 = t21 & t23;
+  t27 = t24 ^ t26;
+  t28 = t25 & t27;
+  t29 = t28 ^ t22;
+  t30 = t23 ^ t24;
+  t31 = t22 ^ t26;
+  t32 = t31 & t30;
+  t33 = t32 ^ t24;
+  t34 = t23 ^ t33;
+  t35 = t27 ^ t33;
+  t36 = t24 & t35;
+  t37 = t36 ^ t34;
+  t38 = t27 ^ t36;
+  t39 = t29 & t38;
+  t40 = t25 ^ t39;
+
+  t41 = t40 ^ t37;
+  t42 = t29 ^ t33;
+  t43 = t29 ^ t40;
+  t44 = t33 ^ t37;
+  t45 = t42 ^ t41;
+  z0  = t44 & y15;
+  z1  = t37 & y6;
+  z2  = t33 & x7;
+  z3  = t43 & y16;
+  z4  = t40 & y1;
+  z5  = t29 & y7;
+  z6  = t42 & y11;
+  z7  = t45 & y17;
+  z8  = t41 & y10;
+  z9  = t44 & y12;
+  z10 = t37 & y3;
+  z11 = t33 & y4;
+  z12 = t43 & y13;
+  z13 = t40 & y5;
+  z14 = t29 & y2;
+  z15 = t42 & y9;
+  z16 = t45 & y14;
+  z17 = t41 & y8;
+
+  // bottom linear transformation
+  t46 = z15 ^ z16;
+  t47 = z10 ^ z11;
+  t48 = z5 ^ z13;
+  t49 = z9 ^ z10;
+  t50 = z2 ^ z12;
+  t51 = z2 ^ z5;
+  t52 = z7 ^ z8;
+  t53 = z0 ^ z3;
+  t54 = z6 ^ z7;
+  t55 = z16 ^ z17;
+  t56 = z12 ^ t48;
+  t57 = t50 ^ t53;
+  t58 = z4 ^ t46;
+  t59 = z3 ^ t54;
+  t60 = t46 ^ t57;
+  t61 = z14 ^ t57;
+  t62 = t52 ^ t58;
+  t63 = t49 ^ t58;
+  t64 = z4 ^ t59;
+  t65 = t61 ^ t62;
+  t66 = z1 ^ t63;
+  s0  = t59 ^ t63;
+  s6  = t56 ^ ~t62;
+  s7  = t48 ^ ~t60;
+  t67 = t64 ^ t65;
+  s3  = t53 ^ t66;
+  s4  = t51 ^ t66;
+  s5  = t47 ^ t65;
+  s1  = t64 ^ ~s3;
+  s2  = t55 ^ ~t67;
+
+  q[7] = s0; q[6] = s1; q[5] = s2; q[4] = s3;
+  q[3] = s4; q[2] = s5; q[1] = s6; q[0] = s7;
+}
+
+// inverse S-box: the forward circuit between two inverse affine maps
+static void ct64_inv_affine(uint64_t q[8]) {
+  uint64_t q0 = ~q[0], q1 = ~q[1], q2 = q[2], q3 = q[3];
+  uint64_t q4 = q[4], q5 = ~q[5], q6 = ~q[6], q7 = q[7];
+
+  q[7] = q1 ^ q4 ^ q6;
+  q[6] = q0 ^ q3 ^ q5;
+  q[5] = q7 ^ q2 ^ q4;
+  q[4] = q6 ^ q1 ^ q3;
+  q[3] = q5 ^ q0 ^ q2;
+  q[2] = q4 ^ q7 ^ q1;
+  q[1] = q3 ^ q6 ^ q0;
+  q[0] = q2 ^ q5 ^ q7;
+}
+
+static void ct64_inv_sbox(uint64_t q[8]) {
+  ct64_inv_affine(q);
+  ct64_sbox(q);
+  ct64_inv_affine(q);
+}
+
+static void ct64_shift_rows(uint64_t q[8]) {
+  for (int i = 0; i < 8; i++) {
+    uint64_t x = q[i];
+    q[i] = (x & 0x000000000000FFFF)
+         | ((x & 0x00000000FFF00000) >> 4)
+         | ((x & 0x00000000000F0000) << 12)
+         | ((x & 0x0000FF0000000000) >> 8)
+         | ((x & 0x000000FF00000000) << 8)
+         | ((x & 0xF000000000000000) >> 12)
+         | ((x & 0x0FFF000000000000) << 4);
+  }
+}
+
+static void ct64_inv_shift_rows(uint64_t q[8]) {
+  for (int i = 0; i < 8; i++) {
+    uint64_t x = q[i];
+    q[i] = (x & 0x000000000000FFFF)
+         | ((x & 0x000000000FFF0000) << 4)
+         | ((x & 0x00000000F0000000) >> 12)
+         | ((x & 0x0000FF0000000000) >> 8)
+         | ((x & 0x000000FF00000000) << 8)
+         | ((x & 0x000F000000000000) << 12)
+         | ((x & 0xFFF0000000000000) >> 4);
+  }
+}
+
+static inline uint64_t ct64_rotr32(uint64_t x) {
+  return (x << 32) | (x >> 32);
+}
+
+/*
+ * Rotating a word by 16 bits moves row r + 1 onto row r, so with
+ * r = rotr16(q) the column is 2 * (q ^ r) ^ r ^ rotr32(q ^ r).
+ */
+static void ct64_mix_columns(uint64_t q[8]) {
+  uint64_t r [8];
+  uint64_t t [8];
+
+  for (int i = 0; i < 8; i++) {
+    r[i] = (q[i] >> 16) | (q[i] << 48);
+    t[i] = q[i] ^ r[i];
+  }
+
+  q[0] = t[7]        ^ r[0] ^ ct64_rotr32(t[0]);
+  q[1] = t[0] ^ t[7] ^ r[1] ^ ct64_rotr32(t[1]);
+  q[2] = t[1]        ^ r[2] ^ ct64_rotr32(t[2]);
+  q[3] = t[2] ^ t[7] ^ r[3] ^ ct64_rotr32(t[3]);
+  q[4] = t[3] ^ t[7] ^ r[4] ^ ct64_rotr32(t[4]);
+  q[5] = t[4]        ^ r[5] ^ ct64_rotr32(t[5]);
+  q[6] = t[5]        ^ r[6] ^ ct64_rotr32(t[6]);
+  q[7] = t[6]        ^ r[7] ^ ct64_rotr32(t[7]);
+}
+
+/*
+ * InvMixColumns is MixColumns after the circulant (05, 00, 04, 00), i.e.
+ * q ^= 4 * (q ^ rotr32(q)).
+ */
+static void ct64_inv_mix_columns(uint64_t q[8]) {
+  uint64_t t [8];
+  uint64_t u [8];
+
+  for (int i = 0; i < 8; i++) {
+    t[i] = q[i] ^ ct64_rotr32(q[i]);
+  }
+  for (int k = 0; k < 2; k++) {
+    u[0] = t[7];
+    u[1] = t[0] ^ t[7];
+    u[2] = t[1];
+    u[3] = t[2] ^ t[7];
+    u[4] = t[3] ^ t[7];
+    u[5] = t[4];
+    u[6] = t[5];
+    u[7] = t[6];
+    memcpy(t, u, sizeof(t));
+  }
+  for (int i = 0; i < 8; i++) {
+    q[i] ^= t[i];
+  }
+
+  ct64_mix_columns(q);
+}
+
+static inline void ct64_add_round_key(uint64_t q[8], const uint64_t sk[8]) {
+  for (int i = 0; i < 8; i++) {
+    q[i] ^= sk[i];
+  }
+}
+
+static uint32_t ct64_sub_word(uint32_t x) {
+  uint32_t w [4 * AES_CT64_BLOCKS] = {x};
+  uint64_t q [8];
+
+  ct64_load(q, w);
+  ct64_sbox(q);
+  ct64_store(w, q);
+  return w[0];
+}
+
+int aes_ct64_key_init(aes_ct64_key_t* k, const uint8_t* key, size_t key_bits) {
+  uint32_t w   [4 * (AES_256_NR + 1)];
+  uint32_t blk [4 * AES_CT64_BLOCKS];
+  uint32_t nk;
+  uint8_t  rcon = 0x01;
+
+  switch (key_bits) {
+    case 128: nk = 4; break;
+    case 192: nk = 6; break;
+    case 256: nk = 8; break;
+    default : return AES_CT64_ERR_KEY;
+  }
+  k->nr = nk + 6;
+
+  memcpy(w, key, 4 * nk);
+  for (uint32_t i = nk; i < 4 * (k->nr + 1); i++) {
+    uint32_t t = w[i - 1];
+    if (i % nk == 0) {
+      t = ct64_sub_word((t >> 8) | (t << 24)) ^ rcon;
+      rcon = (uint8_t)((rcon << 1) ^ (0x1b & -(rcon >> 7)));
+    } else if (nk > 6 && i % nk == 4) {
+      t = ct64_sub_word(t);
+    }
+    w[i] = w[i - nk] ^ t;
+  }
+
+  // the same round key for every block of a pass
+  for (uint32_t r = 0; r <= k->nr; r++) {
+    for (int b = 0; b < AES_CT64_BLOCKS; b++) {
+      memcpy(blk + 4 * b, w + 4 * r, AES_BLOCK_BYTES);
+    }
+    ct64_load(k->sk + 8 * r, blk);
+  }
+
+  return AES_CT64_OK;
+}
+
+static void ct64_encrypt_pass(const aes_ct64_key_t* k, uint64_t q[8]) {
+  const uint64_t* sk = k->sk;
+
+  ct64_add_round_key(q, sk);
+  for (uint32_t r = 1; r < k->nr; r++) {
+    ct64_sbox(q);
+    ct64_shift_rows(q);
+    ct64_mix_columns(q);
+    ct64_add_round_key(q, sk + 8 * r);
+  }
+  ct64_sbox(q);
+  ct64_shift_rows(q);
+  ct64_add_round_key(q, sk + 8 * k->nr);
+}
+
+static void ct64_decrypt_pass(const aes_ct64_key_t* k, uint64_t q[8]) {
+  const uint64_t* sk = k->sk;
+
+  ct64_add_round_key(q, sk + 8 * k->nr);
+  for (uint32_t r = k->nr - 1; r > 0; r--) {
+    ct64_inv_shift_rows(q);
+    ct64_inv_sbox(q);
+    ct64_add_round_key(q, sk + 8 * r);
+    ct64_inv_mix_columns(q);
+  }
+  ct64_inv_shift_rows(q);
+  ct64_inv_sbox(q);
+  ct64_add_round_key(q, sk);
+}
+
+static void ct64_blocks(const aes_ct64_key_t* k, uint8_t* out, const uint8_t* in,
+                        size_t n, int decrypt) {
+  uint32_t w [4 * AES_CT64_BLOCKS];
+  uint64_t q [8];
+
+  while (n > 0) {
+    size_t c = n < AES_CT64_BLOCKS ? n : AES_CT64_BLOCKS;
+    size_t bytes = c * AES_BLOCK_BYTES;
+
+    memset(w, 0, sizeof(w));
+    memcpy(w, in, bytes);
+    ct64_load(q, w);
+    if (decrypt) {
+      ct64_decrypt_pass(k, q);
+    } else {
+      ct64_encrypt_pass(k, q);
+    }
+    ct64_store(w, q);
+    memcpy(out, w, bytes);
+
+    in  += bytes;
+    out += bytes;
+    n   -= c;
+  }
+}
+
+void aes_ct64_encrypt(const aes_ct64_key_t* k, uint8_t* out, const uint8_t* in, size_t n) {
+  ct64_blocks(k, out, in, n, 0);
+}
+
+void aes_ct64_decrypt(const aes_ct64_key_t* k, uint8_t* out, const uint8_t* in, size_t n) {
+  ct64_blocks(k, out, in, n, 1);
+}
@@ -60,6 +60,17 @@
 #   In such cases the replication of values across element groups
 #   will not be occurring.
 #
+# (III) Byte loads on Ara
+#   Keys and text are loaded with vle8.v, so a register holds them in
+#   Ara's EEW=8 lane layout. The dispatcher only reshuffles a register to
+#   a new EEW for in-lane arithmetic, and the crypto unit reads its
+#   operands with the current SEW, so a Zvkned instruction would see the
+#   bytes in the wrong order. Each byte load is followed, at e32, by a
+#   "vmv.v.v vX, vX" (or by the round key vxor.vv of the ".vv" routines),
+#   which lets the dispatcher move the register to the EEW=32 layout.
+#   Stores read the layout the register was written with and need no
+#   such pass.
+#
 
 .text
 
@@ -74,8 +85,9 @@
 #
 # The key is provided at 'key', and the expansion written at 'dest_key'.
 #
-# 'key' and 'dest_key' should be 4-bytes aligned if the target processor
-# does not support unaligned vle32/vse32 vector accesses.
+# 'key' may have any alignment, it is read with byte loads. 'dest_key'
+# should be 4-bytes aligned if the target processor does not support
+# unaligned vse32 vector accesses.
 #
 # Note that there isn't much room to reduce repetitions in this routine
 # since we can't use a scalar register to indicate the round number.
@@ -106,8 +118,12 @@ zvkned_aes128_expand_key:
     # be beneficial to use more registers push stores further from
     # the key schedule logic.
 
-    # Load user key from `key`, all 16B at once
-    vle32.v v4, (a1)
+    # Load user key from `key`, all 16B at once, with byte loads as the
+    # key needs no particular alignment.
+    vsetivli x0, 16, e8, m4, ta, ma
+    vle8.v v4, (a1)
+    vsetivli x0, 4, e32, m4, ta, ma
+    vmv.v.v v4, v4  # to the EEW=32 layout, see note (III)
     # v4 contains the evolving key state during expansion.
 
     # Initial word, copy the input key.
@@ -165,8 +181,9 @@ zvkned_aes128_expand_key:
 #
 # The key is provided at 'key', and the expansion written at 'dest_key'.
 #
-# 'key' and 'dest_key' should be 8-bytes aligned if the target processor
-# does not support unaligned vle64/vse64 vector accesses.
+# 'key' may have any alignment, it is read with byte loads. 'dest_key'
+# should be 4-bytes aligned if the target processor does not support
+# unaligned vse32 vector accesses.
 #
 # C/C++ Signature
 #   extern "C" void
@@ -187,11 +204,16 @@ zvkned_aes256_expand_key:
     # x0 is not written, we known the number of vector elements, 2.
     vsetivli x0, 4, e32, m4, ta, ma   # Vectors of 4B
 
-    # Load user key from `key`, all 16B at once
-    vle32.v v4, (a1)
+    # Load user key from `key`, 16B at a time, with byte loads as the
+    # key needs no particular alignment.
+    vsetivli x0, 16, e8, m4, ta, ma
+    vle8.v v4, (a1)
     addi a1, a1, 16
-    vle32.v v8, (a1)
+    vle8.v v8, (a1)
     addi a1, a1, 16
+    vsetivli x0, 4, e32, m4, ta, ma
+    vmv.v.v v4, v4  # to the EEW=32 layout, see note (III)
+    vmv.v.v v8, v8  # to the EEW=32 layout, see note (III)
 
     # v4 and v8 contain the evolving key state during expansion,
     # alternating holding key[i] and key[i-1] as inputs to vaesfk.
@@ -339,7 +361,12 @@ zvkned_aes128_encode_vs_lmul1:
     vsetvli t2, t3, e32, m1, ta, ma   # Vectors of 4B
 
     # Load plain text from `src`, a full vector of 4B elements at a time.
-    vle32.v v1, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
+    vmv.v.v v1, v1  # to the EEW=32 layout, see note (III)
 
     # Initial AddRoundKey
     vaesz.vs v1, v10   # with round key w[ 0, 4]
@@ -361,7 +388,8 @@ zvkned_aes128_encode_vs_lmul1:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v1, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -443,7 +471,12 @@ zvkned_aes128_encode_vs_lmul2:
     vsetvli t2, t3, e32, m2, ta, ma   # Vectors of 8b
 
     # Load plain text from `src`.
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m2, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m2, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial AddRoundKey
     vaesz.vs  v0,  v2   # with round key w[ 0, 4]
@@ -465,7 +498,8 @@ zvkned_aes128_encode_vs_lmul2:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m2, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -523,7 +557,12 @@ zvkned_aes128_encode_vs_lmul4:
     vsetvli t2, t3, e32, m8, ta, ma   # Vectors of 4B
 
     # Load plain text from `src`.
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m8, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m8, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial AddRoundKey
     vaesz.vs v0, v16   # with round key w[ 0, 4]
@@ -556,7 +595,8 @@ zvkned_aes128_encode_vs_lmul4:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m8, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -718,7 +758,11 @@ zvkned_aes128_encode_vv_lmul1:
     vsetvli t2, t3, e32, m1, ta, ma   # Vectors of 4B
 
     # Load plain text from `src`, 4B(*4) at a time
-    vle32.v v1, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
 
     # Initial AddRoundKey
     vxor.vv v1, v1, v10   # with round key w[ 0, 4]
@@ -740,7 +784,8 @@ zvkned_aes128_encode_vv_lmul1:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v1, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -836,7 +881,12 @@ zvkned_aes128_decode_vs_lmul1:
     # v10-v20 contain the 11 per-round keys.
 
     # Load cipher text from `src`, one vector full at a time.
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial round, AddRoundKey
     vaesz.vs v0, v22  # with round key w[43,47]
@@ -858,7 +908,8 @@ zvkned_aes128_decode_vs_lmul1:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2  # Decrement count (4B elements)
@@ -928,7 +979,12 @@ zvkned_aes128_decode_vs_lmul2:
     # v10-v20 contain the 11 per-round keys.
 
     # Load cipher text from `src`, one vector full at a time.
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m2, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m2, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial round, AddRoundKey
     vaesz.vs v0, v22  # with round key w[43,47]
@@ -950,7 +1006,8 @@ zvkned_aes128_decode_vs_lmul2:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m2, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2  # Decrement count (4B elements)
@@ -1065,7 +1122,11 @@ zvkned_aes128_decode_vv_lmul1:
     # v10-v20 contain the 11 per-round keys.
 
     # Load cipher text from `src`, one vector full at a time.
-    vle32.v v1, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
 
     # Initial round, AddRoundKey
     vxor.vv v1, v1, v20  # with round key w[43,47]
@@ -1087,7 +1148,8 @@ zvkned_aes128_decode_vv_lmul1:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v1, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2  # Decrement count (4B elements)
@@ -1182,7 +1244,12 @@ zvkned_aes256_encode_vs_lmul1:
 
     # v0 contains the text (from clear to cipher)
     # Load plain text from `src`, 4B(*4) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Round 0, Initial AddRoundKey of w[0, 3]
     vaesz.vs v0, v10
@@ -1207,7 +1274,8 @@ zvkned_aes256_encode_vs_lmul1:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v0, (a0)
     # ret # Test a single write
 
     # t2 contains the number of 32b/4B elements processed
@@ -1306,7 +1374,12 @@ zvkned_aes256_encode_vs_lmul2:
 
     # v0 contains the text (from clear to cipher)
     # Load plain text from `src`, 8B(*2) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m2, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m2, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Round 0, Initial AddRoundKey of w[0, 3]
     vaesz.vs v0, v2
@@ -1331,7 +1404,8 @@ zvkned_aes256_encode_vs_lmul2:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m2, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -1400,7 +1474,12 @@ zvkned_aes256_encode_vs_lmul4:
     vsetvli t2, t3, e32, m4, ta, ma   # Vectors of 4b
 
     # Load plain text from `src`.
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m4, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m4, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     vmv.v.v v24, v16  # v20 <- w[ 0,  4]
     vmv.v.v v28, v20  # v28 <- w[ 4,  7]
@@ -1442,7 +1521,8 @@ zvkned_aes256_encode_vs_lmul4:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m4, ta, ma
+    vse8.v v0, (a0)
 
     # t2 contains the number of 32b/4B elements processed
     sub t3, t3, t2              # Decrement count (4B elements)
@@ -1631,7 +1711,11 @@ zvkned_aes256_encode_vv_lmul1:
 
     # v0 contains the text (from clear to cipher)
     # Load plain text from `src`, 4B(*4) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
 
     # Round 0, Initial AddRoundKey of w[0, 3]
     vxor.vv v0, v0, v10
@@ -1656,7 +1740,8 @@ zvkned_aes256_encode_vv_lmul1:
 
     # Store cypher test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v0, (a0)
     # ret # Test a single write
 
     # t2 contains the number of 32b/4B elements processed
@@ -1756,7 +1841,12 @@ zvkned_aes256_decode_vs_lmul1:
     # v10-v24 contain the 15 per-round keys.
 
     # Load cipher text from `src`, 8B(*2) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial round, AddRoundKey
     vaesz.vs v0, v30  # with round key w[56,59]
@@ -1782,7 +1872,8 @@ zvkned_aes256_decode_vs_lmul1:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v0, (a0)
     # ret # Test a single write
 
     # t2 contains the number of 32b/4B elements processed
@@ -1878,7 +1969,12 @@ zvkned_aes256_decode_vs_lmul2:
     # v10-v24 contain the 15 per-round keys.
 
     # Load cipher text from `src`, 8B(*2) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m2, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m2, ta, ma
+    vmv.v.v v0, v0  # to the EEW=32 layout, see note (III)
 
     # Initial round, AddRoundKey
     vaesz.vs v0, v30  # with round key w[56,59]
@@ -1904,7 +2000,8 @@ zvkned_aes256_decode_vs_lmul2:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m2, ta, ma
+    vse8.v v0, (a0)
     # ret # Test a single write
 
     # t2 contains the number of 32b/4B elements processed
@@ -2059,7 +2156,11 @@ zvkned_aes256_decode_vv_lmul1:
     # v10-v24 contain the 15 per-round keys.
 
     # Load cipher text from `src`, 8B(*2) at a time
-    vle32.v v0, (a1)
+    # Byte loads and stores, src and dest need no particular alignment.
+    slli t4, t2, 2
+    vsetvli x0, t4, e8, m1, ta, ma
+    vle8.v v0, (a1)
+    vsetvli x0, t2, e32, m1, ta, ma
 
     # Initial round, AddRoundKey
     vxor.vv v0, v0, v24  # with round key w[56,59]
@@ -2085,7 +2186,8 @@ zvkned_aes256_decode_vv_lmul1:
 
     # Store clear test
     # a0 is the destination (updated)
-    vse32.v v0, (a0)
+    vsetvli x0, t4, e8, m1, ta, ma
+    vse8.v v0, (a0)
     # ret # Test a single write
 
     # t2 contains the number of 32b/4B elements processed
@@ -0,0 +1,54 @@
+/*
+ * File      : zvkned_iov.c
+ * Test      : aes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Scatter-gather AES-128/256 on top of the zvkned kernels.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/zvkned.h"
+
+// adapt the kernels to crypto_iov_ecb_fn
+
+static void aes128_enc(void* dest, const void* src, uint64_t n, const void* rk) {
+  zvkned_aes128_encode_vs_lmul4(dest, src, n, rk);
+}
+
+static void aes128_dec(void* dest, const void* src, uint64_t n, const void* rk) {
+  zvkned_aes128_decode_vs_lmul2(dest, src, n, rk);
+}
+
+static void aes256_enc(void* dest, const void* src, uint64_t n, const void* rk) {
+  zvkned_aes256_encode_vs_lmul4(dest, src, n, rk);
+}
+
+static void aes256_dec(void* dest, const void* src, uint64_t n, const void* rk) {
+  zvkned_aes256_decode_vs_lmul2(dest, src, n, rk);
+}
+
+int zvkned_aes128_encode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                             const crypto_iovec_t* src, size_t src_cnt,
+                             const uint32_t* expanded_key) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, AES_BLOCK_BYTES, aes128_enc, expanded_key);
+}
+
+int zvkned_aes128_decode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                             const crypto_iovec_t* src, size_t src_cnt,
+                             const uint32_t* expanded_key) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, AES_BLOCK_BYTES, aes128_dec, expanded_key);
+}
+
+int zvkned_aes256_encode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                             const crypto_iovec_t* src, size_t src_cnt,
+                             const uint32_t* expanded_key) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, AES_BLOCK_BYTES, aes256_enc, expanded_key);
+}
+
+int zvkned_aes256_decode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                             const crypto_iovec_t* src, size_t src_cnt,
+                             const uint32_t* expanded_key) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, AES_BLOCK_BYTES, aes256_dec, expanded_key);
+}
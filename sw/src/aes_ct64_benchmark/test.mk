@@ -0,0 +1,7 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  aes_benchmark/aes_enc.c \
+  aes_benchmark/aes_ct64.c \
+  aes_benchmark/zvkned.s \
+  aes_modes_benchmark/aes_vec.c \
+  aes_modes_benchmark/aes_dispatch.c
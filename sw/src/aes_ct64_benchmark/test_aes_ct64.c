@@ -0,0 +1,290 @@
+/*
+ * File      : test_aes_ct64.c
+ * Test      : aes_ct64_benchmark
+ * Date      : 19-oct-2026
+ * Description: Bitsliced scalar AES against the byte-wise reference and the
+ * Zvkned blocks, for requests of 1 to 16 blocks, and the ECB dispatch
+ * between them. Also times a short request issued right behind a long
+ * vector request, on either tier.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/api_aes_ct64.h"
+#include "crypto/aes/api_aes_modes.h"
+
+#define CT64_SIZES         5
+#define CT64_MAX_BLOCKS    16
+#define CT64_CHECK_BLOCKS  37
+#define CT64_BULK_BLOCKS   64
+
+static const size_t ct64_sizes [CT64_SIZES] = { 1, 2, 4, 8, 16 };
+
+typedef struct {
+  perf_log_t reference [CT64_SIZES];
+  perf_log_t ct64      [CT64_SIZES];
+  perf_log_t vector    [CT64_SIZES];
+  perf_log_t dispatch  [CT64_SIZES];
+  perf_log_t tail_ct64;
+  perf_log_t tail_vector;
+} aes_ct64_perf_log_t;
+
+static aes_ct64_perf_log_t perf_log = {0};
+
+// FIPS-197 appendix C
+static const uint8_t fips_pt [AES_BLOCK_BYTES] = {
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77,
+  0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+
+static const uint8_t fips_ct [3][AES_BLOCK_BYTES] = {
+  { 0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a },
+  { 0xdd, 0xa9, 0x7c, 0xa4, 0x86, 0x4c, 0xdf, 0xe0,
+    0x6e, 0xaf, 0x70, 0xa0, 0xec, 0x0d, 0x71, 0x91 },
+  { 0x8e, 0xa2, 0xb7, 0xca, 0x51, 0x67, 0x45, 0xbf,
+    0xea, 0xfc, 0x49, 0x90, 0x4b, 0x49, 0x60, 0x89 }
+};
+
+static uint8_t key [AES_256_KEY_BYTES];
+
+static uint32_t pt  [CT64_BULK_BLOCKS][4];
+static uint32_t ct  [3][CT64_BULK_BLOCKS][4];
+static uint32_t vec [CT64_BULK_BLOCKS][4];
+static uint32_t rk  [AES_128_RK_WORDS];
+
+static aes_ct64_key_t     ct64_key;
+static aes_dispatch_key_t disp_key;
+
+static uint32_t test_vectors(void) {
+  const size_t bits [3] = { 128, 192, 256 };
+  uint32_t fail = 0;
+  uint8_t  out [AES_BLOCK_BYTES];
+
+  for (int v = 0; v < 3; v++) {
+    aes_ct64_key_init(&ct64_key, key, bits[v]);
+    aes_ct64_encrypt(&ct64_key, out, fips_pt, 1);
+    if (memcmp(out, fips_ct[v], AES_BLOCK_BYTES)) {
+      printf("# AES-%lu: wrong ciphertext!\n", bits[v]);
+      fail++;
+    }
+    aes_ct64_decrypt(&ct64_key, out, out, 1);
+    if (memcmp(out, fips_pt, AES_BLOCK_BYTES)) {
+      printf("# AES-%lu: wrong plaintext!\n", bits[v]);
+      fail++;
+    }
+  }
+
+  // every length through both tiers of the dispatch
+  aes_ct64_key_init(&ct64_key, key, AES128_BITS);
+  aes_dispatch_key_init(&disp_key, key, AES128_BITS);
+  aes_128_enc_key_schedule(rk, key);
+
+  for (int b = 0; b < CT64_CHECK_BLOCKS; b++) {
+    aes_128_ecb_encrypt((uint8_t*)ct[0][b], (uint8_t*)pt[b], rk);
+  }
+  aes_ct64_encrypt(&ct64_key, (uint8_t*)ct[1], (uint8_t*)pt, CT64_CHECK_BLOCKS);
+  if (memcmp(ct[0], ct[1], CT64_CHECK_BLOCKS * AES_BLOCK_BYTES)) {
+    printf("# bitsliced and reference ciphertexts differ!\n");
+    fail++;
+  }
+
+  for (size_t n = 1; n <= CT64_CHECK_BLOCKS; n++) {
+    aes_dispatch_encrypt(&disp_key, (uint8_t*)ct[2], (uint8_t*)pt, n);
+    aes_dispatch_decrypt(&disp_key, (uint8_t*)vec, (uint8_t*)ct[2], n);
+    if (memcmp(ct[2], ct[0], n * AES_BLOCK_BYTES) || memcmp(vec, pt, n * AES_BLOCK_BYTES)) {
+      printf("# ECB dispatch wrong for %lu blocks!\n", n);
+      fail++;
+    }
+  }
+
+  return fail;
+}
+
+static uint32_t test_sizes(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  for(int i = 0; i < num_tests; i++) {
+    for (int s = 0; s < CT64_SIZES; s++) {
+      size_t n = ct64_sizes[s];
+
+      printf("#\n# AES-128, %lu blocks, test %d/%d:\n", n, i+1, num_tests);
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      for (size_t b = 0; b < n; b++) {
+        aes_128_ecb_encrypt((uint8_t*)ct[0][b], (uint8_t*)pt[b], rk);
+      }
+      volatile uint64_t ref_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t ref_ccount = test_rdcycle() - start_cycles;
+      perf_log.reference[s].icount[i] = ref_icount;
+      perf_log.reference[s].ccount[i] = ref_ccount;
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      aes_ct64_encrypt(&ct64_key, (uint8_t*)ct[1], (uint8_t*)pt, n);
+      volatile uint64_t ct64_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t ct64_ccount = test_rdcycle() - start_cycles;
+      perf_log.ct64[s].icount[i] = ct64_icount;
+      perf_log.ct64[s].ccount[i] = ct64_ccount;
+
+      memcpy(vec, pt, n * AES_BLOCK_BYTES);
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      aes_vec_blocks(&disp_key.vec, vec, n, 0);
+      volatile uint64_t vec_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t vec_ccount = test_rdcycle() - start_cycles;
+      perf_log.vector[s].icount[i] = vec_icount;
+      perf_log.vector[s].ccount[i] = vec_ccount;
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      aes_dispatch_encrypt(&disp_key, (uint8_t*)ct[2], (uint8_t*)pt, n);
+      volatile uint64_t disp_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t disp_ccount = test_rdcycle() - start_cycles;
+      perf_log.dispatch[s].icount[i] = disp_icount;
+      perf_log.dispatch[s].ccount[i] = disp_ccount;
+
+      if (memcmp(ct[0], ct[1], n * AES_BLOCK_BYTES) || memcmp(ct[0], vec, n * AES_BLOCK_BYTES) ||
+          memcmp(ct[0], ct[2], n * AES_BLOCK_BYTES)) {
+        printf("# ciphertexts differ!\n");
+        fail++;
+      }
+
+      printf("#\treference cycles = %020lu\n", ref_ccount);
+      printf("#\tbitsliced cycles = %020lu\n", ct64_ccount);
+      printf("#\tvector cycles    = %020lu\n", vec_ccount);
+      printf("#\tdispatch cycles  = %020lu\n", disp_ccount);
+    }
+  }
+
+  for (int s = 0; s < CT64_SIZES; s++) {
+    perf_log.reference[s].ccount_average = average_count(perf_log.reference[s].ccount);
+    perf_log.reference[s].icount_average = average_count(perf_log.reference[s].icount);
+    perf_log.ct64[s].ccount_average      = average_count(perf_log.ct64[s].ccount);
+    perf_log.ct64[s].icount_average      = average_count(perf_log.ct64[s].icount);
+    perf_log.vector[s].ccount_average    = average_count(perf_log.vector[s].ccount);
+    perf_log.vector[s].icount_average    = average_count(perf_log.vector[s].icount);
+    perf_log.dispatch[s].ccount_average       = average_count(perf_log.dispatch[s].ccount);
+    perf_log.dispatch[s].icount_average       = average_count(perf_log.dispatch[s].icount);
+  }
+
+  return fail;
+}
+
+/*
+ * A bulk vector request followed by two blocks. On the scalar core the two
+ * blocks only need the integer pipeline while Ara drains the bulk pass.
+ */
+static uint32_t test_tail(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  uint32_t tail [2][4];
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# %d vector blocks + 2 blocks, test %d/%d:\n", CT64_BULK_BLOCKS, i+1, num_tests);
+
+    memcpy(vec, pt, sizeof(vec));
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    aes_vec_blocks(&disp_key.vec, vec, CT64_BULK_BLOCKS, 0);
+    aes_ct64_encrypt(&ct64_key, (uint8_t*)tail, (uint8_t*)pt, 2);
+    volatile uint64_t ct64_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ct64_ccount = test_rdcycle() - start_cycles;
+    perf_log.tail_ct64.icount[i] = ct64_icount;
+    perf_log.tail_ct64.ccount[i] = ct64_ccount;
+
+    if (memcmp(tail, ct[0], sizeof(tail))) {
+      printf("# bitsliced tail differs!\n");
+      fail++;
+    }
+
+    memcpy(vec, pt, sizeof(vec));
+    memcpy(tail, pt, sizeof(tail));
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    aes_vec_blocks(&disp_key.vec, vec, CT64_BULK_BLOCKS, 0);
+    aes_vec_blocks(&disp_key.vec, tail, 2, 0);
+    volatile uint64_t vec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t vec_ccount = test_rdcycle() - start_cycles;
+    perf_log.tail_vector.icount[i] = vec_icount;
+    perf_log.tail_vector.ccount[i] = vec_ccount;
+
+    if (memcmp(tail, ct[0], sizeof(tail))) {
+      printf("# vector tail differs!\n");
+      fail++;
+    }
+
+    printf("#\tbitsliced tail cycles = %020lu\n", ct64_ccount);
+    printf("#\tvector tail cycles    = %020lu\n", vec_ccount);
+  }
+
+  perf_log.tail_ct64.ccount_average   = average_count(perf_log.tail_ct64.ccount);
+  perf_log.tail_ct64.icount_average   = average_count(perf_log.tail_ct64.icount);
+  perf_log.tail_vector.ccount_average = average_count(perf_log.tail_vector.ccount);
+  perf_log.tail_vector.icount_average = average_count(perf_log.tail_vector.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for bitsliced scalar AES (%d blocks per pass)\n", AES_CT64_BLOCKS);
+
+  for (int b = 0; b < AES_256_KEY_BYTES; b++) {
+    key[b] = b;
+  }
+  for (int b = 0; b < CT64_BULK_BLOCKS * AES_BLOCK_BYTES; b++) {
+    ((uint8_t*)pt)[b] = (uint8_t)(b * 29 + 7);
+  }
+
+  fail += test_vectors();
+  fail += test_sizes(TEST_COUNT);
+  fail += test_tail(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  for (int s = 0; s < CT64_SIZES; s++) {
+    printf("#\t%lu blocks:\n", ct64_sizes[s]);
+    printf("#\treference.ccount = %05lu\n", perf_log.reference[s].ccount_average);
+    printf("#\tbitsliced.ccount = %05lu\n", perf_log.ct64[s].ccount_average);
+    printf("#\tvector.ccount    = %05lu\n", perf_log.vector[s].ccount_average);
+    printf("#\tdispatch.ccount  = %05lu\n", perf_log.dispatch[s].ccount_average);
+  }
+  printf("#\t%d + 2 blocks:\n", CT64_BULK_BLOCKS);
+  printf("#\ttail_bitsliced.ccount = %05lu\n", perf_log.tail_ct64.ccount_average);
+  printf("#\ttail_vector.ccount    = %05lu\n", perf_log.tail_vector.ccount_average);
+
+  for (int s = 0; s < CT64_SIZES; s++) {
+    size_t len = ct64_sizes[s] * AES_BLOCK_BYTES;
+    bench_record_log("aes128 reference ecb", len, 0, &perf_log.reference[s]);
+    bench_record_log("aes128 ct64 ecb",     len, 0, &perf_log.ct64[s]);
+    bench_record_log("aes128 zvkned ecb",   len, 4, &perf_log.vector[s]);
+    bench_record_log("aes128 dispatch ecb", len, 0, &perf_log.dispatch[s]);
+  }
+  bench_record_log("aes128 ct64 tail",   (CT64_BULK_BLOCKS + 2) * AES_BLOCK_BYTES, 0,
+                   &perf_log.tail_ct64);
+  bench_record_log("aes128 zvkned tail", (CT64_BULK_BLOCKS + 2) * AES_BLOCK_BYTES, 4,
+                   &perf_log.tail_vector);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,210 @@
+/*
+ * File      : aes_ccm.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: AES-CCM (RFC 3610, SP 800-38C). Every pass of the round
+ * instructions carries the next CBC-MAC block in element group 0 and
+ * counter blocks in the remaining groups, so the CTR half comes for free
+ * next to the serial MAC chain.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/aes/api_aes_modes.h"
+
+typedef struct {
+  uint8_t         b0   [AES_BLOCK_BYTES];
+  uint8_t         a0   [AES_BLOCK_BYTES];  // counter block with a zero counter
+  uint8_t         ahdr [6];                // encoded AAD length
+  size_t          ahl;
+  const uint8_t*  aad;
+  size_t          aad_len;
+  size_t          aad_blocks;              // blocks of ahdr || aad, zero padded
+  const uint8_t*  mac_src;                 // plaintext as seen by CBC-MAC
+  size_t          len;
+  size_t          pt_blocks;
+  size_t          L;                       // bytes of the length/counter field
+} ccm_t;
+
+static int ccm_setup(ccm_t* c, size_t tag_len, const uint8_t* nonce, size_t nonce_len,
+                     const uint8_t* aad, size_t aad_len, size_t len) {
+
+  if (nonce_len < AES_CCM_NONCE_MIN || nonce_len > AES_CCM_NONCE_MAX ||
+      tag_len < 4 || tag_len > AES_BLOCK_BYTES || (tag_len & 1) ||
+      (uint64_t)aad_len >> 32) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  c->L = AES_BLOCK_BYTES - 1 - nonce_len;
+  if (c->L < 8 && ((uint64_t)len >> (8 * c->L))) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  memset(c->b0, 0, AES_BLOCK_BYTES);
+  c->b0[0] = (aad_len ? 0x40 : 0) | ((tag_len - 2) / 2) << 3 | (c->L - 1);
+  memcpy(c->b0 + 1, nonce, nonce_len);
+  for (size_t i = 0; i < c->L; i++) {
+    c->b0[AES_BLOCK_BYTES - 1 - i] = (uint8_t)((uint64_t)len >> (8 * i));
+  }
+
+  memset(c->a0, 0, AES_BLOCK_BYTES);
+  c->a0[0] = c->L - 1;
+  memcpy(c->a0 + 1, nonce, nonce_len);
+
+  c->ahl = 0;
+  if (aad_len >= 0xff00) {
+    c->ahdr[c->ahl++] = 0xff;
+    c->ahdr[c->ahl++] = 0xfe;
+    c->ahdr[c->ahl++] = aad_len >> 24;
+    c->ahdr[c->ahl++] = aad_len >> 16;
+  }
+  if (aad_len) {
+    c->ahdr[c->ahl++] = aad_len >> 8;
+    c->ahdr[c->ahl++] = aad_len;
+  }
+
+  c->aad        = aad;
+  c->aad_len    = aad_len;
+  c->aad_blocks = (c->ahl + aad_len + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+  c->len        = len;
+  c->pt_blocks  = (len + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+
+  return AES_MODES_OK;
+}
+
+// MAC input block i: B0, the encoded AAD, then the plaintext, zero padded
+static void ccm_mac_block(uint8_t blk[AES_BLOCK_BYTES], const ccm_t* c, size_t i) {
+  memset(blk, 0, AES_BLOCK_BYTES);
+
+  if (i == 0) {
+    memcpy(blk, c->b0, AES_BLOCK_BYTES);
+  } else if (i <= c->aad_blocks) {
+    size_t o   = AES_BLOCK_BYTES * (i - 1);
+    size_t end = o + AES_BLOCK_BYTES;
+
+    if (o < c->ahl) {
+      memcpy(blk, c->ahdr + o, c->ahl - o < AES_BLOCK_BYTES ? c->ahl - o : AES_BLOCK_BYTES);
+    }
+    size_t s = o > c->ahl ? o : c->ahl;
+    size_t e = end < c->ahl + c->aad_len ? end : c->ahl + c->aad_len;
+    if (s < e) {
+      memcpy(blk + (s - o), c->aad + (s - c->ahl), e - s);
+    }
+  } else {
+    size_t o = AES_BLOCK_BYTES * (i - 1 - c->aad_blocks);
+    size_t n = c->len - o;
+    memcpy(blk, c->mac_src + o, n < AES_BLOCK_BYTES ? n : AES_BLOCK_BYTES);
+  }
+}
+
+/*
+ * When encrypting, the counters trail the MAC so that ct may overwrite pt.
+ * When decrypting, the counters run ahead and the MAC only absorbs
+ * plaintext recovered in an earlier pass. t receives the MAC xor S0.
+ */
+static void ccm_run(const aes_vec_key_t* k, ccm_t* c, uint8_t* out, const uint8_t* in,
+                    int decrypt, uint8_t t[AES_BLOCK_BYTES]) {
+  uint32_t x    [AES_MODES_LANES][4];
+  size_t   ctr  [AES_MODES_LANES];
+  uint8_t  mac  [AES_BLOCK_BYTES] = {0};
+  uint8_t  s0   [AES_BLOCK_BYTES];
+  size_t   g         = aes_vec_lanes();
+  size_t   mac_total = 1 + c->aad_blocks + c->pt_blocks;
+  size_t   mi        = 0;   // next MAC block
+  size_t   ci        = 0;   // next counter, 0 is A0
+
+  while (mi < mac_total || ci <= c->pt_blocks) {
+    size_t m       = 0;
+    int    has_mac = 0;
+
+    if (mi < mac_total &&
+        (!decrypt || mi <= c->aad_blocks || ci > mi - c->aad_blocks)) {
+      uint8_t* b = (uint8_t*)x[0];
+      ccm_mac_block(b, c, mi++);
+      for (int i = 0; i < AES_BLOCK_BYTES; i++) {
+        b[i] ^= mac[i];
+      }
+      has_mac = 1;
+      m = 1;
+    }
+
+    // highest counter allowed in this pass
+    size_t lim = decrypt ? c->pt_blocks : (mi > 1 + c->aad_blocks ? mi - 1 - c->aad_blocks : 0);
+    while (m < g && ci <= lim) {
+      uint8_t* b = (uint8_t*)x[m];
+      memcpy(b, c->a0, AES_BLOCK_BYTES);
+      for (size_t i = 0; i < c->L; i++) {
+        b[AES_BLOCK_BYTES - 1 - i] = (uint8_t)((uint64_t)ci >> (8 * i));
+      }
+      ctr[m++] = ci++;
+    }
+
+    aes_vec_blocks(k, x, m, 0);
+
+    if (has_mac) {
+      memcpy(mac, x[0], AES_BLOCK_BYTES);
+    }
+    for (size_t s = has_mac; s < m; s++) {
+      if (ctr[s] == 0) {
+        memcpy(s0, x[s], AES_BLOCK_BYTES);
+        continue;
+      }
+      size_t         o  = AES_BLOCK_BYTES * (ctr[s] - 1);
+      size_t         n  = c->len - o < AES_BLOCK_BYTES ? c->len - o : AES_BLOCK_BYTES;
+      const uint8_t* ks = (const uint8_t*)x[s];
+      for (size_t i = 0; i < n; i++) {
+        out[o + i] = in[o + i] ^ ks[i];
+      }
+    }
+  }
+
+  for (int i = 0; i < AES_BLOCK_BYTES; i++) {
+    t[i] = mac[i] ^ s0[i];
+  }
+}
+
+int aes_ccm_encrypt(const aes_vec_key_t* k, uint8_t* ct, uint8_t* tag, size_t tag_len,
+                    const uint8_t* nonce, size_t nonce_len,
+                    const uint8_t* aad, size_t aad_len,
+                    const uint8_t* pt, size_t len) {
+  ccm_t   c;
+  uint8_t t [AES_BLOCK_BYTES];
+
+  if (ccm_setup(&c, tag_len, nonce, nonce_len, aad, aad_len, len) != AES_MODES_OK) {
+    return AES_MODES_ERR_PARAM;
+  }
+  c.mac_src = pt;
+
+  ccm_run(k, &c, ct, pt, 0, t);
+  memcpy(tag, t, tag_len);
+
+  return AES_MODES_OK;
+}
+
+int aes_ccm_decrypt(const aes_vec_key_t* k, uint8_t* pt, const uint8_t* tag, size_t tag_len,
+                    const uint8_t* nonce, size_t nonce_len,
+                    const uint8_t* aad, size_t aad_len,
+                    const uint8_t* ct, size_t len) {
+  ccm_t   c;
+  uint8_t t [AES_BLOCK_BYTES];
+  uint8_t d = 0;
+
+  if (ccm_setup(&c, tag_len, nonce, nonce_len, aad, aad_len, len) != AES_MODES_OK) {
+    return AES_MODES_ERR_PARAM;
+  }
+  c.mac_src = pt;
+
+  ccm_run(k, &c, pt, ct, 1, t);
+
+  for (size_t i = 0; i < tag_len; i++) {
+    d |= t[i] ^ tag[i];
+  }
+  if (d) {
+    memset(pt, 0, len);
+    return AES_MODES_ERR_AUTH;
+  }
+
+  return AES_MODES_OK;
+}
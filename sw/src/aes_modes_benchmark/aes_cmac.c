@@ -0,0 +1,110 @@
+/*
+ * File      : aes_cmac.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: AES-CMAC (RFC 4493). The CBC chain of a message is serial,
+ * a batch runs one message per element group.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/aes/api_aes_modes.h"
+
+// doubling in GF(2^128), big endian
+static void cmac_dbl(uint8_t out[AES_BLOCK_BYTES], const uint8_t in[AES_BLOCK_BYTES]) {
+  uint8_t msb = in[0] >> 7;
+
+  for (int i = 0; i < AES_BLOCK_BYTES - 1; i++) {
+    out[i] = (in[i] << 1) | (in[i + 1] >> 7);
+  }
+  out[AES_BLOCK_BYTES - 1] = (in[AES_BLOCK_BYTES - 1] << 1) ^ (0x87 & -msb);
+}
+
+int aes_cmac_init(aes_cmac_key_t* ck, const uint8_t* key, size_t key_bits) {
+  uint32_t l [1][4] = {{0}};
+
+  if (aes_vec_key_init(&ck->key, key, key_bits) != AES_MODES_OK) {
+    return AES_MODES_ERR_KEY;
+  }
+
+  aes_vec_blocks(&ck->key, l, 1, 0);
+  cmac_dbl(ck->k1, (const uint8_t*)l[0]);
+  cmac_dbl(ck->k2, ck->k1);
+
+  return AES_MODES_OK;
+}
+
+// xor block b of a message into x, the last block with its subkey
+static void cmac_absorb(uint8_t x[AES_BLOCK_BYTES], const aes_cmac_key_t* ck,
+                        const uint8_t* msg, size_t len, size_t b, size_t nb) {
+  const uint8_t* p = msg + AES_BLOCK_BYTES * b;
+  size_t         n = len - AES_BLOCK_BYTES * b;
+
+  if (b < nb - 1) {
+    for (int i = 0; i < AES_BLOCK_BYTES; i++) {
+      x[i] ^= p[i];
+    }
+  } else if (n == AES_BLOCK_BYTES) {
+    for (int i = 0; i < AES_BLOCK_BYTES; i++) {
+      x[i] ^= p[i] ^ ck->k1[i];
+    }
+  } else {
+    for (size_t i = 0; i < n; i++) {
+      x[i] ^= p[i];
+    }
+    x[n] ^= 0x80;
+    for (int i = 0; i < AES_BLOCK_BYTES; i++) {
+      x[i] ^= ck->k2[i];
+    }
+  }
+}
+
+/*
+ * Messages that end early keep riding along until the longest message of
+ * the chunk is done, their tag is taken after their last block.
+ */
+void aes_cmac_batch(uint8_t (*tag)[AES_BLOCK_BYTES], const aes_cmac_key_t* ck,
+                    const uint8_t* const* msg, const size_t* len, size_t n) {
+  uint32_t x  [AES_MODES_LANES][4];
+  size_t   nb [AES_MODES_LANES];
+  size_t   lanes = aes_vec_lanes();
+
+  while (n) {
+    size_t c     = n < lanes ? n : lanes;
+    size_t steps = 0;
+
+    memset(x, 0, sizeof(x));
+    for (size_t i = 0; i < c; i++) {
+      nb[i] = len[i] ? (len[i] + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES : 1;
+      steps = nb[i] > steps ? nb[i] : steps;
+    }
+
+    for (size_t b = 0; b < steps; b++) {
+      for (size_t i = 0; i < c; i++) {
+        if (b < nb[i]) {
+          cmac_absorb((uint8_t*)x[i], ck, msg[i], len[i], b, nb[i]);
+        }
+      }
+
+      aes_vec_blocks(&ck->key, x, c, 0);
+
+      for (size_t i = 0; i < c; i++) {
+        if (b == nb[i] - 1) {
+          memcpy(tag[i], x[i], AES_BLOCK_BYTES);
+        }
+      }
+    }
+
+    tag += c;
+    msg += c;
+    len += c;
+    n   -= c;
+  }
+}
+
+void aes_cmac(uint8_t tag[AES_BLOCK_BYTES], const aes_cmac_key_t* ck,
+              const uint8_t* msg, size_t len) {
+  aes_cmac_batch((uint8_t (*)[AES_BLOCK_BYTES])tag, ck, &msg, &len, 1);
+}
@@ -0,0 +1,64 @@
+/*
+ * File      : aes_dispatch.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: ECB dispatch between the bitsliced scalar core and the
+ * Zvkned bulk kernels. A request of one or two blocks pays the vsetvl,
+ * the round key loads and the vector round trip for almost no work, so it
+ * stays on the scalar core.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/aes/zvkned.h"
+#include "crypto/aes/api_aes_ct64.h"
+#include "crypto/aes/api_aes_modes.h"
+
+int aes_dispatch_key_init(aes_dispatch_key_t* k, const uint8_t* key, size_t key_bits) {
+  int rc = aes_vec_key_init(&k->vec, key, key_bits);
+
+  if (rc != AES_MODES_OK) {
+    return rc;
+  }
+  aes_ct64_key_init(&k->ct64, key, key_bits);
+
+  return AES_MODES_OK;
+}
+
+// the kernels take text of any alignment, so out and in are used as they are
+static void dispatch_vec(const aes_dispatch_key_t* k, uint8_t* out, const uint8_t* in,
+                    size_t n, int decrypt) {
+  const uint32_t* rk    = k->vec.rk;
+  uint64_t        bytes = n * AES_BLOCK_BYTES;
+
+  if (k->vec.nr == AES_128_NR) {
+    if (decrypt) {
+      zvkned_aes128_decode_vs_lmul2(out, in, bytes, rk);
+    } else {
+      zvkned_aes128_encode_vs_lmul4(out, in, bytes, rk);
+    }
+  } else {
+    if (decrypt) {
+      zvkned_aes256_decode_vs_lmul2(out, in, bytes, rk);
+    } else {
+      zvkned_aes256_encode_vs_lmul4(out, in, bytes, rk);
+    }
+  }
+}
+
+void aes_dispatch_encrypt(const aes_dispatch_key_t* k, uint8_t* out, const uint8_t* in, size_t n) {
+  if (n <= AES_DISPATCH_SCALAR_MAX_BLOCKS) {
+    aes_ct64_encrypt(&k->ct64, out, in, n);
+  } else {
+    dispatch_vec(k, out, in, n, 0);
+  }
+}
+
+void aes_dispatch_decrypt(const aes_dispatch_key_t* k, uint8_t* out, const uint8_t* in, size_t n) {
+  if (n <= AES_DISPATCH_SCALAR_MAX_BLOCKS) {
+    aes_ct64_decrypt(&k->ct64, out, in, n);
+  } else {
+    dispatch_vec(k, out, in, n, 1);
+  }
+}
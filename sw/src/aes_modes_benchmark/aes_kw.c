@@ -0,0 +1,253 @@
+/*
+ * File      : aes_kw.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: AES key wrap with and without padding (RFC 3394, RFC 5649).
+ * The 6n steps of a wrap are serial, a batch wraps one key per element
+ * group in lockstep.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/aes/api_aes_modes.h"
+
+#define KW_SB  AES_KW_SEMIBLOCK
+
+static const uint8_t kw_iv [KW_SB] = {0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6, 0xa6};
+
+// A ^= t, t as a 64-bit big-endian integer
+static inline void kw_xor_t(uint8_t* a, uint64_t t) {
+  for (int i = 0; i < KW_SB; i++) {
+    a[KW_SB - 1 - i] ^= (uint8_t)(t >> (8 * i));
+  }
+}
+
+/*
+ * Wrap n keys of nsb semiblocks with the initial value iv. Key i is read from
+ * in + i * stride_in, C = A || R is written to out + i * stride_out.
+ */
+static void kw_wrap_core(const aes_vec_key_t* kek, uint8_t* out, size_t stride_out,
+                         const uint8_t* in, size_t stride_in, size_t nsb, size_t n,
+                         const uint8_t iv[KW_SB]) {
+  uint32_t x [AES_MODES_LANES][4];
+  size_t   lanes = aes_vec_lanes();
+
+  for (size_t i = 0; i < n; i++) {
+    memmove(out + i * stride_out + KW_SB, in + i * stride_in, nsb * KW_SB);
+  }
+
+  while (n) {
+    size_t c = n < lanes ? n : lanes;
+
+    for (size_t l = 0; l < c; l++) {
+      memcpy(x[l], iv, KW_SB);
+    }
+
+    for (size_t j = 0; j < 6; j++) {
+      for (size_t i = 1; i <= nsb; i++) {
+        for (size_t l = 0; l < c; l++) {
+          memcpy((uint8_t*)x[l] + KW_SB, out + l * stride_out + i * KW_SB, KW_SB);
+        }
+        aes_vec_blocks(kek, x, c, 0);
+        for (size_t l = 0; l < c; l++) {
+          memcpy(out + l * stride_out + i * KW_SB, (uint8_t*)x[l] + KW_SB, KW_SB);
+          kw_xor_t((uint8_t*)x[l], nsb * j + i);
+        }
+      }
+    }
+
+    for (size_t l = 0; l < c; l++) {
+      memcpy(out + l * stride_out, x[l], KW_SB);
+    }
+
+    out += c * stride_out;
+    n   -= c;
+  }
+}
+
+/*
+ * Inverse of kw_wrap_core, the recovered A of key i is left in a[i]. out and
+ * in may be the same buffer only with out lagging in by a semiblock per key.
+ */
+static void kw_unwrap_core(const aes_vec_key_t* kek, uint8_t* out, size_t stride_out,
+                           const uint8_t* in, size_t stride_in, size_t nsb, size_t n,
+                           uint8_t (*a)[KW_SB]) {
+  uint32_t x [AES_MODES_LANES][4];
+  size_t   lanes = aes_vec_lanes();
+
+  for (size_t i = 0; i < n; i++) {
+    memcpy(a[i], in + i * stride_in, KW_SB);
+    memmove(out + i * stride_out, in + i * stride_in + KW_SB, nsb * KW_SB);
+  }
+
+  while (n) {
+    size_t c = n < lanes ? n : lanes;
+
+    for (size_t l = 0; l < c; l++) {
+      memcpy(x[l], a[l], KW_SB);
+    }
+
+    for (size_t j = 6; j-- > 0;) {
+      for (size_t i = nsb; i >= 1; i--) {
+        for (size_t l = 0; l < c; l++) {
+          kw_xor_t((uint8_t*)x[l], nsb * j + i);
+          memcpy((uint8_t*)x[l] + KW_SB, out + l * stride_out + (i - 1) * KW_SB, KW_SB);
+        }
+        aes_vec_blocks(kek, x, c, 1);
+        for (size_t l = 0; l < c; l++) {
+          memcpy(out + l * stride_out + (i - 1) * KW_SB, (uint8_t*)x[l] + KW_SB, KW_SB);
+        }
+      }
+    }
+
+    for (size_t l = 0; l < c; l++) {
+      memcpy(a[l], x[l], KW_SB);
+    }
+
+    out += c * stride_out;
+    a   += c;
+    n   -= c;
+  }
+}
+
+static int kw_equal(const uint8_t* p, const uint8_t* q, size_t n) {
+  uint8_t d = 0;
+  for (size_t i = 0; i < n; i++) {
+    d |= p[i] ^ q[i];
+  }
+  return d == 0;
+}
+
+int aes_kw_wrap_batch(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in,
+                      size_t len, size_t n) {
+
+  if (len < 2 * KW_SB || len % KW_SB) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  kw_wrap_core(kek, out, len + KW_SB, in, len, len / KW_SB, n, kw_iv);
+  return AES_MODES_OK;
+}
+
+int aes_kw_unwrap_batch(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in,
+                        size_t len, size_t n, int* status) {
+  uint8_t a [AES_MODES_LANES][KW_SB];
+  int     fail = 0;
+
+  if (len < 2 * KW_SB || len % KW_SB) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  for (size_t base = 0; base < n; base += AES_MODES_LANES) {
+    size_t c = n - base < AES_MODES_LANES ? n - base : AES_MODES_LANES;
+
+    kw_unwrap_core(kek, out + base * len, len, in + base * (len + KW_SB), len + KW_SB,
+                   len / KW_SB, c, a);
+
+    for (size_t l = 0; l < c; l++) {
+      int ok = kw_equal(a[l], kw_iv, KW_SB);
+      if (!ok) {
+        memset(out + (base + l) * len, 0, len);
+        fail++;
+      }
+      if (status) {
+        status[base + l] = ok ? AES_MODES_OK : AES_MODES_ERR_AUTH;
+      }
+    }
+  }
+
+  return fail;
+}
+
+int aes_kw_wrap(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in, size_t len) {
+  return aes_kw_wrap_batch(kek, out, in, len, 1);
+}
+
+int aes_kw_unwrap(const aes_vec_key_t* kek, uint8_t* out, const uint8_t* in, size_t len) {
+  if (len < 3 * KW_SB) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  int fail = aes_kw_unwrap_batch(kek, out, in, len - KW_SB, 1, NULL);
+  return fail < 0 ? fail : fail ? AES_MODES_ERR_AUTH : AES_MODES_OK;
+}
+
+int aes_kwp_wrap(const aes_vec_key_t* kek, uint8_t* out, size_t* out_len,
+                 const uint8_t* in, size_t len) {
+  uint8_t aiv [KW_SB] = {0xa6, 0x59, 0x59, 0xa6};
+  size_t  padded      = (len + KW_SB - 1) / KW_SB * KW_SB;
+
+  if (len == 0 || (uint64_t)len >> 32) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  aiv[4] = len >> 24;
+  aiv[5] = len >> 16;
+  aiv[6] = len >> 8;
+  aiv[7] = len;
+
+  if (padded == KW_SB) {
+    // a single semiblock is encrypted together with the AIV
+    uint32_t x [1][4];
+    memcpy(x[0], aiv, KW_SB);
+    memset((uint8_t*)x[0] + KW_SB, 0, KW_SB);
+    memcpy((uint8_t*)x[0] + KW_SB, in, len);
+    aes_vec_blocks(kek, x, 1, 0);
+    memcpy(out, x[0], AES_BLOCK_BYTES);
+  } else {
+    memmove(out + KW_SB, in, len);
+    memset(out + KW_SB + len, 0, padded - len);
+    kw_wrap_core(kek, out, 0, out + KW_SB, 0, padded / KW_SB, 1, aiv);
+  }
+
+  *out_len = padded + KW_SB;
+  return AES_MODES_OK;
+}
+
+int aes_kwp_unwrap(const aes_vec_key_t* kek, uint8_t* out, size_t* out_len,
+                   const uint8_t* in, size_t len) {
+  uint8_t  a [1][KW_SB];
+  uint8_t  p [KW_SB];
+  size_t   padded = len - KW_SB;
+
+  if (len < 2 * KW_SB || len % KW_SB) {
+    return AES_MODES_ERR_PARAM;
+  }
+
+  if (padded == KW_SB) {
+    uint32_t x [1][4];
+    memcpy(x[0], in, AES_BLOCK_BYTES);
+    aes_vec_blocks(kek, x, 1, 1);
+    memcpy(a[0], x[0], KW_SB);
+    memcpy(p, (uint8_t*)x[0] + KW_SB, KW_SB);
+  } else {
+    kw_unwrap_core(kek, out, 0, in, 0, padded / KW_SB, 1, a);
+  }
+
+  // AIV check: constant, message length indicator in range, zero padding
+  size_t  mli = (size_t)a[0][4] << 24 | (size_t)a[0][5] << 16 | (size_t)a[0][6] << 8 | a[0][7];
+  uint8_t pad = 0;
+  int     ok  = a[0][0] == 0xa6 && a[0][1] == 0x59 && a[0][2] == 0x59 && a[0][3] == 0xa6 &&
+                mli + KW_SB > padded && mli <= padded;
+
+  if (ok) {
+    const uint8_t* last = padded == KW_SB ? p : out + padded - KW_SB;
+    for (size_t i = mli - (padded - KW_SB); i < KW_SB; i++) {
+      pad |= last[i];
+    }
+    ok = pad == 0;
+  }
+
+  if (!ok) {
+    memset(out, 0, padded == KW_SB ? 0 : padded);
+    return AES_MODES_ERR_AUTH;
+  }
+
+  if (padded == KW_SB) {
+    memcpy(out, p, mli);
+  }
+  *out_len = mli;
+  return AES_MODES_OK;
+}
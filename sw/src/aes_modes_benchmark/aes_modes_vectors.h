@@ -0,0 +1,155 @@
+/*
+ * File      : aes_modes_vectors.h
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Test vectors for AES-CMAC, AES-CCM and AES-KW/KWP. The
+ * examples of RFC 4493, RFC 3610 and RFC 3394 are quoted, the others were
+ * computed with an independent model checked against them.
+ */
+
+#ifndef __AES_MODES_VECTORS_H__
+#define __AES_MODES_VECTORS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+// RFC 4493, section 4: tags of the first 0, 16, 40 and 64 bytes of the message
+static const uint8_t cmac_key [16] = {
+  0x2b, 0x7e, 0x15, 0x16, 0x28, 0xae, 0xd2, 0xa6, 0xab, 0xf7, 0x15, 0x88,
+  0x09, 0xcf, 0x4f, 0x3c
+};
+
+static const uint8_t cmac_msg [64] = {
+  0x6b, 0xc1, 0xbe, 0xe2, 0x2e, 0x40, 0x9f, 0x96, 0xe9, 0x3d, 0x7e, 0x11,
+  0x73, 0x93, 0x17, 0x2a, 0xae, 0x2d, 0x8a, 0x57, 0x1e, 0x03, 0xac, 0x9c,
+  0x9e, 0xb7, 0x6f, 0xac, 0x45, 0xaf, 0x8e, 0x51, 0x30, 0xc8, 0x1c, 0x46,
+  0xa3, 0x5c, 0xe4, 0x11, 0xe5, 0xfb, 0xc1, 0x19, 0x1a, 0x0a, 0x52, 0xef,
+  0xf6, 0x9f, 0x24, 0x45, 0xdf, 0x4f, 0x9b, 0x17, 0xad, 0x2b, 0x41, 0x7b,
+  0xe6, 0x6c, 0x37, 0x10
+};
+
+static const uint8_t cmac_tag [4][16] = {
+  { 0xbb, 0x1d, 0x69, 0x29, 0xe9, 0x59, 0x37, 0x28, 0x7f, 0xa3, 0x7d, 0x12, 0x9b, 0x75, 0x67, 0x46 },
+  { 0x07, 0x0a, 0x16, 0xb4, 0x6b, 0x4d, 0x41, 0x44, 0xf7, 0x9b, 0xdd, 0x9d, 0xd0, 0x4a, 0x28, 0x7c },
+  { 0xdf, 0xa6, 0x67, 0x47, 0xde, 0x9a, 0xe6, 0x30, 0x30, 0xca, 0x32, 0x61, 0x14, 0x97, 0xc8, 0x27 },
+  { 0x51, 0xf0, 0xbe, 0xbf, 0x7e, 0x3b, 0x9d, 0x92, 0xfc, 0x49, 0x74, 0x17, 0x79, 0x36, 0x3c, 0xfe }
+};
+
+static const size_t cmac_len [4] = { 0, 16, 40, 64 };
+
+// RFC 3610, packet vector #1: header 00..07, payload 08..1e, M = 8
+static const uint8_t ccm1_key [16] = {
+  0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7, 0xc8, 0xc9, 0xca, 0xcb,
+  0xcc, 0xcd, 0xce, 0xcf
+};
+
+static const uint8_t ccm1_nonce [13] = {
+  0x00, 0x00, 0x00, 0x03, 0x02, 0x01, 0x00, 0xa0, 0xa1, 0xa2, 0xa3, 0xa4,
+  0xa5
+};
+
+static const uint8_t ccm1_ct [23] = {
+  0x58, 0x8c, 0x97, 0x9a, 0x61, 0xc6, 0x63, 0xd2, 0xf0, 0x66, 0xd0, 0xc2,
+  0xc0, 0xf9, 0x89, 0x80, 0x6d, 0x5f, 0x6b, 0x61, 0xda, 0xc3, 0x84
+};
+
+static const uint8_t ccm1_tag [8] = {
+  0x17, 0xe8, 0xd1, 0x2c, 0xfd, 0xf9, 0x26, 0xe0
+};
+
+// AES-256, 12-byte nonce, AAD byte i = 5i + 1, payload byte i = 13i + 5
+#define CCM2_AAD_LEN   32
+#define CCM2_LEN       1024
+#define CCM2_AAD(i)    ((uint8_t)((i) * 5 + 1))
+#define CCM2_PT(i)     ((uint8_t)((i) * 13 + 5))
+
+static const uint8_t ccm2_key [32] = {
+  0x01, 0x08, 0x0f, 0x16, 0x1d, 0x24, 0x2b, 0x32, 0x39, 0x40, 0x47, 0x4e,
+  0x55, 0x5c, 0x63, 0x6a, 0x71, 0x78, 0x7f, 0x86, 0x8d, 0x94, 0x9b, 0xa2,
+  0xa9, 0xb0, 0xb7, 0xbe, 0xc5, 0xcc, 0xd3, 0xda
+};
+
+static const uint8_t ccm2_nonce [12] = {
+  0x30, 0x31, 0x32, 0x33, 0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b
+};
+
+static const uint8_t ccm2_ct_head [32] = {
+  0xb6, 0x60, 0x54, 0x6d, 0xd7, 0xe6, 0x73, 0x45, 0xab, 0xaf, 0x48, 0x53,
+  0xbc, 0xd2, 0x82, 0x57, 0xd0, 0x62, 0x26, 0x13, 0x59, 0x01, 0xa2, 0x35,
+  0x29, 0x08, 0x07, 0x01, 0x76, 0xc8, 0x89, 0x8d
+};
+
+static const uint8_t ccm2_tag [16] = {
+  0xcc, 0xd4, 0x36, 0xd1, 0xdf, 0x40, 0x46, 0xd6, 0x57, 0xc3, 0x6d, 0x40,
+  0xd1, 0x9d, 0x49, 0x66
+};
+
+// RFC 3394, 4.1 and 4.6
+static const uint8_t kw1_kek [16] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f
+};
+
+static const uint8_t kw1_key [16] = {
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+  0xcc, 0xdd, 0xee, 0xff
+};
+
+static const uint8_t kw1_wrapped [24] = {
+  0x1f, 0xa6, 0x8b, 0x0a, 0x81, 0x12, 0xb4, 0x47, 0xae, 0xf3, 0x4b, 0xd8,
+  0xfb, 0x5a, 0x7b, 0x82, 0x9d, 0x3e, 0x86, 0x23, 0x71, 0xd2, 0xcf, 0xe5
+};
+
+static const uint8_t kw6_kek [32] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b,
+  0x0c, 0x0d, 0x0e, 0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+  0x18, 0x19, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f
+};
+
+static const uint8_t kw6_key [32] = {
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb,
+  0xcc, 0xdd, 0xee, 0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07,
+  0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+
+static const uint8_t kw6_wrapped [40] = {
+  0x28, 0xc9, 0xf4, 0x04, 0xc4, 0xb8, 0x10, 0xf4, 0xcb, 0xcc, 0xb3, 0x5c,
+  0xfb, 0x87, 0xf8, 0x26, 0x3f, 0x57, 0x86, 0xe2, 0xd8, 0x0e, 0xd3, 0x26,
+  0xcb, 0xc7, 0xf0, 0xe7, 0x1a, 0x99, 0xf4, 0x3b, 0xfb, 0x98, 0x8b, 0x9b,
+  0x7a, 0x02, 0xdd, 0x21
+};
+
+// RFC 5649 section 6 plaintexts, wrapped under kw6_kek (the RFC uses AES-192)
+static const uint8_t kwp_key20 [20] = {
+  0xc3, 0x7b, 0x7e, 0x64, 0x92, 0x58, 0x43, 0x40, 0xbe, 0xd1, 0x22, 0x07,
+  0x80, 0x89, 0x41, 0x15, 0x50, 0x68, 0xf7, 0x38
+};
+
+static const uint8_t kwp_wrapped20 [32] = {
+  0x29, 0xb7, 0xfa, 0x19, 0x1c, 0x21, 0x65, 0x68, 0x43, 0x74, 0xee, 0xe9,
+  0xf7, 0x45, 0x95, 0xe2, 0xa4, 0x2b, 0xac, 0xe7, 0x5c, 0x42, 0x5b, 0x30,
+  0x53, 0xef, 0xa2, 0x6f, 0xfe, 0x1b, 0xb3, 0x2f
+};
+
+static const uint8_t kwp_key7 [7] = {
+  0x46, 0x6f, 0x72, 0x50, 0x61, 0x73, 0x69
+};
+
+static const uint8_t kwp_wrapped7 [16] = {
+  0x44, 0x3b, 0x17, 0x83, 0x7b, 0xb3, 0x93, 0x48, 0x61, 0x0d, 0x19, 0x20,
+  0x2d, 0xf8, 0xa1, 0xf9
+};
+
+// key rotation batch: KW_BATCH data keys, key i byte k = 29i + 3k, under kw6_kek
+#define KW_BATCH       64
+#define KW_BATCH_LEN   32
+#define KW_BATCH_KEY(i, k) ((uint8_t)((i) * 29 + (k) * 3))
+
+static const uint8_t kw_batch_last [40] = {
+  0x35, 0x4d, 0x2f, 0xbd, 0x72, 0xdf, 0xde, 0x0c, 0xea, 0x71, 0x11, 0xff,
+  0x86, 0xaf, 0x34, 0x36, 0x68, 0xb7, 0x62, 0xcf, 0xc1, 0x83, 0x14, 0x19,
+  0x08, 0x8f, 0x60, 0x6b, 0xa0, 0x0a, 0xcb, 0x5b, 0x25, 0xe1, 0xff, 0x45,
+  0x64, 0xeb, 0x2c, 0xab
+};
+
+#endif // __AES_MODES_VECTORS_H__
@@ -0,0 +1,63 @@
+/*
+ * File      : aes_vec.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Key setup and the block primitive shared by the AES modes.
+ * Every element group of an e32m4 register group holds one block, the round
+ * keys are broadcast with the .vs forms.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/aes/zvkned.h"
+#include "crypto/aes/api_aes_modes.h"
+
+int aes_vec_key_init(aes_vec_key_t* k, const uint8_t* key, size_t key_bits) {
+  if (key_bits == AES128_BITS) {
+    zvkned_aes128_expand_key(k->rk, key);
+    k->nr = AES_128_NR;
+  } else if (key_bits == AES256_BITS) {
+    zvkned_aes256_expand_key(k->rk, key);
+    k->nr = AES_256_NR;
+  } else {
+    return AES_MODES_ERR_KEY;
+  }
+
+  return AES_MODES_OK;
+}
+
+size_t aes_vec_lanes(void) {
+  size_t lanes = __riscv_vsetvlmax_e32m4() / 4;
+  return lanes < AES_MODES_LANES ? lanes : AES_MODES_LANES;
+}
+
+void aes_vec_blocks(const aes_vec_key_t* k, uint32_t (*x)[4], size_t n, int decrypt) {
+  const uint32_t* rk = k->rk;
+  const uint32_t  nr = k->nr;
+  size_t vl;
+
+  for (; n > 0; n -= vl / 4, x += vl / 4) {
+    vl = __riscv_vsetvl_e32m4(4 * n);
+    vuint32m4_t s = __riscv_vle32_v_u32m4(&x[0][0], vl);
+
+    if (!decrypt) {
+      s = __riscv_vaesz_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk, 4), vl);
+      for (uint32_t r = 1; r < nr; r++) {
+        s = __riscv_vaesem_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk + 4 * r, 4), vl);
+      }
+      s = __riscv_vaesef_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk + 4 * nr, 4), vl);
+    } else {
+      // the forward schedule in reverse, no equivalent inverse key needed
+      s = __riscv_vaesz_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk + 4 * nr, 4), vl);
+      for (uint32_t r = nr - 1; r > 0; r--) {
+        s = __riscv_vaesdm_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk + 4 * r, 4), vl);
+      }
+      s = __riscv_vaesdf_vs_u32m1_u32m4(s, __riscv_vle32_v_u32m1(rk, 4), vl);
+    }
+
+    __riscv_vse32_v_u32m4(&x[0][0], s, vl);
+  }
+}
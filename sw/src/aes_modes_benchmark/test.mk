@@ -0,0 +1,5 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  aes_benchmark/aes_enc.c \
+  aes_benchmark/aes_ct64.c \
+  aes_benchmark/zvkned.s
@@ -0,0 +1,415 @@
+/*
+ * File      : test_aes_modes.c
+ * Test      : aes_modes_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of AES-CMAC, AES-CCM and AES key wrap.
+ * CMAC and key wrap are timed one message per call against one batch per
+ * call, key wrap also against the scalar block-by-block loop.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/api_aes_modes.h"
+
+#include "aes_modes_vectors.h"
+
+#define CMAC_BATCH      32
+#define CMAC_BATCH_LEN  64
+
+typedef struct {
+  perf_log_t cmac_single;
+  perf_log_t cmac_batch;
+  perf_log_t ccm_encrypt;
+  perf_log_t ccm_decrypt;
+  perf_log_t kw_scalar;
+  perf_log_t kw_single;
+  perf_log_t kw_batch;
+} aes_modes_perf_log_t;
+
+static aes_modes_perf_log_t perf_log = {0};
+
+static uint8_t cmac_bufs [CMAC_BATCH][CMAC_BATCH_LEN];
+static uint8_t cmac_tags [2][CMAC_BATCH][AES_BLOCK_BYTES];
+
+static uint8_t ccm_aad [CCM2_AAD_LEN];
+static uint8_t ccm_pt  [CCM2_LEN];
+static uint8_t ccm_buf [CCM2_LEN];
+
+static uint8_t kw_keys    [KW_BATCH][KW_BATCH_LEN];
+static uint8_t kw_wrapped [3][KW_BATCH][KW_BATCH_LEN + AES_KW_SEMIBLOCK];
+static uint8_t kw_plain   [KW_BATCH][KW_BATCH_LEN];
+
+// RFC 3394 wrap with the scalar reference AES-256, one block at a time
+static void kw_wrap_scalar(uint32_t* kek, uint8_t* out, const uint8_t* in, size_t len) {
+  size_t  n = len / AES_KW_SEMIBLOCK;
+  uint8_t b [AES_BLOCK_BYTES];
+
+  memset(b, 0xa6, AES_KW_SEMIBLOCK);
+  memcpy(out + AES_KW_SEMIBLOCK, in, len);
+
+  for (size_t j = 0; j < 6; j++) {
+    for (size_t i = 1; i <= n; i++) {
+      uint8_t* r = out + i * AES_KW_SEMIBLOCK;
+      uint64_t t = n * j + i;
+
+      memcpy(b + AES_KW_SEMIBLOCK, r, AES_KW_SEMIBLOCK);
+      aes_256_ecb_encrypt(b, b, kek);
+      memcpy(r, b + AES_KW_SEMIBLOCK, AES_KW_SEMIBLOCK);
+      for (int k = 0; k < AES_KW_SEMIBLOCK; k++) {
+        b[AES_KW_SEMIBLOCK - 1 - k] ^= (uint8_t)(t >> (8 * k));
+      }
+    }
+  }
+  memcpy(out, b, AES_KW_SEMIBLOCK);
+}
+
+static uint32_t test_cmac(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  aes_cmac_key_t ck;
+  uint8_t tag [AES_BLOCK_BYTES];
+
+  aes_cmac_init(&ck, cmac_key, AES128_BITS);
+
+  for (int v = 0; v < 4; v++) {
+    aes_cmac(tag, &ck, cmac_msg, cmac_len[v]);
+    if (memcmp(tag, cmac_tag[v], AES_BLOCK_BYTES)) {
+      printf("# CMAC: wrong tag for a %lu byte message!\n", cmac_len[v]);
+      fail++;
+    }
+  }
+
+  const uint8_t* msg [CMAC_BATCH];
+  size_t         len [CMAC_BATCH];
+  for (int m = 0; m < CMAC_BATCH; m++) {
+    for (int k = 0; k < CMAC_BATCH_LEN; k++) {
+      cmac_bufs[m][k] = (uint8_t)(k * 11 + m);
+    }
+    msg[m] = cmac_bufs[m];
+    len[m] = CMAC_BATCH_LEN - (m & 7);    // mix of complete and padded last blocks
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# AES-CMAC, %d messages, test %d/%d:\n", CMAC_BATCH, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    for (int m = 0; m < CMAC_BATCH; m++) {
+      aes_cmac(cmac_tags[0][m], &ck, msg[m], len[m]);
+    }
+    volatile uint64_t single_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t single_ccount = test_rdcycle() - start_cycles;
+    perf_log.cmac_single.icount[i] = single_icount;
+    perf_log.cmac_single.ccount[i] = single_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    aes_cmac_batch(cmac_tags[1], &ck, msg, len, CMAC_BATCH);
+    volatile uint64_t batch_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t batch_ccount = test_rdcycle() - start_cycles;
+    perf_log.cmac_batch.icount[i] = batch_icount;
+    perf_log.cmac_batch.ccount[i] = batch_ccount;
+
+    if (memcmp(cmac_tags[0], cmac_tags[1], sizeof(cmac_tags[0]))) {
+      printf("# CMAC: batch and single tags differ!\n");
+      fail++;
+    }
+
+    printf("#\tsingle cycles = %020lu\n", single_ccount);
+    printf("#\tbatch cycles  = %020lu\n", batch_ccount);
+  }
+
+  perf_log.cmac_single.ccount_average = average_count(perf_log.cmac_single.ccount);
+  perf_log.cmac_single.icount_average = average_count(perf_log.cmac_single.icount);
+  perf_log.cmac_batch.ccount_average  = average_count(perf_log.cmac_batch.ccount);
+  perf_log.cmac_batch.icount_average  = average_count(perf_log.cmac_batch.icount);
+
+  return fail;
+}
+
+static uint32_t test_ccm(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  aes_vec_key_t k;
+  uint8_t hdr [8];
+  uint8_t pt  [23];
+  uint8_t tag [AES_BLOCK_BYTES];
+
+  for (int b = 0; b < 8; b++) {
+    hdr[b] = b;
+  }
+  for (int b = 0; b < 23; b++) {
+    pt[b] = 8 + b;
+  }
+
+  // RFC 3610 packet, encrypted in place and back
+  aes_vec_key_init(&k, ccm1_key, AES128_BITS);
+  memcpy(ccm_buf, pt, sizeof(pt));
+  aes_ccm_encrypt(&k, ccm_buf, tag, 8, ccm1_nonce, 13, hdr, 8, ccm_buf, sizeof(pt));
+  if (memcmp(ccm_buf, ccm1_ct, sizeof(ccm1_ct)) || memcmp(tag, ccm1_tag, 8)) {
+    printf("# CCM: wrong RFC 3610 packet!\n");
+    fail++;
+  }
+  if (aes_ccm_decrypt(&k, ccm_buf, tag, 8, ccm1_nonce, 13, hdr, 8, ccm_buf, sizeof(pt)) != AES_MODES_OK ||
+      memcmp(ccm_buf, pt, sizeof(pt))) {
+    printf("# CCM: RFC 3610 packet not recovered!\n");
+    fail++;
+  }
+
+  aes_vec_key_init(&k, ccm2_key, AES256_BITS);
+  for (int b = 0; b < CCM2_AAD_LEN; b++) {
+    ccm_aad[b] = CCM2_AAD(b);
+  }
+  for (int b = 0; b < CCM2_LEN; b++) {
+    ccm_pt[b] = CCM2_PT(b);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# AES-256-CCM, %d bytes, test %d/%d:\n", CCM2_LEN, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    aes_ccm_encrypt(&k, ccm_buf, tag, 16, ccm2_nonce, 12, ccm_aad, CCM2_AAD_LEN, ccm_pt, CCM2_LEN);
+    volatile uint64_t enc_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t enc_ccount = test_rdcycle() - start_cycles;
+    perf_log.ccm_encrypt.icount[i] = enc_icount;
+    perf_log.ccm_encrypt.ccount[i] = enc_ccount;
+
+    if (memcmp(ccm_buf, ccm2_ct_head, sizeof(ccm2_ct_head)) || memcmp(tag, ccm2_tag, 16)) {
+      printf("# CCM: wrong ciphertext or tag!\n");
+      fail++;
+    }
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int rc = aes_ccm_decrypt(&k, ccm_buf, tag, 16, ccm2_nonce, 12, ccm_aad, CCM2_AAD_LEN, ccm_buf, CCM2_LEN);
+    volatile uint64_t dec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t dec_ccount = test_rdcycle() - start_cycles;
+    perf_log.ccm_decrypt.icount[i] = dec_icount;
+    perf_log.ccm_decrypt.ccount[i] = dec_ccount;
+
+    if (rc != AES_MODES_OK || memcmp(ccm_buf, ccm_pt, CCM2_LEN)) {
+      printf("# CCM: payload not recovered!\n");
+      fail++;
+    }
+
+    printf("#\tencrypt cycles = %020lu\n", enc_ccount);
+    printf("#\tdecrypt cycles = %020lu\n", dec_ccount);
+  }
+
+  // a forged tag must fail and leave no plaintext behind
+  aes_ccm_encrypt(&k, ccm_buf, tag, 16, ccm2_nonce, 12, ccm_aad, CCM2_AAD_LEN, ccm_pt, CCM2_LEN);
+  tag[15] ^= 0x01;
+  if (aes_ccm_decrypt(&k, ccm_buf, tag, 16, ccm2_nonce, 12, ccm_aad, CCM2_AAD_LEN, ccm_buf, CCM2_LEN) != AES_MODES_ERR_AUTH ||
+      ccm_buf[0] | ccm_buf[CCM2_LEN - 1]) {
+    printf("# CCM: forged tag accepted!\n");
+    fail++;
+  }
+  if (aes_ccm_encrypt(&k, ccm_buf, tag, 5, ccm2_nonce, 12, NULL, 0, ccm_pt, 16) != AES_MODES_ERR_PARAM) {
+    printf("# CCM: odd tag length accepted!\n");
+    fail++;
+  }
+
+  perf_log.ccm_encrypt.ccount_average = average_count(perf_log.ccm_encrypt.ccount);
+  perf_log.ccm_encrypt.icount_average = average_count(perf_log.ccm_encrypt.icount);
+  perf_log.ccm_decrypt.ccount_average = average_count(perf_log.ccm_decrypt.ccount);
+  perf_log.ccm_decrypt.icount_average = average_count(perf_log.ccm_decrypt.icount);
+
+  return fail;
+}
+
+static uint32_t test_kw_vectors(void) {
+  uint32_t fail = 0;
+  aes_vec_key_t kek;
+  uint8_t out [48];
+  size_t  len;
+
+  aes_vec_key_init(&kek, kw1_kek, AES128_BITS);
+  aes_kw_wrap(&kek, out, kw1_key, sizeof(kw1_key));
+  if (memcmp(out, kw1_wrapped, sizeof(kw1_wrapped)) ||
+      aes_kw_unwrap(&kek, out, out, sizeof(kw1_wrapped)) != AES_MODES_OK ||
+      memcmp(out, kw1_key, sizeof(kw1_key))) {
+    printf("# KW: RFC 3394 4.1 failed!\n");
+    fail++;
+  }
+
+  aes_vec_key_init(&kek, kw6_kek, AES256_BITS);
+  aes_kw_wrap(&kek, out, kw6_key, sizeof(kw6_key));
+  if (memcmp(out, kw6_wrapped, sizeof(kw6_wrapped)) ||
+      aes_kw_unwrap(&kek, out, out, sizeof(kw6_wrapped)) != AES_MODES_OK ||
+      memcmp(out, kw6_key, sizeof(kw6_key))) {
+    printf("# KW: RFC 3394 4.6 failed!\n");
+    fail++;
+  }
+
+  aes_kwp_wrap(&kek, out, &len, kwp_key20, sizeof(kwp_key20));
+  if (len != sizeof(kwp_wrapped20) || memcmp(out, kwp_wrapped20, len) ||
+      aes_kwp_unwrap(&kek, out, &len, out, len) != AES_MODES_OK ||
+      len != sizeof(kwp_key20) || memcmp(out, kwp_key20, len)) {
+    printf("# KWP: 20 byte key failed!\n");
+    fail++;
+  }
+
+  aes_kwp_wrap(&kek, out, &len, kwp_key7, sizeof(kwp_key7));
+  if (len != sizeof(kwp_wrapped7) || memcmp(out, kwp_wrapped7, len) ||
+      aes_kwp_unwrap(&kek, out, &len, out, len) != AES_MODES_OK ||
+      len != sizeof(kwp_key7) || memcmp(out, kwp_key7, len)) {
+    printf("# KWP: 7 byte key failed!\n");
+    fail++;
+  }
+
+  memcpy(out, kwp_wrapped20, sizeof(kwp_wrapped20));
+  out[3] ^= 0x40;
+  if (aes_kwp_unwrap(&kek, out, &len, out, sizeof(kwp_wrapped20)) != AES_MODES_ERR_AUTH) {
+    printf("# KWP: corrupted key accepted!\n");
+    fail++;
+  }
+
+  return fail;
+}
+
+static uint32_t test_kw(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = test_kw_vectors();
+  aes_vec_key_t kek;
+  uint32_t      kek_scalar [AES_256_RK_WORDS];
+  int           status [KW_BATCH];
+
+  aes_vec_key_init(&kek, kw6_kek, AES256_BITS);
+  aes_256_enc_key_schedule(kek_scalar, (uint8_t*)kw6_kek);
+
+  for (int j = 0; j < KW_BATCH; j++) {
+    for (int b = 0; b < KW_BATCH_LEN; b++) {
+      kw_keys[j][b] = KW_BATCH_KEY(j, b);
+    }
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# AES-256-KW, %d keys, test %d/%d:\n", KW_BATCH, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    for (int j = 0; j < KW_BATCH; j++) {
+      kw_wrap_scalar(kek_scalar, kw_wrapped[0][j], kw_keys[j], KW_BATCH_LEN);
+    }
+    volatile uint64_t scalar_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t scalar_ccount = test_rdcycle() - start_cycles;
+    perf_log.kw_scalar.icount[i] = scalar_icount;
+    perf_log.kw_scalar.ccount[i] = scalar_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    for (int j = 0; j < KW_BATCH; j++) {
+      aes_kw_wrap(&kek, kw_wrapped[1][j], kw_keys[j], KW_BATCH_LEN);
+    }
+    volatile uint64_t single_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t single_ccount = test_rdcycle() - start_cycles;
+    perf_log.kw_single.icount[i] = single_icount;
+    perf_log.kw_single.ccount[i] = single_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    aes_kw_wrap_batch(&kek, kw_wrapped[2][0], kw_keys[0], KW_BATCH_LEN, KW_BATCH);
+    volatile uint64_t batch_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t batch_ccount = test_rdcycle() - start_cycles;
+    perf_log.kw_batch.icount[i] = batch_icount;
+    perf_log.kw_batch.ccount[i] = batch_ccount;
+
+    if (memcmp(kw_wrapped[0], kw_wrapped[1], sizeof(kw_wrapped[0])) ||
+        memcmp(kw_wrapped[0], kw_wrapped[2], sizeof(kw_wrapped[0])) ||
+        memcmp(kw_wrapped[2][KW_BATCH - 1], kw_batch_last, sizeof(kw_batch_last))) {
+      printf("# KW: wrapped keys differ!\n");
+      fail++;
+    }
+
+    printf("#\tscalar cycles = %020lu\n", scalar_ccount);
+    printf("#\tsingle cycles = %020lu\n", single_ccount);
+    printf("#\tbatch cycles  = %020lu\n", batch_ccount);
+  }
+
+  // unwrap the batch with key 5 corrupted
+  kw_wrapped[2][5][20] ^= 0x08;
+  int bad = aes_kw_unwrap_batch(&kek, kw_plain[0], kw_wrapped[2][0], KW_BATCH_LEN, KW_BATCH, status);
+  for (int j = 0; j < KW_BATCH; j++) {
+    int ok = j == 5 ? status[j] == AES_MODES_ERR_AUTH : status[j] == AES_MODES_OK &&
+             !memcmp(kw_plain[j], kw_keys[j], KW_BATCH_LEN);
+    if (!ok) {
+      printf("# KW: unexpected unwrap of key %d (status %d)!\n", j, status[j]);
+      fail++;
+    }
+  }
+  if (bad != 1) {
+    printf("# KW: %d keys reported bad!\n", bad);
+    fail++;
+  }
+
+  perf_log.kw_scalar.ccount_average = average_count(perf_log.kw_scalar.ccount);
+  perf_log.kw_scalar.icount_average = average_count(perf_log.kw_scalar.icount);
+  perf_log.kw_single.ccount_average = average_count(perf_log.kw_single.ccount);
+  perf_log.kw_single.icount_average = average_count(perf_log.kw_single.icount);
+  perf_log.kw_batch.ccount_average  = average_count(perf_log.kw_batch.ccount);
+  perf_log.kw_batch.icount_average  = average_count(perf_log.kw_batch.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for AES-CMAC, AES-CCM and AES-KW (%lu blocks per pass)\n", aes_vec_lanes());
+
+  fail += test_cmac(TEST_COUNT);
+  fail += test_ccm(TEST_COUNT);
+  fail += test_kw(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tCMAC:\n");
+  printf("#\tcmac_single.icount = %05lu\n", perf_log.cmac_single.icount_average);
+  printf("#\tcmac_single.ccount = %05lu\n", perf_log.cmac_single.ccount_average);
+  printf("#\tcmac_batch.icount  = %05lu\n", perf_log.cmac_batch.icount_average);
+  printf("#\tcmac_batch.ccount  = %05lu\n", perf_log.cmac_batch.ccount_average);
+  printf("#\tCCM:\n");
+  printf("#\tccm_encrypt.icount = %05lu\n", perf_log.ccm_encrypt.icount_average);
+  printf("#\tccm_encrypt.ccount = %05lu\n", perf_log.ccm_encrypt.ccount_average);
+  printf("#\tccm_decrypt.icount = %05lu\n", perf_log.ccm_decrypt.icount_average);
+  printf("#\tccm_decrypt.ccount = %05lu\n", perf_log.ccm_decrypt.ccount_average);
+  printf("#\tKW:\n");
+  printf("#\tkw_scalar.icount   = %05lu\n", perf_log.kw_scalar.icount_average);
+  printf("#\tkw_scalar.ccount   = %05lu\n", perf_log.kw_scalar.ccount_average);
+  printf("#\tkw_single.icount   = %05lu\n", perf_log.kw_single.icount_average);
+  printf("#\tkw_single.ccount   = %05lu\n", perf_log.kw_single.ccount_average);
+  printf("#\tkw_batch.icount    = %05lu\n", perf_log.kw_batch.icount_average);
+  printf("#\tkw_batch.ccount    = %05lu\n", perf_log.kw_batch.ccount_average);
+
+  bench_record_log("aes cmac single",  CMAC_BATCH * CMAC_BATCH_LEN, 4, &perf_log.cmac_single);
+  bench_record_log("aes cmac batch",   CMAC_BATCH * CMAC_BATCH_LEN, 4, &perf_log.cmac_batch);
+  bench_record_log("aes ccm encrypt",  CCM2_LEN,                    4, &perf_log.ccm_encrypt);
+  bench_record_log("aes ccm decrypt",  CCM2_LEN,                    4, &perf_log.ccm_decrypt);
+  bench_record_log("aes kw scalar",    KW_BATCH * KW_BATCH_LEN,     0, &perf_log.kw_scalar);
+  bench_record_log("aes kw single",    KW_BATCH * KW_BATCH_LEN,     4, &perf_log.kw_single);
+  bench_record_log("aes kw batch",     KW_BATCH * KW_BATCH_LEN,     4, &perf_log.kw_batch);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
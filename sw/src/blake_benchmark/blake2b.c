@@ -0,0 +1,177 @@
+/*
+ * File      : blake2b.c
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE2b (RFC 7693) on RVV, rows of four 64b words.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/blake/api_blake2.h"
+#include "crypto/blake/blake_core.h"
+
+static const uint64_t kBlake2bIV[8] = {
+  0x6a09e667f3bcc908, 0xbb67ae8584caa73b, 0x3c6ef372fe94f82b, 0xa54ff53a5f1d36f1,
+  0x510e527fade682d1, 0x9b05688c2b3e6c1f, 0x1f83d9abfb41bd6b, 0x5be0cd19137e2179
+};
+
+//! G on the four elements of the rows a, b, c, d with the message words x, y
+#define G64(a, b, c, d, x, y)                                                   \
+  a = __riscv_vadd_vv_u64m2(__riscv_vadd_vv_u64m2(a, b, vl), x, vl);            \
+  d = __riscv_vror_vx_u64m2(__riscv_vxor_vv_u64m2(d, a, vl), 32, vl);           \
+  c = __riscv_vadd_vv_u64m2(c, d, vl);                                          \
+  b = __riscv_vror_vx_u64m2(__riscv_vxor_vv_u64m2(b, c, vl), 24, vl);           \
+  a = __riscv_vadd_vv_u64m2(__riscv_vadd_vv_u64m2(a, b, vl), y, vl);            \
+  d = __riscv_vror_vx_u64m2(__riscv_vxor_vv_u64m2(d, a, vl), 16, vl);           \
+  c = __riscv_vadd_vv_u64m2(c, d, vl);                                          \
+  b = __riscv_vror_vx_u64m2(__riscv_vxor_vv_u64m2(b, c, vl), 63, vl)
+
+//! Message words of step k (0..3), the 32b word offsets doubled for 64b words
+#define MSG64(k)                                                                \
+  __riscv_vluxei64_v_u64m2(m, __riscv_vsll_vx_u64m2(__riscv_vzext_vf2_u64m2(   \
+    __riscv_vle32_v_u32m1(kBlake2sSched[r % 10] + 4 * (k), vl), vl), 1, vl), vl)
+
+void blake2b_rounds(uint64_t v[16], const uint64_t m[16]) {
+  size_t vl = __riscv_vsetvl_e64m2(4);
+
+  vuint64m2_t a = __riscv_vle64_v_u64m2(v +  0, vl);
+  vuint64m2_t b = __riscv_vle64_v_u64m2(v +  4, vl);
+  vuint64m2_t c = __riscv_vle64_v_u64m2(v +  8, vl);
+  vuint64m2_t d = __riscv_vle64_v_u64m2(v + 12, vl);
+
+  vuint64m2_t lane = __riscv_vid_v_u64m2(vl);
+  vuint64m2_t rot1 = __riscv_vand_vx_u64m2(__riscv_vadd_vx_u64m2(lane, 1, vl), 3, vl);
+  vuint64m2_t rot2 = __riscv_vand_vx_u64m2(__riscv_vadd_vx_u64m2(lane, 2, vl), 3, vl);
+  vuint64m2_t rot3 = __riscv_vand_vx_u64m2(__riscv_vadd_vx_u64m2(lane, 3, vl), 3, vl);
+
+  for (size_t r = 0; r < 12; r++) {
+    G64(a, b, c, d, MSG64(0), MSG64(1));
+
+    b = __riscv_vrgather_vv_u64m2(b, rot1, vl);
+    c = __riscv_vrgather_vv_u64m2(c, rot2, vl);
+    d = __riscv_vrgather_vv_u64m2(d, rot3, vl);
+
+    G64(a, b, c, d, MSG64(2), MSG64(3));
+
+    b = __riscv_vrgather_vv_u64m2(b, rot3, vl);
+    c = __riscv_vrgather_vv_u64m2(c, rot2, vl);
+    d = __riscv_vrgather_vv_u64m2(d, rot1, vl);
+  }
+
+  __riscv_vse64_v_u64m2(v +  0, a, vl);
+  __riscv_vse64_v_u64m2(v +  4, b, vl);
+  __riscv_vse64_v_u64m2(v +  8, c, vl);
+  __riscv_vse64_v_u64m2(v + 12, d, vl);
+}
+
+static void blake2b_compress(blake2b_ctx_t* s, const uint8_t* block, int last) {
+  uint64_t m[16];
+  uint64_t v[16];
+
+  memcpy(m, block, sizeof(m));          // little endian, any alignment
+  memcpy(v, s->h, 64);
+  memcpy(v + 8, kBlake2bIV, 64);
+  v[12] ^= s->t[0];
+  v[13] ^= s->t[1];
+  if (last) {
+    v[14] = ~v[14];
+  }
+
+  blake2b_rounds(v, m);
+
+  for (int i = 0; i < 8; i++) {
+    s->h[i] ^= v[i] ^ v[i + 8];
+  }
+}
+
+static void blake2b_count(blake2b_ctx_t* s, uint64_t n) {
+  s->t[0] += n;
+  s->t[1] += s->t[0] < n;
+}
+
+int blake2b_init(blake2b_ctx_t* s, size_t outlen, const void* key, size_t keylen) {
+  if (outlen == 0 || outlen > BLAKE2B_OUT_BYTES || keylen > BLAKE2B_OUT_BYTES) {
+    return BLAKE2_ERR_PARAM;
+  }
+
+  memcpy(s->h, kBlake2bIV, sizeof(s->h));
+  s->h[0] ^= 0x01010000 ^ ((uint64_t)keylen << 8) ^ outlen;
+  s->t[0]  = 0;
+  s->t[1]  = 0;
+  s->buflen = 0;
+  s->outlen = outlen;
+
+  // the key is hashed as a whole first block
+  if (keylen) {
+    memset(s->buf, 0, sizeof(s->buf));
+    memcpy(s->buf, key, keylen);
+    s->buflen = BLAKE2B_BLOCK_BYTES;
+  }
+  return BLAKE2_OK;
+}
+
+void blake2b_update(blake2b_ctx_t* s, const void* in, size_t len) {
+  const uint8_t* p = in;
+
+  // the last block must stay pending, it is compressed by final
+  if (len > BLAKE2B_BLOCK_BYTES - s->buflen) {
+    size_t n = BLAKE2B_BLOCK_BYTES - s->buflen;
+    memcpy(s->buf + s->buflen, p, n);
+    blake2b_count(s, BLAKE2B_BLOCK_BYTES);
+    blake2b_compress(s, s->buf, 0);
+    s->buflen = 0;
+    p   += n;
+    len -= n;
+
+    while (len > BLAKE2B_BLOCK_BYTES) {
+      blake2b_count(s, BLAKE2B_BLOCK_BYTES);
+      blake2b_compress(s, p, 0);
+      p   += BLAKE2B_BLOCK_BYTES;
+      len -= BLAKE2B_BLOCK_BYTES;
+    }
+  }
+
+  memcpy(s->buf + s->buflen, p, len);
+  s->buflen += len;
+}
+
+void blake2b_final(blake2b_ctx_t* s, uint8_t* md) {
+  blake2b_count(s, s->buflen);
+  memset(s->buf + s->buflen, 0, BLAKE2B_BLOCK_BYTES - s->buflen);
+  blake2b_compress(s, s->buf, 1);
+
+  memcpy(md, s->h, s->outlen);
+}
+
+int blake2b(uint8_t* md, size_t outlen, const void* key, size_t keylen, const void* in,
+            size_t len) {
+  blake2b_ctx_t s;
+
+  if (blake2b_init(&s, outlen, key, keylen) != BLAKE2_OK) {
+    return BLAKE2_ERR_PARAM;
+  }
+  blake2b_update(&s, in, len);
+  blake2b_final(&s, md);
+  return BLAKE2_OK;
+}
+
+static void blake2b_hash_init(void* state, size_t md_len) {
+  blake2b_init(state, md_len, NULL, 0);
+}
+
+static void blake2b_hash_update(void* state, const void* in, size_t len) {
+  blake2b_update(state, in, len);
+}
+
+static void blake2b_hash_final(void* state, uint8_t* md) {
+  blake2b_final(state, md);
+}
+
+const crypto_hash_desc_t crypto_hash_blake2b = {
+  "BLAKE2b", BLAKE2B_OUT_BYTES, BLAKE2B_OUT_BYTES, BLAKE2B_BLOCK_BYTES, sizeof(blake2b_ctx_t),
+  blake2b_hash_init, blake2b_hash_update, blake2b_hash_final
+};
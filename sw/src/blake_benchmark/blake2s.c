@@ -0,0 +1,192 @@
+/*
+ * File      : blake2s.c
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE2s (RFC 7693) on RVV, and the row-wise round function
+ * it shares with BLAKE3.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/blake/api_blake2.h"
+#include "crypto/blake/blake_core.h"
+
+static const uint32_t kBlake2sIV[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+const blake_sched32_t kBlake2sSched[10] = {
+  {   0,   8,  16,  24,   4,  12,  20,  28,  32,  40,  48,  56,  36,  44,  52,  60 },
+  {  56,  16,  36,  52,  40,  32,  60,  24,   4,   0,  44,  20,  48,   8,  28,  12 },
+  {  44,  48,  20,  60,  32,   0,   8,  52,  40,  12,  28,  36,  56,  24,   4,  16 },
+  {  28,  12,  52,  44,  36,   4,  48,  56,   8,  20,  16,  60,  24,  40,   0,  32 },
+  {  36,  20,   8,  40,   0,  28,  16,  60,  56,  44,  24,  12,   4,  48,  32,  52 },
+  {   8,  24,   0,  32,  48,  40,  44,  12,  16,  28,  60,   4,  52,  20,  56,  36 },
+  {  48,   4,  56,  16,  20,  60,  52,  40,   0,  24,  36,  32,  28,  12,   8,  44 },
+  {  52,  28,  48,  12,  44,  56,   4,  36,  20,  60,  32,   8,   0,  16,  24,  40 },
+  {  24,  56,  44,   0,  60,  36,  12,  32,  48,  52,   4,  40,   8,  28,  16,  20 },
+  {  40,  32,  28,   4,   8,  16,  24,  20,  60,  36,  12,  52,  44,  56,  48,   0 }
+};
+
+//! G on the four elements of the rows a, b, c, d with the message words x, y
+#define G32(a, b, c, d, x, y)                                                   \
+  a = __riscv_vadd_vv_u32m1(__riscv_vadd_vv_u32m1(a, b, vl), x, vl);            \
+  d = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(d, a, vl), 16, vl);           \
+  c = __riscv_vadd_vv_u32m1(c, d, vl);                                          \
+  b = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(b, c, vl), 12, vl);           \
+  a = __riscv_vadd_vv_u32m1(__riscv_vadd_vv_u32m1(a, b, vl), y, vl);            \
+  d = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(d, a, vl),  8, vl);           \
+  c = __riscv_vadd_vv_u32m1(c, d, vl);                                          \
+  b = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(b, c, vl),  7, vl)
+
+//! Message words of step k (0..3) of a round, gathered from the block
+#define MSG32(k) \
+  __riscv_vluxei32_v_u32m1(m, __riscv_vle32_v_u32m1(sched[r] + 4 * (k), vl), vl)
+
+void blake2s_rounds(uint32_t v[16], const uint32_t m[16], const blake_sched32_t* sched,
+                    size_t rounds) {
+  size_t vl = __riscv_vsetvl_e32m1(4);
+
+  vuint32m1_t a = __riscv_vle32_v_u32m1(v +  0, vl);
+  vuint32m1_t b = __riscv_vle32_v_u32m1(v +  4, vl);
+  vuint32m1_t c = __riscv_vle32_v_u32m1(v +  8, vl);
+  vuint32m1_t d = __riscv_vle32_v_u32m1(v + 12, vl);
+
+  // element j of row k + 1 takes word j + k + 1 of the row, mod 4
+  vuint32m1_t lane = __riscv_vid_v_u32m1(vl);
+  vuint32m1_t rot1 = __riscv_vand_vx_u32m1(__riscv_vadd_vx_u32m1(lane, 1, vl), 3, vl);
+  vuint32m1_t rot2 = __riscv_vand_vx_u32m1(__riscv_vadd_vx_u32m1(lane, 2, vl), 3, vl);
+  vuint32m1_t rot3 = __riscv_vand_vx_u32m1(__riscv_vadd_vx_u32m1(lane, 3, vl), 3, vl);
+
+  for (size_t r = 0; r < rounds; r++) {
+    G32(a, b, c, d, MSG32(0), MSG32(1));
+
+    b = __riscv_vrgather_vv_u32m1(b, rot1, vl);
+    c = __riscv_vrgather_vv_u32m1(c, rot2, vl);
+    d = __riscv_vrgather_vv_u32m1(d, rot3, vl);
+
+    G32(a, b, c, d, MSG32(2), MSG32(3));
+
+    b = __riscv_vrgather_vv_u32m1(b, rot3, vl);
+    c = __riscv_vrgather_vv_u32m1(c, rot2, vl);
+    d = __riscv_vrgather_vv_u32m1(d, rot1, vl);
+  }
+
+  __riscv_vse32_v_u32m1(v +  0, a, vl);
+  __riscv_vse32_v_u32m1(v +  4, b, vl);
+  __riscv_vse32_v_u32m1(v +  8, c, vl);
+  __riscv_vse32_v_u32m1(v + 12, d, vl);
+}
+
+static void blake2s_compress(blake2s_ctx_t* s, const uint8_t* block, int last) {
+  uint32_t m[16];
+  uint32_t v[16];
+
+  memcpy(m, block, sizeof(m));          // little endian, any alignment
+  memcpy(v, s->h, 32);
+  memcpy(v + 8, kBlake2sIV, 32);
+  v[12] ^= s->t[0];
+  v[13] ^= s->t[1];
+  if (last) {
+    v[14] = ~v[14];
+  }
+
+  blake2s_rounds(v, m, kBlake2sSched, 10);
+
+  for (int i = 0; i < 8; i++) {
+    s->h[i] ^= v[i] ^ v[i + 8];
+  }
+}
+
+static void blake2s_count(blake2s_ctx_t* s, uint32_t n) {
+  s->t[0] += n;
+  s->t[1] += s->t[0] < n;
+}
+
+int blake2s_init(blake2s_ctx_t* s, size_t outlen, const void* key, size_t keylen) {
+  if (outlen == 0 || outlen > BLAKE2S_OUT_BYTES || keylen > BLAKE2S_OUT_BYTES) {
+    return BLAKE2_ERR_PARAM;
+  }
+
+  memcpy(s->h, kBlake2sIV, sizeof(s->h));
+  s->h[0] ^= 0x01010000 ^ (keylen << 8) ^ outlen;
+  s->t[0]  = 0;
+  s->t[1]  = 0;
+  s->buflen = 0;
+  s->outlen = outlen;
+
+  // the key is hashed as a whole first block
+  if (keylen) {
+    memset(s->buf, 0, sizeof(s->buf));
+    memcpy(s->buf, key, keylen);
+    s->buflen = BLAKE2S_BLOCK_BYTES;
+  }
+  return BLAKE2_OK;
+}
+
+void blake2s_update(blake2s_ctx_t* s, const void* in, size_t len) {
+  const uint8_t* p = in;
+
+  // the last block must stay pending, it is compressed by final
+  if (len > BLAKE2S_BLOCK_BYTES - s->buflen) {
+    size_t n = BLAKE2S_BLOCK_BYTES - s->buflen;
+    memcpy(s->buf + s->buflen, p, n);
+    blake2s_count(s, BLAKE2S_BLOCK_BYTES);
+    blake2s_compress(s, s->buf, 0);
+    s->buflen = 0;
+    p   += n;
+    len -= n;
+
+    while (len > BLAKE2S_BLOCK_BYTES) {
+      blake2s_count(s, BLAKE2S_BLOCK_BYTES);
+      blake2s_compress(s, p, 0);
+      p   += BLAKE2S_BLOCK_BYTES;
+      len -= BLAKE2S_BLOCK_BYTES;
+    }
+  }
+
+  memcpy(s->buf + s->buflen, p, len);
+  s->buflen += len;
+}
+
+void blake2s_final(blake2s_ctx_t* s, uint8_t* md) {
+  blake2s_count(s, s->buflen);
+  memset(s->buf + s->buflen, 0, BLAKE2S_BLOCK_BYTES - s->buflen);
+  blake2s_compress(s, s->buf, 1);
+
+  memcpy(md, s->h, s->outlen);
+}
+
+int blake2s(uint8_t* md, size_t outlen, const void* key, size_t keylen, const void* in,
+            size_t len) {
+  blake2s_ctx_t s;
+
+  if (blake2s_init(&s, outlen, key, keylen) != BLAKE2_OK) {
+    return BLAKE2_ERR_PARAM;
+  }
+  blake2s_update(&s, in, len);
+  blake2s_final(&s, md);
+  return BLAKE2_OK;
+}
+
+static void blake2s_hash_init(void* state, size_t md_len) {
+  blake2s_init(state, md_len, NULL, 0);
+}
+
+static void blake2s_hash_update(void* state, const void* in, size_t len) {
+  blake2s_update(state, in, len);
+}
+
+static void blake2s_hash_final(void* state, uint8_t* md) {
+  blake2s_final(state, md);
+}
+
+const crypto_hash_desc_t crypto_hash_blake2s = {
+  "BLAKE2s", BLAKE2S_OUT_BYTES, BLAKE2S_OUT_BYTES, BLAKE2S_BLOCK_BYTES, sizeof(blake2s_ctx_t),
+  blake2s_hash_init, blake2s_hash_update, blake2s_hash_final
+};
@@ -0,0 +1,420 @@
+/*
+ * File      : blake3.c
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE3 on RVV.
+ *
+ * Within a chunk, and for the root and the stack merges, one block at a
+ * time goes through the row-wise rounds shared with BLAKE2s. A run of whole
+ * chunks which is certainly not the last input is compressed one chunk per
+ * vector element instead: word i of the state of every chunk is one vector,
+ * the message words are transposed in with strided loads. The run is 2^k
+ * chunks starting at a multiple of 2^k, a complete subtree, so its parents
+ * are compressed the same way, one level at a time, and only the subtree
+ * root joins the chaining value stack.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/blake/api_blake3.h"
+#include "crypto/blake/blake_core.h"
+
+//! Domain flags
+#define BLAKE3_CHUNK_START  (1 << 0)
+#define BLAKE3_CHUNK_END    (1 << 1)
+#define BLAKE3_PARENT       (1 << 2)
+#define BLAKE3_ROOT         (1 << 3)
+#define BLAKE3_KEYED_HASH   (1 << 4)
+
+static const uint32_t kBlake3IV[8] = {
+  0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+  0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+const blake_sched32_t kBlake3Sched[7] = {
+  {   0,   8,  16,  24,   4,  12,  20,  28,  32,  40,  48,  56,  36,  44,  52,  60 },
+  {   8,  12,  28,  16,  24,  40,   0,  52,   4,  48,  36,  60,  44,  20,  56,  32 },
+  {  12,  40,  52,  28,  16,  48,   8,  56,  24,  36,  44,  32,  20,   0,  60,   4 },
+  {  40,  48,  56,  52,  28,  36,  12,  60,  16,  44,  20,   4,   0,   8,  32,  24 },
+  {  48,  36,  60,  56,  52,  44,  40,  32,  28,  20,   0,  24,   8,  12,   4,  16 },
+  {  36,  44,  32,  60,  56,  20,  48,   4,  52,   0,   8,  16,  12,  40,  24,  28 },
+  {  44,  20,   4,  32,  60,   0,  36,  24,  56,   8,  12,  28,  40,  48,  16,  52 }
+};
+
+//! Input of a compression which is not done yet (chunk end or parent)
+typedef struct {
+  uint32_t cv    [8];
+  uint8_t  block [BLAKE3_BLOCK_BYTES];
+  uint64_t counter;
+  uint32_t block_len;
+  uint32_t flags;
+} blake3_output_t;
+
+/******************************* one block ************************************/
+
+static void blake3_compress(uint32_t v[16], const uint32_t cv[8], const uint8_t* block,
+                            uint64_t counter, uint32_t block_len, uint32_t flags) {
+  uint32_t m[16];
+
+  memcpy(m, block, sizeof(m));          // little endian, any alignment
+  memcpy(v, cv, 32);
+  memcpy(v + 8, kBlake3IV, 16);
+  v[12] = (uint32_t)counter;
+  v[13] = (uint32_t)(counter >> 32);
+  v[14] = block_len;
+  v[15] = flags;
+
+  blake2s_rounds(v, m, kBlake3Sched, 7);
+}
+
+//! cv = first 8 words of the compression of block, keyed by cv
+static void blake3_compress_cv(uint32_t cv[8], const uint8_t* block, uint64_t counter,
+                               uint32_t block_len, uint32_t flags) {
+  uint32_t v[16];
+
+  blake3_compress(v, cv, block, counter, block_len, flags);
+  for (int i = 0; i < 8; i++) {
+    cv[i] = v[i] ^ v[i + 8];
+  }
+}
+
+/******************************* many chunks **********************************/
+
+//! a, b, c, d and the message words x, y are the same word of every input
+#define G3(a, b, c, d, x, y)                                                    \
+  a = __riscv_vadd_vv_u32m1(__riscv_vadd_vv_u32m1(a, b, vl), x, vl);            \
+  d = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(d, a, vl), 16, vl);           \
+  c = __riscv_vadd_vv_u32m1(c, d, vl);                                          \
+  b = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(b, c, vl), 12, vl);           \
+  a = __riscv_vadd_vv_u32m1(__riscv_vadd_vv_u32m1(a, b, vl), y, vl);            \
+  d = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(d, a, vl),  8, vl);           \
+  c = __riscv_vadd_vv_u32m1(c, d, vl);                                          \
+  b = __riscv_vror_vx_u32m1(__riscv_vxor_vv_u32m1(b, c, vl),  7, vl)
+
+//! Message word at byte offset `off` of the schedule, for every input
+#define M3(off) __riscv_vle32_v_u32m1(msg + ((off) >> 2) * vl, vl)
+
+/*!
+@brief Compress `blocks` blocks of vl inputs side by side.
+@details Input e starts at in + e * stride, its blocks are compressed with
+the counter counter (+ e if inc is set). flags_start and flags_end are added
+to the flags of the first and of the last block. The chaining value of input
+e is stored to out + 32 * e, out may overlap in.
+*/
+static void blake3_hash_lanes(uint8_t* out, const uint8_t* in, size_t stride, size_t blocks,
+                              const uint32_t key[8], uint64_t counter, int inc, uint32_t flags,
+                              uint32_t flags_start, uint32_t flags_end, size_t vl) {
+  uint32_t msg  [16 * BLAKE3_MAX_LANES];  // word i of input e at msg[i * vl + e]
+  uint32_t h    [ 8 * BLAKE3_MAX_LANES];
+  uint32_t ctr  [ 2 * BLAKE3_MAX_LANES];
+  int      aligned = (((uintptr_t)in | stride) & 3) == 0;
+
+  vl = __riscv_vsetvl_e32m1(vl);
+
+  for (size_t e = 0; e < vl; e++) {
+    uint64_t c = counter + (inc ? e : 0);
+    ctr[e]      = (uint32_t)c;
+    ctr[vl + e] = (uint32_t)(c >> 32);
+  }
+  for (int i = 0; i < 8; i++) {
+    __riscv_vse32_v_u32m1(h + i * vl, __riscv_vmv_v_x_u32m1(key[i], vl), vl);
+  }
+
+  for (size_t b = 0; b < blocks; b++) {
+    const uint8_t* p = in + b * BLAKE3_BLOCK_BYTES;
+    uint32_t       f = flags | (b == 0 ? flags_start : 0) | (b == blocks - 1 ? flags_end : 0);
+
+    // transpose the block of every input
+    if (aligned) {
+      for (int i = 0; i < 16; i++) {
+        __riscv_vse32_v_u32m1(msg + i * vl,
+                              __riscv_vlse32_v_u32m1((const uint32_t*)(p + 4 * i), stride, vl), vl);
+      }
+    } else {
+      for (size_t e = 0; e < vl; e++) {
+        uint32_t w[16];
+        memcpy(w, p + e * stride, sizeof(w));
+        for (int i = 0; i < 16; i++) {
+          msg[i * vl + e] = w[i];
+        }
+      }
+    }
+
+    vuint32m1_t v0  = __riscv_vle32_v_u32m1(h + 0 * vl, vl);
+    vuint32m1_t v1  = __riscv_vle32_v_u32m1(h + 1 * vl, vl);
+    vuint32m1_t v2  = __riscv_vle32_v_u32m1(h + 2 * vl, vl);
+    vuint32m1_t v3  = __riscv_vle32_v_u32m1(h + 3 * vl, vl);
+    vuint32m1_t v4  = __riscv_vle32_v_u32m1(h + 4 * vl, vl);
+    vuint32m1_t v5  = __riscv_vle32_v_u32m1(h + 5 * vl, vl);
+    vuint32m1_t v6  = __riscv_vle32_v_u32m1(h + 6 * vl, vl);
+    vuint32m1_t v7  = __riscv_vle32_v_u32m1(h + 7 * vl, vl);
+    vuint32m1_t v8  = __riscv_vmv_v_x_u32m1(kBlake3IV[0], vl);
+    vuint32m1_t v9  = __riscv_vmv_v_x_u32m1(kBlake3IV[1], vl);
+    vuint32m1_t v10 = __riscv_vmv_v_x_u32m1(kBlake3IV[2], vl);
+    vuint32m1_t v11 = __riscv_vmv_v_x_u32m1(kBlake3IV[3], vl);
+    vuint32m1_t v12 = __riscv_vle32_v_u32m1(ctr, vl);
+    vuint32m1_t v13 = __riscv_vle32_v_u32m1(ctr + vl, vl);
+    vuint32m1_t v14 = __riscv_vmv_v_x_u32m1(BLAKE3_BLOCK_BYTES, vl);
+    vuint32m1_t v15 = __riscv_vmv_v_x_u32m1(f, vl);
+
+    for (int r = 0; r < 7; r++) {
+      const uint32_t* s = kBlake3Sched[r];
+
+      G3(v0, v4, v8,  v12, M3(s[ 0]), M3(s[ 4]));
+      G3(v1, v5, v9,  v13, M3(s[ 1]), M3(s[ 5]));
+      G3(v2, v6, v10, v14, M3(s[ 2]), M3(s[ 6]));
+      G3(v3, v7, v11, v15, M3(s[ 3]), M3(s[ 7]));
+
+      G3(v0, v5, v10, v15, M3(s[ 8]), M3(s[12]));
+      G3(v1, v6, v11, v12, M3(s[ 9]), M3(s[13]));
+      G3(v2, v7, v8,  v13, M3(s[10]), M3(s[14]));
+      G3(v3, v4, v9,  v14, M3(s[11]), M3(s[15]));
+    }
+
+    __riscv_vse32_v_u32m1(h + 0 * vl, __riscv_vxor_vv_u32m1(v0, v8,  vl), vl);
+    __riscv_vse32_v_u32m1(h + 1 * vl, __riscv_vxor_vv_u32m1(v1, v9,  vl), vl);
+    __riscv_vse32_v_u32m1(h + 2 * vl, __riscv_vxor_vv_u32m1(v2, v10, vl), vl);
+    __riscv_vse32_v_u32m1(h + 3 * vl, __riscv_vxor_vv_u32m1(v3, v11, vl), vl);
+    __riscv_vse32_v_u32m1(h + 4 * vl, __riscv_vxor_vv_u32m1(v4, v12, vl), vl);
+    __riscv_vse32_v_u32m1(h + 5 * vl, __riscv_vxor_vv_u32m1(v5, v13, vl), vl);
+    __riscv_vse32_v_u32m1(h + 6 * vl, __riscv_vxor_vv_u32m1(v6, v14, vl), vl);
+    __riscv_vse32_v_u32m1(h + 7 * vl, __riscv_vxor_vv_u32m1(v7, v15, vl), vl);
+  }
+
+  // back to one chaining value per input
+  for (int i = 0; i < 8; i++) {
+    __riscv_vsse32_v_u32m1((uint32_t*)(out + 4 * i), 32,
+                           __riscv_vle32_v_u32m1(h + i * vl, vl), vl);
+  }
+}
+
+/******************************* streaming ************************************/
+
+static void blake3_init_flags(blake3_ctx_t* s, const uint32_t key[8], uint8_t flags) {
+  memcpy(s->key, key, sizeof(s->key));
+  memcpy(s->cv,  key, sizeof(s->cv));
+  s->chunk_counter     = 0;
+  s->buflen            = 0;
+  s->blocks_compressed = 0;
+  s->flags             = flags;
+  s->cv_stack_len      = 0;
+}
+
+void blake3_init(blake3_ctx_t* s) {
+  blake3_init_flags(s, kBlake3IV, 0);
+}
+
+void blake3_init_keyed(blake3_ctx_t* s, const uint8_t key[BLAKE3_KEY_BYTES]) {
+  uint32_t k[8];
+
+  memcpy(k, key, sizeof(k));
+  blake3_init_flags(s, k, BLAKE3_KEYED_HASH);
+}
+
+static size_t blake3_chunk_len(const blake3_ctx_t* s) {
+  return BLAKE3_BLOCK_BYTES * s->blocks_compressed + s->buflen;
+}
+
+static uint32_t blake3_chunk_flags(const blake3_ctx_t* s) {
+  return s->flags | (s->blocks_compressed ? 0 : BLAKE3_CHUNK_START);
+}
+
+//! Add at most the rest of the current chunk, the last block stays pending
+static void blake3_chunk_update(blake3_ctx_t* s, const uint8_t* p, size_t len) {
+  if (s->buflen) {
+    size_t n = BLAKE3_BLOCK_BYTES - s->buflen;
+    n = n < len ? n : len;
+    memcpy(s->buf + s->buflen, p, n);
+    s->buflen += n;
+    p   += n;
+    len -= n;
+
+    if (len) {
+      blake3_compress_cv(s->cv, s->buf, s->chunk_counter, BLAKE3_BLOCK_BYTES,
+                         blake3_chunk_flags(s));
+      s->blocks_compressed++;
+      s->buflen = 0;
+    }
+  }
+
+  while (len > BLAKE3_BLOCK_BYTES) {
+    blake3_compress_cv(s->cv, p, s->chunk_counter, BLAKE3_BLOCK_BYTES, blake3_chunk_flags(s));
+    s->blocks_compressed++;
+    p   += BLAKE3_BLOCK_BYTES;
+    len -= BLAKE3_BLOCK_BYTES;
+  }
+
+  memcpy(s->buf + s->buflen, p, len);
+  s->buflen += len;
+}
+
+static void blake3_chunk_output(const blake3_ctx_t* s, blake3_output_t* o) {
+  memcpy(o->cv, s->cv, sizeof(o->cv));
+  memcpy(o->block, s->buf, s->buflen);
+  memset(o->block + s->buflen, 0, BLAKE3_BLOCK_BYTES - s->buflen);
+  o->counter   = s->chunk_counter;
+  o->block_len = s->buflen;
+  o->flags     = blake3_chunk_flags(s) | BLAKE3_CHUNK_END;
+}
+
+static void blake3_output_cv(const blake3_output_t* o, uint8_t cv[32]) {
+  uint32_t c[8];
+
+  memcpy(c, o->cv, sizeof(c));
+  blake3_compress_cv(c, o->block, o->counter, o->block_len, o->flags);
+  memcpy(cv, c, sizeof(c));
+}
+
+/*!
+@brief Push the chaining value of a complete subtree.
+@details total is the number of such subtrees from the start of the input,
+this one included. As long as it is even, the subtree is the right sibling
+of the top of the stack and both are merged first.
+*/
+static void blake3_push_cv(blake3_ctx_t* s, uint8_t cv[32], uint64_t total) {
+  uint8_t  block[BLAKE3_BLOCK_BYTES];
+  uint32_t c[8];
+
+  while ((total & 1) == 0) {
+    s->cv_stack_len--;
+    memcpy(block, s->cv_stack + 32 * s->cv_stack_len, 32);
+    memcpy(block + 32, cv, 32);
+    memcpy(c, s->key, sizeof(c));
+    blake3_compress_cv(c, block, 0, BLAKE3_BLOCK_BYTES, s->flags | BLAKE3_PARENT);
+    memcpy(cv, c, sizeof(c));
+    total >>= 1;
+  }
+
+  memcpy(s->cv_stack + 32 * s->cv_stack_len, cv, 32);
+  s->cv_stack_len++;
+}
+
+size_t blake3_lanes(void) {
+  size_t vlmax = __riscv_vsetvlmax_e32m1();
+
+  return vlmax < BLAKE3_MAX_LANES ? vlmax : BLAKE3_MAX_LANES;
+}
+
+void blake3_update(blake3_ctx_t* s, const void* in, size_t len) {
+  const uint8_t* p = in;
+  uint32_t       cvs[8 * BLAKE3_MAX_LANES];
+  uint8_t*       cvb = (uint8_t*)cvs;
+
+  // the current chunk is closed only once input beyond it arrives
+  if (blake3_chunk_len(s)) {
+    size_t n = BLAKE3_CHUNK_BYTES - blake3_chunk_len(s);
+    n = n < len ? n : len;
+    blake3_chunk_update(s, p, n);
+    p   += n;
+    len -= n;
+
+    if (!len) {
+      return;
+    }
+
+    blake3_output_t o;
+    blake3_chunk_output(s, &o);
+    blake3_output_cv(&o, cvb);
+    s->chunk_counter++;
+    blake3_push_cv(s, cvb, s->chunk_counter);
+
+    memcpy(s->cv, s->key, sizeof(s->cv));
+    s->buflen            = 0;
+    s->blocks_compressed = 0;
+  }
+
+  // subtrees of 2^k whole chunks side by side, never the last chunk
+  while (len > BLAKE3_CHUNK_BYTES) {
+    size_t n = blake3_lanes();
+    while (n > 1 && (n * BLAKE3_CHUNK_BYTES >= len || (s->chunk_counter & (n - 1)))) {
+      n >>= 1;
+    }
+
+    blake3_hash_lanes(cvb, p, BLAKE3_CHUNK_BYTES, BLAKE3_CHUNK_BYTES / BLAKE3_BLOCK_BYTES,
+                      s->key, s->chunk_counter, 1, s->flags,
+                      BLAKE3_CHUNK_START, BLAKE3_CHUNK_END, n);
+    for (size_t k = n / 2; k > 0; k /= 2) {
+      blake3_hash_lanes(cvb, cvb, 2 * 32, 1, s->key, 0, 0, s->flags | BLAKE3_PARENT, 0, 0, k);
+    }
+
+    s->chunk_counter += n;
+    blake3_push_cv(s, cvb, s->chunk_counter / n);
+    p   += n * BLAKE3_CHUNK_BYTES;
+    len -= n * BLAKE3_CHUNK_BYTES;
+  }
+
+  blake3_chunk_update(s, p, len);
+}
+
+void blake3_final(const blake3_ctx_t* s, uint8_t* out, size_t outlen) {
+  blake3_output_t o;
+  uint32_t        v[16];
+
+  // fold the stack into the root, the current chunk is the rightmost leaf
+  blake3_chunk_output(s, &o);
+  for (size_t i = s->cv_stack_len; i > 0; i--) {
+    uint8_t block[BLAKE3_BLOCK_BYTES];
+    memcpy(block, s->cv_stack + 32 * (i - 1), 32);
+    blake3_output_cv(&o, block + 32);
+
+    memcpy(o.cv, s->key, sizeof(o.cv));
+    memcpy(o.block, block, sizeof(block));
+    o.counter   = 0;
+    o.block_len = BLAKE3_BLOCK_BYTES;
+    o.flags     = s->flags | BLAKE3_PARENT;
+  }
+
+  // the root is compressed once per 64 output bytes
+  for (uint64_t t = 0; outlen; t++) {
+    blake3_compress(v, o.cv, o.block, t, o.block_len, o.flags | BLAKE3_ROOT);
+    for (int i = 0; i < 8; i++) {
+      v[i]     ^= v[i + 8];
+      v[i + 8] ^= o.cv[i];
+    }
+
+    size_t n = outlen < sizeof(v) ? outlen : sizeof(v);
+    memcpy(out, v, n);
+    out    += n;
+    outlen -= n;
+  }
+}
+
+void blake3(uint8_t* out, size_t outlen, const void* in, size_t len) {
+  blake3_ctx_t s;
+
+  blake3_init(&s);
+  blake3_update(&s, in, len);
+  blake3_final(&s, out, outlen);
+}
+
+//! The common interface keeps the digest length next to the context
+typedef struct {
+  blake3_ctx_t ctx;
+  size_t       md_len;
+} blake3_hash_state_t;
+
+static void blake3_hash_init(void* state, size_t md_len) {
+  blake3_hash_state_t* h = state;
+
+  blake3_init(&h->ctx);
+  h->md_len = md_len;
+}
+
+static void blake3_hash_update(void* state, const void* in, size_t len) {
+  blake3_update(&((blake3_hash_state_t*)state)->ctx, in, len);
+}
+
+static void blake3_hash_final(void* state, uint8_t* md) {
+  blake3_hash_state_t* h = state;
+
+  blake3_final(&h->ctx, md, h->md_len);
+}
+
+const crypto_hash_desc_t crypto_hash_blake3 = {
+  "BLAKE3", BLAKE3_OUT_BYTES, SIZE_MAX, BLAKE3_BLOCK_BYTES, sizeof(blake3_hash_state_t),
+  blake3_hash_init, blake3_hash_update, blake3_hash_final
+};
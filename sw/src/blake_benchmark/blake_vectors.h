@@ -0,0 +1,308 @@
+/*
+ * File      : blake_vectors.h
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: BLAKE2s, BLAKE2b and BLAKE3 test vectors, computed with
+ * Python hashlib and the blake3 package. The input of length n is the
+ * sequence i mod 251 for i < n, as in the BLAKE3 test vectors.
+ */
+
+#ifndef __BLAKE_VECTORS_H__
+#define __BLAKE_VECTORS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+#define BLAKE_TEST_INPUTS     18
+#define BLAKE_TEST_MAX_BYTES  31744
+
+typedef struct {
+  size_t  len;
+  uint8_t blake2s [32];
+  uint8_t blake2b [64];
+  uint8_t blake3  [32];
+} blake_vector_t;
+
+static const blake_vector_t blake_vectors [BLAKE_TEST_INPUTS] = {
+  { 0,
+    { 0x69, 0x21, 0x7a, 0x30, 0x79, 0x90, 0x80, 0x94, 0xe1, 0x11, 0x21, 0xd0,
+      0x42, 0x35, 0x4a, 0x7c, 0x1f, 0x55, 0xb6, 0x48, 0x2c, 0xa1, 0xa5, 0x1e,
+      0x1b, 0x25, 0x0d, 0xfd, 0x1e, 0xd0, 0xee, 0xf9 },
+    { 0x78, 0x6a, 0x02, 0xf7, 0x42, 0x01, 0x59, 0x03, 0xc6, 0xc6, 0xfd, 0x85,
+      0x25, 0x52, 0xd2, 0x72, 0x91, 0x2f, 0x47, 0x40, 0xe1, 0x58, 0x47, 0x61,
+      0x8a, 0x86, 0xe2, 0x17, 0xf7, 0x1f, 0x54, 0x19, 0xd2, 0x5e, 0x10, 0x31,
+      0xaf, 0xee, 0x58, 0x53, 0x13, 0x89, 0x64, 0x44, 0x93, 0x4e, 0xb0, 0x4b,
+      0x90, 0x3a, 0x68, 0x5b, 0x14, 0x48, 0xb7, 0x55, 0xd5, 0x6f, 0x70, 0x1a,
+      0xfe, 0x9b, 0xe2, 0xce },
+    { 0xaf, 0x13, 0x49, 0xb9, 0xf5, 0xf9, 0xa1, 0xa6, 0xa0, 0x40, 0x4d, 0xea,
+      0x36, 0xdc, 0xc9, 0x49, 0x9b, 0xcb, 0x25, 0xc9, 0xad, 0xc1, 0x12, 0xb7,
+      0xcc, 0x9a, 0x93, 0xca, 0xe4, 0x1f, 0x32, 0x62 } },
+  { 1,
+    { 0xe3, 0x4d, 0x74, 0xdb, 0xaf, 0x4f, 0xf4, 0xc6, 0xab, 0xd8, 0x71, 0xcc,
+      0x22, 0x04, 0x51, 0xd2, 0xea, 0x26, 0x48, 0x84, 0x6c, 0x77, 0x57, 0xfb,
+      0xaa, 0xc8, 0x2f, 0xe5, 0x1a, 0xd6, 0x4b, 0xea },
+    { 0x2f, 0xa3, 0xf6, 0x86, 0xdf, 0x87, 0x69, 0x95, 0x16, 0x7e, 0x7c, 0x2e,
+      0x5d, 0x74, 0xc4, 0xc7, 0xb6, 0xe4, 0x8f, 0x80, 0x68, 0xfe, 0x0e, 0x44,
+      0x20, 0x83, 0x44, 0xd4, 0x80, 0xf7, 0x90, 0x4c, 0x36, 0x96, 0x3e, 0x44,
+      0x11, 0x5f, 0xe3, 0xeb, 0x2a, 0x3a, 0xc8, 0x69, 0x4c, 0x28, 0xbc, 0xb4,
+      0xf5, 0xa0, 0xf3, 0x27, 0x6f, 0x2e, 0x79, 0x48, 0x7d, 0x82, 0x19, 0x05,
+      0x7a, 0x50, 0x6e, 0x4b },
+    { 0x2d, 0x3a, 0xde, 0xdf, 0xf1, 0x1b, 0x61, 0xf1, 0x4c, 0x88, 0x6e, 0x35,
+      0xaf, 0xa0, 0x36, 0x73, 0x6d, 0xcd, 0x87, 0xa7, 0x4d, 0x27, 0xb5, 0xc1,
+      0x51, 0x02, 0x25, 0xd0, 0xf5, 0x92, 0xe2, 0x13 } },
+  { 63,
+    { 0xe5, 0x7c, 0xb7, 0x94, 0x87, 0xdd, 0x57, 0x90, 0x24, 0x32, 0xb2, 0x50,
+      0x73, 0x38, 0x13, 0xbd, 0x96, 0xa8, 0x4e, 0xfc, 0xe5, 0x9f, 0x65, 0x0f,
+      0xac, 0x26, 0xe6, 0x69, 0x6a, 0xef, 0xaf, 0xc3 },
+    { 0xd1, 0x0b, 0xf9, 0xa1, 0x5b, 0x1c, 0x9f, 0xc8, 0xd4, 0x1f, 0x89, 0xbb,
+      0x14, 0x0b, 0xf0, 0xbe, 0x08, 0xd2, 0xf3, 0x66, 0x61, 0x76, 0xd1, 0x3b,
+      0xaa, 0xc4, 0xd3, 0x81, 0x35, 0x8a, 0xd0, 0x74, 0xc9, 0xd4, 0x74, 0x8c,
+      0x30, 0x05, 0x20, 0xeb, 0x02, 0x6d, 0xae, 0xae, 0xa7, 0xc5, 0xb1, 0x58,
+      0x89, 0x2f, 0xde, 0x4e, 0x8e, 0xc1, 0x7d, 0xc9, 0x98, 0xdc, 0xd5, 0x07,
+      0xdf, 0x26, 0xeb, 0x63 },
+    { 0xe9, 0xbc, 0x37, 0xa5, 0x94, 0xda, 0xad, 0x83, 0xbe, 0x94, 0x70, 0xdf,
+      0x7f, 0x7b, 0x37, 0x98, 0x29, 0x7c, 0x3d, 0x83, 0x4c, 0xe8, 0x0b, 0xa8,
+      0x5d, 0x6e, 0x20, 0x76, 0x27, 0xb7, 0xdb, 0x7b } },
+  { 64,
+    { 0x56, 0xf3, 0x4e, 0x8b, 0x96, 0x55, 0x7e, 0x90, 0xc1, 0xf2, 0x4b, 0x52,
+      0xd0, 0xc8, 0x9d, 0x51, 0x08, 0x6a, 0xcf, 0x1b, 0x00, 0xf6, 0x34, 0xcf,
+      0x1d, 0xde, 0x92, 0x33, 0xb8, 0xea, 0xaa, 0x3e },
+    { 0x2f, 0xc6, 0xe6, 0x9f, 0xa2, 0x6a, 0x89, 0xa5, 0xed, 0x26, 0x90, 0x92,
+      0xcb, 0x9b, 0x2a, 0x44, 0x9a, 0x44, 0x09, 0xa7, 0xa4, 0x40, 0x11, 0xee,
+      0xca, 0xd1, 0x3d, 0x7c, 0x4b, 0x04, 0x56, 0x60, 0x2d, 0x40, 0x2f, 0xa5,
+      0x84, 0x4f, 0x1a, 0x7a, 0x75, 0x81, 0x36, 0xce, 0x3d, 0x5d, 0x8d, 0x0e,
+      0x8b, 0x86, 0x92, 0x1f, 0xff, 0xf4, 0xf6, 0x92, 0xdd, 0x95, 0xbd, 0xc8,
+      0xe5, 0xff, 0x00, 0x52 },
+    { 0x4e, 0xed, 0x71, 0x41, 0xea, 0x4a, 0x5c, 0xd4, 0xb7, 0x88, 0x60, 0x6b,
+      0xd2, 0x3f, 0x46, 0xe2, 0x12, 0xaf, 0x9c, 0xac, 0xeb, 0xac, 0xdc, 0x7d,
+      0x1f, 0x4c, 0x6d, 0xc7, 0xf2, 0x51, 0x1b, 0x98 } },
+  { 65,
+    { 0x1b, 0x53, 0xee, 0x94, 0xaa, 0xf3, 0x4e, 0x4b, 0x15, 0x9d, 0x48, 0xde,
+      0x35, 0x2c, 0x7f, 0x06, 0x61, 0xd0, 0xa4, 0x0e, 0xdf, 0xf9, 0x5a, 0x0b,
+      0x16, 0x39, 0xb4, 0x09, 0x0e, 0x97, 0x44, 0x72 },
+    { 0xfc, 0xbe, 0x8b, 0xe7, 0xdc, 0xb4, 0x9a, 0x32, 0xdb, 0xdf, 0x23, 0x94,
+      0x59, 0xe2, 0x63, 0x08, 0xb8, 0x4d, 0xff, 0x1e, 0xa4, 0x80, 0xdf, 0x8d,
+      0x10, 0x4e, 0xef, 0xf3, 0x4b, 0x46, 0xfa, 0xe9, 0x86, 0x27, 0xb4, 0x50,
+      0xc2, 0x26, 0x7d, 0x48, 0xc0, 0x94, 0x6a, 0x69, 0x7c, 0x5b, 0x59, 0x53,
+      0x14, 0x52, 0xac, 0x04, 0x84, 0xf1, 0xc8, 0x4e, 0x3a, 0x33, 0xd0, 0xc3,
+      0x39, 0xbb, 0x2e, 0x28 },
+    { 0xde, 0x1e, 0x5f, 0xa0, 0xbe, 0x70, 0xdf, 0x6d, 0x2b, 0xe8, 0xff, 0xfd,
+      0x0e, 0x99, 0xce, 0xaa, 0x8e, 0xb6, 0xe8, 0xc9, 0x3a, 0x63, 0xf2, 0xd8,
+      0xd1, 0xc3, 0x0e, 0xcb, 0x6b, 0x26, 0x3d, 0xee } },
+  { 128,
+    { 0x1f, 0xa8, 0x77, 0xde, 0x67, 0x25, 0x9d, 0x19, 0x86, 0x3a, 0x2a, 0x34,
+      0xbc, 0xc6, 0x96, 0x2a, 0x2b, 0x25, 0xfc, 0xbf, 0x5c, 0xbe, 0xcd, 0x7e,
+      0xde, 0x8f, 0x1f, 0xa3, 0x66, 0x88, 0xa7, 0x96 },
+    { 0x23, 0x19, 0xe3, 0x78, 0x9c, 0x47, 0xe2, 0xda, 0xa5, 0xfe, 0x80, 0x7f,
+      0x61, 0xbe, 0xc2, 0xa1, 0xa6, 0x53, 0x7f, 0xa0, 0x3f, 0x19, 0xff, 0x32,
+      0xe8, 0x7e, 0xec, 0xbf, 0xd6, 0x4b, 0x7e, 0x0e, 0x8c, 0xcf, 0xf4, 0x39,
+      0xac, 0x33, 0x3b, 0x04, 0x0f, 0x19, 0xb0, 0xc4, 0xdd, 0xd1, 0x1a, 0x61,
+      0xe2, 0x4a, 0xc1, 0xfe, 0x0f, 0x10, 0xa0, 0x39, 0x80, 0x6c, 0x5d, 0xcc,
+      0x0d, 0xa3, 0xd1, 0x15 },
+    { 0xf1, 0x7e, 0x57, 0x05, 0x64, 0xb2, 0x65, 0x78, 0xc3, 0x3b, 0xb7, 0xf4,
+      0x46, 0x43, 0xf5, 0x39, 0x62, 0x4b, 0x05, 0xdf, 0x1a, 0x76, 0xc8, 0x1f,
+      0x30, 0xac, 0xd5, 0x48, 0xc4, 0x4b, 0x45, 0xef } },
+  { 129,
+    { 0x5b, 0xd1, 0x69, 0xe6, 0x7c, 0x82, 0xc2, 0xc2, 0xe9, 0x8e, 0xf7, 0x00,
+      0x8b, 0xdf, 0x26, 0x1f, 0x2d, 0xdf, 0x30, 0xb1, 0xc0, 0x0f, 0x9e, 0x7f,
+      0x27, 0x5b, 0xb3, 0xe8, 0xa2, 0x8d, 0xc9, 0xa2 },
+    { 0xf5, 0x97, 0x11, 0xd4, 0x4a, 0x03, 0x1d, 0x5f, 0x97, 0xa9, 0x41, 0x3c,
+      0x06, 0x5d, 0x1e, 0x61, 0x4c, 0x41, 0x7e, 0xde, 0x99, 0x85, 0x90, 0x32,
+      0x5f, 0x49, 0xba, 0xd2, 0xfd, 0x44, 0x4d, 0x3e, 0x44, 0x18, 0xbe, 0x19,
+      0xae, 0xc4, 0xe1, 0x14, 0x49, 0xac, 0x1a, 0x57, 0x20, 0x78, 0x98, 0xbc,
+      0x57, 0xd7, 0x6a, 0x1b, 0xcf, 0x35, 0x66, 0x29, 0x2c, 0x20, 0xc6, 0x83,
+      0xa5, 0xc4, 0x64, 0x8f },
+    { 0x68, 0x3a, 0xaa, 0xe9, 0xf3, 0xc5, 0xba, 0x37, 0xea, 0xaf, 0x07, 0x2a,
+      0xed, 0x0f, 0x9e, 0x30, 0xba, 0xc0, 0x86, 0x51, 0x37, 0xba, 0xe6, 0x8b,
+      0x1f, 0xde, 0x4c, 0xa2, 0xae, 0xbd, 0xcb, 0x12 } },
+  { 1023,
+    { 0xe7, 0x3d, 0x4c, 0xf8, 0x04, 0x07, 0xe1, 0x85, 0xa3, 0xf0, 0xd1, 0x4c,
+      0x04, 0x72, 0xd3, 0x5e, 0x2c, 0xa1, 0x52, 0x18, 0xce, 0x76, 0x00, 0x4e,
+      0x8a, 0x59, 0x60, 0x65, 0xd3, 0x3a, 0xf5, 0xc3 },
+    { 0xe5, 0x5f, 0xd6, 0x11, 0xa1, 0x66, 0x96, 0xf8, 0x29, 0x5e, 0xa5, 0x12,
+      0x0a, 0x15, 0x1e, 0x31, 0x2e, 0x5d, 0xfb, 0x14, 0x88, 0xac, 0x74, 0xbe,
+      0x64, 0x11, 0x8f, 0xfe, 0x1b, 0xc1, 0xd5, 0x39, 0xe7, 0x25, 0xad, 0x04,
+      0x40, 0xe5, 0x21, 0x3d, 0xe2, 0x97, 0xba, 0x43, 0x5d, 0x38, 0x1c, 0x66,
+      0xed, 0xf8, 0x8e, 0xeb, 0xf2, 0x8b, 0x8d, 0x64, 0x0e, 0x31, 0x10, 0x38,
+      0x42, 0xd3, 0xbe, 0x29 },
+    { 0x10, 0x10, 0x89, 0x70, 0xee, 0xda, 0x3e, 0xb9, 0x32, 0xba, 0xac, 0x14,
+      0x28, 0xc7, 0xa2, 0x16, 0x3b, 0x0e, 0x92, 0x4c, 0x9a, 0x9e, 0x25, 0xb3,
+      0x5b, 0xba, 0x72, 0xb2, 0x8f, 0x70, 0xbd, 0x11 } },
+  { 1024,
+    { 0xee, 0xfe, 0x54, 0x0b, 0x09, 0x1c, 0x08, 0x1f, 0x91, 0xa3, 0x1b, 0x4d,
+      0xb9, 0x99, 0x26, 0x35, 0x2f, 0x05, 0xcc, 0x01, 0x2a, 0x7a, 0x14, 0x02,
+      0x26, 0x89, 0x23, 0xdd, 0x00, 0xa2, 0x78, 0xd7 },
+    { 0x8d, 0x10, 0x90, 0x90, 0x90, 0x17, 0xad, 0xd4, 0x0e, 0x74, 0x9d, 0xf2,
+      0xd0, 0xeb, 0xac, 0x43, 0x27, 0x3d, 0x6f, 0xc8, 0x16, 0xbc, 0x4f, 0xfa,
+      0xf2, 0xa6, 0xdf, 0xab, 0xe4, 0x20, 0x6d, 0xea, 0x13, 0x67, 0x7d, 0x20,
+      0x02, 0x39, 0x9e, 0x4a, 0x38, 0xe7, 0x00, 0xd8, 0x08, 0x3d, 0xb4, 0xaf,
+      0x83, 0x41, 0xee, 0x9b, 0x3a, 0x51, 0x47, 0x11, 0x0b, 0x6a, 0x96, 0x3a,
+      0x38, 0x94, 0xe4, 0xe2 },
+    { 0x42, 0x21, 0x47, 0x39, 0xf0, 0x95, 0xa4, 0x06, 0xf3, 0xfc, 0x83, 0xde,
+      0xb8, 0x89, 0x74, 0x4a, 0xc0, 0x0d, 0xf8, 0x31, 0xc1, 0x0d, 0xaa, 0x55,
+      0x18, 0x9b, 0x5d, 0x12, 0x1c, 0x85, 0x5a, 0xf7 } },
+  { 1025,
+    { 0x9b, 0x4b, 0x1b, 0xfb, 0x89, 0x17, 0x75, 0x45, 0xcc, 0x59, 0xb3, 0x21,
+      0xbe, 0x54, 0x03, 0x77, 0x4c, 0x58, 0xf0, 0x61, 0xdb, 0x92, 0x7f, 0x04,
+      0xd2, 0x06, 0x11, 0x6b, 0x82, 0x78, 0xd2, 0xb4 },
+    { 0x7a, 0x9e, 0x52, 0x83, 0xa1, 0x5d, 0x13, 0xb9, 0x95, 0x75, 0x53, 0x60,
+      0xfd, 0xe4, 0xc6, 0x5c, 0x2a, 0xe1, 0xbc, 0x0c, 0xf3, 0x3e, 0x8d, 0xb2,
+      0xce, 0x84, 0x16, 0xe5, 0xd1, 0x06, 0x97, 0xc7, 0x3f, 0xc4, 0xb2, 0x62,
+      0x2a, 0x29, 0xb9, 0x38, 0xa1, 0xfa, 0xec, 0x43, 0xd9, 0x31, 0xb0, 0x2e,
+      0x71, 0xad, 0x86, 0x35, 0xe0, 0x71, 0x26, 0x56, 0x33, 0x64, 0x3a, 0x9d,
+      0x93, 0x96, 0xec, 0x28 },
+    { 0xd0, 0x02, 0x78, 0xae, 0x47, 0xeb, 0x27, 0xb3, 0x4f, 0xae, 0xcf, 0x67,
+      0xb4, 0xfe, 0x26, 0x3f, 0x82, 0xd5, 0x41, 0x29, 0x16, 0xc1, 0xff, 0xd9,
+      0x7c, 0x8c, 0xb7, 0xfb, 0x81, 0x4b, 0x84, 0x44 } },
+  { 2048,
+    { 0xe0, 0xed, 0xc3, 0x6d, 0x40, 0xbf, 0xa4, 0x88, 0xe1, 0x18, 0xfb, 0x94,
+      0x4a, 0xd9, 0x36, 0x1e, 0x1e, 0xc7, 0x2f, 0xe8, 0xf2, 0x45, 0x70, 0xe4,
+      0xef, 0x64, 0x87, 0x6b, 0x7e, 0x3d, 0x1a, 0x49 },
+    { 0x84, 0xef, 0x37, 0x6f, 0x80, 0x80, 0xd5, 0xd1, 0x9a, 0x69, 0x14, 0xc9,
+      0xb8, 0xe8, 0xea, 0xf7, 0x1b, 0x3f, 0x71, 0x6f, 0x5b, 0x4f, 0x0d, 0xa4,
+      0xfd, 0xf8, 0x1b, 0x6c, 0x46, 0x5a, 0x56, 0x56, 0xe0, 0x1b, 0x52, 0x80,
+      0x70, 0x11, 0xe1, 0xfc, 0xe0, 0x5e, 0x77, 0x72, 0x9a, 0xae, 0x54, 0x22,
+      0xc6, 0x42, 0x4f, 0xe2, 0x41, 0xf7, 0xba, 0x93, 0xda, 0x39, 0x45, 0x6e,
+      0x5c, 0x54, 0x48, 0xd9 },
+    { 0xe7, 0x76, 0xb6, 0x02, 0x8c, 0x7c, 0xd2, 0x2a, 0x4d, 0x0b, 0xa1, 0x82,
+      0xa8, 0xbf, 0x62, 0x20, 0x5d, 0x2e, 0xf5, 0x76, 0x46, 0x7e, 0x83, 0x8e,
+      0xd6, 0xf2, 0x52, 0x9b, 0x85, 0xfb, 0xa2, 0x4a } },
+  { 2049,
+    { 0x4e, 0xc1, 0x2e, 0x09, 0x80, 0x6c, 0x18, 0x22, 0x5b, 0x10, 0x77, 0x85,
+      0xa2, 0x03, 0x1e, 0x61, 0xee, 0x12, 0x27, 0x41, 0x2b, 0x9c, 0x18, 0xc5,
+      0x61, 0x1b, 0xc6, 0xe5, 0x4c, 0xd8, 0xc4, 0x15 },
+    { 0x14, 0x65, 0x60, 0xfd, 0x77, 0x4a, 0x01, 0x70, 0x4f, 0xcc, 0xe9, 0x6f,
+      0x5f, 0x9b, 0x4b, 0x04, 0x2a, 0xe4, 0x3c, 0x92, 0x8a, 0xd6, 0x54, 0x6f,
+      0xb0, 0x70, 0xb0, 0xec, 0x18, 0xd2, 0xa4, 0xac, 0x59, 0x25, 0x78, 0xaf,
+      0x03, 0x8a, 0x1f, 0x6c, 0x5b, 0x79, 0x14, 0x4f, 0xb1, 0x6a, 0x0c, 0x64,
+      0x28, 0x99, 0x9d, 0x51, 0x83, 0x84, 0xd8, 0x34, 0x9a, 0x3e, 0xc3, 0x70,
+      0x7a, 0xa5, 0x0a, 0xc2 },
+    { 0x5f, 0x4d, 0x72, 0xf4, 0x0d, 0x7a, 0x5f, 0x82, 0xb1, 0x5c, 0xa2, 0xb2,
+      0xe4, 0x4b, 0x1d, 0xe3, 0xc2, 0xef, 0x86, 0xc4, 0x26, 0xc9, 0x5c, 0x1a,
+      0xf0, 0xb6, 0x87, 0x95, 0x22, 0x56, 0x30, 0x30 } },
+  { 3072,
+    { 0x13, 0xa2, 0xb5, 0x80, 0x2f, 0xf5, 0x92, 0xe3, 0x60, 0x0d, 0x91, 0xaa,
+      0x33, 0x9c, 0xe2, 0xaf, 0xe0, 0x22, 0x06, 0x51, 0x0a, 0xab, 0x76, 0x2e,
+      0x31, 0x42, 0xba, 0x84, 0x4a, 0x83, 0xce, 0x6c },
+    { 0x6a, 0x4f, 0xd5, 0xfd, 0x8c, 0xc0, 0xa8, 0xe7, 0x17, 0xb2, 0x87, 0x57,
+      0xc8, 0x96, 0x09, 0x6b, 0x04, 0x52, 0x75, 0x06, 0x84, 0xcf, 0x7c, 0x6c,
+      0x36, 0x36, 0xf5, 0x1a, 0x98, 0xbe, 0xb3, 0x2c, 0x88, 0xf3, 0x2c, 0x9e,
+      0xd7, 0x14, 0x0f, 0x90, 0xa2, 0xcd, 0xff, 0x2f, 0xc4, 0xff, 0x49, 0xbc,
+      0xaa, 0x25, 0x7f, 0x14, 0xa6, 0xbf, 0x6f, 0x92, 0x65, 0x30, 0xcb, 0x47,
+      0xcc, 0x7a, 0xa3, 0x40 },
+    { 0xb9, 0x8c, 0xb0, 0xff, 0x36, 0x23, 0xbe, 0x03, 0x32, 0x6b, 0x37, 0x3d,
+      0xe6, 0xb9, 0x09, 0x52, 0x18, 0x51, 0x3e, 0x64, 0xf1, 0xee, 0x2e, 0xdd,
+      0x25, 0x25, 0xc7, 0xad, 0x1e, 0x5c, 0xff, 0xd2 } },
+  { 3073,
+    { 0x06, 0x8c, 0x5c, 0x57, 0x62, 0x44, 0x5e, 0xbe, 0xa4, 0x5f, 0x78, 0x9e,
+      0x03, 0x47, 0x97, 0xac, 0xf8, 0xf3, 0xe4, 0xac, 0xae, 0x74, 0xcc, 0x1c,
+      0xbe, 0x40, 0x24, 0x67, 0xbf, 0x33, 0x19, 0x29 },
+    { 0x8f, 0x20, 0x4a, 0x6e, 0x02, 0x04, 0x73, 0x34, 0x71, 0x29, 0x0d, 0xb3,
+      0x77, 0xaf, 0xf7, 0x8f, 0x06, 0x9b, 0xc2, 0xd3, 0xd9, 0x43, 0xde, 0x81,
+      0xf9, 0xa0, 0xb7, 0x17, 0x64, 0x20, 0x4c, 0x71, 0xfb, 0x3b, 0x1c, 0x09,
+      0xa3, 0xcd, 0x7f, 0x3b, 0x9f, 0x29, 0x0b, 0x73, 0x25, 0xaf, 0xb5, 0x91,
+      0x59, 0x7e, 0xbe, 0xbc, 0x85, 0x36, 0x57, 0xac, 0xff, 0x0f, 0xdb, 0x24,
+      0x2f, 0x74, 0x5d, 0x16 },
+    { 0x71, 0x24, 0xb4, 0x95, 0x01, 0x01, 0x2f, 0x81, 0xcc, 0x7f, 0x11, 0xca,
+      0x06, 0x9e, 0xc9, 0x22, 0x6c, 0xec, 0xb8, 0xa2, 0xc8, 0x50, 0xcf, 0xe6,
+      0x44, 0xe3, 0x27, 0xd2, 0x2d, 0x3e, 0x1c, 0xd3 } },
+  { 8192,
+    { 0xf3, 0x92, 0x91, 0xe3, 0x92, 0xe6, 0xaf, 0x19, 0x4e, 0x52, 0x75, 0x5f,
+      0x12, 0xa2, 0xeb, 0x8b, 0x1d, 0x06, 0x71, 0xbf, 0xe1, 0x63, 0xc4, 0xf1,
+      0xb8, 0xef, 0xb2, 0xac, 0xb6, 0x9a, 0x9c, 0x50 },
+    { 0x6e, 0x02, 0xa2, 0x82, 0x35, 0xa5, 0xfe, 0xa5, 0xbb, 0x41, 0xfe, 0x37,
+      0x6b, 0x38, 0x4a, 0x8f, 0x83, 0x37, 0x6b, 0x63, 0x3a, 0xe6, 0x75, 0x72,
+      0xd7, 0x3b, 0x41, 0x52, 0xc9, 0x4b, 0x07, 0xa5, 0xfa, 0xdb, 0x14, 0x78,
+      0xa2, 0xde, 0xbe, 0xfb, 0x3a, 0xc3, 0x0c, 0xb5, 0x59, 0x4e, 0x03, 0x52,
+      0xb1, 0x08, 0xb7, 0x31, 0x63, 0xf9, 0xe0, 0x9f, 0x26, 0x0e, 0x4f, 0x48,
+      0x39, 0x00, 0xa0, 0x39 },
+    { 0xaa, 0xe7, 0x92, 0x48, 0x4c, 0x8e, 0xfe, 0x4f, 0x19, 0xe2, 0xca, 0x7d,
+      0x37, 0x1d, 0x8c, 0x46, 0x7f, 0xfb, 0x10, 0x74, 0x8d, 0x8a, 0x5a, 0x1a,
+      0xe5, 0x79, 0x94, 0x8f, 0x71, 0x8a, 0x2a, 0x63 } },
+  { 8193,
+    { 0xf8, 0x0a, 0x41, 0x68, 0x16, 0x76, 0x18, 0x39, 0x95, 0xdf, 0x96, 0xab,
+      0xc3, 0xab, 0x16, 0x3d, 0x88, 0xa4, 0xff, 0xb2, 0x4b, 0xe4, 0x1a, 0xc8,
+      0xfd, 0x44, 0x88, 0xf6, 0xfd, 0xab, 0x02, 0x13 },
+    { 0x00, 0xf3, 0x82, 0xe5, 0x0a, 0xa0, 0x61, 0xd8, 0xe3, 0xea, 0xc0, 0xa7,
+      0xbe, 0xc8, 0x9c, 0x71, 0x1d, 0x2e, 0xc4, 0xc3, 0x15, 0xd8, 0x94, 0xfe,
+      0xf9, 0x2a, 0x8c, 0x71, 0xd7, 0x9b, 0x4f, 0x9b, 0x8b, 0x61, 0x82, 0xbd,
+      0x29, 0x65, 0xb2, 0x42, 0x8c, 0x12, 0x00, 0x1c, 0x07, 0x48, 0xef, 0xff,
+      0x0e, 0x7a, 0x96, 0x10, 0xce, 0xa3, 0x3f, 0x83, 0xa0, 0x55, 0xc6, 0x95,
+      0xd5, 0xab, 0x76, 0x7f },
+    { 0xba, 0xb6, 0xc0, 0x9c, 0xb8, 0xce, 0x8c, 0xf4, 0x59, 0x26, 0x13, 0x98,
+      0xd2, 0xe7, 0xae, 0xf3, 0x57, 0x00, 0xbf, 0x48, 0x81, 0x16, 0xce, 0xb9,
+      0x4a, 0x36, 0xd0, 0xf5, 0xf1, 0xb7, 0xbc, 0x3b } },
+  { 16384,
+    { 0xe4, 0xd9, 0xf9, 0xf7, 0x10, 0x89, 0x76, 0xa6, 0x1b, 0xde, 0xc5, 0xc0,
+      0xe3, 0x2c, 0x25, 0xea, 0x51, 0x92, 0x02, 0xac, 0xe1, 0x3e, 0x68, 0x94,
+      0x6a, 0x17, 0x2e, 0xea, 0xa1, 0x34, 0xa7, 0x5a },
+    { 0xfd, 0xaf, 0x9d, 0xca, 0x1a, 0xaf, 0x9c, 0x01, 0xe6, 0x53, 0x79, 0xb5,
+      0xb1, 0x7d, 0xff, 0xc4, 0x0f, 0x89, 0x07, 0x21, 0x62, 0x7b, 0xf5, 0xec,
+      0xa5, 0x45, 0x58, 0x24, 0x53, 0x24, 0xad, 0x89, 0x83, 0xb7, 0xf4, 0x45,
+      0xa6, 0x42, 0xf9, 0xd9, 0x38, 0x83, 0x67, 0x22, 0x6e, 0x4a, 0x1d, 0x2f,
+      0xb1, 0x55, 0x91, 0xac, 0x0c, 0xbe, 0xec, 0x88, 0x6c, 0x24, 0x7e, 0xee,
+      0x76, 0xd3, 0xa5, 0x76 },
+    { 0xf8, 0x75, 0xd6, 0x64, 0x6d, 0xe2, 0x89, 0x85, 0x64, 0x6f, 0x34, 0xee,
+      0x13, 0xbe, 0x9a, 0x57, 0x6f, 0xd5, 0x15, 0xf7, 0x6b, 0x5b, 0x0a, 0x26,
+      0xbb, 0x32, 0x47, 0x35, 0x04, 0x1d, 0xdd, 0xe4 } },
+  { 31744,
+    { 0x68, 0x64, 0xea, 0xb0, 0x82, 0x12, 0xcf, 0xf2, 0x9a, 0xb5, 0x5a, 0x25,
+      0xbc, 0xde, 0x46, 0x44, 0x97, 0xb8, 0xb6, 0x00, 0x82, 0xf6, 0xdb, 0xd4,
+      0x68, 0x37, 0xdc, 0x0f, 0x39, 0xc1, 0xc2, 0xb0 },
+    { 0xc3, 0x49, 0x45, 0x04, 0xdf, 0x96, 0x96, 0x32, 0xed, 0x8a, 0x08, 0x27,
+      0xab, 0x85, 0x08, 0x35, 0x4f, 0x31, 0x05, 0x9e, 0x7c, 0xd4, 0x4a, 0xe2,
+      0x1a, 0x27, 0xa5, 0x10, 0x79, 0x3c, 0xff, 0xb5, 0x3f, 0xc2, 0x1d, 0xd1,
+      0xa4, 0x2e, 0xfb, 0xb0, 0xdf, 0xe7, 0xb2, 0x24, 0x35, 0x45, 0x00, 0x56,
+      0x44, 0x3a, 0x20, 0x90, 0x99, 0x2f, 0xf6, 0x04, 0x38, 0x18, 0xfb, 0x0b,
+      0x25, 0xb1, 0xd5, 0xd0 },
+    { 0x62, 0xb6, 0x96, 0x0e, 0x1a, 0x44, 0xbc, 0xc1, 0xeb, 0x1a, 0x61, 0x1a,
+      0x8d, 0x62, 0x35, 0xb6, 0xb4, 0xb7, 0x8f, 0x32, 0xe7, 0xab, 0xc4, 0xfb,
+      0x4c, 0x6c, 0xdc, 0xce, 0x94, 0x89, 0x5c, 0x47 } }
+};
+
+// keyed hashes of the 3073 byte input, the key is the sequence 0, 1, 2, ...
+#define BLAKE_KEYED_LEN  3073
+
+static const uint8_t blake2s_keyed [32] = {
+  0x11, 0xc8, 0x04, 0x35, 0x37, 0x3e, 0x3d, 0x1a, 0xb2, 0x1a, 0x40, 0xcd,
+  0x25, 0x6a, 0x8f, 0xb1, 0xfd, 0xf3, 0xd3, 0xa2, 0x99, 0x54, 0x3c, 0xac,
+  0x18, 0x56, 0xb8, 0xe5, 0x7c, 0x0f, 0x0f, 0xd4
+};
+
+static const uint8_t blake2b_keyed [64] = {
+  0x5b, 0xd7, 0x19, 0xfb, 0xa8, 0x6d, 0x5b, 0xac, 0xcc, 0xaf, 0xec, 0xad,
+  0x65, 0x8f, 0x3e, 0xe8, 0xd6, 0x0d, 0x1e, 0x92, 0xb1, 0x9f, 0x57, 0xb5,
+  0x1d, 0x52, 0x79, 0x2a, 0x1a, 0x2b, 0xf4, 0xea, 0x38, 0x3e, 0x6d, 0xba,
+  0x69, 0x59, 0x81, 0xed, 0x57, 0x5b, 0x7a, 0xd8, 0x10, 0xb4, 0xce, 0xdd,
+  0x27, 0x89, 0xe5, 0x29, 0x52, 0x63, 0x93, 0x75, 0xca, 0x3e, 0xc7, 0xb6,
+  0xba, 0x84, 0x20, 0x4d
+};
+
+static const uint8_t blake3_keyed [32] = {
+  0x66, 0xea, 0xbf, 0x3a, 0x0a, 0x1a, 0x26, 0x22, 0x21, 0xee, 0x9e, 0xed,
+  0x63, 0x36, 0x21, 0xa5, 0x06, 0x5e, 0x4e, 0x73, 0xd0, 0x98, 0x27, 0x7c,
+  0x7d, 0xe4, 0x16, 0x25, 0x59, 0xed, 0xb9, 0xb4
+};
+
+// 200 bytes of BLAKE3 XOF output for the 3073 byte input
+static const uint8_t blake3_xof [200] = {
+  0x71, 0x24, 0xb4, 0x95, 0x01, 0x01, 0x2f, 0x81, 0xcc, 0x7f, 0x11, 0xca,
+  0x06, 0x9e, 0xc9, 0x22, 0x6c, 0xec, 0xb8, 0xa2, 0xc8, 0x50, 0xcf, 0xe6,
+  0x44, 0xe3, 0x27, 0xd2, 0x2d, 0x3e, 0x1c, 0xd3, 0x9a, 0x27, 0xae, 0x3b,
+  0x79, 0xd6, 0x8d, 0x89, 0xda, 0x9b, 0xf2, 0x5b, 0xc2, 0x71, 0x39, 0xae,
+  0x65, 0xa3, 0x24, 0x91, 0x8a, 0x5f, 0x9b, 0x78, 0x28, 0x18, 0x1e, 0x52,
+  0xcf, 0x37, 0x3c, 0x84, 0xf3, 0x5b, 0x63, 0x9b, 0x7f, 0xcc, 0xbb, 0x98,
+  0x5b, 0x6f, 0x2f, 0xa5, 0x6a, 0xea, 0x0c, 0x18, 0xf5, 0x31, 0x20, 0x34,
+  0x97, 0xb8, 0xbb, 0xd3, 0xa0, 0x7c, 0xeb, 0x59, 0x26, 0xf1, 0xca, 0xb7,
+  0x4d, 0x14, 0xbd, 0x66, 0x48, 0x6d, 0x9a, 0x91, 0xeb, 0xa9, 0x90, 0x59,
+  0xa9, 0x8b, 0xd1, 0xcd, 0x25, 0x87, 0x6b, 0x2a, 0xf5, 0xa7, 0x6c, 0x3e,
+  0x9e, 0xed, 0x55, 0x4e, 0xd7, 0x2e, 0xa9, 0x52, 0xb6, 0x03, 0xbf, 0xd4,
+  0xb4, 0xb0, 0x52, 0xf9, 0x8f, 0xa1, 0x8f, 0x57, 0x14, 0x42, 0x92, 0xe6,
+  0x1d, 0xfa, 0x2c, 0x38, 0x48, 0x2a, 0xa5, 0x4b, 0x8c, 0xc4, 0xcc, 0xac,
+  0xb7, 0x89, 0x79, 0x15, 0x4f, 0xec, 0x04, 0xee, 0x5e, 0x8e, 0x51, 0xf1,
+  0x29, 0x06, 0xc9, 0x6f, 0x40, 0xdc, 0x7c, 0x70, 0x18, 0x96, 0xab, 0x04,
+  0x4a, 0xfe, 0xfe, 0xf3, 0x31, 0x50, 0x5c, 0x17, 0x59, 0xf1, 0x8c, 0x52,
+  0x9b, 0xda, 0x3a, 0xf9, 0x8c, 0xf3, 0x9e, 0xcb
+};
+
+#endif // __BLAKE_VECTORS_H__
@@ -0,0 +1,220 @@
+/*
+ * File      : test_blake.c
+ * Test      : blake_benchmark
+ * Date      : 19-oct-2026
+ * Description: Known answer tests of BLAKE2s, BLAKE2b and BLAKE3, one-shot
+ * and streamed through the common hash interface in uneven pieces, and
+ * their throughput against SHA-256 (zvknh) on a long message.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+#include "crypto/share/hash.h"
+
+#include "crypto/blake/api_blake2.h"
+#include "crypto/blake/api_blake3.h"
+#include "crypto/sha/api_sha256.h"
+
+#include "blake_vectors.h"
+
+//! Message of the throughput test
+#define BLAKE_BENCH_BYTES  16384
+
+//! Piece sizes of the streaming test, used in turn
+static const size_t kPieces[] = {1, 63, 500, 3000, 64, 1025};
+
+typedef struct {
+  perf_log_t blake2s;
+  perf_log_t blake2b;
+  perf_log_t blake3;
+  perf_log_t sha256;
+} blake_perf_log_t;
+
+static blake_perf_log_t perf_log = {0};
+
+static uint8_t msg [BLAKE_TEST_MAX_BYTES + 1];  // one spare byte for the misaligned copy
+
+//! Large enough for the state of every hash of the common interface
+static union {
+  blake2s_ctx_t s;
+  blake2b_ctx_t b;
+  blake3_ctx_t  b3;
+  uint64_t      state[(sizeof(blake3_ctx_t) + 64) / 8];
+} hash_state;
+
+static uint32_t test_stream(const crypto_hash_desc_t* desc, size_t len, const uint8_t* md,
+                            size_t md_len) {
+  crypto_hash_ctx_t ctx;
+  uint8_t           out[64];
+  size_t            pos = 0;
+
+  crypto_hash_init(&ctx, desc, &hash_state, md_len);
+  for (size_t i = 0; pos < len; i++) {
+    size_t n = kPieces[i % (sizeof(kPieces) / sizeof(kPieces[0]))];
+    n = n < len - pos ? n : len - pos;
+    crypto_hash_update(&ctx, msg + pos, n);
+    pos += n;
+  }
+  crypto_hash_final(&ctx, out);
+
+  if (memcmp(out, md, md_len)) {
+    printf("# %s: streamed known answer test of %lu bytes failed!\n", desc->name, len);
+    return 1;
+  }
+  return 0;
+}
+
+static uint32_t test_blake_kat(void) {
+
+  uint8_t  md  [200];
+  uint8_t  key [64];
+  uint32_t fail = 0;
+
+  for (int i = 0; i < BLAKE_TEST_INPUTS; i++) {
+    const blake_vector_t* v = &blake_vectors[i];
+
+    blake2s(md, 32, NULL, 0, msg, v->len);
+    fail += memcmp(md, v->blake2s, 32) != 0;
+    blake2b(md, 64, NULL, 0, msg, v->len);
+    fail += memcmp(md, v->blake2b, 64) != 0;
+    blake3(md, 32, msg, v->len);
+    fail += memcmp(md, v->blake3, 32) != 0;
+
+    // the input starts one byte into the buffer, misaligned for the words
+    if (v->len) {
+      memmove(msg + 1, msg, v->len);
+      blake3(md, 32, msg + 1, v->len);
+      fail += memcmp(md, v->blake3, 32) != 0;
+      memmove(msg, msg + 1, v->len);
+      msg[v->len] = v->len % 251;
+    }
+
+    fail += test_stream(&crypto_hash_blake2s, v->len, v->blake2s, 32);
+    fail += test_stream(&crypto_hash_blake2b, v->len, v->blake2b, 64);
+    fail += test_stream(&crypto_hash_blake3,  v->len, v->blake3,  32);
+  }
+
+  for (int i = 0; i < 64; i++) {
+    key[i] = i;
+  }
+
+  blake2s(md, 32, key, 32, msg, BLAKE_KEYED_LEN);
+  fail += memcmp(md, blake2s_keyed, 32) != 0;
+  blake2b(md, 64, key, 64, msg, BLAKE_KEYED_LEN);
+  fail += memcmp(md, blake2b_keyed, 64) != 0;
+
+  blake3_ctx_t s;
+  blake3_init_keyed(&s, key);
+  blake3_update(&s, msg, BLAKE_KEYED_LEN);
+  blake3_final(&s, md, 32);
+  fail += memcmp(md, blake3_keyed, 32) != 0;
+
+  blake3(md, sizeof(blake3_xof), msg, BLAKE_KEYED_LEN);
+  fail += memcmp(md, blake3_xof, sizeof(blake3_xof)) != 0;
+
+  fail += blake2s(md, 33, NULL, 0, msg, 0) != BLAKE2_ERR_PARAM;
+  fail += blake2b(md, 64, key, 65, msg, 0) != BLAKE2_ERR_PARAM;
+
+  if (fail) {
+    printf("# BLAKE: %u known answer tests failed!\n", fail);
+  }
+
+  return fail;
+}
+
+static void test_blake_log(perf_log_t* log, int i, uint64_t icount, uint64_t ccount) {
+  log->icount[i] = icount;
+  log->ccount[i] = ccount;
+
+  printf("#\tinstret = %020lu\n", icount);
+  printf("#\tcycles  = %020lu\n", ccount);
+  printf("#\tcycles/byte x100 = %lu\n", 100 * ccount / BLAKE_BENCH_BYTES);
+}
+
+static uint32_t test_blake_perf(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint8_t  md [64];
+  uint32_t H  [8];
+
+  const crypto_hash_desc_t* desc[3] = {
+    &crypto_hash_blake2s, &crypto_hash_blake2b, &crypto_hash_blake3
+  };
+  perf_log_t* logs[3] = { &perf_log.blake2s, &perf_log.blake2b, &perf_log.blake3 };
+
+  for (int i = 0; i < num_tests; i++) {
+    for (int k = 0; k < 3; k++) {
+
+      printf("#\n# %s (%d bytes) test %d/%d:\n", desc[k]->name, BLAKE_BENCH_BYTES, i+1, num_tests);
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      crypto_hash(desc[k], &hash_state, md, desc[k]->md_bytes, msg, BLAKE_BENCH_BYTES);
+      volatile uint64_t bl_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t bl_ccount = test_rdcycle() - start_cycles;
+
+      test_blake_log(logs[k], i, bl_icount, bl_ccount);
+    }
+
+    printf("#\n# SHA-256 (%d bytes) test %d/%d:\n", BLAKE_BENCH_BYTES, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    sha256_hash_vec(H, msg, BLAKE_BENCH_BYTES);
+    volatile uint64_t sh_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t sh_ccount = test_rdcycle() - start_cycles;
+
+    test_blake_log(&perf_log.sha256, i, sh_icount, sh_ccount);
+  }
+
+  for (int k = 0; k < 3; k++) {
+    logs[k]->ccount_average = average_count(logs[k]->ccount);
+    logs[k]->icount_average = average_count(logs[k]->icount);
+  }
+  perf_log.sha256.ccount_average = average_count(perf_log.sha256.ccount);
+  perf_log.sha256.icount_average = average_count(perf_log.sha256.icount);
+
+  return 0;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  for (size_t i = 0; i < sizeof(msg); i++) {
+    msg[i] = i % 251;
+  }
+
+  printf("\nBenchmark for BLAKE2s/2b and BLAKE3 (%lu chunks side by side)\n", blake3_lanes());
+
+  fail += test_blake_kat();
+  fail += test_blake_perf(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tblake2s.icount = %05lu\n", perf_log.blake2s.icount_average);
+  printf("#\tblake2s.ccount = %05lu\n", perf_log.blake2s.ccount_average);
+  printf("#\tblake2b.icount = %05lu\n", perf_log.blake2b.icount_average);
+  printf("#\tblake2b.ccount = %05lu\n", perf_log.blake2b.ccount_average);
+  printf("#\tblake3.icount  = %05lu\n", perf_log.blake3.icount_average);
+  printf("#\tblake3.ccount  = %05lu\n", perf_log.blake3.ccount_average);
+  printf("#\tsha256.icount  = %05lu\n", perf_log.sha256.icount_average);
+  printf("#\tsha256.ccount  = %05lu\n", perf_log.sha256.ccount_average);
+
+  bench_record_log("blake2s",       BLAKE_BENCH_BYTES, 1, &perf_log.blake2s);
+  bench_record_log("blake2b",       BLAKE_BENCH_BYTES, 2, &perf_log.blake2b);
+  bench_record_log("blake3",        BLAKE_BENCH_BYTES, 1, &perf_log.blake3);
+  bench_record_log("sha256 zvknh",  BLAKE_BENCH_BYTES, 1, &perf_log.sha256);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
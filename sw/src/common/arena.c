@@ -0,0 +1,59 @@
+/*
+ * File      : arena.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Bump allocator over a fixed memory region.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/share/arena.h"
+
+// provided by the linker script
+extern uint8_t l2_alloc_base[];
+extern uint8_t l2_alloc_end[];
+extern uint8_t l2_stack_size[];
+extern uint8_t dram_end_address_reg[];
+
+#define ARENA_ROUND(x) (((x) + CRYPTO_ARENA_ALIGN - 1) & ~(uintptr_t)(CRYPTO_ARENA_ALIGN - 1))
+
+void crypto_arena_init(crypto_arena_t* a, void* base, size_t len) {
+  a->base = (uintptr_t)base;
+  a->end  = a->base + len;
+  a->top  = ARENA_ROUND(a->base);
+
+  if (a->top > a->end) {
+    a->top = a->end;
+  }
+}
+
+void crypto_arena_init_l2(crypto_arena_t* a) {
+  uintptr_t base = (uintptr_t)l2_alloc_base;
+  uintptr_t end  = (uintptr_t)l2_alloc_end;
+  // crt0.S starts the stack at the DRAM end of the CTRL registers, a smaller
+  // DRAM window than the linker script assumes moves the reserve down
+  uintptr_t dram = *(volatile uint64_t*)dram_end_address_reg;
+  uintptr_t top  = dram - (uintptr_t)l2_stack_size;
+
+  if (dram > (uintptr_t)l2_stack_size && top < end) {
+    end = top > base ? top : base;
+  }
+  crypto_arena_init(a, l2_alloc_base, (size_t)(end - base));
+}
+
+void* crypto_arena_alloc(crypto_arena_t* a, size_t n) {
+  uintptr_t p = a->top;
+
+  if (n > a->end - p) {
+    return NULL;
+  }
+
+  // the next block starts aligned, clamped for a region with an odd end
+  a->top = ARENA_ROUND(p + n) <= a->end ? ARENA_ROUND(p + n) : a->end;
+  return (void*)p;
+}
+
+size_t crypto_arena_avail(const crypto_arena_t* a) {
+  return a->end - a->top;
+}
@@ -8,6 +8,7 @@
 #include <stddef.h>
 
 #include "lfsr.h"
+#include "trace.h"
 
 #include "crypto/share/benchmarks.h"
 
@@ -32,3 +33,463 @@ uint64_t average_count(uint64_t* count_arr) {
 }
 
 
+void bench_record(const char* kernel, size_t len, unsigned lmul, uint64_t icount,
+                  uint64_t ccount) {
+  printf(BENCH_RECORD_TAG ",%s,%lu,%u,%lu,%lu\n", kernel, len, lmul, icount, ccount);
+}
+
+void bench_record_log(const char* kernel, size_t len, unsigned lmul, const perf_log_t* log) {
+  bench_record(kernel, len, lmul, log->icount_average, log->ccount_average);
+}
+
+//
+// Kernel registry
+// ----------------------------------------------------------------------
+
+static struct {
+  const bench_kernel_t* kernel [BENCH_MAX_KERNELS];
+  size_t                count;
+  uint8_t*              in;
+  uint8_t*              out;
+  const uint64_t*       evict;
+  uint64_t              evict_sum;
+  crypto_arena_t*       arena;
+  bench_stats_t*        stats;  // the lengths of kernel k from first[k] on
+  uintptr_t             stats_top;
+  size_t                first [BENCH_MAX_KERNELS];
+  size_t                sizes [BENCH_MAX_KERNELS];
+  uint64_t              ccount_overhead;
+  uint64_t              icount_overhead;
+} bench;
+
+int bench_init(crypto_arena_t* arena) {
+  bench.arena = arena;
+  bench.stats = NULL;
+  bench.in    = crypto_arena_alloc(arena, BENCH_MAX_BYTES);
+  bench.out   = crypto_arena_alloc(arena, BENCH_MAX_BYTES);
+  bench.evict = crypto_arena_alloc(arena, BENCH_EVICT_BYTES);
+
+  if (!bench.in || !bench.out || !bench.evict) {
+    return BENCH_ERR_MEMORY;
+  }
+
+  test_rdrandom(bench.in, BENCH_MAX_BYTES);
+
+  // cost of the counter reads themselves, taken off every measurement
+  bench.ccount_overhead = UINT64_MAX;
+  bench.icount_overhead = UINT64_MAX;
+  for (int i = 0; i < 8; i++) {
+    uint64_t start_instrs = test_rdinstret();
+    uint64_t start_cycles = test_rdcycle();
+    uint64_t icount = test_rdinstret() - start_instrs;
+    uint64_t ccount = test_rdcycle() - start_cycles;
+
+    bench.icount_overhead = icount < bench.icount_overhead ? icount : bench.icount_overhead;
+    bench.ccount_overhead = ccount < bench.ccount_overhead ? ccount : bench.ccount_overhead;
+  }
+  hpm_calibrate();
+
+  return BENCH_OK;
+}
+
+int bench_register(const bench_kernel_t* k) {
+  if (bench.count == BENCH_MAX_KERNELS) {
+    return BENCH_ERR_FULL;
+  }
+  bench.kernel[bench.count++] = k;
+  return BENCH_OK;
+}
+
+// drop the result table of the last bench_run(), its memory is given back
+// if nothing was allocated above it since
+static void bench_drop_stats(void) {
+  if (bench.stats && crypto_arena_mark(bench.arena) == bench.stats_top) {
+    crypto_arena_release(bench.arena, (uintptr_t)bench.stats);
+  }
+  bench.stats = NULL;
+}
+
+void bench_reset(void) {
+  for (size_t k = 0; k < bench.count; k++) {
+    bench.sizes[k] = 0;
+  }
+  bench.count = 0;
+  bench_drop_stats();
+}
+
+void bench_config_default(bench_config_t* c) {
+  c->min_len = BENCH_MIN_BYTES;
+  c->max_len = BENCH_MAX_BYTES;
+  c->warmup  = BENCH_WARMUP;
+  c->reps    = BENCH_REPS;
+  c->cold    = BENCH_COLD_REPS;
+  c->hpm     = BENCH_HPM_EVENTS;
+}
+
+void bench_evict_caches(void) {
+  volatile const uint64_t* p = bench.evict;
+  uint64_t sum = 0;
+  uint64_t dcache;
+
+  // one load per line, repeated, displaces the D-cache however it is indexed
+  // and replaced
+  for (unsigned pass = 0; p && pass < BENCH_EVICT_PASSES; pass++) {
+    for (size_t i = 0; i < BENCH_EVICT_BYTES / sizeof(uint64_t);
+         i += BENCH_CACHE_LINE / sizeof(uint64_t)) {
+      sum += p[i];
+    }
+  }
+  bench.evict_sum = sum;
+
+  // the write-through D-cache invalidates all lines when it is disabled,
+  // fence would only flush a write-back one
+  asm volatile("fence\n\t"
+               "csrrci %0, %1, 1\n\t"
+               "csrw   %1, %0\n\t"
+               "fence.i"
+               : "=&r"(dcache) : "i"(BENCH_CSR_DCACHE) : "memory");
+}
+
+static uint64_t isqrt64(uint64_t x) {
+  uint64_t r   = 0;
+  uint64_t bit = (uint64_t)1 << 62;
+
+  while (bit > x) {
+    bit >>= 2;
+  }
+  while (bit) {
+    if (x >= r + bit) {
+      x -= r + bit;
+      r  = (r >> 1) + bit;
+    } else {
+      r >>= 1;
+    }
+    bit >>= 2;
+  }
+  return r;
+}
+
+void bench_stats(bench_stats_t* s, uint64_t* cycles, unsigned n) {
+  uint64_t sum = 0;
+  uint64_t var = 0;
+
+  if (n == 0) {
+    s->min = s->median = s->mean = s->stddev = 0;
+    return;
+  }
+
+  // insertion sort, n is small
+  for (unsigned i = 1; i < n; i++) {
+    uint64_t c = cycles[i];
+    unsigned j = i;
+    for (; j > 0 && cycles[j - 1] > c; j--) {
+      cycles[j] = cycles[j - 1];
+    }
+    cycles[j] = c;
+  }
+
+  for (unsigned i = 0; i < n; i++) {
+    sum += cycles[i];
+  }
+  s->mean = sum / n;
+
+  for (unsigned i = 0; i < n; i++) {
+    uint64_t d = cycles[i] > s->mean ? cycles[i] - s->mean : s->mean - cycles[i];
+    var += d * d;
+  }
+
+  s->min    = cycles[0];
+  s->median = n & 1 ? cycles[n / 2] : (cycles[n / 2 - 1] + cycles[n / 2]) / 2;
+  s->stddev = isqrt64(var / n);
+}
+
+const bench_stats_t* bench_results(size_t k, size_t* n) {
+  *n = bench.stats ? bench.sizes[k] : 0;
+  return bench.stats ? bench.stats + bench.first[k] : NULL;
+}
+
+//! Cycles per byte with two decimals
+static void bench_print_cpb(uint64_t ccount, size_t len) {
+  uint64_t cpb = len ? 100 * ccount / len : 0;
+  printf("%lu.%02lu", cpb / 100, cpb % 100);
+}
+
+static void bench_print_kernel(const bench_kernel_t* k) {
+  if (k->lmul) {
+    printf("%s (lmul = %u)", k->name, k->lmul);
+  } else {
+    printf("%s (scalar)", k->name);
+  }
+}
+
+// median cycles of kernel k at len, UINT64_MAX if it did not run that length
+static uint64_t bench_median_at(size_t k, size_t len) {
+  size_t n;
+  const bench_stats_t* s = bench_results(k, &n);
+
+  for (size_t i = 0; i < n; i++) {
+    if (s[i].len == len) {
+      return s[i].median;
+    }
+  }
+  return UINT64_MAX;
+}
+
+void bench_print_table(const char* title, const size_t* ks, size_t n) {
+  size_t len = 0;
+
+  printf("\n# %s (median cycles/byte):\n", title);
+  for (size_t c = 0; c < n; c++) {
+    printf("#\t[%lu] ", c);
+    bench_print_kernel(bench.kernel[ks[c]]);
+    printf("\n");
+  }
+
+  printf("#\t%8s", "bytes");
+  for (size_t c = 0; c < n; c++) {
+    printf("  %9s[%lu]", "", c);
+  }
+  printf("\n");
+
+  // the lengths of all columns in increasing order, granules may differ
+  while (1) {
+    size_t next = SIZE_MAX;
+
+    for (size_t c = 0; c < n; c++) {
+      size_t m;
+      const bench_stats_t* s = bench_results(ks[c], &m);
+      for (size_t i = 0; i < m; i++) {
+        if (s[i].len > len && s[i].len < next) {
+          next = s[i].len;
+        }
+      }
+    }
+    if (next == SIZE_MAX) {
+      break;
+    }
+    len = next;
+
+    printf("#\t%8lu", len);
+    for (size_t c = 0; c < n; c++) {
+      uint64_t median = bench_median_at(ks[c], len);
+      uint64_t cpb    = 100 * median / len;
+
+      if (median == UINT64_MAX) {
+        printf("  %12s", "-");
+      } else {
+        printf("  %9lu.%02lu", cpb / 100, cpb % 100);
+      }
+    }
+    printf("\n");
+  }
+}
+
+size_t bench_crossover(size_t a, size_t b) {
+  size_t n;
+  const bench_stats_t* s = bench_results(b, &n);
+  size_t from = 0;
+
+  for (size_t i = n; i-- > 0;) {
+    uint64_t ref = bench_median_at(a, s[i].len);
+
+    if (ref == UINT64_MAX) {
+      continue;
+    }
+    if (s[i].median > ref) {
+      break;
+    }
+    from = s[i].len;
+  }
+  return from;
+}
+
+// reps timed runs of kernel k, each on evicted caches if cold is set; the
+// cycles of each run, the fewest instructions and the mean events
+static void bench_time(size_t k, const bench_io_t* io, unsigned reps, int cold,
+                       uint64_t* cycles, uint64_t* icount_min, hpm_sample_t* hpm) {
+  const bench_kernel_t* kern = bench.kernel[k];
+  hpm_region_t region;
+
+  *icount_min = UINT64_MAX;
+  for (int e = 0; e < HPM_EVENTS; e++) {
+    hpm->count[e] = 0;
+  }
+  for (unsigned i = 0; i < reps; i++) {
+    if (cold) {
+      bench_evict_caches();
+    }
+    trace_event(TRACE_EV_KERNEL_ENTER, (uint32_t)k);
+    hpm_begin(&region);
+    uint64_t start_instrs = test_rdinstret();
+    uint64_t start_cycles = test_rdcycle();
+    kern->run(io);
+    uint64_t icount = test_rdinstret() - start_instrs;
+    uint64_t ccount = test_rdcycle() - start_cycles;
+    hpm_end(&region);
+    trace_event(TRACE_EV_KERNEL_EXIT, (uint32_t)k);
+
+    for (int e = 0; e < HPM_EVENTS; e++) {
+      hpm->count[e] += region.delta.count[e];
+    }
+
+    icount -= icount > bench.icount_overhead ? bench.icount_overhead : icount;
+    ccount -= ccount > bench.ccount_overhead ? bench.ccount_overhead : ccount;
+
+    cycles[i] = ccount;
+    *icount_min = icount < *icount_min ? icount : *icount_min;
+  }
+
+  for (int e = 0; e < HPM_EVENTS; e++) {
+    hpm->count[e] /= reps ? reps : 1;
+  }
+}
+
+static void bench_run_len(size_t k, const bench_config_t* c, size_t len) {
+  const bench_kernel_t* kern = bench.kernel[k];
+  bench_stats_t* s = bench.stats + bench.first[k] + bench.sizes[k];
+  uint64_t cycles [BENCH_MAX_REPS];
+  hpm_sample_t hpm, cold_hpm;
+  // at least one timed run, the statistics divide by the count
+  unsigned reps = c->reps == 0 ? 1 : c->reps < BENCH_MAX_REPS ? c->reps : BENCH_MAX_REPS;
+  unsigned cold = c->cold < BENCH_MAX_REPS ? c->cold : BENCH_MAX_REPS;
+
+  bench_io_t io = { bench.in, bench.out, len, kern->arg };
+
+  if (kern->setup) {
+    kern->setup(&io);
+  }
+
+  // cold runs first, the warm-up would only be evicted again
+  s->cold_min    = 0;
+  s->cold_median = 0;
+  s->cold_icount = 0;
+  if (cold) {
+    bench_stats_t cs;
+
+    bench_time(k, &io, cold, 1, cycles, &s->cold_icount, &cold_hpm);
+    bench_stats(&cs, cycles, cold);
+    s->cold_min    = cs.min;
+    s->cold_median = cs.median;
+  }
+
+  for (unsigned i = 0; i < c->warmup; i++) {
+    kern->run(&io);
+  }
+  bench_time(k, &io, reps, 0, cycles, &s->icount, &hpm);
+
+  s->len = len;
+  bench_stats(s, cycles, reps);
+  bench.sizes[k]++;
+
+  printf("#\t%6lu B: min %lu, median %lu, mean %lu, stddev %lu cycles, %lu instret, ",
+         len, s->min, s->median, s->mean, s->stddev, s->icount);
+  bench_print_cpb(s->median, len);
+  printf(" cycles/byte\n");
+  if (c->hpm) {
+    printf("#\t%6s    ", "");
+    hpm_print(&hpm, c->hpm);
+  }
+  if (cold) {
+    uint64_t penalty = s->cold_median > s->median ? s->cold_median - s->median : 0;
+
+    printf("#\t%6s    cold: min %lu, median %lu cycles (+%lu), %lu instret, ", "",
+           s->cold_min, s->cold_median, penalty, s->cold_icount);
+    bench_print_cpb(s->cold_median, len);
+    printf(" cycles/byte\n");
+    if (c->hpm) {
+      printf("#\t%6s    cold: ", "");
+      hpm_print(&cold_hpm, c->hpm);
+    }
+  }
+
+  bench_record(kern->name, len, kern->lmul, s->icount, s->median);
+  hpm_record(kern->name, len, kern->lmul, &hpm);
+  if (cold) {
+    char name [64];
+
+    snprintf(name, sizeof(name), "%s" BENCH_COLD_SUFFIX, kern->name);
+    bench_record(name, len, kern->lmul, s->cold_icount, s->cold_median);
+    hpm_record(name, len, kern->lmul, &cold_hpm);
+  }
+}
+
+// length of the sweep of a kernel after last (0 for the first one), 0 at
+// the end
+static size_t bench_next_len(const bench_kernel_t* kern, const bench_config_t* c,
+                             size_t last) {
+  size_t granule = kern->granule ? kern->granule : 1;
+  // the sweep buffers hold BENCH_MAX_BYTES
+  size_t max_len = c->max_len < BENCH_MAX_BYTES ? c->max_len : BENCH_MAX_BYTES;
+
+  if (kern->fixed_len) {
+    return last || kern->fixed_len > BENCH_MAX_BYTES ? 0 : kern->fixed_len;
+  }
+  // lengths below the granule, or rounded onto the previous one, are skipped
+  for (size_t n = c->min_len; n && n <= max_len; n <<= 1) {
+    if (n / granule * granule > last) {
+      return n / granule * granule;
+    }
+  }
+  return 0;
+}
+
+void bench_run(const bench_config_t* c) {
+  size_t total = 0;
+
+  // one result per kernel and length, in a table sized for this sweep
+  bench_drop_stats();
+  for (size_t k = 0; k < bench.count; k++) {
+    bench.first[k] = total;
+    bench.sizes[k] = 0;
+    for (size_t len = bench_next_len(bench.kernel[k], c, 0); len;
+         len = bench_next_len(bench.kernel[k], c, len)) {
+      total++;
+    }
+  }
+  bench.stats     = crypto_arena_alloc(bench.arena, total * sizeof(bench_stats_t));
+  bench.stats_top = crypto_arena_mark(bench.arena);
+  if (!bench.stats) {
+    printf("# bench_run: the results of %lu runs do not fit the arena (%lu B free)!\n",
+           total, crypto_arena_avail(bench.arena));
+    return;
+  }
+
+  for (size_t k = 0; k < bench.count; k++) {
+    const bench_kernel_t* kern = bench.kernel[k];
+
+    printf("#\n# ");
+    bench_print_kernel(kern);
+    printf(":\n");
+
+    if (kern->fixed_len > BENCH_MAX_BYTES) {
+      printf("#\tskipped: fixed length %lu B exceeds BENCH_MAX_BYTES (%u B)\n",
+             kern->fixed_len, (unsigned)BENCH_MAX_BYTES);
+      continue;
+    }
+    for (size_t len = bench_next_len(kern, c, 0); len; len = bench_next_len(kern, c, len)) {
+      bench_run_len(k, c, len);
+    }
+  }
+
+  printf("\n\n# Result Summary (median cycles/byte, shortest and longest message, cold shortest):\n");
+
+  for (size_t k = 0; k < bench.count; k++) {
+    size_t n;
+    const bench_stats_t* s = bench_results(k, &n);
+
+    if (n == 0) {
+      continue;
+    }
+    printf("#\t");
+    bench_print_kernel(bench.kernel[k]);
+    printf(": %lu B ", s[0].len);
+    bench_print_cpb(s[0].median, s[0].len);
+    printf(", %lu B ", s[n - 1].len);
+    bench_print_cpb(s[n - 1].median, s[n - 1].len);
+    if (s[0].cold_median) {
+      printf(", cold %lu B ", s[0].len);
+      bench_print_cpb(s[0].cold_median, s[0].len);
+    }
+    printf("\n");
+  }
+}
@@ -6,8 +6,10 @@
 //*****************************************************************************/
 
 #include "clint.h"
+#include "trace.h"
 
 
 void set_timer(uint64_t rtc_cycles) {
+  trace_event(TRACE_EV_CLINT_SET, (uint32_t)rtc_cycles);
   CLINT_MTIMECMP_REG = rtc_cycles; // write to CLINT mtimecmp register
 }
\ No newline at end of file
@@ -0,0 +1,74 @@
+/*
+ * File      : hpm.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Measurement regions over the CVA6 event counters.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "printf.h"
+
+#include "crypto/share/hpm.h"
+
+static const char* const hpm_names[HPM_EVENTS] = {
+  "icache_miss", "dcache_miss", "itlb_miss", "dtlb_miss", "load", "store",
+  "exception", "exception_ret", "branch_jump", "call", "ret", "mis_predict",
+  "sb_full", "if_empty"
+};
+
+// counts of an empty region, the minimum of a few tries
+static hpm_sample_t hpm_overhead;
+
+const char* hpm_event_name(hpm_event_t e) {
+  return (unsigned)e < HPM_EVENTS ? hpm_names[e] : "?";
+}
+
+void hpm_calibrate(void) {
+  hpm_region_t r;
+  hpm_sample_t min;
+
+  for (int i = 0; i < HPM_EVENTS; i++) {
+    hpm_overhead.count[i] = 0;
+    min.count[i]          = UINT64_MAX;
+  }
+
+  for (int k = 0; k < 8; k++) {
+    hpm_begin(&r);
+    hpm_end(&r);
+    for (int i = 0; i < HPM_EVENTS; i++) {
+      min.count[i] = r.delta.count[i] < min.count[i] ? r.delta.count[i] : min.count[i];
+    }
+  }
+
+  hpm_overhead = min;
+}
+
+void hpm_discount(hpm_sample_t* delta) {
+  for (int i = 0; i < HPM_EVENTS; i++) {
+    uint64_t o = hpm_overhead.count[i];
+    delta->count[i] -= delta->count[i] > o ? o : delta->count[i];
+  }
+}
+
+void hpm_print(const hpm_sample_t* s, uint32_t mask) {
+  int first = 1;
+
+  for (int i = 0; i < HPM_EVENTS; i++) {
+    if (!(mask >> i & 1) || s->count[i] == 0) {
+      continue;
+    }
+    printf("%s%s %lu", first ? "" : ", ", hpm_names[i], s->count[i]);
+    first = 0;
+  }
+  printf(first ? "no events\n" : "\n");
+}
+
+void hpm_record(const char* kernel, size_t len, unsigned lmul, const hpm_sample_t* s) {
+  printf(HPM_RECORD_TAG ",%s,%lu,%u", kernel, len, lmul);
+  for (int i = 0; i < HPM_EVENTS; i++) {
+    printf(",%lu", s->count[i]);
+  }
+  printf("\n");
+}
@@ -0,0 +1,143 @@
+/*
+ * File      : iovec.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Scatter-gather drivers for the bulk cipher and hash kernels.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/share/iovec.h"
+
+static inline size_t iov_left(const crypto_iov_cursor_t* c) {
+  return c->idx < c->cnt ? c->iov[c->idx].len - c->off : 0;
+}
+
+static inline uint8_t* iov_ptr(const crypto_iov_cursor_t* c) {
+  return (uint8_t*)c->iov[c->idx].base + c->off;
+}
+
+// move by n bytes within the current segment, skipping exhausted ones
+static inline void iov_advance(crypto_iov_cursor_t* c, size_t n) {
+  c->off += n;
+  while (c->idx < c->cnt && c->off == c->iov[c->idx].len) {
+    c->idx++;
+    c->off = 0;
+  }
+}
+
+size_t crypto_iov_len(const crypto_iovec_t* iov, size_t cnt) {
+  size_t len = 0;
+
+  for (size_t i = 0; i < cnt; i++) {
+    len += iov[i].len;
+  }
+  return len;
+}
+
+void crypto_iov_init(crypto_iov_cursor_t* c, const crypto_iovec_t* iov, size_t cnt) {
+  c->iov = iov;
+  c->cnt = cnt;
+  c->idx = 0;
+  c->off = 0;
+  iov_advance(c, 0);
+}
+
+/*
+ * The pieces of a straddling block are slid into one register group, so the
+ * block reaches memory with a single store however many segments it spans.
+ * e8m8 holds CRYPTO_IOV_MAX_BLOCK bytes from VLEN = 128 on.
+ */
+size_t crypto_iov_gather(uint8_t* block, crypto_iov_cursor_t* c, size_t n) {
+  size_t     got = 0;
+  vuint8m8_t acc = __riscv_vmv_v_x_u8m8(0, __riscv_vsetvl_e8m8(n));
+
+  while (got < n && c->idx < c->cnt) {
+    size_t take = iov_left(c);
+    take = take < n - got ? take : n - got;
+
+    vuint8m8_t part = __riscv_vle8_v_u8m8(iov_ptr(c), take);
+    acc = __riscv_vslideup_vx_u8m8(acc, part, got, got + take);
+
+    got += take;
+    iov_advance(c, take);
+  }
+
+  __riscv_vse8_v_u8m8(block, acc, got);
+  return got;
+}
+
+void crypto_iov_scatter(crypto_iov_cursor_t* c, const uint8_t* block, size_t n) {
+  vuint8m8_t acc = __riscv_vle8_v_u8m8(block, n);
+
+  while (n && c->idx < c->cnt) {
+    size_t take = iov_left(c);
+    take = take < n ? take : n;
+
+    __riscv_vse8_v_u8m8(iov_ptr(c), acc, take);
+    acc = __riscv_vslidedown_vx_u8m8(acc, take, n);
+
+    n -= take;
+    iov_advance(c, take);
+  }
+}
+
+int crypto_iov_ecb(const crypto_iovec_t* dst, size_t dst_cnt,
+                   const crypto_iovec_t* src, size_t src_cnt,
+                   size_t block_bytes, crypto_iov_ecb_fn fn, const void* key) {
+
+  crypto_iov_cursor_t s, d;
+  uint8_t             blk [CRYPTO_IOV_MAX_BLOCK] __attribute__((aligned(8)));
+  size_t              len = crypto_iov_len(src, src_cnt);
+
+  if (len != crypto_iov_len(dst, dst_cnt) || (len & (block_bytes - 1))) {
+    return CRYPTO_IOV_ERR_LEN;
+  }
+
+  crypto_iov_init(&s, src, src_cnt);
+  crypto_iov_init(&d, dst, dst_cnt);
+
+  while (len) {
+    // longest run of whole blocks that is contiguous on both sides
+    size_t run = iov_left(&s) < iov_left(&d) ? iov_left(&s) : iov_left(&d);
+    run &= ~(block_bytes - 1);
+
+    if (run) {
+      fn(iov_ptr(&d), iov_ptr(&s), run, key);
+      iov_advance(&s, run);
+      iov_advance(&d, run);
+      len -= run;
+    } else {
+      crypto_iov_gather(blk, &s, block_bytes);
+      fn(blk, blk, block_bytes, key);
+      crypto_iov_scatter(&d, blk, block_bytes);
+      len -= block_bytes;
+    }
+  }
+
+  return CRYPTO_IOV_OK;
+}
+
+void crypto_iov_hash(void* state, crypto_iov_cursor_t* c, size_t n,
+                     size_t block_bytes, crypto_iov_hash_fn fn) {
+
+  uint8_t blk [CRYPTO_IOV_MAX_BLOCK] __attribute__((aligned(8)));
+
+  while (n) {
+    size_t run = iov_left(c) < n ? iov_left(c) : n;
+    run &= ~(block_bytes - 1);
+
+    if (run) {
+      fn(state, iov_ptr(c), run);
+      iov_advance(c, run);
+      n -= run;
+    } else {
+      crypto_iov_gather(blk, c, block_bytes);
+      fn(state, blk, block_bytes);
+      n -= block_bytes;
+    }
+  }
+}
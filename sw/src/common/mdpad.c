@@ -0,0 +1,77 @@
+/*
+ * File      : mdpad.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Vector Merkle-Damgard padding and digest output.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/share/mdpad.h"
+
+const uint32_t crypto_md_zvknh_off32 [8] = {
+  4 * 3, 4 * 2, 4 * 7, 4 * 6, 4 * 1, 4 * 0, 4 * 5, 4 * 4
+};
+
+const uint64_t crypto_md_zvknh_off64 [8] = {
+  8 * 3, 8 * 2, 8 * 7, 8 * 6, 8 * 1, 8 * 0, 8 * 5, 8 * 4
+};
+
+void crypto_md_store_len(uint8_t* p, uint64_t len_bits) {
+  vuint64m1_t l = __riscv_vmv_s_x_u64m1(len_bits, 1);
+
+  l = __riscv_vrev8_v_u64m1(l, 1);
+  __riscv_vse8_v_u8m1(p, __riscv_vreinterpret_v_u64m1_u8m1(l), 8);
+}
+
+size_t crypto_md_pad(uint8_t* out, const uint8_t* tail, size_t num, size_t block,
+                     uint64_t len_bits) {
+  // the 0x80 marker and the length field, block / 8 bytes, follow the tail
+  size_t total = num + 1 + block / 8 > block ? 2 * block : block;
+  size_t vl;
+
+  for (size_t pos = 0; pos < total; pos += vl) {
+    vl = __riscv_vsetvl_e8m4(total - pos);
+    vuint8m4_t v = __riscv_vmv_v_x_u8m4(0, vl);
+
+    if (pos < num) {
+      size_t n = num - pos < vl ? num - pos : vl;
+      v = __riscv_vle8_v_u8m4_tu(v, tail + pos, n);
+    }
+    if (num >= pos && num - pos < vl) {
+      vbool2_t m = __riscv_vmseq_vx_u8m4_b2(__riscv_vid_v_u8m4(vl), (uint8_t)(num - pos), vl);
+      v = __riscv_vmerge_vxm_u8m4(v, 0x80, m, vl);
+    }
+
+    __riscv_vse8_v_u8m4(out + pos, v, vl);
+  }
+
+  crypto_md_store_len(out + total - 8, len_bits);
+
+  return total;
+}
+
+void crypto_md_store_be32(uint8_t* md, const uint32_t* H, const uint32_t* off, size_t n) {
+  size_t vl;
+
+  for (; n > 0; n -= vl, off += vl, md += 4 * vl) {
+    vl = __riscv_vsetvl_e32m2(n);
+    vuint32m2_t x = __riscv_vluxei32_v_u32m2(H, __riscv_vle32_v_u32m2(off, vl), vl);
+    x = __riscv_vrev8_v_u32m2(x, vl);
+    __riscv_vse8_v_u8m2(md, __riscv_vreinterpret_v_u32m2_u8m2(x), 4 * vl);
+  }
+}
+
+void crypto_md_store_be64(uint8_t* md, const uint64_t* H, const uint64_t* off, size_t n) {
+  size_t vl;
+
+  for (; n > 0; n -= vl, off += vl, md += 8 * vl) {
+    vl = __riscv_vsetvl_e64m4(n);
+    vuint64m4_t x = __riscv_vluxei64_v_u64m4(H, __riscv_vle64_v_u64m4(off, vl), vl);
+    x = __riscv_vrev8_v_u64m4(x, vl);
+    __riscv_vse8_v_u8m4(md, __riscv_vreinterpret_v_u64m4_u8m4(x), 8 * vl);
+  }
+}
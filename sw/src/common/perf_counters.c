@@ -0,0 +1,80 @@
+/*
+ * File      : perf_counters.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Driver of the crypto unit and Ara performance counters.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "printf.h"
+#include "perf_counters.h"
+
+static const char* const perf_crypto_names[PERF_CRYPTO_TYPES] = {
+  "aes", "ghash", "sha2", "sm4", "sm3"
+};
+
+static const char* const perf_vfu_names[PERF_VFUS] = {
+  "alu", "mfpu", "slide", "mask", "load", "crypto", "store"
+};
+
+void perf_counters_start(void) {
+  CTRL_HW_CNT_EN_REG = HW_CNT_EN_CLEAR;
+  CTRL_HW_CNT_EN_REG = HW_CNT_EN_COUNT;
+}
+
+void perf_counters_stop(void) {
+  CTRL_HW_CNT_EN_REG = 0;
+}
+
+void perf_counters_sample(perf_counters_t* s) {
+  for (unsigned i = 0; i < PERF_COUNTERS; i++) {
+    s->count[i] = perf_counters_read(i);
+  }
+}
+
+void perf_counters_delta(perf_counters_t* d, const perf_counters_t* end,
+                         const perf_counters_t* start) {
+  for (unsigned i = 0; i < PERF_COUNTERS; i++) {
+    d->count[i] = end->count[i] - start->count[i];
+  }
+}
+
+// part of whole in percent with one decimal
+static void perf_print_share(uint64_t part, uint64_t whole) {
+  uint64_t p = whole ? 1000 * part / whole : 0;
+  printf("%lu.%lu%%", p / 10, p % 10);
+}
+
+void perf_counters_print(const perf_counters_t* s) {
+  uint64_t cycles = s->count[PERF_CNT_CYCLES];
+
+  printf("#\tcycles = %lu\n", cycles);
+
+  for (unsigned t = 0; t < PERF_CRYPTO_TYPES; t++) {
+    uint64_t busy  = s->count[PERF_CNT_CRYPTO_BUSY(t)];
+    uint64_t wait  = s->count[PERF_CNT_CRYPTO_WAIT(t)];
+    uint64_t stall = s->count[PERF_CNT_CRYPTO_STALL(t)];
+
+    if (busy == 0) {
+      continue;
+    }
+    printf("#\tcrypto %-5s busy %lu (", perf_crypto_names[t], busy);
+    perf_print_share(busy, cycles);
+    printf(" of cycles), operand wait %lu (", wait);
+    perf_print_share(wait, busy);
+    printf("), write back stall %lu (", stall);
+    perf_print_share(stall, busy);
+    printf(")\n");
+  }
+
+  printf("#\tissued:");
+  for (unsigned u = 0; u < PERF_VFUS; u++) {
+    printf(" %s %lu", perf_vfu_names[u], s->count[PERF_CNT_VINSN_ISSUED(u)]);
+  }
+  printf("\n");
+
+  printf("#\tvlsu: load %lu B (beats), store %lu B\n", s->count[PERF_CNT_LOAD_BYTES],
+         s->count[PERF_CNT_STORE_BYTES]);
+}
@@ -8,6 +8,7 @@
  */
 
 #include "qspi.h"
+#include "trace.h"
 
 /************
  *  Setters *
@@ -44,7 +45,7 @@ void spi_set_clk_div(uint8_t clock_div)
 
 void spi_set_status_reg(uint8_t cs, uint8_t SRST, uint8_t QWR, uint8_t QRD, uint8_t WR, uint8_t RD)
 {
-  SPIM_STATUS = (
+  uint32_t status = (
     (cs   & 0xFu) << 8 |
     (SRST & 0x1u) << 4 | 
     (QWR  & 0x1u) << 3 | 
@@ -52,6 +53,9 @@ void spi_set_status_reg(uint8_t cs, uint8_t SRST, uint8_t QWR, uint8_t QRD, uint
     (WR   & 0x1u) << 1 | 
     (RD   & 0x1u)
   );
+
+  trace_event(TRACE_EV_QSPI_START, status);
+  SPIM_STATUS = status;
 }
 
 /**************
@@ -73,4 +77,5 @@ uint32_t spi_get_status(void) {
 void wait_for_idle(void) {
   // loop until SPI FSM is in IDLE
   while((SPIM_STATUS & 0xFu) != 1u);
+  trace_event(TRACE_EV_QSPI_IDLE, 0);
 }
\ No newline at end of file
@@ -5,6 +5,7 @@
  * Date      : 21-feb-2024
  * Description: Contains implementations of runtime functions
  * [TZS 19-jul-2024] Added default exception/trap handlers
+ * [19-oct-2026] Trace trap entry/exit and PLIC claims (trace.h)
  */
 
 #include <stdint.h>
@@ -16,6 +17,7 @@
 #include "printf.h"
 #include "runtime.h"
 #include "handlers.h"
+#include "trace.h"
 
 // handlers defined within handlers.c
 extern void (*irq_handler_u_soft)(void);
@@ -49,6 +51,8 @@ void mtvec_handler(uint64_t mcause) {
   // update externally accessible id
   interrupt_id = id;
 
+  trace_event(TRACE_EV_TRAP_ENTER, (uint32_t)id | (uint32_t)(mcause >> 32 & 0x80000000u));
+
   if((mcause & (1UL << (__riscv_xlen - 1)))) {
     // interrupt
     switch (id) {
@@ -88,6 +92,7 @@ void mtvec_handler(uint64_t mcause) {
       case IRQ_M_EXT:        
         
         volatile uint32_t plic_claim_id = PLIC_IRQ_CLAIM_M;
+        trace_event(TRACE_EV_PLIC_CLAIM, plic_claim_id);
         
         switch (plic_claim_id) {
           case APB_TIMER_OVERFLOW_IRQ:
@@ -123,6 +128,7 @@ void mtvec_handler(uint64_t mcause) {
       default:
         printf("[INTERRUPT ID 0x%016X] - UNKNOWN ID\n", id);
     }
+    trace_event(TRACE_EV_TRAP_EXIT, (uint32_t)id | 0x80000000u);
   } else {
     // exception
     switch (id) {
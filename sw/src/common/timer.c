@@ -6,6 +6,7 @@
 //*****************************************************************************/
 
 #include "timer.h"
+#include "trace.h"
 
 
 void set_cmp_reg(uint32_t val) {
@@ -13,10 +14,15 @@ void set_cmp_reg(uint32_t val) {
 }
 
 void enable_timer(void) {
+#ifdef TRACE_ENABLE
+  // the compare value costs an APB read, only taken when tracing
+  trace_event(TRACE_EV_TIMER_ENABLE, CMP_REG);
+#endif
   CTRL_REG = 1u;
 }
 
 void disable_timer(void) {
+  trace_event(TRACE_EV_TIMER_DISABLE, 0);
   CTRL_REG = 0u;
 }
 
@@ -0,0 +1,31 @@
+/*
+ * File      : trace.c
+ * Test      : common
+ * Date      : 19-oct-2026
+ * Description: Header and UART drain of the binary event trace.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "printf.h"
+#include "trace.h"
+
+// initialised data, so the header is valid from reset and found by its magic
+// in a memory dump
+trace_log_t trace_log = { TRACE_MAGIC, TRACE_RECORDS, trace_buffer, 0 };
+
+void trace_reset(void) {
+  trace_log.head = 0;
+}
+
+void trace_drain(void) {
+  uint64_t head  = trace_log.head;
+  uint64_t first = head > TRACE_RECORDS ? head - TRACE_RECORDS : 0;
+
+  printf(TRACE_RECORD_TAG ",head,%lu,%u\n", head, TRACE_RECORDS);
+  for (uint64_t i = first; i < head; i++) {
+    const trace_record_t* r = &trace_buffer[i & (TRACE_RECORDS - 1)];
+    printf(TRACE_RECORD_TAG ",%lu,%u,0x%x\n", r->cycle, r->id, r->arg);
+  }
+}
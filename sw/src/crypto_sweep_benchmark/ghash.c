@@ -0,0 +1,210 @@
+/*
+ * File      : ghash.c
+ * Test      : crypto_sweep_benchmark
+ * Date      : 19-oct-2026
+ * Description: GHASH, scalar with the 4-bit tables of OpenSSL's
+ * gcm_gmult_4bit, and with vghsh over one register group of blocks at a
+ * time. Lane j of a stripe of L blocks is multiplied by H^L on every stripe
+ * but the last, where it takes H^(L-j), so that the lanes XOR together into
+ * the serial result.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/aes/api_ghash.h"
+
+// reduction of the four bits shifted out of the low end, x^128 = x^7 + x^2 + x + 1
+static const uint64_t kRem4bit[16] = {
+  0x0000000000000000, 0x1c20000000000000, 0x3840000000000000, 0x2460000000000000,
+  0x7080000000000000, 0x6ca0000000000000, 0x48c0000000000000, 0x54e0000000000000,
+  0xe100000000000000, 0xfd20000000000000, 0xd940000000000000, 0xc560000000000000,
+  0x9180000000000000, 0x8da0000000000000, 0xa9c0000000000000, 0xb5e0000000000000
+};
+
+static inline uint64_t load_be64(const uint8_t* p) {
+  uint64_t x = 0;
+  for (int i = 0; i < 8; i++) {
+    x = x << 8 | p[i];
+  }
+  return x;
+}
+
+static inline void store_be64(uint8_t* p, uint64_t x) {
+  for (int i = 7; i >= 0; i--) {
+    p[i] = x;
+    x >>= 8;
+  }
+}
+
+// byte i of a block held as two big endian words
+static inline unsigned block_byte(const uint64_t x[2], int i) {
+  return (x[i >> 3] >> (56 - 8 * (i & 7))) & 0xff;
+}
+
+// multiplication by x in the bit reflected convention of GCM
+static inline void gf128_mulx(uint64_t v[2]) {
+  uint64_t r = 0xe100000000000000 & (0 - (v[1] & 1));
+
+  v[1] = (v[0] << 63) | (v[1] >> 1);
+  v[0] = (v[0] >> 1) ^ r;
+}
+
+// bitwise z = x * y, only used for the key tables
+static void gf128_mul(uint64_t z[2], const uint64_t x[2], const uint64_t y[2]) {
+  uint64_t v[2] = { y[0], y[1] };
+  uint64_t r[2] = { 0, 0 };
+
+  for (int i = 0; i < 128; i++) {
+    uint64_t m = 0 - ((x[i >> 6] >> (63 - (i & 63))) & 1);
+    r[0] ^= v[0] & m;
+    r[1] ^= v[1] & m;
+    gf128_mulx(v);
+  }
+  z[0] = r[0];
+  z[1] = r[1];
+}
+
+void ghash_key_init(ghash_key_t* k, const uint8_t h[GHASH_BLOCK_BYTES]) {
+  uint64_t H[2] = { load_be64(h), load_be64(h + 8) };
+  uint64_t v[2] = { H[0], H[1] };
+  uint8_t  b[GHASH_BLOCK_BYTES];
+
+  // htable[i] = i * H, the bits of i taken as the coefficients of 1, x, x^2, x^3
+  memset(k->htable, 0, sizeof(k->htable));
+  for (int i = 8; i > 0; i >>= 1) {
+    k->htable[i][0] = v[0];
+    k->htable[i][1] = v[1];
+    gf128_mulx(v);
+  }
+  for (int i = 2; i < 16; i <<= 1) {
+    for (int j = 1; j < i; j++) {
+      k->htable[i + j][0] = k->htable[i][0] ^ k->htable[j][0];
+      k->htable[i + j][1] = k->htable[i][1] ^ k->htable[j][1];
+    }
+  }
+
+  v[0] = H[0];
+  v[1] = H[1];
+  for (int i = GHASH_LANES - 1; i >= 0; i--) {
+    store_be64(b, v[0]);
+    store_be64(b + 8, v[1]);
+    memcpy(k->hpow[i], b, GHASH_BLOCK_BYTES);
+    gf128_mul(v, v, H);
+  }
+}
+
+// x = x * H, one nibble at a time from the last byte on
+static void ghash_gmult(const ghash_key_t* k, uint64_t x[2]) {
+  unsigned nlo = block_byte(x, 15);
+  unsigned nhi = nlo >> 4;
+  uint64_t zh, zl, rem;
+  int      cnt = 15;
+
+  nlo &= 0xf;
+  zh = k->htable[nlo][0];
+  zl = k->htable[nlo][1];
+
+  while (1) {
+    rem = zl & 0xf;
+    zl  = (zh << 60) | (zl >> 4);
+    zh  = (zh >> 4) ^ kRem4bit[rem];
+    zh ^= k->htable[nhi][0];
+    zl ^= k->htable[nhi][1];
+
+    if (--cnt < 0) {
+      break;
+    }
+
+    nlo = block_byte(x, cnt);
+    nhi = nlo >> 4;
+    nlo &= 0xf;
+
+    rem = zl & 0xf;
+    zl  = (zh << 60) | (zl >> 4);
+    zh  = (zh >> 4) ^ kRem4bit[rem];
+    zh ^= k->htable[nlo][0];
+    zl ^= k->htable[nlo][1];
+  }
+
+  x[0] = zh;
+  x[1] = zl;
+}
+
+void ghash_scalar(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES], const uint8_t* in,
+                  size_t len) {
+  uint64_t x[2] = { load_be64(y), load_be64(y + 8) };
+
+  for (; len >= GHASH_BLOCK_BYTES; len -= GHASH_BLOCK_BYTES, in += GHASH_BLOCK_BYTES) {
+    x[0] ^= load_be64(in);
+    x[1] ^= load_be64(in + 8);
+    ghash_gmult(k, x);
+  }
+
+  store_be64(y, x[0]);
+  store_be64(y + 8, x[1]);
+}
+
+/*
+ * The blocks that do not fill whole stripes go first, one element group at
+ * a time, so that the last stripe is always full. The running hash enters
+ * the first stripe in lane 0. Blocks are read with word loads: vghsh does
+ * not reshuffle its operands, so a register loaded at EEW=8 would reach it
+ * in the wrong byte order. in must be 4-byte aligned, y is staged in acc.
+ */
+#define GHASH_ZVKG(LMUL)                                                                     \
+void ghash_zvkg_lmul##LMUL(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES],                 \
+                           const uint8_t* in, size_t len) {                                  \
+  uint32_t acc [GHASH_LANES][4];                                                             \
+  size_t   lanes = __riscv_vsetvlmax_e32m##LMUL() / 4;                                       \
+  size_t   n     = len / GHASH_BLOCK_BYTES;                                                  \
+  size_t   vl;                                                                               \
+                                                                                             \
+  lanes = lanes < GHASH_LANES ? lanes : GHASH_LANES;                                         \
+                                                                                             \
+  vuint32m1_t h1 = __riscv_vle32_v_u32m1(k->hpow[GHASH_LANES - 1], 4);                       \
+  memcpy(acc[0], y, GHASH_BLOCK_BYTES);                                                      \
+  vuint32m1_t y1 = __riscv_vle32_v_u32m1(acc[0], 4);                                         \
+  for (; n % lanes; n--, in += GHASH_BLOCK_BYTES) {                                          \
+    vuint32m1_t x = __riscv_vle32_v_u32m1((const uint32_t*)in, 4);                           \
+    y1 = __riscv_vghsh_vv_u32m1(y1, h1, x, 4);                                               \
+  }                                                                                          \
+  __riscv_vse32_v_u32m1(acc[0], y1, 4);                                                      \
+                                                                                             \
+  if (n == 0) {                                                                              \
+    memcpy(y, acc[0], GHASH_BLOCK_BYTES);                                                    \
+    return;                                                                                  \
+  }                                                                                          \
+                                                                                             \
+  memset(acc[1], 0, sizeof(acc) - sizeof(acc[0]));                                           \
+                                                                                             \
+  /* H^lanes in every element group, and H^lanes down to H^1 across them */                  \
+  vl = __riscv_vsetvl_e32m##LMUL(4 * lanes);                                                 \
+  vuint32m##LMUL##_t idx = __riscv_vsll_vx_u32m##LMUL(                                       \
+    __riscv_vand_vx_u32m##LMUL(__riscv_vid_v_u32m##LMUL(vl), 3, vl), 2, vl);                 \
+  vuint32m##LMUL##_t hk = __riscv_vluxei32_v_u32m##LMUL(k->hpow[GHASH_LANES - lanes], idx, vl); \
+  vuint32m##LMUL##_t hd = __riscv_vle32_v_u32m##LMUL(k->hpow[GHASH_LANES - lanes], vl);      \
+  vuint32m##LMUL##_t a  = __riscv_vle32_v_u32m##LMUL(acc[0], vl);                            \
+                                                                                             \
+  for (; n > lanes; n -= lanes, in += lanes * GHASH_BLOCK_BYTES) {                           \
+    vuint32m##LMUL##_t x = __riscv_vle32_v_u32m##LMUL((const uint32_t*)in, vl);              \
+    a = __riscv_vghsh_vv_u32m##LMUL(a, hk, x, vl);                                           \
+  }                                                                                          \
+  vuint32m##LMUL##_t x = __riscv_vle32_v_u32m##LMUL((const uint32_t*)in, vl);                \
+  a = __riscv_vghsh_vv_u32m##LMUL(a, hd, x, vl);                                             \
+  __riscv_vse32_v_u32m##LMUL(acc[0], a, vl);                                                 \
+                                                                                             \
+  for (size_t j = 1; j < lanes; j++) {                                                       \
+    for (int i = 0; i < 4; i++) {                                                            \
+      acc[0][i] ^= acc[j][i];                                                                \
+    }                                                                                        \
+  }                                                                                          \
+  memcpy(y, acc[0], GHASH_BLOCK_BYTES);                                                      \
+}
+
+GHASH_ZVKG(1)
+GHASH_ZVKG(2)
+GHASH_ZVKG(4)
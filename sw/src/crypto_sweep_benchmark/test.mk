@@ -0,0 +1,15 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  aes_benchmark/aes_enc.c \
+  aes_benchmark/aes_ct64.c \
+  aes_benchmark/zvkned.s \
+  sha_benchmark/sha256.c \
+  sha_benchmark/sha512.c \
+  sha_benchmark/zvknh.s \
+  sm3_benchmark/sm3_api.c \
+  sm3_benchmark/sm3_cf256_zksh.c \
+  sm3_benchmark/sm3_openssl.c \
+  sm3_benchmark/zvksh.s \
+  sm4_benchmark/sm4_openssl.c \
+  sm4_benchmark/sm4_reference.c \
+  sm4_benchmark/zvksed.s
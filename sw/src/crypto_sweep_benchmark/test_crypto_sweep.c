@@ -0,0 +1,482 @@
+/*
+ * File      : test_crypto_sweep.c
+ * Test      : crypto_sweep_benchmark
+ * Date      : 19-oct-2026
+ * Description: The scalar and vector kernels of AES-128, SHA-256/512, SM3,
+ * SM4 and GHASH over one doubling size sweep. Every algorithm gets a table
+ * of cycles per byte against the message length, and every vector kernel
+ * the length from which it stays ahead of each scalar one.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+#include "runtime.h"
+
+#include "crypto/share/arena.h"
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/api_aes_ct64.h"
+#include "crypto/aes/api_ghash.h"
+#include "crypto/aes/zvkned.h"
+#include "crypto/sha/api_sha256.h"
+#include "crypto/sha/api_sha512.h"
+#include "crypto/sm3/sm3_api.h"
+#include "crypto/sm3/zvksh.h"
+#include "crypto/sm4/sm4_api.h"
+#include "crypto/sm4/zvksed.h"
+
+//! Longest message of the sweep, the crossovers lie far below
+#ifndef SWEEP_MAX_BYTES
+#define SWEEP_MAX_BYTES 16384
+#endif
+
+//! Message of the cross checks, not a whole number of hash blocks
+#define CHECK_BYTES     1000
+#define CHECK_BLOCKS    (1024 / AES_BLOCK_BYTES)
+
+static uint8_t message [1024] __attribute__((aligned(16)));
+static uint8_t output  [1024] __attribute__((aligned(16)));
+static uint8_t output2 [1024] __attribute__((aligned(16)));
+
+static uint8_t  key [16] __attribute__((aligned(16)));
+static uint32_t erk     [AES_128_RK_WORDS] __attribute__((aligned(16)));
+static uint32_t erk_zvk [AES_128_RK_WORDS] __attribute__((aligned(16)));
+static uint32_t sm4_rk  [32];
+
+static aes_ct64_key_t ct64_key;
+static SM4_KEY        sm4_key;
+static ghash_key_t    ghash_key;
+
+static crypto_arena_t arena;
+
+typedef void     (*sm3_cf_t)(uint32_t *sp, const uint32_t *mp, size_t n);
+typedef uint64_t (*aes_vs_t)(void* dest, const void* src, uint64_t n, const uint32_t* erk);
+typedef void     (*ghash_t)(const ghash_key_t* k, uint8_t y[GHASH_BLOCK_BYTES],
+                            const uint8_t* in, size_t len);
+
+//
+// Kernels of the size sweep
+// ----------------------------------------------------------------------
+
+static void run_aes_reference(const bench_io_t* io) {
+  for (size_t i = 0; i < io->len; i += AES_BLOCK_BYTES) {
+    aes_128_ecb_encrypt(io->out + i, (uint8_t*)io->in + i, erk);
+  }
+}
+
+static void run_aes_ct64(const bench_io_t* io) {
+  aes_ct64_encrypt(&ct64_key, io->out, io->in, io->len / AES_BLOCK_BYTES);
+}
+
+static void run_aes_zvkned(const bench_io_t* io) {
+  ((aes_vs_t)io->arg)(io->out, io->in, io->len, erk_zvk);
+}
+
+// the .vv kernel expands the key into vector registers on every call
+static void run_aes_zvkned_vv(const bench_io_t* io) {
+  zvkned_aes128_encode_vv_lmul1(io->out, io->in, io->len, (const uint32_t*)key);
+}
+
+static void run_sha256_openssl(const bench_io_t* io) {
+  SHA256_CTX c;
+
+  SHA256_Init(&c);
+  SHA256_Update(&c, io->in, io->len);
+  SHA256_Final(io->out, &c);
+}
+
+static void run_sha256_reference(const bench_io_t* io) {
+  sha256_hash((uint32_t*)io->out, (uint8_t*)io->in, io->len);
+}
+
+static void run_sha256_zvknh(const bench_io_t* io) {
+  sha256_hash_vec((uint32_t*)io->out, (uint8_t*)io->in, io->len);
+}
+
+static void run_sha512_openssl(const bench_io_t* io) {
+  SHA512_CTX c;
+
+  SHA512_Init(&c);
+  SHA512_Update(&c, io->in, io->len);
+  SHA512_Final(io->out, &c);
+}
+
+static void run_sha512_reference(const bench_io_t* io) {
+  sha512_hash((uint64_t*)io->out, (uint8_t*)io->in, io->len);
+}
+
+static void run_sha512_zvknh(const bench_io_t* io) {
+  sha512_hash_vec((uint64_t*)io->out, (uint8_t*)io->in, io->len);
+}
+
+static void run_sha512_zvknh_ctx(const bench_io_t* io) {
+  sha512_vec_ctx_t c;
+
+  sha512_vec_init(&c);
+  sha512_vec_update(&c, io->in, io->len);
+  sha512_vec_final(&c, io->out);
+}
+
+static void run_sm3_openssl(const bench_io_t* io) {
+  SM3_CTX c;
+
+  ossl_sm3_init(&c);
+  ossl_sm3_update(&c, io->in, io->len);
+  ossl_sm3_final(io->out, &c);
+}
+
+// the compression function is selected once per length, outside the timing
+static void setup_sm3(const bench_io_t* io) {
+  sm3_compress = (sm3_cf_t)io->arg;
+}
+
+static void run_sm3(const bench_io_t* io) {
+  sm3_256(io->out, io->in, io->len);
+}
+
+static void run_sm4_openssl(const bench_io_t* io) {
+  for (size_t i = 0; i < io->len; i += SM4_BLOCK_SIZE) {
+    ossl_sm4_encrypt(io->in + i, io->out + i, &sm4_key);
+  }
+}
+
+static void run_sm4_reference(const bench_io_t* io) {
+  for (size_t i = 0; i < io->len; i += SM4_BLOCK_SIZE) {
+    sm4_block_enc_dec(io->out + i, (uint8_t*)io->in + i, sm4_rk);
+  }
+}
+
+static void run_sm4_zvksed(const bench_io_t* io) {
+  zvksed_sm4_encode_vv(io->out, io->in, io->len, sm4_rk);
+}
+
+static void run_ghash(const bench_io_t* io) {
+  ((ghash_t)io->arg)(&ghash_key, io->out, io->in, io->len);
+}
+
+static const bench_kernel_t aes_kernels[] = {
+  { "aes128 reference enc",  0, AES_BLOCK_BYTES, 0, NULL, run_aes_reference, NULL },
+  { "aes128 ct64 enc",       0, AES_BLOCK_BYTES, 0, NULL, run_aes_ct64,      NULL },
+  { "aes128 zvkned vs enc",  1, AES_BLOCK_BYTES, 0, NULL, run_aes_zvkned,
+    (void*)zvkned_aes128_encode_vs_lmul1 },
+  { "aes128 zvkned vs enc",  2, AES_BLOCK_BYTES, 0, NULL, run_aes_zvkned,
+    (void*)zvkned_aes128_encode_vs_lmul2 },
+  { "aes128 zvkned vs enc",  4, AES_BLOCK_BYTES, 0, NULL, run_aes_zvkned,
+    (void*)zvkned_aes128_encode_vs_lmul4 },
+  { "aes128 zvkned vv key+enc", 1, AES_BLOCK_BYTES, 0, NULL, run_aes_zvkned_vv, NULL },
+};
+
+static const bench_kernel_t sha256_kernels[] = {
+  { "sha256 openssl",   0, 0, 0, NULL, run_sha256_openssl,   NULL },
+  { "sha256 reference", 0, 0, 0, NULL, run_sha256_reference, NULL },
+  { "sha256 zvknh",     1, 0, 0, NULL, run_sha256_zvknh,     NULL },
+};
+
+static const bench_kernel_t sha512_kernels[] = {
+  { "sha512 openssl",   0, 0, 0, NULL, run_sha512_openssl,   NULL },
+  { "sha512 reference", 0, 0, 0, NULL, run_sha512_reference, NULL },
+  { "sha512 zvknh",     1, 0, 0, NULL, run_sha512_zvknh,     NULL },
+  { "sha512 zvknh ctx", 2, 0, 0, NULL, run_sha512_zvknh_ctx, NULL },
+};
+
+static const bench_kernel_t sm3_kernels[] = {
+  { "sm3 openssl", 0, 0, 0, NULL,      run_sm3_openssl, NULL },
+  { "sm3 zksh",    0, 0, 0, setup_sm3, run_sm3, (void*)sm3_cf256_zksh },
+  { "sm3 zvksh",   1, 0, 0, setup_sm3, run_sm3, (void*)sm3_cf256_zvksh_lmul1 },
+  { "sm3 zvksh",   2, 0, 0, setup_sm3, run_sm3, (void*)sm3_cf256_zvksh_lmul2 },
+  { "sm3 zvksh",   4, 0, 0, setup_sm3, run_sm3, (void*)sm3_cf256_zvksh_lmul4 },
+};
+
+static const bench_kernel_t sm4_kernels[] = {
+  { "sm4 openssl enc",   0, SM4_BLOCK_SIZE, 0, NULL, run_sm4_openssl,   NULL },
+  { "sm4 reference enc", 0, SM4_BLOCK_SIZE, 0, NULL, run_sm4_reference, NULL },
+  { "sm4 zvksed enc",    1, SM4_BLOCK_SIZE, 0, NULL, run_sm4_zvksed,    NULL },
+};
+
+static const bench_kernel_t ghash_kernels[] = {
+  { "ghash 4-bit table", 0, GHASH_BLOCK_BYTES, 0, NULL, run_ghash, (void*)ghash_scalar },
+  { "ghash zvkg",        1, GHASH_BLOCK_BYTES, 0, NULL, run_ghash, (void*)ghash_zvkg_lmul1 },
+  { "ghash zvkg",        2, GHASH_BLOCK_BYTES, 0, NULL, run_ghash, (void*)ghash_zvkg_lmul2 },
+  { "ghash zvkg",        4, GHASH_BLOCK_BYTES, 0, NULL, run_ghash, (void*)ghash_zvkg_lmul4 },
+};
+
+//! Kernels of one algorithm, registered back to back
+typedef struct {
+  const char*           name;
+  const bench_kernel_t* kernels;
+  size_t                count;
+  size_t                first;   //!< registration index of kernels[0]
+} sweep_alg_t;
+
+#define SWEEP_ALG(name, k) { name, k, sizeof(k) / sizeof(k[0]), 0 }
+
+static sweep_alg_t algs[] = {
+  SWEEP_ALG("AES-128 ECB", aes_kernels),
+  SWEEP_ALG("SHA-256",     sha256_kernels),
+  SWEEP_ALG("SHA-512",     sha512_kernels),
+  SWEEP_ALG("SM3",         sm3_kernels),
+  SWEEP_ALG("SM4 ECB",     sm4_kernels),
+  SWEEP_ALG("GHASH",       ghash_kernels),
+};
+
+#define SWEEP_ALGS (sizeof(algs) / sizeof(algs[0]))
+
+//
+// Cross checks
+// ----------------------------------------------------------------------
+
+/*
+ * FIPS-197 C.1 for the reference AES, and every other AES kernel against it
+ * on the whole message.
+ */
+static uint32_t test_aes(void) {
+  static const uint8_t ct_fips [16] = {
+    0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30,
+    0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+  };
+  uint8_t  pt_fips [16];
+  uint8_t  fips_key[16];
+  uint32_t rk [AES_128_RK_WORDS];
+  uint32_t fail = 0;
+
+  for (int i = 0; i < 16; i++) {
+    fips_key[i] = i;
+    pt_fips[i]  = i * 0x11;
+  }
+  aes_128_enc_key_schedule(rk, fips_key);
+  aes_128_ecb_encrypt(output, pt_fips, rk);
+  fail += memcmp(output, ct_fips, 16) != 0;
+
+  bench_io_t io = { message, output2, sizeof(message), NULL };
+
+  run_aes_reference(&io);
+  io.out = output;
+  for (size_t k = 1; k < sizeof(aes_kernels) / sizeof(aes_kernels[0]); k++) {
+    memset(output, 0, sizeof(output));
+    io.arg = aes_kernels[k].arg;
+    aes_kernels[k].run(&io);
+    fail += memcmp(output, output2, sizeof(output)) != 0;
+  }
+
+  return fail;
+}
+
+// every hash kernel against the first one, on a message with a tail
+static uint32_t test_hash(const bench_kernel_t* kernels, size_t count, size_t md_len) {
+  uint32_t fail = 0;
+  bench_io_t io = { message, output2, CHECK_BYTES, NULL };
+
+  kernels[0].run(&io);
+  io.out = output;
+  for (size_t k = 1; k < count; k++) {
+    memset(output, 0, md_len);
+    io.arg = kernels[k].arg;
+    if (kernels[k].setup) {
+      kernels[k].setup(&io);
+    }
+    kernels[k].run(&io);
+    fail += memcmp(output, output2, md_len) != 0;
+  }
+
+  return fail;
+}
+
+// example 1 of the standard, and the other SM4 kernels against OpenSSL
+static uint32_t test_sm4(void) {
+  static const uint8_t ct_spec [16] = {
+    0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
+    0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46
+  };
+  uint32_t fail = 0;
+
+  ossl_sm4_encrypt(spec_input, output, &sm4_key);
+  fail += memcmp(output, ct_spec, 16) != 0;
+
+  bench_io_t io = { message, output2, sizeof(message), NULL };
+
+  run_sm4_openssl(&io);
+  io.out = output;
+  for (size_t k = 1; k < sizeof(sm4_kernels) / sizeof(sm4_kernels[0]); k++) {
+    memset(output, 0, sizeof(output));
+    sm4_kernels[k].run(&io);
+    fail += memcmp(output, output2, sizeof(output)) != 0;
+  }
+
+  return fail;
+}
+
+// the vector GHASH kernels against the scalar one on n blocks
+static uint32_t test_ghash_blocks(size_t n) {
+  uint8_t  y  [16];
+  uint8_t  yv [16];
+  uint32_t fail = 0;
+
+  memcpy(y, message, 16);
+  ghash_scalar(&ghash_key, y, message, n * GHASH_BLOCK_BYTES);
+
+  for (size_t k = 1; k < sizeof(ghash_kernels) / sizeof(ghash_kernels[0]); k++) {
+    memcpy(yv, message, 16);
+    ((ghash_t)ghash_kernels[k].arg)(&ghash_key, yv, message, n * GHASH_BLOCK_BYTES);
+    fail += memcmp(y, yv, 16) != 0;
+  }
+
+  return fail;
+}
+
+/*
+ * Test case 2 of the GCM specification (the zero key, one zero plaintext
+ * block): the ciphertext and the length block hash to f38cbb1a...f885.
+ * Then, with a random subkey, every number of blocks up to two stripes and
+ * a remainder, and the whole message.
+ */
+static uint32_t test_ghash(void) {
+  static const uint8_t h [16] = {
+    0x66, 0xe9, 0x4b, 0xd4, 0xef, 0x8a, 0x2c, 0x3b,
+    0x88, 0x4c, 0xfa, 0x59, 0xca, 0x34, 0x2b, 0x2e
+  };
+  static const uint8_t x [32] = {
+    0x03, 0x88, 0xda, 0xce, 0x60, 0xb6, 0xa3, 0x92,
+    0xf3, 0x28, 0xc2, 0xb9, 0x71, 0xb2, 0xfe, 0x78,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x80
+  };
+  static const uint8_t tag [16] = {
+    0xf3, 0x8c, 0xbb, 0x1a, 0xd6, 0x92, 0x23, 0xdc,
+    0xc3, 0x45, 0x7a, 0xe5, 0xb6, 0xb0, 0xf8, 0x85
+  };
+  uint8_t  y [16];
+  uint32_t fail = 0;
+
+  ghash_key_init(&ghash_key, h);
+
+  for (size_t k = 0; k < sizeof(ghash_kernels) / sizeof(ghash_kernels[0]); k++) {
+    memset(y, 0, sizeof(y));
+    ((ghash_t)ghash_kernels[k].arg)(&ghash_key, y, x, sizeof(x));
+    fail += memcmp(y, tag, 16) != 0;
+  }
+
+  ghash_key_init(&ghash_key, message + sizeof(message) - GHASH_BLOCK_BYTES);
+
+  for (size_t n = 1; n <= 2 * GHASH_LANES + 3; n++) {
+    fail += test_ghash_blocks(n);
+  }
+  fail += test_ghash_blocks(CHECK_BLOCKS);
+
+  return fail;
+}
+
+static uint32_t test_sweep_kat(void) {
+  static const char* const names[6] = { "AES", "SHA-256", "SHA-512", "SM3", "SM4", "GHASH" };
+  uint32_t fail[6];
+  uint32_t total = 0;
+
+  fail[0] = test_aes();
+  fail[1] = test_hash(sha256_kernels, sizeof(sha256_kernels) / sizeof(sha256_kernels[0]), 32);
+  fail[2] = test_hash(sha512_kernels, sizeof(sha512_kernels) / sizeof(sha512_kernels[0]), 64);
+  fail[3] = test_hash(sm3_kernels,    sizeof(sm3_kernels)    / sizeof(sm3_kernels[0]),    32);
+  fail[4] = test_sm4();
+  fail[5] = test_ghash();
+
+  for (int i = 0; i < 6; i++) {
+    if (fail[i]) {
+      printf("# %s: %u cross checks failed!\n", names[i], fail[i]);
+    }
+    total += fail[i];
+  }
+
+  return total;
+}
+
+//
+// Crossover report
+// ----------------------------------------------------------------------
+
+static void print_crossovers(const sweep_alg_t* a) {
+  for (size_t v = 0; v < a->count; v++) {
+    if (a->kernels[v].lmul == 0) {
+      continue;
+    }
+    for (size_t s = 0; s < a->count; s++) {
+      if (a->kernels[s].lmul != 0) {
+        continue;
+      }
+
+      size_t from = bench_crossover(a->first + s, a->first + v);
+
+      printf("#\t%s (lmul = %u) over %s: ", a->kernels[v].name, a->kernels[v].lmul,
+             a->kernels[s].name);
+      if (from) {
+        printf("from %lu B\n", from);
+      } else {
+        printf("not within the sweep\n");
+      }
+    }
+  }
+}
+
+static void init(void) {
+  test_rdrandom(message, sizeof(message));
+  test_rdrandom(key, sizeof(key));
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+  bench_config_t    config;
+  size_t            ks [8];
+
+  init_vrf();
+  init();
+
+  crypto_arena_init_l2(&arena);
+  if (bench_init(&arena) != BENCH_OK) {
+    printf("# Sweep: the benchmark buffers do not fit the L2 arena!\n");
+    return 1;
+  }
+
+  aes_128_enc_key_schedule(erk, key);
+  zvkned_aes128_expand_key(erk_zvk, key);
+  aes_ct64_key_init(&ct64_key, key, AES128_BITS);
+  ossl_sm4_set_key(spec_input, &sm4_key);
+  sm4_key_schedule_enc(sm4_rk, (uint8_t*)spec_input);
+
+  fail += test_sweep_kat();
+
+  size_t next = 0;
+  for (size_t a = 0; a < SWEEP_ALGS; a++) {
+    algs[a].first = next;
+    for (size_t k = 0; k < algs[a].count; k++, next++) {
+      bench_register(&algs[a].kernels[k]);
+    }
+  }
+
+  bench_config_default(&config);
+  config.max_len = config.max_len < SWEEP_MAX_BYTES ? config.max_len : SWEEP_MAX_BYTES;
+
+  printf("\nThroughput sweep of AES, SHA, SM3, SM4 and GHASH with %lu to %lu Byte Messages\n",
+         config.min_len, config.max_len);
+
+  bench_run(&config);
+
+  for (size_t a = 0; a < SWEEP_ALGS; a++) {
+    for (size_t k = 0; k < algs[a].count; k++) {
+      ks[k] = algs[a].first + k;
+    }
+    bench_print_table(algs[a].name, ks, algs[a].count);
+  }
+
+  printf("\n# Crossover (shortest message from which the vector kernel stays ahead):\n");
+  for (size_t a = 0; a < SWEEP_ALGS; a++) {
+    print_crossovers(&algs[a]);
+  }
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
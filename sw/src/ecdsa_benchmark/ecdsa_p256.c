@@ -0,0 +1,241 @@
+/*
+ * File      : ecdsa_p256.c
+ * Test      : ecdsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: ECDSA P-256 / SHA-256 signature verification. A batch
+ * verifies one signature per vector lane on the fp256/ecp256 arithmetic
+ * shared with SM2: s^-1 and the two scalars are computed for all lanes at
+ * once over the group order, [u1]G comes from a constant comb table with
+ * mixed additions and [u2]Q from a per-lane 4 bit window. The digest is
+ * computed with the Zvknh vslide block kernel.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/ecc/api_ecdsa_p256.h"
+#include "crypto/ecc/fp256.h"
+#include "crypto/ecc/ecp256.h"
+#include "crypto/sha/zvknh.h"
+#include "crypto/share/mdpad.h"
+
+// curve parameters p, a, b, Gx, Gy, n (FIPS 186-5, SP 800-186)
+static const uint8_t kP256Params[6][32] = {
+  { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+  { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc },
+  { 0x5a, 0xc6, 0x35, 0xd8, 0xaa, 0x3a, 0x93, 0xe7, 0xb3, 0xeb, 0xbd, 0x55, 0x76, 0x98, 0x86, 0xbc,
+    0x65, 0x1d, 0x06, 0xb0, 0xcc, 0x53, 0xb0, 0xf6, 0x3b, 0xce, 0x3c, 0x3e, 0x27, 0xd2, 0x60, 0x4b },
+  { 0x6b, 0x17, 0xd1, 0xf2, 0xe1, 0x2c, 0x42, 0x47, 0xf8, 0xbc, 0xe6, 0xe5, 0x63, 0xa4, 0x40, 0xf2,
+    0x77, 0x03, 0x7d, 0x81, 0x2d, 0xeb, 0x33, 0xa0, 0xf4, 0xa1, 0x39, 0x45, 0xd8, 0x98, 0xc2, 0x96 },
+  { 0x4f, 0xe3, 0x42, 0xe2, 0xfe, 0x1a, 0x7f, 0x9b, 0x8e, 0xe7, 0xeb, 0x4a, 0x7c, 0x0f, 0x9e, 0x16,
+    0x2b, 0xce, 0x33, 0x57, 0x6b, 0x31, 0x5e, 0xce, 0xcb, 0xb6, 0x40, 0x68, 0x37, 0xbf, 0x51, 0xf5 },
+  { 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xbc, 0xe6, 0xfa, 0xad, 0xa7, 0x17, 0x9e, 0x84, 0xf3, 0xb9, 0xca, 0xc2, 0xfc, 0x63, 0x25, 0x51 }
+};
+
+/*
+ * Comb table of the generator, kP256Comb[b] = sum of [2^(64k)]G over the
+ * bits k of b, in affine coordinates and in the Montgomery domain of fp256
+ * (x * 2^261 mod p, 29b limbs). Entry 0 (the point at infinity) is never
+ * read.
+ */
+static const ecp256_precomp_t kP256Comb[16] = {
+  { { 0 }, { 0 } },
+  { { 0x15228783, 0x0730d418, 0x0db00bcf, 0x057f11fb, 0x0a20eb75,
+      0x12b77622, 0x0330fdb9, 0x1af4dd57, 0x00120bee },
+    { 0x12aac150, 0x125357ce, 0x0f22e6ef, 0x0e390e86, 0x064b1695,
+      0x088dd21f, 0x02a97443, 0x02962176, 0x00ae3fe3 } },
+  { { 0x141a5765, 0x122fc516, 0x11a4ca7c, 0x105afc98, 0x19161ab9,
+      0x13a57c62, 0x1fb520e7, 0x08946d99, 0x00ebcd2c },
+    { 0x1402f2fe, 0x15c70bf5, 0x0b0c92e0, 0x0d131c25, 0x16a47a41,
+      0x137071fd, 0x1d0a488d, 0x1df5bc3d, 0x00c91f22 } },
+  { { 0x06f7778b, 0x166847e1, 0x105f64f2, 0x11a78c9a, 0x08c7c868,
+      0x16179d73, 0x0aace213, 0x15acf400, 0x0057c050 },
+    { 0x098fb572, 0x0a837cc0, 0x10603c95, 0x07d2ecc9, 0x186eae7b,
+      0x16278e6c, 0x013e498a, 0x0fedbdce, 0x00976e4b } },
+  { { 0x1c4124ac, 0x08c244bf, 0x07433b15, 0x06b0cbf7, 0x00c72383,
+      0x1d5dd387, 0x1afd4b52, 0x12074c93, 0x003ab0fa },
+    { 0x0e2e7d5f, 0x1673a2a3, 0x1c5b2f43, 0x0001d6dd, 0x087c4709,
+      0x01e05bab, 0x1e8c7c22, 0x0cf887be, 0x00423fc2 } },
+  { { 0x1633ffab, 0x091f2b2c, 0x11e118e4, 0x0356d664, 0x151c0375,
+      0x1678ac5c, 0x0e2f681e, 0x11dc4efb, 0x000dd609 },
+    { 0x1d1da123, 0x15c6e527, 0x0f6f1061, 0x08cf0006, 0x05f43d03,
+      0x0c056c65, 0x0887c7eb, 0x0222193c, 0x003ab581 } },
+  { { 0x16a67ab7, 0x177734d2, 0x0eee0312, 0x02bd7a6f, 0x0526ce77,
+      0x09aa79ec, 0x184fbf3e, 0x09eec99a, 0x006dbcca },
+    { 0x0a4b366c, 0x09303ab6, 0x13a4073f, 0x0bf4dc0e, 0x184fad41,
+      0x1d19b3cf, 0x0db2d641, 0x0af462e6, 0x00168c33 } },
+  { { 0x1cb54393, 0x0a38e11a, 0x19b2c5eb, 0x194aac79, 0x0fdb716e,
+      0x014ee5f8, 0x06398980, 0x0d1bafff, 0x00a1e4f6 },
+    { 0x0e614aa4, 0x1246317a, 0x1e41d654, 0x16cbef6e, 0x14e3392a,
+      0x1e0ac019, 0x0673e0ef, 0x1555bb12, 0x00894acd } },
+  { { 0x1f162d50, 0x18410ef4, 0x193352b7, 0x06bf911e, 0x0f832e48,
+      0x18e6d9c8, 0x0d452035, 0x0d350aac, 0x0007e7c0 },
+    { 0x1b7d8d38, 0x0309a804, 0x1682fbf8, 0x017d9eee, 0x12ff5077,
+      0x073ad8e1, 0x008304b9, 0x1c419eb7, 0x0012e881 } },
+  { { 0x0f35669e, 0x0a56f2c3, 0x0fc68c23, 0x01a2a507, 0x11df51dc,
+      0x059176c6, 0x179818a2, 0x1a057c7c, 0x0035e65a },
+    { 0x0eb7aa04, 0x0375315d, 0x1b3de4ce, 0x1feeb5cb, 0x047f06f9,
+      0x01848d77, 0x057309d2, 0x040b5072, 0x007a1e26 } },
+  { { 0x17cb456a, 0x13e225d5, 0x079e376c, 0x0660c24d, 0x1ff8dfcf,
+      0x12622626, 0x14f98a04, 0x07264085, 0x0017769b },
+    { 0x0fd8c7c5, 0x0191c6e5, 0x0e6d91bc, 0x0b0ffc07, 0x01ecca84,
+      0x19b0236e, 0x018cd404, 0x00a7f927, 0x00620023 } },
+  { { 0x0722b27b, 0x08b5c59b, 0x1387e7e3, 0x1d686060, 0x1977870b,
+      0x1aad19ad, 0x05cca279, 0x096feeb8, 0x00aab133 },
+    { 0x1705fe9c, 0x188b8e74, 0x19a64c9d, 0x0f0fe479, 0x0455a5c0,
+      0x0af43c03, 0x005d3d4f, 0x07d27581, 0x00dc98aa } },
+  { { 0x1d843fdf, 0x014bfe80, 0x0df412ff, 0x045a7295, 0x1acfed9c,
+      0x0072f4a5, 0x17505e2d, 0x074df98e, 0x005a4e29 },
+    { 0x1560b66e, 0x00b6ac29, 0x08d73486, 0x0a0ef789, 0x1cfa6f53,
+      0x075c2aad, 0x01cd3ee4, 0x103c386a, 0x00e70fbc } },
+  { { 0x0d81baf6, 0x1ecc49a5, 0x0363a0f4, 0x1f35e582, 0x1d9d4b9f,
+      0x008f505a, 0x1eefbd0a, 0x05bbc311, 0x006f70b8 },
+    { 0x01cd51f3, 0x16b6e4cc, 0x047919ac, 0x12efb4ce, 0x1e9dfada,
+      0x1fac39ce, 0x0a89d229, 0x0647d8a3, 0x00826b59 } },
+  { { 0x191f17d8, 0x1c729495, 0x1b15f850, 0x111fdefc, 0x095852c3,
+      0x003df63d, 0x1fef20c2, 0x1147b3a3, 0x00213f39 },
+    { 0x128ae0b3, 0x1095d058, 0x1c2e0616, 0x0f65917a, 0x09377210,
+      0x18d7a404, 0x10763495, 0x1f1bb87b, 0x00786689 } },
+  { { 0x12260e85, 0x1ae35642, 0x0a15886a, 0x06c9c829, 0x0654aa92,
+      0x065b3107, 0x008f4e53, 0x0a1c6933, 0x002b23aa },
+    { 0x09f307ec, 0x0f5b6bb8, 0x1c270f3b, 0x1bd04fd7, 0x03137cfd,
+      0x09680baa, 0x15d9006a, 0x1de3bccc, 0x006ecaa3 } },
+};
+
+static ecp256_curve_t p256_curve;
+static int            p256_curve_ready = 0;
+
+// the Montgomery constants are derived on first use
+static const ecp256_curve_t* p256_get_curve(void) {
+  if (!p256_curve_ready) {
+    ecp256_curve_init(&p256_curve, kP256Params);
+    p256_curve_ready = 1;
+  }
+  return &p256_curve;
+}
+
+static const uint32_t kZero[FP256_LIMBS] = {0};
+
+// 0 < s < n
+static int sc_in_range(const ecp256_curve_t* c, const uint8_t s[32]) {
+  uint8_t any = 0;
+
+  for (int i = 0; i < 32; i++) {
+    any |= s[i];
+  }
+  return any != 0 && memcmp(s, c->n.be, 32) < 0;
+}
+
+// e = SHA-256(M), whole blocks straight from M, the tail padded in registers
+static void ecdsa_p256_digest(uint8_t e[32], const uint8_t* msg, size_t len) {
+  uint32_t H [8];
+  uint32_t B [32];
+  uint64_t len_bits = (uint64_t)(len) << 3;
+  size_t   n;
+
+  memcpy(H, kSha256InitialHash, sizeof(H));
+
+  for (; len >= 64; len -= 64, msg += 64) {
+    sha256_block_vslide_lmul1((uint8_t*)(H), msg);
+  }
+
+  n = crypto_md_pad((uint8_t*)(B), msg, len, 64, len_bits);
+  for (size_t i = 0; i < n / 4; i += 16) {
+    sha256_block_vslide_lmul1((uint8_t*)(H), B + i);
+  }
+
+  crypto_md_store_be32(e, H, crypto_md_zvknh_off32, 8);
+}
+
+static void ecdsa_p256_verify_lanes(const ecdsa_p256_item_t* items, int* result, size_t vl) {
+
+  const ecp256_curve_t* c = p256_get_curve();
+  ecp256_t       a, p;
+  fp256_t        fr, fs, fe, zero;
+  const uint8_t* pk    [FP256_LANES];
+  uint8_t        r     [FP256_LANES][32];
+  uint8_t        u1    [FP256_LANES][32];
+  uint8_t        u2    [FP256_LANES][32];
+  uint8_t        e     [32];
+  uint32_t       valid [FP256_LANES];
+  uint32_t       eq    [FP256_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    const uint8_t* s = items[i].sig + 32;
+
+    pk[i] = items[i].pk;
+    memcpy(r[i], items[i].sig, 32);
+
+    if (!sc_in_range(c, r[i]) || !sc_in_range(c, s)) {
+      result[i] = ECDSA_P256_ERR_ENCODING;
+    } else {
+      result[i] = ECDSA_P256_OK;
+    }
+
+    ecdsa_p256_digest(e, items[i].msg, items[i].msg_len);
+
+    fp256_frombytes(&fr, i, r[i]);
+    fp256_frombytes(&fs, i, s);
+    fp256_frombytes(&fe, i, e);
+  }
+
+  // w = s^-1 R, u1 = e * w and u2 = r * w leave the Montgomery domain
+  fp256_set      (&zero, kZero, vl);
+  fp256_add      (&c->n, &fe, &fe, &zero, vl);
+  fp256_to_mont  (&c->n, &fs, &fs, vl);
+  fp256_invert   (&c->n, &fs, &fs, vl);
+  fp256_mul      (&c->n, &fe, &fs, &fe, vl);
+  fp256_mul      (&c->n, &fs, &fs, &fr, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    fp256_tobytes(u1[i], &fe, i);
+    fp256_tobytes(u2[i], &fs, i);
+  }
+
+  ecp256_frombytes(c, &a, valid, pk, vl);
+
+  // p = [u1]G + [u2]Q, its x coordinate must be r mod n
+  ecp256_mul2_comb(c, &p, kP256Comb, u1, &a, u2, vl);
+  ecp256_x_equals (c, eq, &p, r, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    if (result[i] == ECDSA_P256_OK && !valid[i]) {
+      result[i] = ECDSA_P256_ERR_ENCODING;
+    }
+    if (result[i] == ECDSA_P256_OK && !eq[i]) {
+      result[i] = ECDSA_P256_ERR_MISMATCH;
+    }
+  }
+}
+
+int ecdsa_p256_verify(const uint8_t sig[ECDSA_P256_SIGNATURE_BYTES], const uint8_t* msg,
+                      size_t msg_len, const uint8_t pk[ECDSA_P256_PUBLIC_KEY_BYTES]) {
+
+  ecdsa_p256_item_t item = { pk, sig, msg, msg_len };
+  int               result;
+
+  ecdsa_p256_verify_lanes(&item, &result, 1);
+
+  return result;
+}
+
+size_t ecdsa_p256_verify_batch(const ecdsa_p256_item_t* items, int* result, size_t n) {
+
+  size_t lanes = fp256_lanes();
+  size_t fail  = 0;
+
+  for (size_t i = 0; i < n; i += lanes) {
+    size_t vl = (n - i) < lanes ? (n - i) : lanes;
+    ecdsa_p256_verify_lanes(items + i, result + i, vl);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    fail += (result[i] != ECDSA_P256_OK);
+  }
+
+  return fail;
+}
@@ -0,0 +1,511 @@
+/*
+ * File      : ecdsa_vectors.h
+ * Test      : ecdsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: ECDSA P-256 / SHA-256 test vectors. Keys and signatures were
+ * generated with OpenSSL (openssl ecparam -genkey / dgst -sha256 -sign).
+ */
+
+#ifndef __ECDSA_VECTORS_H__
+#define __ECDSA_VECTORS_H__
+
+#include <stdint.h>
+
+#include "crypto/ecc/api_ecdsa_p256.h"
+
+// public keys, signatures and messages
+#define ECDSA_TEST_ITEMS 16
+
+static const uint8_t ecdsa_pk0 [64] = {
+  0xb0, 0x5a, 0x5f, 0x0a, 0xd0, 0xa8, 0x9f, 0x5b, 0x3d, 0xc4, 0x4f, 0x87,
+  0x63, 0x8c, 0x3e, 0x45, 0x02, 0xf2, 0xab, 0x2b, 0xa0, 0xa2, 0xaa, 0x5a,
+  0x17, 0x79, 0x69, 0xdc, 0x2f, 0xe5, 0x5b, 0x95, 0x8f, 0x6f, 0x3a, 0xac,
+  0x5d, 0xa7, 0xb2, 0x68, 0x6c, 0xd2, 0x56, 0x26, 0xd3, 0x8f, 0xe6, 0x53,
+  0x91, 0xa6, 0x08, 0x14, 0x08, 0x5a, 0xc4, 0x21, 0xb0, 0x05, 0x71, 0x7b,
+  0x79, 0x99, 0xf4, 0xdf
+};
+
+static const uint8_t ecdsa_sig0 [64] = {
+  0x55, 0x14, 0x67, 0xc8, 0x3e, 0x23, 0xee, 0x55, 0x95, 0x29, 0x2c, 0x1e,
+  0x3a, 0x90, 0xa7, 0x30, 0xe6, 0x0c, 0xb8, 0x7c, 0xbd, 0x23, 0x3a, 0x2f,
+  0x21, 0xfc, 0x8e, 0x99, 0xff, 0x72, 0xa1, 0x6e, 0x10, 0xda, 0x0a, 0x31,
+  0x73, 0x85, 0x21, 0x65, 0x95, 0x7e, 0xcb, 0xc1, 0x5f, 0x70, 0x4d, 0x9c,
+  0xf1, 0xf4, 0x32, 0x22, 0xf5, 0x31, 0x6c, 0x52, 0x31, 0x45, 0x4a, 0xdd,
+  0xdf, 0x06, 0xfc, 0x3f
+};
+
+static const uint8_t ecdsa_msg0 [1] = {0};
+
+static const uint8_t ecdsa_pk1 [64] = {
+  0xcc, 0xaa, 0x3d, 0x3d, 0xec, 0x56, 0x3d, 0x3a, 0x83, 0xd4, 0xea, 0x98,
+  0x77, 0xf1, 0x66, 0xe5, 0x25, 0x7c, 0x74, 0x8c, 0x89, 0x3d, 0x23, 0x23,
+  0x5c, 0xf1, 0xfb, 0xfa, 0xe0, 0xc7, 0xdb, 0xb2, 0xf1, 0xfa, 0xad, 0x1a,
+  0xf0, 0xb6, 0x7e, 0x4e, 0x55, 0xa7, 0xa7, 0xdc, 0x92, 0x5c, 0x16, 0x91,
+  0x96, 0x74, 0x1d, 0xbd, 0xcf, 0x44, 0x35, 0x14, 0xaf, 0x5b, 0xec, 0xba,
+  0x3c, 0xbf, 0xba, 0xc9
+};
+
+static const uint8_t ecdsa_sig1 [64] = {
+  0x85, 0xf4, 0x54, 0x7a, 0x05, 0x7d, 0xbe, 0xeb, 0x2f, 0x9f, 0xff, 0x7b,
+  0xfe, 0x20, 0x28, 0xe3, 0x7f, 0x68, 0xa2, 0xd6, 0xd4, 0xf3, 0xc2, 0x9f,
+  0x85, 0xb0, 0xd7, 0xf1, 0x50, 0x8c, 0x27, 0xa2, 0x73, 0x11, 0x7d, 0x82,
+  0x1d, 0x7f, 0xe1, 0xc7, 0x91, 0x2b, 0xac, 0x3c, 0x16, 0xa7, 0x17, 0x84,
+  0xe6, 0x77, 0x78, 0x56, 0x40, 0x45, 0xf7, 0x21, 0xed, 0xd2, 0x66, 0x53,
+  0x84, 0x65, 0xd2, 0x68
+};
+
+static const uint8_t ecdsa_msg1 [3] = {
+  0xd7, 0xdb, 0x34
+};
+
+static const uint8_t ecdsa_pk2 [64] = {
+  0x35, 0x9d, 0x5e, 0x74, 0x12, 0x28, 0x13, 0x6e, 0x47, 0x35, 0x3e, 0x27,
+  0x92, 0x64, 0x7c, 0x04, 0x8c, 0xdc, 0xb1, 0x9a, 0xdd, 0x35, 0xba, 0xc1,
+  0xd6, 0xe7, 0xd4, 0x10, 0x87, 0x83, 0xee, 0xfe, 0x89, 0xe2, 0xe2, 0x97,
+  0xbf, 0xad, 0x7d, 0xe4, 0x23, 0x99, 0xab, 0x3b, 0xc2, 0x9a, 0x8e, 0x83,
+  0xbc, 0xbe, 0x47, 0x1b, 0x3a, 0xd7, 0xed, 0xe9, 0x02, 0x99, 0x82, 0x44,
+  0xa2, 0x3a, 0xce, 0x66
+};
+
+static const uint8_t ecdsa_sig2 [64] = {
+  0x5d, 0x78, 0xd9, 0x4e, 0xe1, 0xd6, 0xbd, 0xd9, 0x6e, 0xf8, 0xe5, 0x35,
+  0x2f, 0xc7, 0xf2, 0xa2, 0x27, 0x06, 0x28, 0xbe, 0x9d, 0xec, 0xf6, 0x26,
+  0x88, 0x0e, 0xd3, 0x94, 0xfd, 0x4e, 0x4f, 0x6e, 0xb2, 0x22, 0x09, 0x08,
+  0x83, 0x2a, 0xce, 0x69, 0x7a, 0x4b, 0x22, 0x40, 0xe4, 0x81, 0xf9, 0x51,
+  0x79, 0x81, 0xa1, 0x20, 0x12, 0xbb, 0x1d, 0x5f, 0xc7, 0xba, 0xc1, 0x28,
+  0xc2, 0x78, 0x0a, 0x1f
+};
+
+static const uint8_t ecdsa_msg2 [32] = {
+  0x21, 0xbb, 0xed, 0xbf, 0x16, 0x57, 0xb0, 0xa7, 0x88, 0xa8, 0x9d, 0xf2,
+  0xcd, 0x72, 0x2b, 0xfa, 0x48, 0xdf, 0x7e, 0x05, 0xc2, 0xbf, 0x0c, 0x4a,
+  0xf3, 0x34, 0x80, 0x3a, 0x41, 0xea, 0x2c, 0x3c
+};
+
+static const uint8_t ecdsa_pk3 [64] = {
+  0xa1, 0xbc, 0x0a, 0x81, 0xef, 0x32, 0xf2, 0xc0, 0x7a, 0x75, 0x21, 0x5e,
+  0x79, 0x20, 0x7f, 0x99, 0x23, 0x59, 0xe3, 0xec, 0x02, 0xdc, 0x67, 0x6a,
+  0x87, 0x66, 0x9b, 0x29, 0xc1, 0x50, 0x99, 0x28, 0xc4, 0xfc, 0x8c, 0x47,
+  0x1b, 0x2b, 0x0d, 0x46, 0x67, 0x10, 0x58, 0x89, 0x55, 0x27, 0x0a, 0x02,
+  0xe5, 0x6f, 0xfa, 0x66, 0x79, 0x69, 0x72, 0xfc, 0x3a, 0x61, 0x0e, 0xf2,
+  0x77, 0x61, 0x9f, 0x09
+};
+
+static const uint8_t ecdsa_sig3 [64] = {
+  0x9f, 0xa8, 0xd7, 0xd5, 0xc0, 0xa6, 0x46, 0x04, 0xb3, 0x74, 0xb6, 0xb9,
+  0xda, 0x36, 0x29, 0xe2, 0x30, 0x34, 0xdc, 0xbf, 0x96, 0x7a, 0xbb, 0x66,
+  0x0e, 0x06, 0x82, 0x8d, 0x27, 0xe8, 0xdf, 0xf2, 0x0b, 0x18, 0xb3, 0x59,
+  0x49, 0x25, 0x29, 0x60, 0x5c, 0x86, 0x19, 0x23, 0x3f, 0x6d, 0x99, 0xd1,
+  0x79, 0x4d, 0x40, 0x74, 0x9a, 0xdd, 0xd4, 0x87, 0x0d, 0xfc, 0xb6, 0xed,
+  0xcb, 0x9c, 0xee, 0x8e
+};
+
+static const uint8_t ecdsa_msg3 [55] = {
+  0xc9, 0x96, 0x5d, 0xb6, 0xe8, 0xd6, 0xfa, 0x93, 0x87, 0x5b, 0xdd, 0x87,
+  0x53, 0xbe, 0x28, 0x7a, 0x7f, 0x9b, 0x0e, 0x4b, 0xda, 0x7a, 0xba, 0x22,
+  0x0f, 0xb1, 0x12, 0x71, 0xc1, 0x4a, 0xe2, 0x21, 0x52, 0x17, 0xe2, 0x03,
+  0x4a, 0xc0, 0x47, 0x87, 0x64, 0x10, 0xae, 0x81, 0x0d, 0x2b, 0xec, 0x6a,
+  0x90, 0x85, 0x44, 0xd6, 0x5e, 0x0a, 0x99
+};
+
+static const uint8_t ecdsa_pk4 [64] = {
+  0x33, 0xa8, 0x43, 0x1a, 0xb3, 0x1b, 0xf3, 0x86, 0xeb, 0x3a, 0x03, 0x6d,
+  0xd8, 0xeb, 0x02, 0xc3, 0xc4, 0xb6, 0x40, 0x95, 0xc3, 0xa4, 0xf6, 0x57,
+  0x5a, 0x12, 0x6c, 0xd5, 0x60, 0xe1, 0xd7, 0x3c, 0x98, 0x1d, 0x73, 0x14,
+  0x35, 0xd5, 0x72, 0x60, 0x76, 0xa6, 0x55, 0xc2, 0x05, 0x84, 0x6d, 0x37,
+  0x59, 0xbe, 0xfa, 0xc1, 0x95, 0x20, 0x24, 0x92, 0x74, 0x32, 0xe8, 0x6a,
+  0xa8, 0x73, 0xad, 0x0a
+};
+
+static const uint8_t ecdsa_sig4 [64] = {
+  0x67, 0x36, 0x9b, 0xb4, 0x8e, 0x0e, 0xb9, 0xb8, 0x96, 0x0a, 0xb6, 0xcf,
+  0xac, 0x05, 0x39, 0xc1, 0x0f, 0xe4, 0x48, 0xa7, 0x21, 0x94, 0x8b, 0x8e,
+  0xa3, 0xb4, 0xd8, 0xb0, 0x5c, 0x1f, 0xeb, 0xba, 0xf6, 0x98, 0x57, 0xc6,
+  0x0e, 0xa2, 0xad, 0xa0, 0x91, 0x7a, 0x49, 0xf9, 0x2a, 0x7c, 0x80, 0x3c,
+  0xf7, 0xaf, 0xf1, 0x46, 0x30, 0x24, 0xec, 0x5d, 0x5f, 0x4e, 0xfc, 0x1d,
+  0x08, 0xf3, 0x39, 0xfd
+};
+
+static const uint8_t ecdsa_msg4 [56] = {
+  0x7a, 0xc1, 0x15, 0x30, 0x27, 0xe2, 0xc5, 0x92, 0x03, 0xd1, 0x85, 0xd1,
+  0xf1, 0xe1, 0xa2, 0x5f, 0x6e, 0xce, 0x37, 0xa5, 0x8f, 0x56, 0x0b, 0x7c,
+  0x6c, 0x9e, 0x23, 0x5a, 0x3c, 0xbb, 0x18, 0xd9, 0xea, 0x1c, 0xcd, 0xf2,
+  0x75, 0x66, 0x72, 0xb4, 0x8a, 0x36, 0x4e, 0x85, 0xaf, 0x34, 0x17, 0x1c,
+  0xc4, 0xa7, 0x81, 0xbe, 0x8e, 0xdf, 0x3f, 0xd5
+};
+
+static const uint8_t ecdsa_pk5 [64] = {
+  0xd7, 0xc1, 0xb6, 0xe3, 0x4c, 0xcf, 0x90, 0x24, 0x57, 0xce, 0xc0, 0xde,
+  0xd0, 0xae, 0x70, 0x9d, 0x33, 0xf1, 0x95, 0x0b, 0x74, 0xea, 0x4a, 0xd6,
+  0x39, 0xc5, 0x4a, 0xcb, 0xc0, 0xfb, 0x4f, 0xb9, 0xb3, 0x52, 0x54, 0x30,
+  0x55, 0x9a, 0x52, 0x81, 0x81, 0xf2, 0xdd, 0x30, 0x14, 0xec, 0x26, 0x54,
+  0x8b, 0x48, 0x73, 0x8b, 0xbb, 0x62, 0x21, 0xdd, 0x05, 0x36, 0xaa, 0x80,
+  0x9c, 0xd0, 0x62, 0xb9
+};
+
+static const uint8_t ecdsa_sig5 [64] = {
+  0x31, 0x2a, 0x0b, 0x9f, 0x20, 0x84, 0x80, 0xe9, 0x22, 0xeb, 0xc7, 0xc6,
+  0x57, 0x40, 0x08, 0x2a, 0xcc, 0xc0, 0x81, 0x8f, 0x37, 0x41, 0x72, 0x7e,
+  0x2c, 0x83, 0xd2, 0x1a, 0x11, 0xbe, 0xcc, 0x01, 0x08, 0x29, 0xe8, 0x69,
+  0xf2, 0xf4, 0xbb, 0xec, 0x3f, 0xe1, 0x8b, 0x5c, 0xfb, 0xa2, 0x71, 0x9d,
+  0xf7, 0x88, 0x57, 0x4d, 0x24, 0x25, 0xef, 0xca, 0x60, 0x1d, 0xda, 0x44,
+  0xb0, 0xc6, 0xc7, 0x4c
+};
+
+static const uint8_t ecdsa_msg5 [64] = {
+  0xdc, 0xe3, 0xe5, 0x78, 0x5c, 0xb9, 0x44, 0xea, 0x87, 0x80, 0x8c, 0x75,
+  0xd0, 0x3b, 0x26, 0xb3, 0xf8, 0x9c, 0x88, 0x50, 0x98, 0x01, 0x13, 0x02,
+  0x7e, 0xab, 0x86, 0x3f, 0x49, 0xfc, 0x15, 0x94, 0x10, 0x22, 0xd5, 0x78,
+  0xd4, 0x1d, 0x59, 0x57, 0x52, 0xbe, 0xd6, 0x6b, 0x3e, 0x57, 0x96, 0xdc,
+  0x1d, 0xe4, 0x12, 0xea, 0x82, 0x48, 0x05, 0x8f, 0xfc, 0x01, 0x5c, 0x08,
+  0x88, 0x87, 0x1b, 0x05
+};
+
+static const uint8_t ecdsa_pk6 [64] = {
+  0x85, 0x82, 0x4f, 0x83, 0xf4, 0xe1, 0x2f, 0xee, 0xf2, 0x38, 0xc1, 0x89,
+  0x42, 0x04, 0x61, 0x65, 0xac, 0x90, 0xa7, 0x82, 0xc0, 0xfd, 0x2f, 0x93,
+  0x4a, 0x00, 0x30, 0x46, 0x15, 0xb6, 0x38, 0x92, 0xee, 0xf4, 0x67, 0x36,
+  0xed, 0x9c, 0xaa, 0x75, 0x88, 0xcb, 0x7b, 0x98, 0x73, 0xe2, 0xf5, 0xa7,
+  0x0d, 0x2e, 0x10, 0x34, 0x78, 0xdf, 0xf9, 0x23, 0x66, 0xa3, 0x4f, 0x5f,
+  0x0a, 0x82, 0x36, 0x15
+};
+
+static const uint8_t ecdsa_sig6 [64] = {
+  0x21, 0xbe, 0x5d, 0x1f, 0x79, 0x08, 0x78, 0x29, 0x2e, 0x7d, 0xfd, 0xfa,
+  0x3a, 0xbb, 0x30, 0x2d, 0xb8, 0x91, 0x70, 0xc4, 0xaf, 0x48, 0xfb, 0x65,
+  0xbf, 0x7f, 0xcc, 0x19, 0xec, 0x54, 0xcf, 0xca, 0x4f, 0x21, 0x9d, 0xe7,
+  0x84, 0x1d, 0xfe, 0xde, 0xee, 0x03, 0x1e, 0x13, 0x9e, 0x41, 0xf9, 0xee,
+  0x42, 0xc6, 0x19, 0xe3, 0x35, 0x56, 0x07, 0x1b, 0x00, 0xb5, 0x26, 0x79,
+  0xb4, 0xff, 0xcf, 0xaa
+};
+
+static const uint8_t ecdsa_msg6 [100] = {
+  0xa3, 0x2b, 0x26, 0xda, 0xc3, 0x4b, 0xe2, 0x3c, 0x96, 0x61, 0x67, 0x5e,
+  0x92, 0x7b, 0xc9, 0x2c, 0x09, 0x24, 0x8f, 0xaf, 0xc5, 0x52, 0x52, 0x94,
+  0x85, 0x9d, 0x0f, 0xad, 0x8e, 0xa6, 0x7c, 0x34, 0x26, 0x0a, 0xae, 0x40,
+  0x4a, 0x1c, 0xa6, 0xb9, 0x0d, 0x47, 0x4d, 0x68, 0x46, 0x17, 0xc9, 0x83,
+  0x0c, 0x02, 0x16, 0xec, 0x82, 0xd9, 0x5e, 0xf2, 0x11, 0x79, 0xfc, 0x91,
+  0xe7, 0x54, 0x3a, 0xde, 0xc3, 0x49, 0x57, 0xad, 0x09, 0x7e, 0x15, 0x14,
+  0x0a, 0x07, 0x55, 0xaf, 0x7c, 0xa2, 0xe1, 0xf2, 0x33, 0xfb, 0xd1, 0x76,
+  0xd5, 0x25, 0x2d, 0x7d, 0x3c, 0x76, 0xd1, 0x16, 0xd4, 0x15, 0xa8, 0xf2,
+  0x85, 0xe3, 0x1c, 0x33
+};
+
+static const uint8_t ecdsa_pk7 [64] = {
+  0x1f, 0x30, 0xbc, 0xa6, 0xd5, 0xa2, 0xf4, 0x9e, 0x2e, 0x0f, 0x8c, 0xdd,
+  0x4c, 0xb2, 0xb8, 0xd2, 0x26, 0x1a, 0x2a, 0xbe, 0xbc, 0x8b, 0x62, 0xfa,
+  0x6d, 0x94, 0x6d, 0xf4, 0x9e, 0x43, 0x22, 0x34, 0xd2, 0xf6, 0x87, 0xbc,
+  0x7d, 0xe4, 0x75, 0xa9, 0x14, 0x15, 0x22, 0x2c, 0x5a, 0x27, 0xb3, 0xe6,
+  0xfc, 0xc1, 0x55, 0x1b, 0x98, 0x73, 0xd9, 0x23, 0xe6, 0xe9, 0x72, 0x14,
+  0xb1, 0x14, 0x9d, 0x61
+};
+
+static const uint8_t ecdsa_sig7 [64] = {
+  0x89, 0x25, 0x7c, 0xaf, 0xb4, 0xf7, 0x1b, 0xfd, 0xc9, 0xeb, 0x68, 0x1d,
+  0x20, 0xcc, 0x35, 0xa2, 0x1f, 0xc1, 0x4f, 0xf4, 0x14, 0x7a, 0x5d, 0x05,
+  0xcf, 0xa2, 0x67, 0x13, 0xb3, 0x8c, 0x14, 0xd2, 0xf8, 0x2e, 0x90, 0x41,
+  0xa1, 0x65, 0x0f, 0xe9, 0xfe, 0xcd, 0x44, 0x16, 0xb3, 0xe2, 0xbc, 0x2b,
+  0x49, 0x6d, 0x36, 0xe3, 0xbd, 0x6b, 0x86, 0x85, 0x2d, 0x91, 0xab, 0x35,
+  0x66, 0x02, 0x56, 0x6d
+};
+
+static const uint8_t ecdsa_msg7 [127] = {
+  0x42, 0x5c, 0xd7, 0xbb, 0xbb, 0x13, 0xae, 0x98, 0xac, 0xd0, 0x02, 0x0b,
+  0x92, 0x88, 0x01, 0x2b, 0xf4, 0x27, 0x94, 0xca, 0xaa, 0x53, 0x67, 0xcf,
+  0x70, 0x87, 0xbc, 0xf3, 0x40, 0x47, 0x61, 0x63, 0x55, 0x33, 0x3a, 0x75,
+  0x99, 0x68, 0xff, 0xc1, 0x78, 0x76, 0xbb, 0x24, 0x13, 0xcd, 0x55, 0x17,
+  0x06, 0x3d, 0x14, 0xcf, 0xe9, 0x30, 0xb2, 0xeb, 0xbb, 0xf9, 0x5a, 0xe0,
+  0x40, 0xcd, 0xd5, 0x5e, 0xbd, 0x16, 0xba, 0x6d, 0xea, 0x13, 0xda, 0x38,
+  0xc7, 0x80, 0xfd, 0xce, 0x09, 0xdf, 0x52, 0x0c, 0x3e, 0x11, 0x96, 0x8b,
+  0x6a, 0xc6, 0xbb, 0xeb, 0xd0, 0x8e, 0xcb, 0x7e, 0x13, 0x9a, 0x60, 0xa1,
+  0x9c, 0x86, 0x50, 0x50, 0xd9, 0x65, 0x28, 0xeb, 0xf6, 0xa7, 0x63, 0x85,
+  0x7a, 0xfd, 0x9c, 0x92, 0x62, 0x99, 0x29, 0xea, 0xf0, 0x45, 0x1b, 0x55,
+  0xc4, 0xa3, 0x4a, 0xca, 0xca, 0x9c, 0xbc
+};
+
+static const uint8_t ecdsa_pk8 [64] = {
+  0xa4, 0x06, 0xe5, 0xf1, 0x23, 0xd5, 0x70, 0x4c, 0x94, 0xf1, 0x35, 0x80,
+  0x28, 0xaf, 0xf7, 0xf9, 0x52, 0x44, 0xe5, 0x16, 0xb5, 0xe4, 0x91, 0xee,
+  0x5a, 0x71, 0x3b, 0xc0, 0xb0, 0xd9, 0x00, 0xaa, 0xca, 0xdf, 0xf5, 0x7e,
+  0x83, 0xfa, 0xbb, 0x3a, 0xdf, 0x37, 0x31, 0xbc, 0x49, 0x5a, 0xda, 0x70,
+  0xbf, 0x50, 0xe8, 0xfd, 0x1d, 0xca, 0x4b, 0x91, 0xe0, 0x28, 0x57, 0x58,
+  0x61, 0x86, 0x83, 0x47
+};
+
+static const uint8_t ecdsa_sig8 [64] = {
+  0x0c, 0x9a, 0x67, 0x91, 0xeb, 0xee, 0x8a, 0x41, 0xf8, 0x6d, 0xb7, 0x37,
+  0xe7, 0x02, 0xba, 0xb0, 0x6a, 0xad, 0x3b, 0x85, 0xc2, 0x8f, 0x65, 0x40,
+  0xeb, 0xe0, 0xd2, 0xb5, 0x00, 0x0f, 0xcb, 0x4f, 0x24, 0xc8, 0x7c, 0xe8,
+  0xc0, 0x9e, 0xc9, 0x2c, 0x88, 0x81, 0x9a, 0xf1, 0xc6, 0xd6, 0x4a, 0x7a,
+  0x2c, 0xd4, 0x84, 0x35, 0xad, 0x0c, 0xe8, 0x6c, 0xe8, 0x5d, 0xf5, 0x88,
+  0x21, 0xdd, 0xc2, 0xaf
+};
+
+static const uint8_t ecdsa_msg8 [128] = {
+  0x09, 0x13, 0x43, 0xe4, 0x31, 0xb4, 0x95, 0xcc, 0xee, 0xf1, 0xa4, 0x12,
+  0x19, 0x0f, 0x99, 0x0e, 0x55, 0x30, 0x16, 0xf9, 0x18, 0x42, 0x76, 0xb4,
+  0xbf, 0x64, 0xa8, 0xd9, 0xd5, 0xbd, 0xbe, 0x0e, 0x14, 0xed, 0xcd, 0x5e,
+  0x9e, 0x38, 0x39, 0xc0, 0x98, 0xc3, 0x11, 0xbd, 0x42, 0xd0, 0xb9, 0x6d,
+  0xe6, 0x58, 0x7f, 0xc2, 0x5e, 0x6f, 0x04, 0x2d, 0x39, 0x64, 0x9a, 0x1e,
+  0x0a, 0xc8, 0x0e, 0xa3, 0xa1, 0x7a, 0x05, 0x74, 0x91, 0xa4, 0xc8, 0xce,
+  0x4e, 0xd6, 0xad, 0xd3, 0x1e, 0x6a, 0x60, 0x9a, 0x33, 0x01, 0x4b, 0xdc,
+  0x06, 0xfc, 0xb9, 0xac, 0x22, 0xda, 0x9f, 0x58, 0xe4, 0xeb, 0xb5, 0xf3,
+  0xc2, 0x37, 0x80, 0x5e, 0x4c, 0x21, 0x12, 0x92, 0x23, 0x84, 0xfb, 0x92,
+  0x78, 0xfe, 0x44, 0x29, 0xde, 0x1c, 0x32, 0xdd, 0x29, 0x06, 0x23, 0x09,
+  0x3a, 0x6a, 0x4c, 0xc1, 0x33, 0xe1, 0x50, 0x64
+};
+
+static const uint8_t ecdsa_pk9 [64] = {
+  0x6d, 0xcc, 0xd5, 0xa6, 0x1e, 0x89, 0x56, 0x72, 0x5f, 0x92, 0x12, 0x4c,
+  0x71, 0xff, 0x98, 0x0b, 0x3d, 0x08, 0x2b, 0xd9, 0x4f, 0x7b, 0x53, 0xd4,
+  0x50, 0x12, 0x2e, 0xa6, 0xad, 0x1a, 0xc7, 0xbb, 0x67, 0x52, 0x3e, 0xc7,
+  0x89, 0x0a, 0xb5, 0x5a, 0xd5, 0xcd, 0x44, 0xb4, 0x5a, 0x7d, 0xb3, 0xe9,
+  0xb2, 0xa1, 0xb5, 0xbe, 0x48, 0x88, 0xe1, 0x27, 0x3d, 0x92, 0xe6, 0xe6,
+  0x7a, 0xd6, 0x34, 0x2d
+};
+
+static const uint8_t ecdsa_sig9 [64] = {
+  0xa8, 0x7d, 0x87, 0xa3, 0x60, 0x37, 0x8c, 0x9c, 0xf8, 0x11, 0x86, 0x47,
+  0x0e, 0x0e, 0x61, 0x21, 0x66, 0xcb, 0xf8, 0x12, 0x4a, 0x0f, 0x58, 0x14,
+  0x0e, 0x53, 0xc2, 0xa0, 0x9f, 0x80, 0x68, 0x0a, 0x9d, 0xb9, 0x31, 0x87,
+  0x66, 0xa7, 0x8d, 0xaf, 0x5d, 0xbd, 0x08, 0x3f, 0x54, 0x87, 0xf6, 0x8a,
+  0xe0, 0x21, 0xa4, 0x51, 0xbb, 0x1e, 0x13, 0x50, 0x51, 0xda, 0x5d, 0x11,
+  0x83, 0xd3, 0xb1, 0x76
+};
+
+static const uint8_t ecdsa_msg9 [200] = {
+  0xb8, 0x32, 0x70, 0xe1, 0xd7, 0xbd, 0x49, 0x6f, 0x7d, 0x58, 0x80, 0x97,
+  0xd8, 0x8c, 0xc4, 0x0b, 0x5b, 0x9b, 0xb3, 0x9d, 0x1d, 0x39, 0x3f, 0xe9,
+  0x77, 0xc2, 0xb0, 0x45, 0x9c, 0xf2, 0x29, 0xd6, 0xf2, 0x7d, 0xb9, 0xc7,
+  0x7a, 0x45, 0xf4, 0xa4, 0xc1, 0xce, 0x51, 0xf1, 0x2f, 0x07, 0x40, 0x9d,
+  0xa9, 0x8b, 0x0c, 0xd3, 0xbb, 0x76, 0x66, 0x96, 0x6a, 0x8f, 0x22, 0xa8,
+  0x42, 0xeb, 0x76, 0x21, 0xf5, 0xbe, 0xb5, 0x1c, 0x9a, 0x25, 0xf2, 0xcc,
+  0x2a, 0xa9, 0x36, 0xf0, 0xfe, 0xb7, 0x94, 0x87, 0x04, 0xd8, 0x40, 0xec,
+  0xbd, 0x9d, 0x75, 0xbb, 0x11, 0xd0, 0xb0, 0xd3, 0x5b, 0xa3, 0xd2, 0xe2,
+  0x98, 0x61, 0xbc, 0x87, 0x65, 0x88, 0xc0, 0x3c, 0x51, 0x3e, 0x9e, 0xab,
+  0x17, 0xbb, 0x69, 0x4c, 0x66, 0xa8, 0x72, 0xf7, 0xfe, 0x7e, 0xed, 0xe2,
+  0xe3, 0x0c, 0xe1, 0xf4, 0xfe, 0xa0, 0xb3, 0xfb, 0xf4, 0xcf, 0x8e, 0x61,
+  0x0f, 0x5c, 0xe1, 0xce, 0x3b, 0xe8, 0x07, 0x1b, 0xf4, 0x25, 0x97, 0xfd,
+  0x59, 0x18, 0xeb, 0xad, 0x7d, 0xd6, 0x28, 0xdf, 0x9f, 0x28, 0x54, 0xe4,
+  0x8f, 0x2e, 0x93, 0x2c, 0x9d, 0xa5, 0x36, 0xb2, 0x60, 0xeb, 0xec, 0x3c,
+  0x90, 0x0e, 0x63, 0x58, 0x15, 0xc0, 0xa3, 0x61, 0x3a, 0x20, 0x5b, 0xed,
+  0x6e, 0xd8, 0x71, 0x8c, 0x01, 0x46, 0x40, 0x93, 0xee, 0x85, 0xab, 0xf5,
+  0x57, 0x03, 0x46, 0xf9, 0x01, 0x3b, 0x4f, 0xe6
+};
+
+static const uint8_t ecdsa_pk10 [64] = {
+  0x70, 0xa6, 0xcc, 0x47, 0x5b, 0x16, 0x87, 0xf4, 0x0b, 0x17, 0xb1, 0x53,
+  0x4f, 0xa5, 0x87, 0xaf, 0x8d, 0xf3, 0x2e, 0x3b, 0x96, 0xb1, 0xc7, 0x0e,
+  0x4a, 0xac, 0x50, 0x29, 0x86, 0x92, 0xf3, 0x47, 0xda, 0x29, 0xb9, 0xb1,
+  0x88, 0x01, 0x12, 0x46, 0x5a, 0xbf, 0x4d, 0xc7, 0xb3, 0x4f, 0xe5, 0x00,
+  0x50, 0xff, 0x6b, 0xd4, 0xc2, 0xbb, 0xfe, 0x0c, 0xbb, 0x78, 0xec, 0x89,
+  0x0f, 0xa6, 0xd5, 0xc1
+};
+
+static const uint8_t ecdsa_sig10 [64] = {
+  0x6a, 0x43, 0x61, 0x4b, 0x73, 0x0a, 0xcf, 0x82, 0xaa, 0xfc, 0xa4, 0xdd,
+  0x75, 0xcf, 0x94, 0xb6, 0x56, 0x98, 0xf8, 0x09, 0x1f, 0xf1, 0xc2, 0x9e,
+  0xe9, 0xca, 0x85, 0x02, 0xae, 0x38, 0xc0, 0xd3, 0x5e, 0x01, 0x74, 0x5d,
+  0x19, 0xc9, 0x7a, 0xed, 0xee, 0xa2, 0x7d, 0xa8, 0xb2, 0x10, 0x3c, 0xc5,
+  0x3c, 0x05, 0x4d, 0x55, 0xc0, 0xa7, 0xdb, 0x47, 0xa8, 0xbc, 0xa7, 0x33,
+  0x94, 0x94, 0x6c, 0x06
+};
+
+static const uint8_t ecdsa_msg10 [256] = {
+  0xe9, 0x56, 0xaf, 0x02, 0xe1, 0x32, 0xc1, 0xf0, 0x9c, 0xfe, 0x80, 0xf0,
+  0xac, 0x33, 0xf2, 0xef, 0x99, 0x4e, 0x86, 0xbd, 0x3b, 0xdc, 0xdd, 0xee,
+  0x41, 0xa5, 0x9b, 0x49, 0x18, 0x7a, 0xf7, 0xbb, 0xcb, 0x48, 0x89, 0x61,
+  0xaf, 0x96, 0x33, 0x0a, 0x90, 0x09, 0x94, 0x0c, 0x95, 0xf9, 0x80, 0xc6,
+  0xd6, 0xad, 0xab, 0x9c, 0x2e, 0xa6, 0x33, 0x73, 0xd6, 0xbe, 0xbd, 0x4f,
+  0x18, 0xe8, 0x47, 0x26, 0x1d, 0x28, 0x21, 0xd4, 0x49, 0x99, 0xfe, 0x1a,
+  0xf4, 0xae, 0x14, 0x68, 0x89, 0xab, 0xea, 0x45, 0x48, 0x37, 0x8d, 0x59,
+  0x4c, 0xbc, 0x06, 0xc7, 0x59, 0x84, 0xd4, 0xe7, 0xa9, 0x48, 0x45, 0x7f,
+  0xa4, 0xce, 0xe6, 0x02, 0xc8, 0xc5, 0xd7, 0x70, 0x31, 0xad, 0xe1, 0x33,
+  0x9e, 0x91, 0x2a, 0xb8, 0x3e, 0x5a, 0x70, 0x2a, 0x24, 0x31, 0x8f, 0x74,
+  0xea, 0x6f, 0x4e, 0xf4, 0x38, 0xe8, 0x13, 0xfe, 0xe1, 0x55, 0xce, 0x77,
+  0xb5, 0x24, 0xa0, 0xe2, 0x04, 0xe5, 0x09, 0xc1, 0xb1, 0x3a, 0xb1, 0xd4,
+  0x9f, 0x27, 0x39, 0xbf, 0x72, 0xbe, 0x2c, 0x27, 0x5d, 0x85, 0x9d, 0xba,
+  0x8f, 0x1b, 0x00, 0x6e, 0x6a, 0x36, 0x2a, 0x2d, 0x4f, 0x73, 0xf8, 0x31,
+  0xac, 0xa5, 0x00, 0x10, 0x8a, 0xc8, 0x3b, 0xa9, 0xc3, 0x26, 0x7c, 0x0d,
+  0xf6, 0x0d, 0x5a, 0xf8, 0xd0, 0xc1, 0x4b, 0xff, 0x6d, 0xbd, 0x33, 0x29,
+  0x78, 0xf7, 0xfa, 0xfe, 0x95, 0x5d, 0x12, 0x9f, 0x3f, 0xdf, 0x53, 0x32,
+  0x08, 0x78, 0xf1, 0x57, 0xb8, 0xf3, 0xa0, 0x11, 0x18, 0x8d, 0xbc, 0x9b,
+  0xf8, 0x42, 0x5f, 0x5b, 0x53, 0xe7, 0xe9, 0xbf, 0x9e, 0x28, 0x8d, 0x10,
+  0x8e, 0xf7, 0xe0, 0xe1, 0xc4, 0x63, 0xea, 0x6e, 0xdb, 0x1f, 0x41, 0xe6,
+  0xf2, 0x3f, 0x66, 0x06, 0x63, 0x04, 0x59, 0x18, 0x70, 0xc1, 0xf1, 0x4b,
+  0xdf, 0x76, 0x6e, 0xb7
+};
+
+static const uint8_t ecdsa_pk11 [64] = {
+  0xa3, 0x87, 0x86, 0x38, 0xf2, 0x3d, 0xc0, 0xd8, 0x0f, 0x90, 0x6b, 0x25,
+  0x65, 0x91, 0x22, 0xa5, 0xa7, 0x20, 0x1a, 0x9d, 0x43, 0x58, 0x08, 0x1a,
+  0xc4, 0xda, 0x1c, 0x5f, 0x16, 0x4f, 0xc2, 0xeb, 0xbb, 0xb2, 0x81, 0xd6,
+  0x32, 0x1b, 0x8f, 0x62, 0x98, 0x26, 0x2d, 0xd7, 0x7a, 0xe6, 0x48, 0xed,
+  0x02, 0x13, 0x3c, 0xd2, 0x4f, 0xfe, 0xfd, 0x8c, 0x38, 0xb3, 0x30, 0xb5,
+  0x07, 0xcc, 0x35, 0xca
+};
+
+static const uint8_t ecdsa_sig11 [64] = {
+  0x24, 0x55, 0x72, 0x2c, 0x94, 0x7d, 0x8e, 0x5e, 0xcf, 0xa3, 0x7b, 0x62,
+  0x79, 0x2a, 0x92, 0xac, 0xcb, 0x85, 0x02, 0x52, 0x8c, 0x05, 0xc7, 0x90,
+  0x9c, 0x5d, 0xfc, 0x19, 0xbe, 0x85, 0xbb, 0xe5, 0x94, 0xdd, 0xc0, 0x60,
+  0x74, 0xe5, 0x71, 0x4b, 0x26, 0x50, 0x0d, 0xd6, 0x29, 0xa8, 0x4b, 0xd7,
+  0xf4, 0xc4, 0xa3, 0x26, 0x08, 0x0b, 0x73, 0x11, 0x47, 0xa6, 0xb1, 0xa3,
+  0x4b, 0x07, 0xf0, 0x68
+};
+
+static const uint8_t ecdsa_msg11 [1] = {
+  0x32
+};
+
+static const uint8_t ecdsa_pk12 [64] = {
+  0x89, 0xdd, 0xb5, 0x6f, 0xe1, 0xb2, 0x5d, 0xca, 0xbc, 0x61, 0x89, 0xea,
+  0x3d, 0x89, 0x2a, 0xb5, 0x4c, 0x60, 0x88, 0x38, 0x7e, 0xbc, 0x14, 0xd3,
+  0x18, 0x1b, 0xde, 0xb3, 0x87, 0x5f, 0x8b, 0x4b, 0x1a, 0x94, 0xb0, 0x5a,
+  0xdb, 0x69, 0x4d, 0x5c, 0xa0, 0xf8, 0xce, 0x06, 0x93, 0x9d, 0x28, 0x24,
+  0x82, 0x2d, 0x0a, 0xf8, 0x59, 0xfc, 0x18, 0x05, 0xc7, 0x1d, 0x09, 0x03,
+  0x03, 0x32, 0x7a, 0xc0
+};
+
+static const uint8_t ecdsa_sig12 [64] = {
+  0x78, 0x96, 0x4d, 0xe8, 0xdb, 0x39, 0x46, 0xf7, 0xe2, 0x72, 0x12, 0x47,
+  0x56, 0x6b, 0x62, 0x2e, 0x2b, 0x21, 0x6a, 0xd9, 0xf0, 0xa3, 0xe4, 0xce,
+  0xf3, 0xc6, 0x6c, 0x4d, 0x8f, 0x9a, 0x8e, 0x35, 0x97, 0xa3, 0x00, 0x04,
+  0xc9, 0x5d, 0x39, 0xd3, 0xe3, 0xac, 0x48, 0xec, 0x3a, 0x35, 0x82, 0xbf,
+  0xd5, 0x78, 0x17, 0x57, 0x8f, 0x1d, 0x30, 0xf6, 0x44, 0xad, 0x65, 0x79,
+  0xc0, 0x9b, 0x02, 0xa5
+};
+
+static const uint8_t ecdsa_msg12 [17] = {
+  0xd6, 0x20, 0x74, 0x64, 0x0a, 0xd2, 0x41, 0x0f, 0xaf, 0x51, 0xc9, 0x66,
+  0x5d, 0x06, 0xfa, 0x80, 0xc1
+};
+
+static const uint8_t ecdsa_pk13 [64] = {
+  0x12, 0x51, 0x93, 0x46, 0xe8, 0x77, 0x5e, 0xb3, 0xdd, 0xad, 0xe5, 0xac,
+  0xd1, 0x00, 0xae, 0x21, 0x48, 0xbc, 0x7c, 0x6a, 0x5b, 0xf5, 0xc4, 0x8e,
+  0x7e, 0x96, 0x3d, 0x3b, 0x4c, 0xff, 0xf1, 0xc4, 0x05, 0xdb, 0xea, 0x83,
+  0x0c, 0x24, 0xa5, 0xee, 0x41, 0xd8, 0x22, 0x38, 0x31, 0xe7, 0x5d, 0x6a,
+  0xf3, 0x52, 0x05, 0x67, 0xcd, 0x3a, 0x5e, 0x98, 0x94, 0x2e, 0x83, 0xda,
+  0xcc, 0x00, 0x55, 0xd5
+};
+
+static const uint8_t ecdsa_sig13 [64] = {
+  0x22, 0x16, 0x61, 0xc9, 0x52, 0xfd, 0xaa, 0xcc, 0x6e, 0x84, 0x4e, 0x4d,
+  0xbe, 0x55, 0x82, 0xb7, 0xad, 0x42, 0xdd, 0x45, 0x8a, 0x82, 0x20, 0x79,
+  0xe4, 0xcc, 0x6e, 0x4e, 0x21, 0xdc, 0x41, 0x1e, 0xaa, 0xa5, 0x30, 0x96,
+  0x11, 0x70, 0xdf, 0xf8, 0x35, 0x37, 0x9d, 0x1c, 0x58, 0x9a, 0xa6, 0x20,
+  0xa8, 0x18, 0x40, 0xd2, 0x01, 0xd8, 0x15, 0xbc, 0x36, 0x64, 0xa9, 0x67,
+  0x8b, 0xd2, 0x5f, 0x1f
+};
+
+static const uint8_t ecdsa_msg13 [95] = {
+  0xd4, 0xf7, 0xff, 0x9c, 0x92, 0x9d, 0xbb, 0x10, 0xc9, 0x15, 0x3c, 0xb7,
+  0x6d, 0xb0, 0x56, 0xce, 0x32, 0x5a, 0x16, 0x19, 0x94, 0x8f, 0x45, 0x51,
+  0x9d, 0x1b, 0x5f, 0xdc, 0xb3, 0x7a, 0x03, 0x47, 0x41, 0x1e, 0x95, 0x79,
+  0x5a, 0xa1, 0x0c, 0xe7, 0x2d, 0xa1, 0x36, 0x31, 0xa8, 0x9e, 0x3f, 0xfc,
+  0xa2, 0x10, 0x30, 0x3f, 0x39, 0xc3, 0xbc, 0xf4, 0xa1, 0x93, 0xd7, 0x5c,
+  0x4d, 0x97, 0x92, 0x33, 0xa6, 0x3e, 0xc7, 0x0f, 0x00, 0xf7, 0x46, 0x85,
+  0x62, 0x01, 0x6d, 0x17, 0xe7, 0x91, 0x36, 0x79, 0xd0, 0xb3, 0x21, 0xbe,
+  0xbf, 0x78, 0x58, 0x7a, 0xb2, 0x89, 0x99, 0x5d, 0x26, 0xe4, 0x67
+};
+
+static const uint8_t ecdsa_pk14 [64] = {
+  0x31, 0x77, 0x06, 0x95, 0x16, 0x38, 0x08, 0xb2, 0xe4, 0x15, 0xb4, 0x26,
+  0x00, 0x05, 0x49, 0xda, 0x26, 0x4a, 0xbb, 0x81, 0x54, 0x0f, 0x44, 0xcd,
+  0x48, 0xc0, 0xdc, 0x28, 0x10, 0x8a, 0xb4, 0x2b, 0xcf, 0xa4, 0xb8, 0xf8,
+  0x72, 0xd6, 0xbf, 0x82, 0x0b, 0x6f, 0xad, 0x0a, 0x2c, 0x1f, 0xf0, 0xa6,
+  0x61, 0x86, 0xe9, 0xb6, 0xdb, 0xb9, 0x6a, 0x19, 0x62, 0x6d, 0x08, 0x83,
+  0x68, 0x34, 0x50, 0x8f
+};
+
+static const uint8_t ecdsa_sig14 [64] = {
+  0x11, 0x11, 0x95, 0xed, 0x95, 0xb5, 0x12, 0x12, 0x39, 0xf3, 0x60, 0x97,
+  0x3b, 0x68, 0xd1, 0x25, 0x5d, 0x35, 0x76, 0xae, 0x14, 0xbd, 0x33, 0xc9,
+  0x66, 0x80, 0x96, 0xd3, 0x52, 0x16, 0xc8, 0x02, 0xd1, 0x01, 0xe0, 0xbd,
+  0xf7, 0xad, 0x40, 0x1d, 0x32, 0x7b, 0xdd, 0xc7, 0xd1, 0xbc, 0x48, 0x40,
+  0x19, 0x1f, 0x5a, 0x82, 0x30, 0xd1, 0x22, 0xe3, 0x19, 0x99, 0xf5, 0xea,
+  0x23, 0x12, 0xdd, 0xed
+};
+
+static const uint8_t ecdsa_msg14 [140] = {
+  0xaa, 0x3f, 0x9f, 0x80, 0x69, 0xc7, 0xed, 0x25, 0xa7, 0xe8, 0x08, 0x07,
+  0x71, 0x14, 0x40, 0x9d, 0x29, 0x48, 0x91, 0x38, 0xdb, 0xf1, 0x95, 0xdd,
+  0x39, 0x99, 0x77, 0x27, 0x78, 0x01, 0xae, 0x9f, 0xef, 0x8e, 0x50, 0xc2,
+  0xfb, 0x3b, 0xed, 0xfb, 0x0e, 0x2a, 0x64, 0x58, 0x5a, 0x35, 0x5b, 0x98,
+  0x95, 0x61, 0xca, 0x23, 0xcb, 0xd8, 0x2e, 0x88, 0x08, 0x99, 0xaa, 0x2b,
+  0x25, 0xae, 0x23, 0xe2, 0xee, 0x00, 0x78, 0x76, 0xcd, 0xea, 0xce, 0x06,
+  0xda, 0xda, 0x58, 0xdd, 0x6e, 0xfb, 0xb7, 0x67, 0x98, 0x8d, 0xed, 0xcb,
+  0xf7, 0xc7, 0xf1, 0xde, 0xe8, 0xc2, 0x5a, 0x9c, 0xc5, 0x5b, 0x28, 0x93,
+  0xd5, 0xcd, 0x49, 0xce, 0xb7, 0x2d, 0x43, 0xad, 0xae, 0xab, 0x88, 0x4a,
+  0x8a, 0x35, 0x8a, 0x93, 0x35, 0xfb, 0xda, 0xce, 0x37, 0xe4, 0x1a, 0xac,
+  0x7e, 0x00, 0x40, 0x5a, 0x92, 0x7c, 0xb8, 0x44, 0x33, 0xd2, 0xf1, 0xef,
+  0xb4, 0xc4, 0xbb, 0xf4, 0x52, 0x40, 0x1d, 0xe8
+};
+
+static const uint8_t ecdsa_pk15 [64] = {
+  0x22, 0x32, 0x34, 0x56, 0x0e, 0x4c, 0xc0, 0xc6, 0x3a, 0x56, 0xf7, 0x68,
+  0xf5, 0xe3, 0x04, 0x0a, 0xac, 0x8e, 0x9c, 0x28, 0x00, 0xce, 0x29, 0xf3,
+  0x62, 0x48, 0x76, 0xe6, 0x81, 0x43, 0xc0, 0x8b, 0x2f, 0x72, 0x9c, 0x67,
+  0xb3, 0x94, 0xd6, 0xfe, 0x29, 0xa4, 0x44, 0x3a, 0x50, 0x9e, 0x80, 0x46,
+  0xed, 0x64, 0x25, 0x76, 0xa4, 0xcd, 0x93, 0x75, 0x43, 0xcc, 0x0f, 0x12,
+  0x57, 0xc8, 0xbb, 0x8d
+};
+
+static const uint8_t ecdsa_sig15 [64] = {
+  0x87, 0xa4, 0x6c, 0x54, 0x02, 0x9f, 0x36, 0xcc, 0x16, 0xaa, 0xe1, 0x35,
+  0x36, 0xb3, 0x69, 0x48, 0xc4, 0xe6, 0xfa, 0x42, 0xc8, 0xd0, 0x10, 0x14,
+  0xc1, 0xd8, 0x3c, 0xc6, 0x2f, 0x0e, 0xee, 0xc8, 0x73, 0x6b, 0x37, 0xcc,
+  0x79, 0x32, 0x16, 0x64, 0x5a, 0x9e, 0xfc, 0x73, 0x18, 0x79, 0x3e, 0xad,
+  0x37, 0xae, 0x30, 0x43, 0x7d, 0x36, 0xaa, 0x95, 0x5f, 0xa7, 0x83, 0xef,
+  0xa6, 0xdc, 0x54, 0xdd
+};
+
+static const uint8_t ecdsa_msg15 [300] = {
+  0xd4, 0xa1, 0x4e, 0x1d, 0xde, 0x2d, 0xe7, 0xe0, 0xe4, 0x4a, 0x8e, 0xf1,
+  0xd7, 0xae, 0x00, 0x93, 0xd3, 0x95, 0x18, 0x30, 0xff, 0x68, 0x62, 0x11,
+  0x14, 0x17, 0xf1, 0xe2, 0xc6, 0x87, 0x7f, 0xac, 0xc6, 0x7c, 0x76, 0x1a,
+  0x50, 0xfa, 0xa1, 0xe1, 0xed, 0xe6, 0x6a, 0xe4, 0x74, 0x38, 0x72, 0x62,
+  0x9d, 0xe8, 0xc4, 0xbf, 0x00, 0x24, 0xd8, 0x6c, 0x4b, 0x74, 0xb4, 0x21,
+  0x08, 0xa1, 0xc9, 0x88, 0xfa, 0xbf, 0x52, 0x48, 0xed, 0xdf, 0x9b, 0xda,
+  0x85, 0x00, 0xb2, 0x27, 0x48, 0xa9, 0x9f, 0x5b, 0x1b, 0xf0, 0x88, 0xa1,
+  0x42, 0xd6, 0x8d, 0xc5, 0x87, 0xcd, 0xa5, 0x0b, 0x83, 0xbd, 0xa7, 0x10,
+  0x9d, 0xce, 0x61, 0x3c, 0xec, 0x27, 0xf2, 0x20, 0x84, 0x43, 0x45, 0xc0,
+  0x97, 0xdf, 0x9d, 0x57, 0xb0, 0x47, 0x61, 0x63, 0x13, 0x10, 0xf5, 0x9a,
+  0x06, 0xfe, 0x70, 0x27, 0x5a, 0x51, 0xab, 0x79, 0xf3, 0x07, 0xb4, 0x49,
+  0xbe, 0xb1, 0x64, 0x40, 0x1d, 0x42, 0x29, 0xff, 0x50, 0x6c, 0xa1, 0x81,
+  0x50, 0x4a, 0xa5, 0x30, 0x42, 0x67, 0x73, 0x71, 0x2c, 0x00, 0xe2, 0xac,
+  0xeb, 0x60, 0xd8, 0xc8, 0xe7, 0x92, 0xaa, 0xf0, 0xd8, 0xdb, 0x8c, 0x93,
+  0xca, 0x82, 0x08, 0x0b, 0x50, 0xd2, 0xee, 0x6c, 0x01, 0x69, 0xd5, 0x2b,
+  0xa6, 0x96, 0x3f, 0x8d, 0xa6, 0x09, 0x82, 0x3c, 0x4d, 0xad, 0x06, 0x86,
+  0x88, 0x68, 0x2d, 0x12, 0x3a, 0xc9, 0xaf, 0x88, 0x77, 0x54, 0xbb, 0x9b,
+  0xf0, 0xbd, 0x4b, 0x6b, 0xed, 0xe8, 0x2d, 0xd1, 0xd6, 0x11, 0xbf, 0x35,
+  0xa9, 0xfb, 0x1a, 0x47, 0x43, 0xc5, 0xc8, 0xcc, 0xe0, 0xd0, 0x6f, 0xc5,
+  0xab, 0x02, 0x12, 0x85, 0xf6, 0x00, 0x68, 0x8c, 0xd1, 0x9b, 0xd7, 0x9a,
+  0xfa, 0xf9, 0xdd, 0xf1, 0xf0, 0x50, 0xed, 0x71, 0xdc, 0x13, 0xfa, 0x4b,
+  0xf1, 0x6e, 0x55, 0x15, 0x83, 0x80, 0x9a, 0x2e, 0xe5, 0x72, 0x3b, 0xa3,
+  0xff, 0x8b, 0x41, 0x40, 0x65, 0xd4, 0x1e, 0x8d, 0xbd, 0xad, 0x47, 0x66,
+  0x02, 0x30, 0xfe, 0xc0, 0xc0, 0x95, 0x93, 0x7f, 0x39, 0x83, 0xa9, 0x7e,
+  0x56, 0x7d, 0x31, 0x97, 0x92, 0x13, 0xd2, 0xfd, 0xc7, 0xe0, 0x02, 0x1a
+};
+
+static const ecdsa_p256_item_t ecdsa_items [ECDSA_TEST_ITEMS] = {
+  { ecdsa_pk0, ecdsa_sig0, ecdsa_msg0, 0 },
+  { ecdsa_pk1, ecdsa_sig1, ecdsa_msg1, 3 },
+  { ecdsa_pk2, ecdsa_sig2, ecdsa_msg2, 32 },
+  { ecdsa_pk3, ecdsa_sig3, ecdsa_msg3, 55 },
+  { ecdsa_pk4, ecdsa_sig4, ecdsa_msg4, 56 },
+  { ecdsa_pk5, ecdsa_sig5, ecdsa_msg5, 64 },
+  { ecdsa_pk6, ecdsa_sig6, ecdsa_msg6, 100 },
+  { ecdsa_pk7, ecdsa_sig7, ecdsa_msg7, 127 },
+  { ecdsa_pk8, ecdsa_sig8, ecdsa_msg8, 128 },
+  { ecdsa_pk9, ecdsa_sig9, ecdsa_msg9, 200 },
+  { ecdsa_pk10, ecdsa_sig10, ecdsa_msg10, 256 },
+  { ecdsa_pk11, ecdsa_sig11, ecdsa_msg11, 1 },
+  { ecdsa_pk12, ecdsa_sig12, ecdsa_msg12, 17 },
+  { ecdsa_pk13, ecdsa_sig13, ecdsa_msg13, 95 },
+  { ecdsa_pk14, ecdsa_sig14, ecdsa_msg14, 140 },
+  { ecdsa_pk15, ecdsa_sig15, ecdsa_msg15, 300 },
+};
+
+#endif // __ECDSA_VECTORS_H__
@@ -0,0 +1,5 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  sha_benchmark/zvknh.s \
+  sm2_benchmark/ecp256.c \
+  sm2_benchmark/fp256.c
@@ -0,0 +1,169 @@
+/*
+ * File      : test_ecdsa.c
+ * Test      : ecdsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of ECDSA P-256 signature verification,
+ * single against batches with one signature per vector lane, and a short
+ * certificate chain verified as one batch.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/ecc/api_ecdsa_p256.h"
+#include "crypto/ecc/fp256.h"
+
+#include "ecdsa_vectors.h"
+
+// signatures checked on boot for a leaf, intermediate and root certificate
+#define CHAIN_LEN 3
+
+typedef struct {
+  perf_log_t ecdsa_single;
+  perf_log_t ecdsa_batch;
+  perf_log_t ecdsa_chain;
+} ecdsa_perf_log_t;
+
+static ecdsa_perf_log_t perf_log = {0};
+
+static ecdsa_p256_item_t bad_items     [ECDSA_TEST_ITEMS];
+static uint8_t           bad_sigs      [2][ECDSA_P256_SIGNATURE_BYTES];
+static uint8_t           bad_pk        [ECDSA_P256_PUBLIC_KEY_BYTES];
+static int               ecdsa_results [ECDSA_TEST_ITEMS];
+
+static uint32_t test_ecdsa(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ECDSA P-256 single verify test %d/%d:\n", i+1, num_tests);
+
+    const ecdsa_p256_item_t* item = &ecdsa_items[i % ECDSA_TEST_ITEMS];
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = ecdsa_p256_verify(item->sig, item->msg, item->msg_len, item->pk);
+    volatile uint64_t ec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ec_ccount = test_rdcycle() - start_cycles;
+    perf_log.ecdsa_single.icount[i] = ec_icount;
+    perf_log.ecdsa_single.ccount[i] = ec_ccount;
+
+    printf("#\tresult  = %d\n", ret);
+    printf("#\tinstret = %020lu\n", ec_icount);
+    printf("#\tcycles  = %020lu\n", ec_ccount);
+
+    fail += (ret != ECDSA_P256_OK);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ECDSA P-256 batch (%d) verify test %d/%d:\n", ECDSA_TEST_ITEMS, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t bad = ecdsa_p256_verify_batch(ecdsa_items, ecdsa_results, ECDSA_TEST_ITEMS);
+    volatile uint64_t ec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ec_ccount = test_rdcycle() - start_cycles;
+    perf_log.ecdsa_batch.icount[i] = ec_icount;
+    perf_log.ecdsa_batch.ccount[i] = ec_ccount;
+
+    printf("#\tfailed  = %lu\n", bad);
+    printf("#\tinstret = %020lu\n", ec_icount);
+    printf("#\tcycles  = %020lu\n", ec_ccount);
+    printf("#\tcycles/op = %lu\n", ec_ccount / ECDSA_TEST_ITEMS);
+
+    fail += (bad != 0);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ECDSA P-256 chain (%d) verify test %d/%d:\n", CHAIN_LEN, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t bad = ecdsa_p256_verify_batch(ecdsa_items, ecdsa_results, CHAIN_LEN);
+    volatile uint64_t ec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ec_ccount = test_rdcycle() - start_cycles;
+    perf_log.ecdsa_chain.icount[i] = ec_icount;
+    perf_log.ecdsa_chain.ccount[i] = ec_ccount;
+
+    printf("#\tfailed  = %lu\n", bad);
+    printf("#\tinstret = %020lu\n", ec_icount);
+    printf("#\tcycles  = %020lu\n", ec_ccount);
+
+    fail += (bad != 0);
+  }
+
+  // a corrupted r (item 1), s (item 2) and message length (item 3) must be
+  // pinpointed within the batch, a public key off the curve (item 4) is
+  // rejected as encoding
+  memcpy(bad_items, ecdsa_items, sizeof(bad_items));
+  memcpy(bad_sigs[0], ecdsa_items[1].sig, ECDSA_P256_SIGNATURE_BYTES);
+  memcpy(bad_sigs[1], ecdsa_items[2].sig, ECDSA_P256_SIGNATURE_BYTES);
+  memcpy(bad_pk, ecdsa_items[4].pk, ECDSA_P256_PUBLIC_KEY_BYTES);
+  bad_sigs[0][5]  ^= 0x01;
+  bad_sigs[1][40] ^= 0x01;
+  bad_pk[63]      ^= 0x01;
+  bad_items[1].sig = bad_sigs[0];
+  bad_items[2].sig = bad_sigs[1];
+  bad_items[3].msg_len--;
+  bad_items[4].pk  = bad_pk;
+
+  ecdsa_p256_verify_batch(bad_items, ecdsa_results, ECDSA_TEST_ITEMS);
+
+  for (int i = 0; i < ECDSA_TEST_ITEMS; i++) {
+    int expected = (i >= 1 && i <= 3) ? ECDSA_P256_ERR_MISMATCH :
+                   (i == 4)           ? ECDSA_P256_ERR_ENCODING : ECDSA_P256_OK;
+    if (ecdsa_results[i] != expected) {
+      printf("# ECDSA P-256: unexpected result %d for corrupted batch item %d!\n",
+             ecdsa_results[i], i);
+      fail++;
+    }
+  }
+
+  perf_log.ecdsa_single.ccount_average = average_count(perf_log.ecdsa_single.ccount);
+  perf_log.ecdsa_single.icount_average = average_count(perf_log.ecdsa_single.icount);
+  perf_log.ecdsa_batch.ccount_average  = average_count(perf_log.ecdsa_batch.ccount);
+  perf_log.ecdsa_batch.icount_average  = average_count(perf_log.ecdsa_batch.icount);
+  perf_log.ecdsa_chain.ccount_average  = average_count(perf_log.ecdsa_chain.ccount);
+  perf_log.ecdsa_chain.icount_average  = average_count(perf_log.ecdsa_chain.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for ECDSA P-256 (%lu lanes per batch)\n", fp256_lanes());
+
+  fail += test_ecdsa(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tECDSA P-256:\n");
+  printf("#\tecdsa_single.icount = %05lu\n", perf_log.ecdsa_single.icount_average);
+  printf("#\tecdsa_single.ccount = %05lu\n", perf_log.ecdsa_single.ccount_average);
+  printf("#\tecdsa_batch.icount  = %05lu\n", perf_log.ecdsa_batch.icount_average);
+  printf("#\tecdsa_batch.ccount  = %05lu\n", perf_log.ecdsa_batch.ccount_average);
+  printf("#\tecdsa_chain.icount  = %05lu\n", perf_log.ecdsa_chain.icount_average);
+  printf("#\tecdsa_chain.ccount  = %05lu\n", perf_log.ecdsa_chain.ccount_average);
+
+  bench_record_log("ecdsa p256 verify single", 0, 1, &perf_log.ecdsa_single);
+  bench_record_log("ecdsa p256 verify batch",  0, 1, &perf_log.ecdsa_batch);
+  bench_record_log("ecdsa p256 verify chain",  0, 1, &perf_log.ecdsa_chain);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
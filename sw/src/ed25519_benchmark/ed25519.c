@@ -0,0 +1,200 @@
+/*
+ * File      : ed25519.c
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Ed25519 signature verification (RFC 8032). A batch verifies
+ * one signature per vector lane: the public keys are decoded and
+ * [S]B - [h]A is computed for all lanes at once, with a uniform
+ * double-and-add over a per-lane selected addend.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/curve25519/api_ed25519.h"
+#include "crypto/curve25519/fe25519.h"
+#include "crypto/curve25519/ge25519.h"
+#include "crypto/sha/api_sha512.h"
+
+// group order L = 2^252 + 27742317777372353535851937790883648493
+static const uint64_t kOrder[4] = {
+  0x5812631a5cf5d3edUL, 0x14def9dea2f79cd6UL, 0x0000000000000000UL, 0x1000000000000000UL
+};
+
+// scalars are < L < 2^253
+#define ED25519_SCALAR_BITS  253
+
+static void sc_load(uint64_t r[4], const uint8_t s[32]) {
+  for (int i = 0; i < 4; i++) {
+    r[i] = 0;
+    for (int j = 7; j >= 0; j--) {
+      r[i] = (r[i] << 8) | s[8 * i + j];
+    }
+  }
+}
+
+// S must be canonical, i.e. S < L
+static int sc_is_canonical(const uint8_t s[32]) {
+  uint64_t x[4];
+
+  sc_load(x, s);
+  for (int i = 3; i >= 0; i--) {
+    if (x[i] != kOrder[i]) {
+      return x[i] < kOrder[i];
+    }
+  }
+  return 0;
+}
+
+/*
+ * r = x mod L for the 512b little endian digest x, reduced bit by bit from
+ * the top (r < L before every step, so 2r+1 < 2^254 never overflows). The
+ * digest is public, so this does not need to be constant time.
+ */
+static void sc_reduce(uint8_t r[32], const uint8_t x[64]) {
+  uint64_t a[4] = {0};
+  uint64_t t[4];
+
+  for (int i = 511; i >= 0; i--) {
+    uint64_t bit    = (x[i >> 3] >> (i & 7)) & 1;
+    uint64_t borrow = 0;
+
+    a[3] = (a[3] << 1) | (a[2] >> 63);
+    a[2] = (a[2] << 1) | (a[1] >> 63);
+    a[1] = (a[1] << 1) | (a[0] >> 63);
+    a[0] = (a[0] << 1) | bit;
+
+    for (int j = 0; j < 4; j++) {
+      uint64_t d = a[j] - kOrder[j];
+      uint64_t b = (a[j] < kOrder[j]) | ((d == 0) & borrow);
+      t[j]   = d - borrow;
+      borrow = b;
+    }
+    if (!borrow) {
+      memcpy(a, t, sizeof(a));
+    }
+  }
+
+  for (int i = 0; i < 32; i++) {
+    r[i] = (uint8_t)(a[i >> 3] >> (8 * (i & 7)));
+  }
+}
+
+// h = SHA-512(R || A || M) mod L
+static void ed25519_challenge(uint8_t h[32], const ed25519_item_t* item) {
+  sha512_vec_ctx_t ctx;
+  uint8_t          md [64];
+
+  sha512_vec_init  (&ctx);
+  sha512_vec_update(&ctx, item->sig, 32);
+  sha512_vec_update(&ctx, item->pk, ED25519_PUBLIC_KEY_BYTES);
+  sha512_vec_update(&ctx, item->msg, item->msg_len);
+  sha512_vec_final (&ctx, md);
+
+  sc_reduce(h, md);
+}
+
+static void ge25519_copy_cached(ge25519_cached_t* r, const ge25519_cached_t* p, size_t vl) {
+  fe25519_copy(&r->YpX, &p->YpX, vl);
+  fe25519_copy(&r->YmX, &p->YmX, vl);
+  fe25519_copy(&r->Z2,  &p->Z2,  vl);
+  fe25519_copy(&r->T2d, &p->T2d, vl);
+}
+
+static void ed25519_verify_lanes(const ed25519_item_t* items, int* result, size_t vl) {
+
+  ge25519_t        a, p;
+  ge25519_cached_t table [4];
+  ge25519_cached_t addend;
+  const uint8_t*   pk    [FE25519_LANES];
+  uint8_t          h     [FE25519_LANES][32];
+  uint8_t          r     [FE25519_LANES][32];
+  uint32_t         valid [FE25519_LANES];
+  uint32_t         sel   [4][FE25519_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    pk[i] = items[i].pk;
+  }
+
+  ge25519_frombytes(&a, valid, pk, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    if (!valid[i] || !sc_is_canonical(items[i].sig + 32)) {
+      result[i] = ED25519_ERR_ENCODING;
+    } else {
+      result[i] = ED25519_OK;
+    }
+    ed25519_challenge(h[i], &items[i]);
+  }
+
+  // addends indexed by (bit of h) << 1 | (bit of S): O, B, -A, B-A
+  ge25519_neg       (&a, &a, vl);
+  ge25519_0         (&p, vl);
+  ge25519_to_cached (&table[0], &p, vl);
+  ge25519_base      (&p, vl);
+  ge25519_to_cached (&table[1], &p, vl);
+  ge25519_to_cached (&table[2], &a, vl);
+  ge25519_add       (&p, &a, &table[1], vl);
+  ge25519_to_cached (&table[3], &p, vl);
+
+  // p = [S]B + [h](-A)
+  ge25519_0(&p, vl);
+
+  for (int t = ED25519_SCALAR_BITS - 1; t >= 0; t--) {
+
+    ge25519_dbl(&p, &p, vl);
+
+    for (size_t i = 0; i < vl; i++) {
+      uint32_t idx = ((items[i].sig[32 + (t >> 3)] >> (t & 7)) & 1) |
+                     (((h[i][t >> 3] >> (t & 7)) & 1) << 1);
+      sel[1][i] = (idx == 1);
+      sel[2][i] = (idx == 2);
+      sel[3][i] = (idx == 3);
+    }
+
+    ge25519_copy_cached(&addend, &table[0], vl);
+    ge25519_cmov_cached(&addend, &table[1], sel[1], vl);
+    ge25519_cmov_cached(&addend, &table[2], sel[2], vl);
+    ge25519_cmov_cached(&addend, &table[3], sel[3], vl);
+
+    ge25519_add(&p, &p, &addend, vl);
+  }
+
+  // the encoding of [S]B - [h]A must match R
+  ge25519_tobytes(r, &p, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    if (result[i] == ED25519_OK && memcmp(r[i], items[i].sig, 32)) {
+      result[i] = ED25519_ERR_MISMATCH;
+    }
+  }
+}
+
+int ed25519_verify(const uint8_t sig[ED25519_SIGNATURE_BYTES], const uint8_t* msg,
+                   size_t msg_len, const uint8_t pk[ED25519_PUBLIC_KEY_BYTES]) {
+
+  ed25519_item_t item = { pk, sig, msg, msg_len };
+  int            result;
+
+  ed25519_verify_lanes(&item, &result, 1);
+
+  return result;
+}
+
+size_t ed25519_verify_batch(const ed25519_item_t* items, int* result, size_t n) {
+
+  size_t lanes = fe25519_lanes();
+  size_t fail  = 0;
+
+  for (size_t i = 0; i < n; i += lanes) {
+    size_t vl = (n - i) < lanes ? (n - i) : lanes;
+    ed25519_verify_lanes(items + i, result + i, vl);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    fail += (result[i] != ED25519_OK);
+  }
+
+  return fail;
+}
@@ -0,0 +1,521 @@
+/*
+ * File      : ed25519_vectors.h
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: X25519 and Ed25519 test vectors. Keys, shared secret and
+ * signatures were generated with OpenSSL (openssl genpkey / pkeyutl).
+ */
+
+#ifndef __ED25519_VECTORS_H__
+#define __ED25519_VECTORS_H__
+
+#include <stdint.h>
+
+#include "crypto/curve25519/api_ed25519.h"
+
+// RFC 7748, section 5.2: first X25519 test vector
+static const uint8_t x25519_rfc_scalar [32] = {
+  0xa5, 0x46, 0xe3, 0x6b, 0xf0, 0x52, 0x7c, 0x9d, 0x3b, 0x16, 0x15, 0x4b,
+  0x82, 0x46, 0x5e, 0xdd, 0x62, 0x14, 0x4c, 0x0a, 0xc1, 0xfc, 0x5a, 0x18,
+  0x50, 0x6a, 0x22, 0x44, 0xba, 0x44, 0x9a, 0xc4
+};
+
+static const uint8_t x25519_rfc_point [32] = {
+  0xe6, 0xdb, 0x68, 0x67, 0x58, 0x30, 0x30, 0xdb, 0x35, 0x94, 0xc1, 0xa4,
+  0x24, 0xb1, 0x5f, 0x7c, 0x72, 0x66, 0x24, 0xec, 0x26, 0xb3, 0x35, 0x3b,
+  0x10, 0xa9, 0x03, 0xa6, 0xd0, 0xab, 0x1c, 0x4c
+};
+
+static const uint8_t x25519_rfc_result [32] = {
+  0xc3, 0xda, 0x55, 0x37, 0x9d, 0xe9, 0xc6, 0x90, 0x8e, 0x94, 0xea, 0x4d,
+  0xf2, 0x8d, 0x08, 0x4f, 0x32, 0xec, 0xcf, 0x03, 0x49, 0x1c, 0x71, 0xf7,
+  0x54, 0xb4, 0x07, 0x55, 0x77, 0xa2, 0x85, 0x52
+};
+
+// X25519 key pairs of Alice and Bob and their shared secret
+static const uint8_t x25519_alice_sk [32] = {
+  0xf0, 0x83, 0x1d, 0x38, 0xb1, 0x92, 0xd1, 0x8d, 0xbb, 0xd9, 0xf7, 0xfa,
+  0x9f, 0x67, 0x23, 0x37, 0x9c, 0x9d, 0x39, 0x7c, 0xd1, 0x34, 0x98, 0x36,
+  0xa2, 0x6d, 0xe2, 0x73, 0x79, 0xd0, 0x48, 0x42
+};
+
+static const uint8_t x25519_alice_pk [32] = {
+  0xb8, 0xdf, 0x7d, 0x16, 0xab, 0x15, 0xaf, 0xf9, 0xf2, 0x33, 0x1e, 0x9f,
+  0x98, 0xd2, 0x19, 0x43, 0xf5, 0xaa, 0xca, 0x7e, 0x6f, 0xda, 0x45, 0x51,
+  0x72, 0xa6, 0x9a, 0x35, 0x45, 0x80, 0x04, 0x71
+};
+
+static const uint8_t x25519_bob_sk [32] = {
+  0x60, 0x59, 0x06, 0xc2, 0xdf, 0xe1, 0x24, 0x2d, 0xa7, 0xdd, 0x33, 0x30,
+  0x03, 0x19, 0xfa, 0xd4, 0xc0, 0xa0, 0x4c, 0x3e, 0x96, 0xee, 0x9e, 0xd5,
+  0x3a, 0x09, 0x31, 0xc3, 0xfd, 0x03, 0xf0, 0x62
+};
+
+static const uint8_t x25519_bob_pk [32] = {
+  0xcd, 0x5a, 0x3c, 0xa6, 0x90, 0x1a, 0xb9, 0xa9, 0x76, 0x54, 0xe3, 0x90,
+  0x1e, 0xb6, 0xd5, 0xba, 0x4f, 0x1e, 0x0a, 0x1a, 0xc6, 0x70, 0x4b, 0xb5,
+  0x42, 0x71, 0xe5, 0xd8, 0xbd, 0x8d, 0x51, 0x34
+};
+
+static const uint8_t x25519_shared [32] = {
+  0x70, 0xed, 0x2a, 0x46, 0xee, 0x4f, 0x31, 0x30, 0xcb, 0xff, 0xe2, 0x13,
+  0x4d, 0xdf, 0x33, 0xfe, 0x30, 0xd0, 0x58, 0x5a, 0x16, 0x06, 0x11, 0x48,
+  0x3d, 0xfa, 0xfc, 0x34, 0xe0, 0xf3, 0xbe, 0x7c
+};
+
+// Ed25519 public keys, signatures and messages, the first one is
+// TEST 1 of RFC 8032 (empty message)
+#define ED25519_TEST_ITEMS 16
+
+static const uint8_t ed25519_pk0 [32] = {
+  0xd7, 0x5a, 0x98, 0x01, 0x82, 0xb1, 0x0a, 0xb7, 0xd5, 0x4b, 0xfe, 0xd3,
+  0xc9, 0x64, 0x07, 0x3a, 0x0e, 0xe1, 0x72, 0xf3, 0xda, 0xa6, 0x23, 0x25,
+  0xaf, 0x02, 0x1a, 0x68, 0xf7, 0x07, 0x51, 0x1a
+};
+
+static const uint8_t ed25519_sig0 [64] = {
+  0xe5, 0x56, 0x43, 0x00, 0xc3, 0x60, 0xac, 0x72, 0x90, 0x86, 0xe2, 0xcc,
+  0x80, 0x6e, 0x82, 0x8a, 0x84, 0x87, 0x7f, 0x1e, 0xb8, 0xe5, 0xd9, 0x74,
+  0xd8, 0x73, 0xe0, 0x65, 0x22, 0x49, 0x01, 0x55, 0x5f, 0xb8, 0x82, 0x15,
+  0x90, 0xa3, 0x3b, 0xac, 0xc6, 0x1e, 0x39, 0x70, 0x1c, 0xf9, 0xb4, 0x6b,
+  0xd2, 0x5b, 0xf5, 0xf0, 0x59, 0x5b, 0xbe, 0x24, 0x65, 0x51, 0x41, 0x43,
+  0x8e, 0x7a, 0x10, 0x0b
+};
+
+static const uint8_t ed25519_msg0 [1] = {0};
+
+static const uint8_t ed25519_pk1 [32] = {
+  0xa8, 0x39, 0xf6, 0xb7, 0x01, 0xa5, 0xc4, 0x67, 0x43, 0xb3, 0xcf, 0xd0,
+  0xf2, 0x04, 0x15, 0x00, 0x95, 0x19, 0x5b, 0x84, 0xdb, 0xea, 0xe8, 0x54,
+  0xf1, 0x98, 0xbd, 0x03, 0xf7, 0x3b, 0x9a, 0x33
+};
+
+static const uint8_t ed25519_sig1 [64] = {
+  0xc2, 0x5f, 0xed, 0x50, 0x6a, 0x73, 0xb5, 0x92, 0x3f, 0x1e, 0x83, 0x46,
+  0x44, 0xf1, 0x06, 0xb9, 0xce, 0xb1, 0x35, 0xd0, 0x87, 0xc3, 0x52, 0xea,
+  0x8c, 0x45, 0x5b, 0xf6, 0xc5, 0xdd, 0xd3, 0x34, 0x9e, 0x6f, 0xbf, 0x65,
+  0x43, 0xb4, 0xa7, 0x3a, 0xcf, 0x26, 0x3d, 0x9a, 0x9a, 0xc5, 0xf5, 0x56,
+  0xbf, 0x92, 0xef, 0xc1, 0xdb, 0x4d, 0x00, 0xd6, 0x28, 0xa6, 0xf2, 0x04,
+  0x44, 0xc2, 0x9a, 0x0b
+};
+
+static const uint8_t ed25519_msg1 [3] = {
+  0xf5, 0x8d, 0x92
+};
+
+static const uint8_t ed25519_pk2 [32] = {
+  0xcf, 0x21, 0x13, 0xd2, 0x3f, 0x0f, 0xfe, 0x73, 0x98, 0xb4, 0x73, 0xc8,
+  0xce, 0x40, 0x4f, 0xcd, 0x9f, 0x7b, 0x41, 0xad, 0xa7, 0xf7, 0x1c, 0x03,
+  0x5d, 0x1e, 0xe8, 0x6d, 0x42, 0xf9, 0x8e, 0x8b
+};
+
+static const uint8_t ed25519_sig2 [64] = {
+  0xb6, 0xfe, 0xef, 0x21, 0x29, 0xaf, 0x94, 0xb6, 0xb4, 0x76, 0xb5, 0xc0,
+  0xeb, 0x2d, 0x30, 0x56, 0xb0, 0xb6, 0x0e, 0x55, 0x15, 0x92, 0x58, 0x3d,
+  0x4b, 0x5f, 0x3d, 0x6d, 0xab, 0x6e, 0xa4, 0xba, 0xc1, 0x8b, 0x92, 0x39,
+  0x86, 0xa3, 0xbf, 0x4f, 0x11, 0xec, 0xd6, 0x68, 0x6e, 0x57, 0x20, 0x3c,
+  0x1c, 0xdc, 0xc8, 0x13, 0x2c, 0xbc, 0x42, 0x6f, 0xeb, 0x0d, 0x05, 0xe1,
+  0x20, 0x6c, 0x3b, 0x06
+};
+
+static const uint8_t ed25519_msg2 [32] = {
+  0x64, 0x25, 0x21, 0x82, 0xaa, 0x81, 0xbe, 0xce, 0x5d, 0x7e, 0x7a, 0xfb,
+  0x24, 0x28, 0xd9, 0xd5, 0x1a, 0xe1, 0xb3, 0x06, 0xf4, 0x81, 0x46, 0xac,
+  0x74, 0x48, 0x32, 0xc8, 0x9a, 0x13, 0x2b, 0x57
+};
+
+static const uint8_t ed25519_pk3 [32] = {
+  0x02, 0x0a, 0x8d, 0x6b, 0xcf, 0xca, 0xd9, 0xd8, 0xcb, 0xbe, 0x78, 0x62,
+  0xd1, 0x05, 0x63, 0x83, 0xa7, 0x80, 0x78, 0x73, 0xf4, 0x4d, 0x98, 0x40,
+  0x62, 0x74, 0x23, 0x3e, 0x09, 0x3d, 0x9b, 0x31
+};
+
+static const uint8_t ed25519_sig3 [64] = {
+  0xbb, 0xc6, 0xdf, 0x1f, 0xce, 0x14, 0xfe, 0x79, 0x06, 0xa4, 0xf4, 0x5f,
+  0xba, 0xfd, 0xfb, 0xf0, 0xd4, 0x35, 0xa0, 0x2d, 0xb5, 0xc5, 0x0e, 0x3f,
+  0xc9, 0x03, 0x9e, 0xbe, 0x08, 0xa5, 0x20, 0xac, 0x53, 0x18, 0x02, 0xe3,
+  0xe3, 0xc5, 0x90, 0x6b, 0xc0, 0x5a, 0x88, 0xaf, 0xa4, 0xdb, 0x27, 0x02,
+  0xb0, 0x34, 0x74, 0x25, 0x91, 0xb1, 0x05, 0xd3, 0x6e, 0x03, 0x52, 0x4c,
+  0x7e, 0xe2, 0x1a, 0x09
+};
+
+static const uint8_t ed25519_msg3 [64] = {
+  0xeb, 0x4d, 0x87, 0x1a, 0x58, 0x07, 0xe7, 0x4d, 0xb1, 0xd4, 0x21, 0x9d,
+  0xe0, 0xef, 0xb4, 0x06, 0xb8, 0x50, 0x87, 0x5a, 0xf7, 0xb6, 0x1f, 0x7f,
+  0x57, 0x6a, 0xfa, 0x2e, 0xab, 0xad, 0x1d, 0xc9, 0xaf, 0x3a, 0x9a, 0x82,
+  0x2a, 0x99, 0xe9, 0xed, 0x91, 0x3c, 0x0b, 0x91, 0x6e, 0xf4, 0x3d, 0x01,
+  0x1d, 0xbe, 0x61, 0x97, 0x31, 0x10, 0xd8, 0xd2, 0xeb, 0x01, 0x5c, 0xb4,
+  0x07, 0x61, 0x74, 0xc3
+};
+
+static const uint8_t ed25519_pk4 [32] = {
+  0x4c, 0x6f, 0x04, 0x1a, 0x92, 0x1c, 0x48, 0xb1, 0xab, 0xcb, 0xe1, 0x2b,
+  0xf9, 0x05, 0xa9, 0xac, 0xad, 0x96, 0x37, 0xaf, 0x39, 0xd1, 0x37, 0x46,
+  0x79, 0x53, 0xb4, 0x84, 0x17, 0x3e, 0xf5, 0xd0
+};
+
+static const uint8_t ed25519_sig4 [64] = {
+  0x82, 0x9c, 0xd7, 0x78, 0x47, 0x9c, 0x88, 0xa4, 0xb4, 0x8b, 0xbc, 0xa2,
+  0x1b, 0x2c, 0x8e, 0xb2, 0x36, 0x91, 0xe6, 0x75, 0x9c, 0x91, 0x0d, 0x56,
+  0x6f, 0x2f, 0xf6, 0xc5, 0x0f, 0x08, 0x5c, 0xc5, 0xe7, 0x04, 0x3a, 0xaf,
+  0x3c, 0x21, 0x5f, 0x2a, 0x91, 0x50, 0x4f, 0xad, 0x6e, 0x6a, 0x37, 0x38,
+  0xc8, 0xf1, 0xdc, 0x51, 0xc6, 0xcd, 0x64, 0x18, 0x1a, 0xcd, 0x21, 0xfb,
+  0x5a, 0xd5, 0x64, 0x0a
+};
+
+static const uint8_t ed25519_msg4 [111] = {
+  0x62, 0xa8, 0xc4, 0x20, 0xb0, 0x15, 0x5d, 0x20, 0x28, 0x96, 0x77, 0x46,
+  0xec, 0xf4, 0x34, 0x77, 0xbc, 0x8f, 0x0f, 0xfb, 0x52, 0x9f, 0xef, 0x6d,
+  0xdf, 0x9b, 0x68, 0x4c, 0xaa, 0x1d, 0x74, 0x3f, 0xf0, 0x28, 0x7c, 0xde,
+  0xa2, 0x9c, 0x16, 0x40, 0x34, 0xcd, 0x2c, 0xbf, 0x68, 0x54, 0x0a, 0x5f,
+  0xe3, 0x19, 0xe3, 0x19, 0x71, 0x8f, 0x67, 0x30, 0xe3, 0xbb, 0xa8, 0x6a,
+  0xc8, 0x61, 0x52, 0x04, 0xb3, 0x7b, 0x66, 0xa4, 0xc2, 0xf0, 0xad, 0x21,
+  0x7d, 0x25, 0x18, 0x42, 0x18, 0xfa, 0x2f, 0xe5, 0x35, 0x44, 0x9d, 0xf8,
+  0xa9, 0xc3, 0xac, 0x20, 0xff, 0xb0, 0xb9, 0xf6, 0x9a, 0xf9, 0x60, 0x71,
+  0x7a, 0x72, 0xb2, 0x37, 0x9d, 0x97, 0x54, 0xce, 0xfa, 0x88, 0xd7, 0x86,
+  0x0e, 0x5c, 0x38
+};
+
+static const uint8_t ed25519_pk5 [32] = {
+  0xb6, 0x5d, 0x27, 0xa9, 0xf5, 0xd9, 0x8f, 0x92, 0x15, 0xfd, 0xb6, 0x86,
+  0x67, 0x81, 0x7d, 0xa6, 0xf6, 0x65, 0x46, 0xab, 0xc2, 0x02, 0x83, 0xc2,
+  0x6c, 0xfc, 0xf0, 0x38, 0xd5, 0x38, 0x09, 0xf9
+};
+
+static const uint8_t ed25519_sig5 [64] = {
+  0x9c, 0x15, 0xa7, 0xde, 0xfc, 0xa3, 0xe0, 0xd5, 0xbf, 0xc8, 0x22, 0xad,
+  0x39, 0x1c, 0x30, 0x15, 0xbf, 0x4d, 0x6d, 0xb2, 0x47, 0xf6, 0x84, 0xbe,
+  0x52, 0xc8, 0x28, 0xf5, 0x99, 0xf7, 0x39, 0xe4, 0x20, 0x8c, 0xd3, 0x9f,
+  0x0c, 0xb9, 0x02, 0xe4, 0x99, 0xd7, 0x69, 0xc2, 0x07, 0x4e, 0xff, 0xcc,
+  0x47, 0x63, 0x44, 0x2a, 0x4f, 0x58, 0xd5, 0xfe, 0xf7, 0xa9, 0x99, 0x68,
+  0x20, 0xa2, 0x42, 0x0a
+};
+
+static const uint8_t ed25519_msg5 [112] = {
+  0xec, 0x15, 0x1d, 0xe4, 0x7b, 0x86, 0x32, 0x38, 0x4e, 0x7d, 0x98, 0xdd,
+  0x84, 0x8c, 0x14, 0x59, 0x1c, 0xe9, 0x3f, 0x2b, 0x7d, 0xac, 0x4c, 0x38,
+  0x0b, 0x74, 0x0c, 0x83, 0xfc, 0xad, 0x01, 0xd9, 0x2b, 0x0b, 0xbf, 0x90,
+  0x30, 0x3f, 0x5b, 0x4c, 0x5a, 0x09, 0x92, 0xf9, 0x17, 0xbe, 0x3f, 0xfc,
+  0x4d, 0xa8, 0xee, 0xac, 0x8f, 0x66, 0xaa, 0x84, 0x62, 0xd2, 0xeb, 0x45,
+  0x21, 0xdc, 0xde, 0xc8, 0xc5, 0xae, 0xde, 0xdf, 0x52, 0x23, 0x3f, 0x47,
+  0xdc, 0x60, 0x48, 0x90, 0xfb, 0xc7, 0xa9, 0x5b, 0x89, 0xab, 0x2f, 0x33,
+  0x24, 0xfd, 0x54, 0xd6, 0x0e, 0x07, 0x05, 0x5e, 0x82, 0xf9, 0x0a, 0x9d,
+  0xf7, 0x3e, 0xfd, 0xd0, 0xc8, 0xc7, 0xa5, 0xa7, 0x7d, 0x00, 0x81, 0x06,
+  0xe5, 0x0a, 0xd8, 0x54
+};
+
+static const uint8_t ed25519_pk6 [32] = {
+  0x57, 0x9e, 0x90, 0xf2, 0x4b, 0x93, 0x1c, 0xb2, 0x97, 0x00, 0x9f, 0x5b,
+  0x16, 0x28, 0x18, 0x51, 0xd6, 0x3c, 0xc3, 0xae, 0xd8, 0x7e, 0x49, 0xe9,
+  0xf8, 0x1c, 0x9e, 0x36, 0xc8, 0x5f, 0xec, 0x64
+};
+
+static const uint8_t ed25519_sig6 [64] = {
+  0x47, 0x9a, 0xea, 0xea, 0xf4, 0xc8, 0x25, 0x4f, 0xce, 0x5a, 0x60, 0xf6,
+  0x06, 0x00, 0xd3, 0x2b, 0x8a, 0xf7, 0x4b, 0xb7, 0xd4, 0x8a, 0x32, 0x6d,
+  0x3f, 0xe3, 0x1c, 0x59, 0x0c, 0xb6, 0x21, 0x7c, 0x06, 0xef, 0x58, 0x98,
+  0x1c, 0xeb, 0x0e, 0x8d, 0x01, 0x0d, 0xd9, 0x06, 0x5a, 0x25, 0x69, 0xb6,
+  0xa8, 0xd4, 0x35, 0x0a, 0xdb, 0x04, 0x90, 0xf5, 0xa6, 0x73, 0xb0, 0x09,
+  0xad, 0xd9, 0x84, 0x05
+};
+
+static const uint8_t ed25519_msg6 [127] = {
+  0xc0, 0x1d, 0x70, 0xd7, 0x16, 0x8c, 0x60, 0x41, 0x42, 0xf9, 0x62, 0x04,
+  0xff, 0xe0, 0xfb, 0x62, 0x29, 0xc4, 0x51, 0x6a, 0xf7, 0x89, 0x78, 0x9c,
+  0xef, 0xd5, 0x19, 0xf9, 0xc2, 0xe2, 0x69, 0x30, 0x98, 0x8f, 0x4a, 0x1a,
+  0x39, 0x39, 0xbb, 0xea, 0xd1, 0xf4, 0xcd, 0x70, 0xd2, 0x4a, 0x9e, 0x22,
+  0xec, 0x84, 0xdf, 0xfe, 0x12, 0x10, 0xfc, 0x03, 0xf9, 0x28, 0x81, 0x5d,
+  0x56, 0x8f, 0xfe, 0xe6, 0xfc, 0xc3, 0xd9, 0x30, 0xe9, 0x7f, 0xf2, 0x09,
+  0xd6, 0x6e, 0x16, 0xc0, 0xa7, 0x2d, 0x86, 0x91, 0xfb, 0xbb, 0x7c, 0xd4,
+  0x32, 0xb4, 0x6b, 0x6f, 0xc1, 0x51, 0x21, 0xf6, 0x1a, 0x77, 0x1d, 0xa9,
+  0xfb, 0x1e, 0x1c, 0xe2, 0x49, 0x3c, 0xfb, 0xd8, 0x10, 0x38, 0x7d, 0xd9,
+  0xb1, 0xc4, 0xf2, 0xe3, 0x01, 0xcb, 0x3c, 0x97, 0xc7, 0x07, 0xee, 0x93,
+  0x64, 0x76, 0xa4, 0x3a, 0xfb, 0x35, 0xaa
+};
+
+static const uint8_t ed25519_pk7 [32] = {
+  0xa2, 0xa9, 0xbc, 0xee, 0x51, 0xa4, 0x2c, 0xaf, 0x3b, 0xf1, 0xf2, 0xd0,
+  0xe0, 0x71, 0xb8, 0xdd, 0xd4, 0xbd, 0xd6, 0x44, 0x3f, 0x9e, 0x66, 0x82,
+  0xf0, 0xb6, 0x00, 0xd2, 0x38, 0x85, 0xa5, 0xd6
+};
+
+static const uint8_t ed25519_sig7 [64] = {
+  0xe2, 0x2a, 0xcf, 0x53, 0x42, 0x63, 0x72, 0x8c, 0x5b, 0x06, 0x60, 0x4b,
+  0x51, 0x45, 0x8d, 0x94, 0xee, 0xb2, 0xad, 0x30, 0x7b, 0xaf, 0x12, 0x95,
+  0x3a, 0x31, 0x5f, 0xd2, 0x1a, 0x72, 0xc7, 0x00, 0x5e, 0x07, 0xb7, 0x21,
+  0x51, 0xe0, 0xfc, 0x49, 0x7e, 0x50, 0x23, 0x66, 0x61, 0x84, 0x1d, 0xb9,
+  0x26, 0x5a, 0x83, 0x14, 0x4f, 0x79, 0xf8, 0x41, 0x53, 0x3e, 0x8c, 0xea,
+  0x9f, 0xbe, 0x33, 0x05
+};
+
+static const uint8_t ed25519_msg7 [128] = {
+  0x24, 0x3c, 0xd7, 0xed, 0xe8, 0x63, 0x57, 0x45, 0x21, 0x73, 0x01, 0x46,
+  0x71, 0x8c, 0x4c, 0x62, 0xae, 0x2a, 0x31, 0x21, 0x82, 0x49, 0x27, 0x30,
+  0x5f, 0x5f, 0x69, 0x98, 0x1a, 0xae, 0x27, 0x52, 0x35, 0x08, 0x5f, 0x74,
+  0x13, 0x91, 0x0e, 0x38, 0x19, 0xa4, 0x95, 0xc3, 0xc4, 0x49, 0xf4, 0xba,
+  0xd6, 0xcf, 0x89, 0xce, 0xc6, 0x78, 0xcf, 0x1d, 0x04, 0xe1, 0x87, 0x7b,
+  0x43, 0x5e, 0x3b, 0xfb, 0x5d, 0x21, 0xb6, 0xa8, 0x05, 0xe3, 0x8f, 0x20,
+  0xe6, 0x6a, 0xe1, 0x7a, 0x9e, 0x7c, 0xe4, 0x7f, 0x7c, 0x46, 0x74, 0xed,
+  0x52, 0x43, 0x3d, 0xde, 0x7f, 0xdc, 0x51, 0xbd, 0xfa, 0x4b, 0x05, 0x06,
+  0x0e, 0x9c, 0x26, 0x50, 0xf9, 0xc6, 0x62, 0x97, 0x60, 0x9c, 0x9b, 0x83,
+  0x38, 0xc9, 0xa1, 0x68, 0xec, 0xe8, 0x31, 0x54, 0xc2, 0x79, 0xeb, 0x00,
+  0x17, 0x54, 0xf6, 0xcc, 0xcd, 0x08, 0x02, 0x11
+};
+
+static const uint8_t ed25519_pk8 [32] = {
+  0x75, 0xf1, 0x29, 0x68, 0x32, 0xe8, 0xe6, 0x20, 0xf0, 0x00, 0x61, 0x6e,
+  0x27, 0x42, 0xf3, 0x79, 0x50, 0x88, 0x78, 0xef, 0x3d, 0xbf, 0xc7, 0x0d,
+  0x19, 0xb0, 0x38, 0x4d, 0xd4, 0x8d, 0x14, 0x0f
+};
+
+static const uint8_t ed25519_sig8 [64] = {
+  0xe4, 0x04, 0x83, 0xad, 0xc4, 0x42, 0x67, 0xb9, 0x97, 0xd5, 0x4b, 0xd7,
+  0x2b, 0x85, 0xa5, 0xd4, 0x7b, 0x3b, 0x1f, 0x2f, 0x0d, 0x8f, 0x67, 0xe8,
+  0xc5, 0x7a, 0x47, 0x61, 0x5c, 0xbf, 0xc5, 0x34, 0xfd, 0xe0, 0x63, 0x36,
+  0x53, 0x1e, 0xdd, 0x1f, 0x4e, 0x17, 0xcd, 0xca, 0x94, 0x16, 0x42, 0x47,
+  0x3f, 0x89, 0x7a, 0x32, 0x96, 0xad, 0xe6, 0xfa, 0xa1, 0x11, 0x0b, 0x1d,
+  0x90, 0xca, 0x46, 0x02
+};
+
+static const uint8_t ed25519_msg8 [200] = {
+  0x4d, 0xdf, 0x68, 0xa1, 0x76, 0x72, 0x6a, 0x54, 0x5a, 0x31, 0x72, 0x22,
+  0x10, 0xac, 0xf6, 0x3d, 0xf5, 0xec, 0x93, 0x7b, 0x4c, 0x4d, 0x17, 0xd2,
+  0xd0, 0xd8, 0x6b, 0x7e, 0x68, 0x41, 0xff, 0x74, 0x25, 0xb9, 0x69, 0x98,
+  0xda, 0x25, 0x68, 0xf5, 0x28, 0xc5, 0xdb, 0xa2, 0x3f, 0xfd, 0xdd, 0x55,
+  0xc3, 0x64, 0x6e, 0x7c, 0xa0, 0x83, 0x7e, 0xb4, 0xfb, 0x53, 0x1e, 0xb2,
+  0x58, 0xac, 0xd1, 0x3b, 0xe2, 0x1c, 0x4a, 0xe7, 0x9d, 0x97, 0xd1, 0xd6,
+  0x00, 0x2b, 0x94, 0xb1, 0x3f, 0x77, 0x1f, 0xbc, 0x45, 0x95, 0x03, 0xe9,
+  0xf0, 0xf0, 0x22, 0x10, 0x52, 0xd0, 0x41, 0xe9, 0x6e, 0x22, 0x72, 0x11,
+  0x17, 0x0d, 0x73, 0xdb, 0x7f, 0x83, 0x06, 0x75, 0x3c, 0xd8, 0x07, 0x39,
+  0x8c, 0x75, 0x85, 0xe2, 0x72, 0xfe, 0x49, 0x7e, 0x54, 0xf5, 0x2a, 0xb0,
+  0xfe, 0x03, 0xaa, 0x01, 0x78, 0xc1, 0x6c, 0xb8, 0x84, 0x1d, 0x54, 0xbd,
+  0x40, 0x6c, 0x9c, 0x2e, 0x76, 0x3d, 0x21, 0x35, 0x6e, 0x46, 0xa7, 0x07,
+  0x5e, 0x71, 0x95, 0x9b, 0xfc, 0x54, 0x42, 0x3b, 0x33, 0xc8, 0xa3, 0xed,
+  0x02, 0x77, 0x28, 0xaa, 0xb8, 0x40, 0x49, 0x17, 0x07, 0xfc, 0x78, 0x23,
+  0x22, 0x33, 0x13, 0x2a, 0x3d, 0x8c, 0x9f, 0xc8, 0x58, 0x5e, 0xc5, 0xc1,
+  0x54, 0xbc, 0x1c, 0xf9, 0xdd, 0x53, 0x85, 0xb9, 0xe2, 0x43, 0xee, 0xe5,
+  0x6c, 0x7c, 0xe1, 0xf5, 0x66, 0xd4, 0x50, 0xa4
+};
+
+static const uint8_t ed25519_pk9 [32] = {
+  0x3c, 0x46, 0x84, 0x81, 0x37, 0xdb, 0x0e, 0xf5, 0xc5, 0x6c, 0x53, 0x68,
+  0xfe, 0xa3, 0x5e, 0x9f, 0x2f, 0xf0, 0xe4, 0x72, 0x04, 0x1a, 0xee, 0x2a,
+  0xc9, 0x0b, 0x3a, 0xd0, 0x87, 0xc5, 0x3d, 0x7b
+};
+
+static const uint8_t ed25519_sig9 [64] = {
+  0xa6, 0xa0, 0x73, 0xf1, 0x21, 0x3b, 0xe0, 0x8f, 0x6f, 0x9d, 0x0e, 0x75,
+  0xe1, 0x18, 0x70, 0x34, 0x19, 0x29, 0xdf, 0x63, 0x53, 0xc5, 0xd5, 0x22,
+  0x57, 0x39, 0x3c, 0x77, 0x09, 0xfa, 0x62, 0x08, 0xb7, 0xb8, 0x7a, 0xa1,
+  0x18, 0xc3, 0x92, 0xe7, 0x12, 0xc6, 0x71, 0xc9, 0x74, 0x7f, 0x5b, 0x3b,
+  0x74, 0x97, 0xa2, 0xeb, 0x89, 0x8e, 0x75, 0xc4, 0x4b, 0x04, 0x07, 0x53,
+  0xe6, 0xcb, 0x2e, 0x0b
+};
+
+static const uint8_t ed25519_msg9 [256] = {
+  0xd7, 0xb6, 0x8b, 0x68, 0xcc, 0x9e, 0xff, 0x25, 0xee, 0x9e, 0x2b, 0xf2,
+  0x0b, 0x27, 0xaf, 0xb1, 0xbe, 0x74, 0xaa, 0x7a, 0xb3, 0x1c, 0x22, 0xe3,
+  0x16, 0x97, 0x4a, 0x01, 0x25, 0x05, 0x43, 0x68, 0x7f, 0xd5, 0x9e, 0xbd,
+  0x1f, 0x62, 0xe0, 0x45, 0xb3, 0x81, 0x00, 0xa7, 0xd6, 0x57, 0x25, 0x1c,
+  0xd8, 0xca, 0xea, 0xc6, 0xea, 0x62, 0x52, 0xe3, 0x4b, 0xe4, 0x73, 0x23,
+  0x59, 0xd8, 0xff, 0x45, 0x89, 0x2d, 0xea, 0x49, 0xe9, 0x96, 0x30, 0xe4,
+  0xbd, 0xac, 0x5e, 0x27, 0xee, 0x1b, 0xe6, 0xd2, 0x53, 0x51, 0xae, 0x47,
+  0xc5, 0x5e, 0x5e, 0x45, 0x78, 0x39, 0xb1, 0x02, 0xec, 0x96, 0xce, 0x9a,
+  0x31, 0x6c, 0x40, 0x1b, 0x4a, 0xe7, 0xde, 0x6f, 0x46, 0x39, 0x1b, 0x54,
+  0xb8, 0xb2, 0xb1, 0x29, 0x64, 0xc7, 0xf0, 0x5b, 0x96, 0xe4, 0x49, 0xef,
+  0x36, 0x19, 0xb7, 0x1b, 0x79, 0xea, 0xbd, 0x69, 0x4d, 0x81, 0x5b, 0x2e,
+  0xed, 0xa3, 0xd4, 0xe5, 0xd3, 0xac, 0xa4, 0xa7, 0xc6, 0x64, 0xc6, 0x8a,
+  0xfe, 0x7b, 0xda, 0xa6, 0xf6, 0x07, 0x87, 0x4b, 0xd7, 0x74, 0x2b, 0x58,
+  0x4f, 0xc8, 0x49, 0x7f, 0x02, 0x7d, 0x57, 0x45, 0xf1, 0x6d, 0x08, 0xdc,
+  0xa1, 0x72, 0xa4, 0x9f, 0x62, 0x39, 0x8c, 0x3f, 0x1f, 0x4a, 0xcb, 0x2e,
+  0x73, 0x9a, 0x53, 0xc5, 0x3a, 0xd1, 0x8c, 0x85, 0xbb, 0xe5, 0xdd, 0x10,
+  0xf2, 0xba, 0xda, 0xf6, 0x7e, 0xfa, 0xe3, 0x11, 0x30, 0xa0, 0x93, 0x6e,
+  0xf4, 0xf1, 0xdf, 0xfd, 0xeb, 0x55, 0xc2, 0xb0, 0xaa, 0x74, 0x66, 0x34,
+  0xc7, 0x4e, 0x8f, 0xcf, 0x93, 0xbd, 0xd6, 0xef, 0xa7, 0x86, 0xc9, 0x02,
+  0x97, 0xd8, 0x43, 0xe4, 0x97, 0x06, 0x81, 0x7d, 0xe6, 0xd6, 0x55, 0xf8,
+  0x8d, 0xc5, 0x73, 0x58, 0x37, 0x02, 0x9c, 0x40, 0xf4, 0x03, 0xfd, 0x98,
+  0x62, 0xb1, 0x2e, 0x4b
+};
+
+static const uint8_t ed25519_pk10 [32] = {
+  0x3a, 0xa9, 0x80, 0xfc, 0xa6, 0x67, 0x6b, 0xc4, 0x04, 0x7d, 0x04, 0xe6,
+  0x21, 0x4b, 0x0a, 0xab, 0x3e, 0xc4, 0x42, 0x48, 0x31, 0xed, 0x12, 0x6a,
+  0x91, 0xf9, 0x9d, 0x11, 0x52, 0xe9, 0x5d, 0x52
+};
+
+static const uint8_t ed25519_sig10 [64] = {
+  0x7f, 0xf9, 0x97, 0x3b, 0x4c, 0xf1, 0xfa, 0x0f, 0x54, 0x57, 0x30, 0x94,
+  0xd1, 0x40, 0xec, 0xcf, 0xda, 0x4f, 0x37, 0x6a, 0xce, 0x3d, 0x8e, 0x0b,
+  0xcf, 0x26, 0xec, 0x9b, 0x77, 0xda, 0xf0, 0x4f, 0xa0, 0xb7, 0xc5, 0xf3,
+  0x95, 0xee, 0x30, 0xe0, 0x30, 0x7c, 0x22, 0x9a, 0x47, 0xe0, 0x3b, 0x7a,
+  0x23, 0xfc, 0x72, 0x93, 0x3c, 0xdb, 0x13, 0xb7, 0x79, 0xb9, 0x48, 0xeb,
+  0xc3, 0x35, 0xda, 0x04
+};
+
+static const uint8_t ed25519_msg10 [1] = {
+  0xa7
+};
+
+static const uint8_t ed25519_pk11 [32] = {
+  0x7a, 0x1d, 0x29, 0xde, 0xa7, 0x18, 0x90, 0xe2, 0xbc, 0x91, 0xbc, 0x50,
+  0x51, 0xa1, 0x65, 0xe4, 0x68, 0x8b, 0x66, 0x94, 0x2c, 0x5f, 0x5c, 0x9c,
+  0x9f, 0x05, 0x12, 0xde, 0xcd, 0xf7, 0x27, 0x50
+};
+
+static const uint8_t ed25519_sig11 [64] = {
+  0x46, 0x51, 0x75, 0xf9, 0xa9, 0xcc, 0xcb, 0x69, 0x6d, 0x34, 0xc0, 0x25,
+  0xec, 0x64, 0xdc, 0xbb, 0xe6, 0x41, 0x82, 0x31, 0x37, 0x80, 0xed, 0x11,
+  0x50, 0xc0, 0x5d, 0xf8, 0x54, 0x77, 0xab, 0x5b, 0xce, 0xf6, 0xfa, 0x58,
+  0x3f, 0xa5, 0xd9, 0x8e, 0xeb, 0xe2, 0x57, 0xac, 0xce, 0x77, 0x1d, 0xa3,
+  0xe6, 0x8c, 0x1f, 0x53, 0xab, 0x3d, 0x19, 0xa5, 0xf8, 0xd9, 0xe2, 0x00,
+  0x7e, 0x50, 0xba, 0x08
+};
+
+static const uint8_t ed25519_msg11 [17] = {
+  0x3a, 0xce, 0x21, 0x2b, 0x96, 0xb8, 0x77, 0x05, 0x7a, 0xa7, 0x1b, 0xa1,
+  0xf0, 0xe0, 0x5e, 0xbd, 0x99
+};
+
+static const uint8_t ed25519_pk12 [32] = {
+  0xef, 0x9d, 0x78, 0xec, 0xce, 0xac, 0x6c, 0x9c, 0xd7, 0x89, 0xbb, 0xc4,
+  0xc9, 0x88, 0x85, 0xc6, 0xa6, 0x1b, 0x0f, 0x6b, 0xb6, 0x53, 0xf0, 0xe2,
+  0xdf, 0xe4, 0x86, 0x65, 0x0c, 0x8e, 0x2a, 0x65
+};
+
+static const uint8_t ed25519_sig12 [64] = {
+  0xdc, 0xf8, 0xf2, 0x1e, 0x26, 0x9f, 0x57, 0x96, 0xe1, 0x62, 0x2f, 0x05,
+  0xfa, 0x25, 0x1a, 0xac, 0xea, 0x8a, 0x73, 0x5c, 0x7e, 0xda, 0x60, 0x33,
+  0x43, 0x72, 0x2d, 0xa7, 0x36, 0x6b, 0xfd, 0x07, 0x7a, 0x9c, 0x70, 0x06,
+  0x3d, 0x31, 0x99, 0x5e, 0xa4, 0x6f, 0xe0, 0x0d, 0x33, 0x82, 0x66, 0x3e,
+  0xf0, 0xf6, 0x3a, 0x6b, 0x43, 0x3e, 0x7f, 0x5d, 0xb1, 0x0a, 0x69, 0x54,
+  0xae, 0x08, 0x35, 0x04
+};
+
+static const uint8_t ed25519_msg12 [95] = {
+  0x2d, 0x2b, 0x67, 0x83, 0x0c, 0xaf, 0x97, 0xd6, 0x6e, 0xe9, 0x75, 0x17,
+  0x0f, 0x7c, 0x96, 0x11, 0xff, 0xc1, 0x70, 0x5c, 0xa3, 0xbb, 0x7e, 0x19,
+  0x61, 0x64, 0xb7, 0x99, 0x0d, 0xdf, 0x4b, 0xdc, 0xef, 0x4b, 0x7c, 0x64,
+  0x9a, 0xfb, 0xbe, 0xa6, 0xb8, 0x1d, 0x21, 0xd6, 0xcb, 0x0b, 0x73, 0x29,
+  0x76, 0xb9, 0xe9, 0x07, 0x4e, 0xcc, 0x16, 0x9a, 0x06, 0x57, 0xe1, 0x4c,
+  0xc4, 0x08, 0xf9, 0x19, 0x83, 0x91, 0x8d, 0xed, 0xea, 0xa6, 0x57, 0x2c,
+  0x62, 0xa6, 0xdc, 0xa7, 0x5e, 0xbc, 0x4b, 0xdf, 0x32, 0xa3, 0x1f, 0x1e,
+  0x4c, 0xb8, 0x76, 0xd6, 0xe3, 0xea, 0xb6, 0xde, 0x3c, 0x33, 0xda
+};
+
+static const uint8_t ed25519_pk13 [32] = {
+  0xe2, 0x66, 0xaa, 0x8a, 0xfa, 0xfc, 0xe9, 0x93, 0x13, 0x44, 0xbe, 0x21,
+  0xc8, 0x52, 0xdc, 0x68, 0x41, 0xa7, 0x24, 0x5e, 0x9a, 0x8e, 0x21, 0x42,
+  0x7a, 0xc2, 0xbf, 0x77, 0x37, 0x24, 0x50, 0xd4
+};
+
+static const uint8_t ed25519_sig13 [64] = {
+  0x3d, 0x8b, 0x17, 0xa7, 0xd3, 0x66, 0x43, 0x8e, 0x71, 0x2e, 0xc4, 0x0e,
+  0x1a, 0x5d, 0xa0, 0x24, 0x7c, 0x59, 0x67, 0xe8, 0xbd, 0x2f, 0x01, 0x90,
+  0xd9, 0x11, 0xdb, 0x49, 0x75, 0xb1, 0x42, 0x4f, 0xde, 0x0e, 0x44, 0x19,
+  0xa2, 0x71, 0x22, 0x32, 0x41, 0x9e, 0x99, 0x7c, 0x19, 0x99, 0x39, 0x01,
+  0xbf, 0x8c, 0x20, 0x3c, 0x98, 0x60, 0x2a, 0x9b, 0x6b, 0x8e, 0xfd, 0xf9,
+  0xa9, 0xed, 0xae, 0x04
+};
+
+static const uint8_t ed25519_msg13 [140] = {
+  0xc5, 0x05, 0x46, 0xd2, 0x02, 0x1d, 0xa4, 0x8f, 0xed, 0xa8, 0xf9, 0x71,
+  0x52, 0x9d, 0x06, 0xd7, 0x76, 0xc5, 0x94, 0x07, 0x68, 0xa6, 0x26, 0x8b,
+  0xcd, 0xc6, 0xfe, 0xf8, 0xf6, 0x06, 0x3e, 0x60, 0x20, 0x8d, 0xcc, 0xfb,
+  0xbf, 0x78, 0x27, 0x23, 0x4a, 0x25, 0x9c, 0xe0, 0xb9, 0x38, 0x31, 0x4c,
+  0xf1, 0xdc, 0xf9, 0x8b, 0x2b, 0x73, 0x88, 0xd6, 0xa2, 0xae, 0x62, 0xfd,
+  0x2f, 0x47, 0x07, 0x6b, 0x19, 0x69, 0xb0, 0x7e, 0x2f, 0x07, 0xed, 0x7f,
+  0xf0, 0x50, 0xb9, 0xcb, 0x25, 0x0f, 0xd9, 0x57, 0xa9, 0xe8, 0xff, 0x86,
+  0xc3, 0x3e, 0x73, 0x12, 0x00, 0x91, 0xca, 0x2a, 0xd4, 0x58, 0xb5, 0xea,
+  0xdb, 0x21, 0xd0, 0xc2, 0x49, 0x06, 0xf3, 0x8e, 0xac, 0x77, 0x05, 0x8c,
+  0x40, 0x72, 0x69, 0x3f, 0xe7, 0x84, 0x81, 0x88, 0x44, 0x7b, 0xd2, 0x32,
+  0x28, 0x56, 0xbb, 0xe3, 0x2f, 0xbd, 0x1e, 0xcf, 0x30, 0xd1, 0xbf, 0x47,
+  0x0c, 0x63, 0x72, 0x8c, 0x3e, 0xe9, 0xef, 0x2c
+};
+
+static const uint8_t ed25519_pk14 [32] = {
+  0x32, 0x4c, 0xec, 0x62, 0x11, 0xcc, 0xe9, 0x1a, 0x9c, 0x29, 0xb5, 0xe4,
+  0xda, 0x84, 0x05, 0xa5, 0x8b, 0xe5, 0x5a, 0xc8, 0x29, 0xc1, 0x1d, 0x89,
+  0xe4, 0x00, 0x42, 0xe5, 0x19, 0xf9, 0xf4, 0x1c
+};
+
+static const uint8_t ed25519_sig14 [64] = {
+  0x9f, 0xbe, 0xcf, 0x16, 0xde, 0x7d, 0x47, 0x66, 0x4d, 0x1c, 0x30, 0xe3,
+  0x48, 0xa9, 0x0c, 0x24, 0x0b, 0x04, 0xcb, 0xc0, 0xce, 0x5f, 0x48, 0x60,
+  0xec, 0x52, 0x0e, 0x12, 0xad, 0xff, 0x58, 0xd3, 0x11, 0x1b, 0x3a, 0x0e,
+  0xc7, 0xf8, 0x94, 0xf2, 0x28, 0xa6, 0x05, 0xa2, 0x5e, 0x01, 0x29, 0xf6,
+  0x5f, 0xd4, 0x9e, 0x72, 0x45, 0x3c, 0x72, 0x6e, 0x05, 0x89, 0x05, 0x8d,
+  0x93, 0x55, 0x30, 0x0e
+};
+
+static const uint8_t ed25519_msg14 [63] = {
+  0x1e, 0xe7, 0xaf, 0xdf, 0x3c, 0xef, 0x52, 0xc9, 0x03, 0xa3, 0x28, 0xc7,
+  0xac, 0x2a, 0xd2, 0x41, 0xb0, 0xee, 0xb8, 0x83, 0x75, 0x10, 0x1d, 0x4c,
+  0x37, 0x85, 0x3b, 0xa6, 0x1a, 0x8f, 0x7c, 0x5d, 0x0b, 0x2a, 0x89, 0x74,
+  0x34, 0xb6, 0x60, 0x6f, 0xde, 0x61, 0xfc, 0x2c, 0x9a, 0x06, 0x89, 0xa4,
+  0x04, 0xc4, 0xaf, 0xa0, 0x0a, 0xdf, 0xe6, 0x98, 0xf7, 0x72, 0xdf, 0x7d,
+  0xf4, 0x7d, 0x61
+};
+
+static const uint8_t ed25519_pk15 [32] = {
+  0x87, 0x71, 0x23, 0x39, 0xd3, 0x9d, 0x5e, 0x8e, 0x18, 0x67, 0xf6, 0xc8,
+  0x66, 0x59, 0x15, 0x2b, 0x05, 0x5d, 0x8c, 0xba, 0x6b, 0x43, 0xa8, 0x8a,
+  0x6f, 0x70, 0xbc, 0x86, 0xb9, 0x54, 0x45, 0x24
+};
+
+static const uint8_t ed25519_sig15 [64] = {
+  0x9e, 0x6d, 0xc1, 0xa2, 0x1c, 0x8c, 0x37, 0x4a, 0x1a, 0x5b, 0x9c, 0xcf,
+  0x3c, 0x93, 0x2d, 0xbd, 0xa0, 0xee, 0x4b, 0x7d, 0x7a, 0x74, 0x1b, 0x98,
+  0x65, 0x7a, 0x14, 0x7f, 0xd8, 0xac, 0xd7, 0xa6, 0x25, 0x74, 0xec, 0x1f,
+  0x0c, 0xe5, 0x9c, 0x7d, 0xe4, 0xc3, 0x33, 0xd8, 0xd4, 0x07, 0xf3, 0x4a,
+  0xf7, 0x05, 0x25, 0x90, 0x15, 0x76, 0x60, 0x30, 0xa6, 0xf9, 0xf7, 0x4f,
+  0x66, 0x00, 0xf5, 0x07
+};
+
+static const uint8_t ed25519_msg15 [300] = {
+  0x17, 0xa0, 0xe3, 0x84, 0x29, 0xa0, 0x0d, 0xb9, 0x17, 0x27, 0x4d, 0x69,
+  0x88, 0xfd, 0x6a, 0x9f, 0xe4, 0x0c, 0x24, 0xac, 0x54, 0x95, 0x0e, 0x87,
+  0x27, 0xbf, 0xbb, 0xf5, 0x2b, 0xf6, 0x56, 0x68, 0xb8, 0xfb, 0x0b, 0x17,
+  0x2d, 0xe2, 0xbb, 0xeb, 0x0a, 0xdc, 0x96, 0x6b, 0x11, 0xcf, 0x67, 0x41,
+  0xed, 0xfd, 0x76, 0x30, 0x66, 0xc6, 0x7a, 0x54, 0x0c, 0xfa, 0xfd, 0xe8,
+  0xc4, 0x51, 0xd4, 0xfe, 0xf4, 0x25, 0x99, 0xe8, 0x87, 0x31, 0x4e, 0x74,
+  0x82, 0xd5, 0x1e, 0x2e, 0x16, 0x8b, 0x7e, 0x5e, 0xe5, 0x4a, 0x58, 0x8a,
+  0xf6, 0xe7, 0x0d, 0x22, 0x92, 0xd9, 0x6c, 0x71, 0x09, 0x19, 0xfd, 0xfc,
+  0xe2, 0x01, 0x78, 0x56, 0xdb, 0x5f, 0x26, 0x4c, 0x3d, 0x38, 0x81, 0x3e,
+  0xb5, 0x60, 0x2c, 0xba, 0x3e, 0xdc, 0x56, 0xd6, 0xc9, 0x03, 0x67, 0x3f,
+  0xeb, 0x66, 0x1a, 0xbc, 0xc7, 0x1d, 0x0a, 0x84, 0x3f, 0x6d, 0x1f, 0xea,
+  0x67, 0xe2, 0x07, 0x45, 0x93, 0x94, 0x23, 0x08, 0xb5, 0x27, 0xcd, 0x6b,
+  0x43, 0x5e, 0x26, 0x71, 0x71, 0x91, 0x78, 0xb5, 0x83, 0xb5, 0xb1, 0xe0,
+  0x31, 0xcc, 0x27, 0x91, 0x5d, 0x26, 0x7c, 0x51, 0xeb, 0xeb, 0xc5, 0x80,
+  0xbf, 0xb0, 0xce, 0x1e, 0x05, 0x8f, 0x24, 0x8c, 0x7b, 0x68, 0x84, 0x33,
+  0x83, 0x81, 0xfc, 0xe6, 0xdf, 0xdb, 0xde, 0xa2, 0xde, 0xe3, 0xb0, 0xf1,
+  0x23, 0x5f, 0xdc, 0xa5, 0xe6, 0x0a, 0x56, 0x69, 0xf3, 0x02, 0x01, 0x57,
+  0xe7, 0x78, 0x17, 0x9e, 0xdf, 0x73, 0x48, 0x98, 0x24, 0xd1, 0x2b, 0xc8,
+  0xa7, 0x20, 0x93, 0x7f, 0x3b, 0x15, 0x81, 0x85, 0x9a, 0xb3, 0xf1, 0xf1,
+  0x91, 0xcc, 0xd1, 0xf5, 0x5c, 0x72, 0xbf, 0xf3, 0xce, 0xeb, 0x2c, 0x46,
+  0x2e, 0x43, 0x83, 0x6b, 0x3e, 0x3b, 0xab, 0x1c, 0x6b, 0x70, 0x6a, 0x4e,
+  0xbc, 0xb5, 0x31, 0x97, 0xfa, 0xf3, 0xb4, 0x60, 0x4a, 0x93, 0x39, 0x7a,
+  0x5d, 0xd2, 0x64, 0xb5, 0xa5, 0x78, 0xd7, 0xf1, 0x61, 0x8c, 0x21, 0xe1,
+  0x6c, 0x3b, 0x1d, 0x5d, 0xbd, 0x09, 0x3e, 0xf6, 0x5c, 0x78, 0x95, 0x9f,
+  0xe1, 0xe3, 0x7e, 0x2f, 0xac, 0xa1, 0x09, 0x68, 0x36, 0x0c, 0x7d, 0xf0
+};
+
+static const ed25519_item_t ed25519_items [ED25519_TEST_ITEMS] = {
+  { ed25519_pk0, ed25519_sig0, ed25519_msg0, 0 },
+  { ed25519_pk1, ed25519_sig1, ed25519_msg1, 3 },
+  { ed25519_pk2, ed25519_sig2, ed25519_msg2, 32 },
+  { ed25519_pk3, ed25519_sig3, ed25519_msg3, 64 },
+  { ed25519_pk4, ed25519_sig4, ed25519_msg4, 111 },
+  { ed25519_pk5, ed25519_sig5, ed25519_msg5, 112 },
+  { ed25519_pk6, ed25519_sig6, ed25519_msg6, 127 },
+  { ed25519_pk7, ed25519_sig7, ed25519_msg7, 128 },
+  { ed25519_pk8, ed25519_sig8, ed25519_msg8, 200 },
+  { ed25519_pk9, ed25519_sig9, ed25519_msg9, 256 },
+  { ed25519_pk10, ed25519_sig10, ed25519_msg10, 1 },
+  { ed25519_pk11, ed25519_sig11, ed25519_msg11, 17 },
+  { ed25519_pk12, ed25519_sig12, ed25519_msg12, 95 },
+  { ed25519_pk13, ed25519_sig13, ed25519_msg13, 140 },
+  { ed25519_pk14, ed25519_sig14, ed25519_msg14, 63 },
+  { ed25519_pk15, ed25519_sig15, ed25519_msg15, 300 },
+};
+
+#endif // __ED25519_VECTORS_H__
@@ -0,0 +1,560 @@
+/*
+ * File      : fe25519.c
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched GF(2^255-19) arithmetic with one field element per
+ * e32 lane. Limb products are accumulated with the widening vwmulu/vwmaccu
+ * into e64 and carried before narrowing back to 32b limbs.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/curve25519/fe25519.h"
+
+#define MASK25  0x01ffffffu
+#define MASK26  0x03ffffffu
+
+// bit offset of every limb within the 255b number
+static const uint8_t kLimbOffset[FE25519_LIMBS] = {
+  0, 26, 51, 77, 102, 128, 153, 179, 204, 230
+};
+
+// 2*p, added before a subtraction to keep the limbs positive
+static const uint32_t kTwoP[FE25519_LIMBS] = {
+  0x07ffffda, 0x03fffffe, 0x07fffffe, 0x03fffffe, 0x07fffffe,
+  0x03fffffe, 0x07fffffe, 0x03fffffe, 0x07fffffe, 0x03fffffe
+};
+
+#define LOAD_FE(P, f)                                                   \
+  vuint32m1_t P##0 = __riscv_vle32_v_u32m1((f)->v[0], vl);              \
+  vuint32m1_t P##1 = __riscv_vle32_v_u32m1((f)->v[1], vl);              \
+  vuint32m1_t P##2 = __riscv_vle32_v_u32m1((f)->v[2], vl);              \
+  vuint32m1_t P##3 = __riscv_vle32_v_u32m1((f)->v[3], vl);              \
+  vuint32m1_t P##4 = __riscv_vle32_v_u32m1((f)->v[4], vl);              \
+  vuint32m1_t P##5 = __riscv_vle32_v_u32m1((f)->v[5], vl);              \
+  vuint32m1_t P##6 = __riscv_vle32_v_u32m1((f)->v[6], vl);              \
+  vuint32m1_t P##7 = __riscv_vle32_v_u32m1((f)->v[7], vl);              \
+  vuint32m1_t P##8 = __riscv_vle32_v_u32m1((f)->v[8], vl);              \
+  vuint32m1_t P##9 = __riscv_vle32_v_u32m1((f)->v[9], vl);
+
+#define STORE_FE(h, P) {                                                \
+  __riscv_vse32_v_u32m1((h)->v[0], P##0, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[1], P##1, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[2], P##2, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[3], P##3, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[4], P##4, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[5], P##5, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[6], P##6, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[7], P##7, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[8], P##8, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[9], P##9, vl);                           \
+}
+
+// narrow the (carried) e64 accumulators and store them as 32b limbs
+#define STORE_FE64(h, P) {                                                    \
+  __riscv_vse32_v_u32m1((h)->v[0], __riscv_vncvt_x_x_w_u32m1(P##0, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[1], __riscv_vncvt_x_x_w_u32m1(P##1, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[2], __riscv_vncvt_x_x_w_u32m1(P##2, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[3], __riscv_vncvt_x_x_w_u32m1(P##3, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[4], __riscv_vncvt_x_x_w_u32m1(P##4, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[5], __riscv_vncvt_x_x_w_u32m1(P##5, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[6], __riscv_vncvt_x_x_w_u32m1(P##6, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[7], __riscv_vncvt_x_x_w_u32m1(P##7, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[8], __riscv_vncvt_x_x_w_u32m1(P##8, vl), vl);  \
+  __riscv_vse32_v_u32m1((h)->v[9], __riscv_vncvt_x_x_w_u32m1(P##9, vl), vl);  \
+}
+
+// move the bits of limb a above `bits` into limb b
+#define CARRY32(a, b, bits) {                                           \
+  vuint32m1_t c = __riscv_vsrl_vx_u32m1(a, bits, vl);                   \
+  a = __riscv_vand_vx_u32m1(a, MASK##bits, vl);                         \
+  b = __riscv_vadd_vv_u32m1(b, c, vl);                                  \
+}
+
+#define CARRY64(a, b, bits) {                                           \
+  vuint64m2_t c = __riscv_vsrl_vx_u64m2(a, bits, vl);                   \
+  a = __riscv_vand_vx_u64m2(a, MASK##bits, vl);                         \
+  b = __riscv_vadd_vv_u64m2(b, c, vl);                                  \
+}
+
+// 2^255 = 19 mod p, the carry out of limb 9 wraps around into limb 0
+#define CARRY32_WRAP(a9, a0) {                                          \
+  vuint32m1_t c = __riscv_vsrl_vx_u32m1(a9, 25, vl);                    \
+  a9 = __riscv_vand_vx_u32m1(a9, MASK25, vl);                           \
+  a0 = __riscv_vmacc_vx_u32m1(a0, 19, c, vl);                           \
+}
+
+#define CARRY64_WRAP(a9, a0) {                                          \
+  vuint64m2_t c = __riscv_vsrl_vx_u64m2(a9, 25, vl);                    \
+  a9 = __riscv_vand_vx_u64m2(a9, MASK25, vl);                           \
+  a0 = __riscv_vmacc_vx_u64m2(a0, 19, c, vl);                           \
+}
+
+// Two interleaved carry chains (0->5 and 4->9) as in ref10, which shortens
+// the dependency chain through the vector unit.
+#define CARRY_CHAIN(W, h) {                                             \
+  CARRY##W(h##0, h##1, 26); CARRY##W(h##4, h##5, 26);                   \
+  CARRY##W(h##1, h##2, 25); CARRY##W(h##5, h##6, 25);                   \
+  CARRY##W(h##2, h##3, 26); CARRY##W(h##6, h##7, 26);                   \
+  CARRY##W(h##3, h##4, 25); CARRY##W(h##7, h##8, 25);                   \
+  CARRY##W(h##4, h##5, 26); CARRY##W(h##8, h##9, 26);                   \
+  CARRY##W##_WRAP(h##9, h##0);                                          \
+  CARRY##W(h##0, h##1, 26);                                             \
+}
+
+size_t fe25519_lanes(void) {
+  size_t vlmax = __riscv_vsetvlmax_e32m1();
+  return vlmax < FE25519_LANES ? vlmax : FE25519_LANES;
+}
+
+void fe25519_set(fe25519_t* h, const uint32_t c[FE25519_LIMBS], size_t vl) {
+  for (size_t i = 0; i < FE25519_LIMBS; i++) {
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vmv_v_x_u32m1(c[i], vl), vl);
+  }
+}
+
+void fe25519_0(fe25519_t* h, size_t vl) {
+  static const uint32_t zero[FE25519_LIMBS] = {0};
+  fe25519_set(h, zero, vl);
+}
+
+void fe25519_1(fe25519_t* h, size_t vl) {
+  static const uint32_t one[FE25519_LIMBS] = {1};
+  fe25519_set(h, one, vl);
+}
+
+void fe25519_copy(fe25519_t* h, const fe25519_t* f, size_t vl) {
+  for (size_t i = 0; i < FE25519_LIMBS; i++) {
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vle32_v_u32m1(f->v[i], vl), vl);
+  }
+}
+
+void fe25519_add(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl) {
+  LOAD_FE(f, f)
+  LOAD_FE(g, g)
+  vuint32m1_t h0 = __riscv_vadd_vv_u32m1(f0, g0, vl);
+  vuint32m1_t h1 = __riscv_vadd_vv_u32m1(f1, g1, vl);
+  vuint32m1_t h2 = __riscv_vadd_vv_u32m1(f2, g2, vl);
+  vuint32m1_t h3 = __riscv_vadd_vv_u32m1(f3, g3, vl);
+  vuint32m1_t h4 = __riscv_vadd_vv_u32m1(f4, g4, vl);
+  vuint32m1_t h5 = __riscv_vadd_vv_u32m1(f5, g5, vl);
+  vuint32m1_t h6 = __riscv_vadd_vv_u32m1(f6, g6, vl);
+  vuint32m1_t h7 = __riscv_vadd_vv_u32m1(f7, g7, vl);
+  vuint32m1_t h8 = __riscv_vadd_vv_u32m1(f8, g8, vl);
+  vuint32m1_t h9 = __riscv_vadd_vv_u32m1(f9, g9, vl);
+  CARRY_CHAIN(32, h)
+  STORE_FE(h, h)
+}
+
+#define SUB_LIMB(i) \
+  vuint32m1_t h##i = __riscv_vsub_vv_u32m1(__riscv_vadd_vx_u32m1(f##i, kTwoP[i], vl), g##i, vl);
+
+void fe25519_sub(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl) {
+  LOAD_FE(f, f)
+  LOAD_FE(g, g)
+  SUB_LIMB(0) SUB_LIMB(1) SUB_LIMB(2) SUB_LIMB(3) SUB_LIMB(4)
+  SUB_LIMB(5) SUB_LIMB(6) SUB_LIMB(7) SUB_LIMB(8) SUB_LIMB(9)
+  CARRY_CHAIN(32, h)
+  STORE_FE(h, h)
+}
+
+void fe25519_neg(fe25519_t* h, const fe25519_t* f, size_t vl) {
+  fe25519_t zero;
+  fe25519_0(&zero, vl);
+  fe25519_sub(h, &zero, f, vl);
+}
+
+/*
+ * h = f * g, schoolbook over the 10x10 limb products. Products which wrap
+ * around 2^255 are scaled by 19 (g*19 < 2^31), and products of two odd limbs
+ * by 2 (f*2) to account for the 25.5b radix. With carried inputs every
+ * accumulator stays below 2^61.
+ */
+void fe25519_mul(fe25519_t* h, const fe25519_t* f, const fe25519_t* g, size_t vl) {
+  vuint64m2_t h0, h1, h2, h3, h4, h5, h6, h7, h8, h9;
+
+  LOAD_FE(f, f)
+  LOAD_FE(g, g)
+
+  vuint32m1_t f1_2  = __riscv_vadd_vv_u32m1(f1, f1, vl);
+  vuint32m1_t f3_2  = __riscv_vadd_vv_u32m1(f3, f3, vl);
+  vuint32m1_t f5_2  = __riscv_vadd_vv_u32m1(f5, f5, vl);
+  vuint32m1_t f7_2  = __riscv_vadd_vv_u32m1(f7, f7, vl);
+  vuint32m1_t f9_2  = __riscv_vadd_vv_u32m1(f9, f9, vl);
+  vuint32m1_t g1_19 = __riscv_vmul_vx_u32m1(g1, 19, vl);
+  vuint32m1_t g2_19 = __riscv_vmul_vx_u32m1(g2, 19, vl);
+  vuint32m1_t g3_19 = __riscv_vmul_vx_u32m1(g3, 19, vl);
+  vuint32m1_t g4_19 = __riscv_vmul_vx_u32m1(g4, 19, vl);
+  vuint32m1_t g5_19 = __riscv_vmul_vx_u32m1(g5, 19, vl);
+  vuint32m1_t g6_19 = __riscv_vmul_vx_u32m1(g6, 19, vl);
+  vuint32m1_t g7_19 = __riscv_vmul_vx_u32m1(g7, 19, vl);
+  vuint32m1_t g8_19 = __riscv_vmul_vx_u32m1(g8, 19, vl);
+  vuint32m1_t g9_19 = __riscv_vmul_vx_u32m1(g9, 19, vl);
+
+  h0 = __riscv_vwmulu_vv_u64m2(f0, g0, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f1_2, g9_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f2, g8_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f3_2, g7_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f4, g6_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f5_2, g5_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f6, g4_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f7_2, g3_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f8, g2_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f9_2, g1_19, vl);
+
+  h1 = __riscv_vwmulu_vv_u64m2(f0, g1, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f1, g0, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f2, g9_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f3, g8_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f4, g7_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f5, g6_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f6, g5_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f7, g4_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f8, g3_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f9, g2_19, vl);
+
+  h2 = __riscv_vwmulu_vv_u64m2(f0, g2, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f1_2, g1, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f2, g0, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f3_2, g9_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f4, g8_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f5_2, g7_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f6, g6_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f7_2, g5_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f8, g4_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f9_2, g3_19, vl);
+
+  h3 = __riscv_vwmulu_vv_u64m2(f0, g3, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f1, g2, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f2, g1, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f3, g0, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f4, g9_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f5, g8_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f6, g7_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f7, g6_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f8, g5_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f9, g4_19, vl);
+
+  h4 = __riscv_vwmulu_vv_u64m2(f0, g4, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f1_2, g3, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f2, g2, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f3_2, g1, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f4, g0, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f5_2, g9_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f6, g8_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f7_2, g7_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f8, g6_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f9_2, g5_19, vl);
+
+  h5 = __riscv_vwmulu_vv_u64m2(f0, g5, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f1, g4, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f2, g3, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f3, g2, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f4, g1, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f5, g0, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f6, g9_19, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f7, g8_19, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f8, g7_19, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f9, g6_19, vl);
+
+  h6 = __riscv_vwmulu_vv_u64m2(f0, g6, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f1_2, g5, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f2, g4, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f3_2, g3, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f4, g2, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f5_2, g1, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f6, g0, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f7_2, g9_19, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f8, g8_19, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f9_2, g7_19, vl);
+
+  h7 = __riscv_vwmulu_vv_u64m2(f0, g7, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f1, g6, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f2, g5, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f3, g4, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f4, g3, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f5, g2, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f6, g1, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f7, g0, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f8, g9_19, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f9, g8_19, vl);
+
+  h8 = __riscv_vwmulu_vv_u64m2(f0, g8, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f1_2, g7, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f2, g6, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f3_2, g5, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f4, g4, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f5_2, g3, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f6, g2, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f7_2, g1, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f8, g0, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f9_2, g9_19, vl);
+
+  h9 = __riscv_vwmulu_vv_u64m2(f0, g9, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f1, g8, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f2, g7, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f3, g6, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f4, g5, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f5, g4, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f6, g3, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f7, g2, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f8, g1, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f9, g0, vl);
+  CARRY_CHAIN(64, h)
+  STORE_FE64(h, h)
+}
+
+/*
+ * h = f^2, as fe25519_mul but every cross product f[i]*f[j], i != j, is
+ * only computed once and doubled (f*2, f*4).
+ */
+void fe25519_sq(fe25519_t* h, const fe25519_t* f, size_t vl) {
+  vuint64m2_t h0, h1, h2, h3, h4, h5, h6, h7, h8, h9;
+
+  LOAD_FE(f, f)
+
+  vuint32m1_t f0_2  = __riscv_vadd_vv_u32m1(f0, f0, vl);
+  vuint32m1_t f1_2  = __riscv_vadd_vv_u32m1(f1, f1, vl);
+  vuint32m1_t f2_2  = __riscv_vadd_vv_u32m1(f2, f2, vl);
+  vuint32m1_t f3_2  = __riscv_vadd_vv_u32m1(f3, f3, vl);
+  vuint32m1_t f4_2  = __riscv_vadd_vv_u32m1(f4, f4, vl);
+  vuint32m1_t f5_2  = __riscv_vadd_vv_u32m1(f5, f5, vl);
+  vuint32m1_t f6_2  = __riscv_vadd_vv_u32m1(f6, f6, vl);
+  vuint32m1_t f7_2  = __riscv_vadd_vv_u32m1(f7, f7, vl);
+  vuint32m1_t f8_2  = __riscv_vadd_vv_u32m1(f8, f8, vl);
+  vuint32m1_t f9_2  = __riscv_vadd_vv_u32m1(f9, f9, vl);
+  vuint32m1_t f1_4  = __riscv_vadd_vv_u32m1(f1_2, f1_2, vl);
+  vuint32m1_t f3_4  = __riscv_vadd_vv_u32m1(f3_2, f3_2, vl);
+  vuint32m1_t f5_4  = __riscv_vadd_vv_u32m1(f5_2, f5_2, vl);
+  vuint32m1_t f7_4  = __riscv_vadd_vv_u32m1(f7_2, f7_2, vl);
+  vuint32m1_t f5_19 = __riscv_vmul_vx_u32m1(f5, 19, vl);
+  vuint32m1_t f6_19 = __riscv_vmul_vx_u32m1(f6, 19, vl);
+  vuint32m1_t f7_19 = __riscv_vmul_vx_u32m1(f7, 19, vl);
+  vuint32m1_t f8_19 = __riscv_vmul_vx_u32m1(f8, 19, vl);
+  vuint32m1_t f9_19 = __riscv_vmul_vx_u32m1(f9, 19, vl);
+
+  h0 = __riscv_vwmulu_vv_u64m2(f0, f0, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f1_4, f9_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f2_2, f8_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f3_4, f7_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f4_2, f6_19, vl);
+  h0 = __riscv_vwmaccu_vv_u64m2(h0, f5_2, f5_19, vl);
+
+  h1 = __riscv_vwmulu_vv_u64m2(f0_2, f1, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f2_2, f9_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f3_2, f8_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f4_2, f7_19, vl);
+  h1 = __riscv_vwmaccu_vv_u64m2(h1, f5_2, f6_19, vl);
+
+  h2 = __riscv_vwmulu_vv_u64m2(f0_2, f2, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f1_2, f1, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f3_4, f9_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f4_2, f8_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f5_4, f7_19, vl);
+  h2 = __riscv_vwmaccu_vv_u64m2(h2, f6, f6_19, vl);
+
+  h3 = __riscv_vwmulu_vv_u64m2(f0_2, f3, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f1_2, f2, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f4_2, f9_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f5_2, f8_19, vl);
+  h3 = __riscv_vwmaccu_vv_u64m2(h3, f6_2, f7_19, vl);
+
+  h4 = __riscv_vwmulu_vv_u64m2(f0_2, f4, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f1_4, f3, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f2, f2, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f5_4, f9_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f6_2, f8_19, vl);
+  h4 = __riscv_vwmaccu_vv_u64m2(h4, f7_2, f7_19, vl);
+
+  h5 = __riscv_vwmulu_vv_u64m2(f0_2, f5, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f1_2, f4, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f2_2, f3, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f6_2, f9_19, vl);
+  h5 = __riscv_vwmaccu_vv_u64m2(h5, f7_2, f8_19, vl);
+
+  h6 = __riscv_vwmulu_vv_u64m2(f0_2, f6, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f1_4, f5, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f2_2, f4, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f3_2, f3, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f7_4, f9_19, vl);
+  h6 = __riscv_vwmaccu_vv_u64m2(h6, f8, f8_19, vl);
+
+  h7 = __riscv_vwmulu_vv_u64m2(f0_2, f7, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f1_2, f6, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f2_2, f5, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f3_2, f4, vl);
+  h7 = __riscv_vwmaccu_vv_u64m2(h7, f8_2, f9_19, vl);
+
+  h8 = __riscv_vwmulu_vv_u64m2(f0_2, f8, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f1_4, f7, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f2_2, f6, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f3_4, f5, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f4, f4, vl);
+  h8 = __riscv_vwmaccu_vv_u64m2(h8, f9_2, f9_19, vl);
+
+  h9 = __riscv_vwmulu_vv_u64m2(f0_2, f9, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f1_2, f8, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f2_2, f7, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f3_2, f6, vl);
+  h9 = __riscv_vwmaccu_vv_u64m2(h9, f4_2, f5, vl);
+  CARRY_CHAIN(64, h)
+  STORE_FE64(h, h)
+}
+
+void fe25519_mul_small(fe25519_t* h, const fe25519_t* f, uint32_t c, size_t vl) {
+  LOAD_FE(f, f)
+  vuint64m2_t h0 = __riscv_vwmulu_vx_u64m2(f0, c, vl);
+  vuint64m2_t h1 = __riscv_vwmulu_vx_u64m2(f1, c, vl);
+  vuint64m2_t h2 = __riscv_vwmulu_vx_u64m2(f2, c, vl);
+  vuint64m2_t h3 = __riscv_vwmulu_vx_u64m2(f3, c, vl);
+  vuint64m2_t h4 = __riscv_vwmulu_vx_u64m2(f4, c, vl);
+  vuint64m2_t h5 = __riscv_vwmulu_vx_u64m2(f5, c, vl);
+  vuint64m2_t h6 = __riscv_vwmulu_vx_u64m2(f6, c, vl);
+  vuint64m2_t h7 = __riscv_vwmulu_vx_u64m2(f7, c, vl);
+  vuint64m2_t h8 = __riscv_vwmulu_vx_u64m2(f8, c, vl);
+  vuint64m2_t h9 = __riscv_vwmulu_vx_u64m2(f9, c, vl);
+  CARRY_CHAIN(64, h)
+  STORE_FE64(h, h)
+}
+
+// h = f^(2^n)
+static void fe25519_sq_n(fe25519_t* h, const fe25519_t* f, int n, size_t vl) {
+  fe25519_sq(h, f, vl);
+  for (int i = 1; i < n; i++) {
+    fe25519_sq(h, h, vl);
+  }
+}
+
+// Shared head of the addition chains of ref10: t0 = f^11, returns
+// t1 = f^(2^250 - 1)
+static void fe25519_pow_2_250_1(fe25519_t* t0, fe25519_t* t1, const fe25519_t* f, size_t vl) {
+  fe25519_t t2, t3;
+
+  fe25519_sq   (t0, f, vl);           // 2
+  fe25519_sq_n (t1, t0, 2, vl);       // 8
+  fe25519_mul  (t1, f, t1, vl);       // 9
+  fe25519_mul  (t0, t0, t1, vl);      // 11
+  fe25519_sq   (&t2, t0, vl);         // 22
+  fe25519_mul  (t1, t1, &t2, vl);     // 2^5 - 1
+  fe25519_sq_n (&t2, t1, 5, vl);
+  fe25519_mul  (t1, &t2, t1, vl);     // 2^10 - 1
+  fe25519_sq_n (&t2, t1, 10, vl);
+  fe25519_mul  (&t2, &t2, t1, vl);    // 2^20 - 1
+  fe25519_sq_n (&t3, &t2, 20, vl);
+  fe25519_mul  (&t2, &t3, &t2, vl);   // 2^40 - 1
+  fe25519_sq_n (&t2, &t2, 10, vl);
+  fe25519_mul  (t1, &t2, t1, vl);     // 2^50 - 1
+  fe25519_sq_n (&t2, t1, 50, vl);
+  fe25519_mul  (&t2, &t2, t1, vl);    // 2^100 - 1
+  fe25519_sq_n (&t3, &t2, 100, vl);
+  fe25519_mul  (&t2, &t3, &t2, vl);   // 2^200 - 1
+  fe25519_sq_n (&t2, &t2, 50, vl);
+  fe25519_mul  (t1, &t2, t1, vl);     // 2^250 - 1
+}
+
+void fe25519_invert(fe25519_t* h, const fe25519_t* f, size_t vl) {
+  fe25519_t t0, t1;
+
+  fe25519_pow_2_250_1(&t0, &t1, f, vl);
+  fe25519_sq_n (&t1, &t1, 5, vl);     // 2^255 - 2^5
+  fe25519_mul  (h, &t1, &t0, vl);     // 2^255 - 21
+}
+
+void fe25519_pow22523(fe25519_t* h, const fe25519_t* f, size_t vl) {
+  fe25519_t t0, t1;
+
+  fe25519_pow_2_250_1(&t0, &t1, f, vl);
+  fe25519_sq_n (&t1, &t1, 2, vl);     // 2^252 - 4
+  fe25519_mul  (h, &t1, f, vl);       // 2^252 - 3
+}
+
+void fe25519_cmov(fe25519_t* h, const fe25519_t* f, const uint32_t* sel, size_t vl) {
+  vbool32_t m = __riscv_vmsne_vx_u32m1_b32(__riscv_vle32_v_u32m1(sel, vl), 0, vl);
+
+  for (size_t i = 0; i < FE25519_LIMBS; i++) {
+    vuint32m1_t a = __riscv_vle32_v_u32m1(h->v[i], vl);
+    vuint32m1_t b = __riscv_vle32_v_u32m1(f->v[i], vl);
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vmerge_vvm_u32m1(a, b, m, vl), vl);
+  }
+}
+
+void fe25519_cswap(fe25519_t* f, fe25519_t* g, const uint32_t* sel, size_t vl) {
+  vbool32_t m = __riscv_vmsne_vx_u32m1_b32(__riscv_vle32_v_u32m1(sel, vl), 0, vl);
+
+  for (size_t i = 0; i < FE25519_LIMBS; i++) {
+    vuint32m1_t a = __riscv_vle32_v_u32m1(f->v[i], vl);
+    vuint32m1_t b = __riscv_vle32_v_u32m1(g->v[i], vl);
+    __riscv_vse32_v_u32m1(f->v[i], __riscv_vmerge_vvm_u32m1(a, b, m, vl), vl);
+    __riscv_vse32_v_u32m1(g->v[i], __riscv_vmerge_vvm_u32m1(b, a, m, vl), vl);
+  }
+}
+
+/*
+ * Conversion from/to bytes works on a single lane with scalar code, it is
+ * only needed when a batch is loaded or its results are checked.
+ */
+void fe25519_frombytes(fe25519_t* h, size_t lane, const uint8_t s[32]) {
+  uint64_t w[5] = {0};
+
+  for (int i = 0; i < 32; i++) {
+    w[i >> 3] |= (uint64_t)(s[i]) << (8 * (i & 7));
+  }
+
+  for (int i = 0; i < FE25519_LIMBS; i++) {
+    int      o = kLimbOffset[i];
+    uint64_t x = w[o >> 6] >> (o & 63);
+    if ((o & 63) > 38) {
+      x |= w[(o >> 6) + 1] << (64 - (o & 63));
+    }
+    h->v[i][lane] = (uint32_t)(x) & ((i & 1) ? MASK25 : MASK26);
+  }
+}
+
+void fe25519_tobytes(uint8_t s[32], const fe25519_t* f, size_t lane) {
+  uint32_t t[FE25519_LIMBS];
+  uint32_t q[FE25519_LIMBS];
+  uint64_t w[5] = {0};
+
+  for (int i = 0; i < FE25519_LIMBS; i++) {
+    t[i] = f->v[i][lane];
+  }
+
+  // carry until every limb fits its width, t < 2^255
+  for (int pass = 0; pass < 3; pass++) {
+    for (int i = 0; i < FE25519_LIMBS - 1; i++) {
+      int bits = (i & 1) ? 25 : 26;
+      t[i + 1] += t[i] >> bits;
+      t[i]     &= (i & 1) ? MASK25 : MASK26;
+    }
+    t[0] += 19 * (t[9] >> 25);
+    t[9] &= MASK25;
+  }
+
+  // q = t + 19, which has bit 255 set iff t >= p, in which case t - p = q - 2^255
+  uint32_t c = 19;
+  for (int i = 0; i < FE25519_LIMBS; i++) {
+    int bits = (i & 1) ? 25 : 26;
+    q[i] = t[i] + c;
+    c    = q[i] >> bits;
+    q[i] &= (i & 1) ? MASK25 : MASK26;
+  }
+
+  uint32_t mask = -c;
+  for (int i = 0; i < FE25519_LIMBS; i++) {
+    t[i] = (q[i] & mask) | (t[i] & ~mask);
+  }
+
+  for (int i = 0; i < FE25519_LIMBS; i++) {
+    int o = kLimbOffset[i];
+    w[o >> 6]       |= (uint64_t)(t[i]) << (o & 63);
+    w[(o >> 6) + 1] |= (o & 63) ? (uint64_t)(t[i]) >> (64 - (o & 63)) : 0;
+  }
+
+  for (int i = 0; i < 32; i++) {
+    s[i] = (uint8_t)(w[i >> 3] >> (8 * (i & 7)));
+  }
+}
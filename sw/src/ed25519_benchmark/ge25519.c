@@ -0,0 +1,244 @@
+/*
+ * File      : ge25519.c
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched edwards25519 point arithmetic in extended coordinates
+ * (Hisil-Wong-Carter-Dawson, a = -1) on top of the lane-parallel field
+ * arithmetic of fe25519.c.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/curve25519/fe25519.h"
+#include "crypto/curve25519/ge25519.h"
+
+// d = -121665/121666
+static const uint32_t kD[FE25519_LIMBS] = {
+  0x035978a3, 0x00d37284, 0x03156ebd, 0x006a0a0e, 0x0001c029,
+  0x0179e898, 0x03a03cbb, 0x01ce7198, 0x02e2b6ff, 0x01480db3
+};
+
+// 2*d
+static const uint32_t kD2[FE25519_LIMBS] = {
+  0x02b2f159, 0x01a6e509, 0x022add7a, 0x00d4141d, 0x00038052,
+  0x00f3d130, 0x03407977, 0x019ce331, 0x01c56dff, 0x00901b67
+};
+
+// sqrt(-1) = 2^((p-1)/4)
+static const uint32_t kSqrtM1[FE25519_LIMBS] = {
+  0x020ea0b0, 0x0186c9d2, 0x008f189d, 0x0035697f, 0x00bd0c60,
+  0x01fbd7a7, 0x02804c9e, 0x01e16569, 0x0004fc1d, 0x00ae0c92
+};
+
+// base point B = (x, 4/5), x even
+static const uint32_t kBaseX[FE25519_LIMBS] = {
+  0x0325d51a, 0x018b5823, 0x00f6592a, 0x0104a92d, 0x01a4b31d,
+  0x01d6dc5c, 0x027118fe, 0x007fd814, 0x013cd6e5, 0x0085a4db
+};
+
+static const uint32_t kBaseY[FE25519_LIMBS] = {
+  0x02666658, 0x01999999, 0x00cccccc, 0x01333333, 0x01999999,
+  0x00666666, 0x03333333, 0x00cccccc, 0x02666666, 0x01999999
+};
+
+static const uint32_t kBaseT[FE25519_LIMBS] = {
+  0x01b7dda3, 0x01a2ace9, 0x025eadbb, 0x0003ba8a, 0x0083c27e,
+  0x00abe37d, 0x01274732, 0x00ccacdd, 0x00fd78b7, 0x019e1d7c
+};
+
+void ge25519_0(ge25519_t* r, size_t vl) {
+  fe25519_0(&r->X, vl);
+  fe25519_1(&r->Y, vl);
+  fe25519_1(&r->Z, vl);
+  fe25519_0(&r->T, vl);
+}
+
+void ge25519_base(ge25519_t* r, size_t vl) {
+  fe25519_set(&r->X, kBaseX, vl);
+  fe25519_set(&r->Y, kBaseY, vl);
+  fe25519_1  (&r->Z, vl);
+  fe25519_set(&r->T, kBaseT, vl);
+}
+
+void ge25519_neg(ge25519_t* r, const ge25519_t* p, size_t vl) {
+  fe25519_neg (&r->X, &p->X, vl);
+  fe25519_copy(&r->Y, &p->Y, vl);
+  fe25519_copy(&r->Z, &p->Z, vl);
+  fe25519_neg (&r->T, &p->T, vl);
+}
+
+/*
+ * dbl-2008-hwcd with every intermediate negated, which saves the negations
+ * of a = -1:
+ *   A = X^2, B = Y^2, C = 2*Z^2, H = A+B, E = H-(X+Y)^2, G = A-B, F = C+G
+ *   X3 = E*F, Y3 = G*H, T3 = E*H, Z3 = F*G
+ */
+void ge25519_dbl(ge25519_t* r, const ge25519_t* p, size_t vl) {
+  fe25519_t a, b, c, e, f, g, h;
+
+  fe25519_sq  (&a, &p->X, vl);
+  fe25519_sq  (&b, &p->Y, vl);
+  fe25519_sq  (&c, &p->Z, vl);
+  fe25519_add (&c, &c, &c, vl);
+  fe25519_add (&h, &a, &b, vl);
+  fe25519_add (&e, &p->X, &p->Y, vl);
+  fe25519_sq  (&e, &e, vl);
+  fe25519_sub (&e, &h, &e, vl);
+  fe25519_sub (&g, &a, &b, vl);
+  fe25519_add (&f, &c, &g, vl);
+
+  fe25519_mul (&r->X, &e, &f, vl);
+  fe25519_mul (&r->Y, &g, &h, vl);
+  fe25519_mul (&r->T, &e, &h, vl);
+  fe25519_mul (&r->Z, &f, &g, vl);
+}
+
+void ge25519_to_cached(ge25519_cached_t* r, const ge25519_t* p, size_t vl) {
+  fe25519_t d2;
+
+  fe25519_set (&d2, kD2, vl);
+  fe25519_add (&r->YpX, &p->Y, &p->X, vl);
+  fe25519_sub (&r->YmX, &p->Y, &p->X, vl);
+  fe25519_add (&r->Z2, &p->Z, &p->Z, vl);
+  fe25519_mul (&r->T2d, &p->T, &d2, vl);
+}
+
+/*
+ * add-2008-hwcd-3 with a precomputed addend:
+ *   A = (Y1-X1)*(Y2-X2), B = (Y1+X1)*(Y2+X2), C = T1*2d*T2, D = Z1*2*Z2
+ *   E = B-A, F = D-C, G = D+C, H = B+A
+ *   X3 = E*F, Y3 = G*H, T3 = E*H, Z3 = F*G
+ */
+void ge25519_add(ge25519_t* r, const ge25519_t* p, const ge25519_cached_t* q, size_t vl) {
+  fe25519_t a, b, c, d, e, f, g, h;
+
+  fe25519_sub (&a, &p->Y, &p->X, vl);
+  fe25519_mul (&a, &a, &q->YmX, vl);
+  fe25519_add (&b, &p->Y, &p->X, vl);
+  fe25519_mul (&b, &b, &q->YpX, vl);
+  fe25519_mul (&c, &p->T, &q->T2d, vl);
+  fe25519_mul (&d, &p->Z, &q->Z2, vl);
+
+  fe25519_sub (&e, &b, &a, vl);
+  fe25519_sub (&f, &d, &c, vl);
+  fe25519_add (&g, &d, &c, vl);
+  fe25519_add (&h, &b, &a, vl);
+
+  fe25519_mul (&r->X, &e, &f, vl);
+  fe25519_mul (&r->Y, &g, &h, vl);
+  fe25519_mul (&r->T, &e, &h, vl);
+  fe25519_mul (&r->Z, &f, &g, vl);
+}
+
+void ge25519_cmov_cached(ge25519_cached_t* r, const ge25519_cached_t* p,
+                         const uint32_t* sel, size_t vl) {
+  fe25519_cmov(&r->YpX, &p->YpX, sel, vl);
+  fe25519_cmov(&r->YmX, &p->YmX, sel, vl);
+  fe25519_cmov(&r->Z2,  &p->Z2,  sel, vl);
+  fe25519_cmov(&r->T2d, &p->T2d, sel, vl);
+}
+
+static int fe25519_iszero_lane(const fe25519_t* f, size_t lane) {
+  uint8_t  s[32];
+  uint32_t acc = 0;
+
+  fe25519_tobytes(s, f, lane);
+  for (int i = 0; i < 32; i++) {
+    acc |= s[i];
+  }
+  return acc == 0;
+}
+
+/*
+ * x^2 = (y^2-1)/(d*y^2+1) = u/v is solved for all lanes at once with
+ * x = u*v^3*(u*v^7)^((p-5)/8), corrected by sqrt(-1) where v*x^2 = -u.
+ * Only the final checks and sign fix ups look at individual lanes.
+ */
+void ge25519_frombytes(ge25519_t* r, uint32_t* valid, const uint8_t* const* s, size_t vl) {
+  fe25519_t u, v, v3, vxx, t, d;
+  uint32_t  sel [FE25519_LANES];
+  uint8_t   b   [32];
+
+  for (size_t i = 0; i < vl; i++) {
+    fe25519_frombytes(&r->Y, i, s[i]);
+  }
+  fe25519_1   (&r->Z, vl);
+  fe25519_set (&d, kD, vl);
+
+  fe25519_sq  (&u, &r->Y, vl);
+  fe25519_mul (&v, &u, &d, vl);
+  fe25519_sub (&u, &u, &r->Z, vl);      // u = y^2-1
+  fe25519_add (&v, &v, &r->Z, vl);      // v = d*y^2+1
+
+  fe25519_sq  (&v3, &v, vl);
+  fe25519_mul (&v3, &v3, &v, vl);       // v3 = v^3
+  fe25519_sq  (&r->X, &v3, vl);
+  fe25519_mul (&r->X, &r->X, &v, vl);
+  fe25519_mul (&r->X, &r->X, &u, vl);   // x = u*v^7
+
+  fe25519_pow22523(&r->X, &r->X, vl);
+  fe25519_mul (&r->X, &r->X, &v3, vl);
+  fe25519_mul (&r->X, &r->X, &u, vl);   // x = u*v^3*(u*v^7)^((p-5)/8)
+
+  fe25519_sq  (&vxx, &r->X, vl);
+  fe25519_mul (&vxx, &vxx, &v, vl);
+
+  // v*x^2 == u: x is a root, v*x^2 == -u: x*sqrt(-1) is a root
+  fe25519_sub (&t, &vxx, &u, vl);
+  fe25519_add (&u, &vxx, &u, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    valid[i] = 1;
+    sel[i]   = 0;
+    if (!fe25519_iszero_lane(&t, i)) {
+      if (fe25519_iszero_lane(&u, i)) {
+        sel[i] = 1;
+      } else {
+        valid[i] = 0;
+      }
+    }
+  }
+
+  fe25519_set  (&t, kSqrtM1, vl);
+  fe25519_mul  (&t, &r->X, &t, vl);
+  fe25519_cmov (&r->X, &t, sel, vl);
+
+  // pick the root whose parity matches the sign bit, reject y >= p and
+  // the non-canonical encoding of x = 0 with sign bit set
+  for (size_t i = 0; i < vl; i++) {
+    uint32_t sign = s[i][31] >> 7;
+
+    fe25519_tobytes(b, &r->Y, i);
+    b[31] |= sign << 7;
+    if (memcmp(b, s[i], 32)) {
+      valid[i] = 0;
+    }
+
+    fe25519_tobytes(b, &r->X, i);
+    if (sign && fe25519_iszero_lane(&r->X, i)) {
+      valid[i] = 0;
+    }
+    sel[i] = (b[0] & 1) ^ sign;
+  }
+
+  fe25519_neg  (&t, &r->X, vl);
+  fe25519_cmov (&r->X, &t, sel, vl);
+  fe25519_mul  (&r->T, &r->X, &r->Y, vl);
+}
+
+void ge25519_tobytes(uint8_t (*s)[32], const ge25519_t* p, size_t vl) {
+  fe25519_t zi, x, y;
+  uint8_t   b [32];
+
+  fe25519_invert (&zi, &p->Z, vl);
+  fe25519_mul    (&x, &p->X, &zi, vl);
+  fe25519_mul    (&y, &p->Y, &zi, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    fe25519_tobytes(s[i], &y, i);
+    fe25519_tobytes(b, &x, i);
+    s[i][31] ^= (b[0] & 1) << 7;
+  }
+}
@@ -0,0 +1,4 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  sha_benchmark/sha512.c \
+  sha_benchmark/zvknh.s
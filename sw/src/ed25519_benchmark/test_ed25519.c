@@ -0,0 +1,224 @@
+/*
+ * File      : test_ed25519.c
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of X25519 and Ed25519 signature
+ * verification, single operations against batches with one operation per
+ * vector lane.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/curve25519/api_ed25519.h"
+#include "crypto/curve25519/api_x25519.h"
+#include "crypto/curve25519/fe25519.h"
+
+#include "ed25519_vectors.h"
+
+#define X25519_BATCH  FE25519_LANES
+
+typedef struct {
+  perf_log_t x25519_single;
+  perf_log_t x25519_batch;
+  perf_log_t ed25519_single;
+  perf_log_t ed25519_batch;
+} ed25519_perf_log_t;
+
+static ed25519_perf_log_t perf_log = {0};
+
+static uint8_t x25519_scalars [X25519_BATCH][X25519_BYTES];
+static uint8_t x25519_points  [X25519_BATCH][X25519_BYTES];
+static uint8_t x25519_outputs [X25519_BATCH][X25519_BYTES];
+
+static ed25519_item_t bad_items  [ED25519_TEST_ITEMS];
+static uint8_t        bad_sigs   [2][ED25519_SIGNATURE_BYTES];
+static int            ed25519_results [ED25519_TEST_ITEMS];
+
+static uint32_t test_x25519(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  uint8_t  out [X25519_BYTES];
+
+  // known answers
+  x25519(out, x25519_rfc_scalar, x25519_rfc_point);
+  fail += memcmp(out, x25519_rfc_result, X25519_BYTES) != 0;
+
+  x25519_base(out, x25519_alice_sk);
+  fail += memcmp(out, x25519_alice_pk, X25519_BYTES) != 0;
+
+  if (fail) {
+    printf("# X25519: known answer test failed!\n");
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# X25519 single test %d/%d:\n", i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = x25519(out, x25519_alice_sk, x25519_bob_pk);
+    volatile uint64_t x_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t x_ccount = test_rdcycle() - start_cycles;
+    perf_log.x25519_single.icount[i] = x_icount;
+    perf_log.x25519_single.ccount[i] = x_ccount;
+
+    printf("#\tinstret = %020lu\n", x_icount);
+    printf("#\tcycles  = %020lu\n", x_ccount);
+
+    fail += (ret != X25519_OK) || memcmp(out, x25519_shared, X25519_BYTES);
+  }
+
+  // both sides of the key exchange, alternating between the lanes
+  for (int i = 0; i < X25519_BATCH; i++) {
+    memcpy(x25519_scalars[i], (i & 1) ? x25519_bob_sk   : x25519_alice_sk, X25519_BYTES);
+    memcpy(x25519_points[i],  (i & 1) ? x25519_alice_pk : x25519_bob_pk,   X25519_BYTES);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# X25519 batch (%d) test %d/%d:\n", X25519_BATCH, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t zero = x25519_batch(x25519_outputs, (const uint8_t (*)[X25519_BYTES])(x25519_scalars),
+                               (const uint8_t (*)[X25519_BYTES])(x25519_points), X25519_BATCH);
+    volatile uint64_t x_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t x_ccount = test_rdcycle() - start_cycles;
+    perf_log.x25519_batch.icount[i] = x_icount;
+    perf_log.x25519_batch.ccount[i] = x_ccount;
+
+    printf("#\tinstret = %020lu\n", x_icount);
+    printf("#\tcycles  = %020lu\n", x_ccount);
+    printf("#\tcycles/op = %lu\n", x_ccount / X25519_BATCH);
+
+    fail += (zero != 0);
+    for (int j = 0; j < X25519_BATCH; j++) {
+      fail += memcmp(x25519_outputs[j], x25519_shared, X25519_BYTES) != 0;
+    }
+  }
+
+  perf_log.x25519_single.ccount_average = average_count(perf_log.x25519_single.ccount);
+  perf_log.x25519_single.icount_average = average_count(perf_log.x25519_single.icount);
+  perf_log.x25519_batch.ccount_average  = average_count(perf_log.x25519_batch.ccount);
+  perf_log.x25519_batch.icount_average  = average_count(perf_log.x25519_batch.icount);
+
+  return fail;
+}
+
+static uint32_t test_ed25519(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# Ed25519 single verify test %d/%d:\n", i+1, num_tests);
+
+    const ed25519_item_t* item = &ed25519_items[i % ED25519_TEST_ITEMS];
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = ed25519_verify(item->sig, item->msg, item->msg_len, item->pk);
+    volatile uint64_t ed_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ed_ccount = test_rdcycle() - start_cycles;
+    perf_log.ed25519_single.icount[i] = ed_icount;
+    perf_log.ed25519_single.ccount[i] = ed_ccount;
+
+    printf("#\tresult  = %d\n", ret);
+    printf("#\tinstret = %020lu\n", ed_icount);
+    printf("#\tcycles  = %020lu\n", ed_ccount);
+
+    fail += (ret != ED25519_OK);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# Ed25519 batch (%d) verify test %d/%d:\n", ED25519_TEST_ITEMS, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t bad = ed25519_verify_batch(ed25519_items, ed25519_results, ED25519_TEST_ITEMS);
+    volatile uint64_t ed_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t ed_ccount = test_rdcycle() - start_cycles;
+    perf_log.ed25519_batch.icount[i] = ed_icount;
+    perf_log.ed25519_batch.ccount[i] = ed_ccount;
+
+    printf("#\tfailed  = %lu\n", bad);
+    printf("#\tinstret = %020lu\n", ed_icount);
+    printf("#\tcycles  = %020lu\n", ed_ccount);
+    printf("#\tcycles/op = %lu\n", ed_ccount / ED25519_TEST_ITEMS);
+
+    fail += (bad != 0);
+  }
+
+  // a corrupted R (item 1) and S (item 2) must be pinpointed within the batch
+  memcpy(bad_items, ed25519_items, sizeof(bad_items));
+  memcpy(bad_sigs[0], ed25519_items[1].sig, ED25519_SIGNATURE_BYTES);
+  memcpy(bad_sigs[1], ed25519_items[2].sig, ED25519_SIGNATURE_BYTES);
+  bad_sigs[0][5]  ^= 0x01;
+  bad_sigs[1][40] ^= 0x01;
+  bad_items[1].sig = bad_sigs[0];
+  bad_items[2].sig = bad_sigs[1];
+
+  ed25519_verify_batch(bad_items, ed25519_results, ED25519_TEST_ITEMS);
+
+  for (int i = 0; i < ED25519_TEST_ITEMS; i++) {
+    int expected = (i == 1 || i == 2) ? ED25519_ERR_MISMATCH : ED25519_OK;
+    if (ed25519_results[i] != expected) {
+      printf("# Ed25519: unexpected result %d for corrupted batch item %d!\n",
+             ed25519_results[i], i);
+      fail++;
+    }
+  }
+
+  perf_log.ed25519_single.ccount_average = average_count(perf_log.ed25519_single.ccount);
+  perf_log.ed25519_single.icount_average = average_count(perf_log.ed25519_single.icount);
+  perf_log.ed25519_batch.ccount_average  = average_count(perf_log.ed25519_batch.ccount);
+  perf_log.ed25519_batch.icount_average  = average_count(perf_log.ed25519_batch.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for X25519 and Ed25519 (%lu lanes per batch)\n", fe25519_lanes());
+
+  fail += test_x25519(TEST_COUNT);
+  fail += test_ed25519(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tX25519:\n");
+  printf("#\tx25519_single.icount  = %05lu\n", perf_log.x25519_single.icount_average);
+  printf("#\tx25519_single.ccount  = %05lu\n", perf_log.x25519_single.ccount_average);
+  printf("#\tx25519_batch.icount   = %05lu\n", perf_log.x25519_batch.icount_average);
+  printf("#\tx25519_batch.ccount   = %05lu\n", perf_log.x25519_batch.ccount_average);
+
+  printf("#\tEd25519:\n");
+  printf("#\ted25519_single.icount = %05lu\n", perf_log.ed25519_single.icount_average);
+  printf("#\ted25519_single.ccount = %05lu\n", perf_log.ed25519_single.ccount_average);
+  printf("#\ted25519_batch.icount  = %05lu\n", perf_log.ed25519_batch.icount_average);
+  printf("#\ted25519_batch.ccount  = %05lu\n", perf_log.ed25519_batch.ccount_average);
+
+  bench_record_log("x25519 single",         0, 1, &perf_log.x25519_single);
+  bench_record_log("x25519 batch",          0, 1, &perf_log.x25519_batch);
+  bench_record_log("ed25519 verify single", 0, 1, &perf_log.ed25519_single);
+  bench_record_log("ed25519 verify batch",  0, 1, &perf_log.ed25519_batch);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,123 @@
+/*
+ * File      : x25519.c
+ * Test      : ed25519_benchmark
+ * Date      : 19-oct-2026
+ * Description: X25519 (RFC 7748) with the Montgomery ladder running on all
+ * vector lanes at once, each lane with its own scalar and u-coordinate.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/curve25519/api_x25519.h"
+#include "crypto/curve25519/fe25519.h"
+
+// (A - 2) / 4 for curve25519
+#define X25519_A24  121665
+
+static void x25519_lanes(uint8_t (*out)[X25519_BYTES], const uint8_t (*scalar)[X25519_BYTES],
+                         const uint8_t (*point)[X25519_BYTES], size_t vl) {
+
+  fe25519_t x1, x2, z2, x3, z3;
+  fe25519_t a, aa, b, bb, e, c, d;
+  uint8_t   k    [FE25519_LANES][X25519_BYTES];
+  uint32_t  bit  [FE25519_LANES];
+  uint32_t  swap [FE25519_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    memcpy(k[i], scalar[i], X25519_BYTES);
+    k[i][0]  &= 248;
+    k[i][31] &= 127;
+    k[i][31] |= 64;
+    swap[i]   = 0;
+    fe25519_frombytes(&x1, i, point[i]);
+  }
+
+  fe25519_1    (&x2, vl);
+  fe25519_0    (&z2, vl);
+  fe25519_copy (&x3, &x1, vl);
+  fe25519_1    (&z3, vl);
+
+  for (int t = 254; t >= 0; t--) {
+
+    // swap (x2, z2) and (x3, z3) in the lanes where the scalar bit changed
+    for (size_t i = 0; i < vl; i++) {
+      bit[i]   = (k[i][t >> 3] >> (t & 7)) & 1;
+      swap[i] ^= bit[i];
+    }
+    fe25519_cswap(&x2, &x3, swap, vl);
+    fe25519_cswap(&z2, &z3, swap, vl);
+    memcpy(swap, bit, vl * sizeof(uint32_t));
+
+    fe25519_add (&a, &x2, &z2, vl);
+    fe25519_sq  (&aa, &a, vl);
+    fe25519_sub (&b, &x2, &z2, vl);
+    fe25519_sq  (&bb, &b, vl);
+    fe25519_sub (&e, &aa, &bb, vl);
+    fe25519_add (&c, &x3, &z3, vl);
+    fe25519_sub (&d, &x3, &z3, vl);
+    fe25519_mul (&d, &d, &a, vl);             // DA
+    fe25519_mul (&c, &c, &b, vl);             // CB
+
+    fe25519_add (&x3, &d, &c, vl);
+    fe25519_sq  (&x3, &x3, vl);
+    fe25519_sub (&z3, &d, &c, vl);
+    fe25519_sq  (&z3, &z3, vl);
+    fe25519_mul (&z3, &z3, &x1, vl);
+    fe25519_mul (&x2, &aa, &bb, vl);
+    fe25519_mul_small(&z2, &e, X25519_A24, vl);
+    fe25519_add (&z2, &z2, &aa, vl);
+    fe25519_mul (&z2, &z2, &e, vl);
+  }
+
+  fe25519_cswap  (&x2, &x3, swap, vl);
+  fe25519_cswap  (&z2, &z3, swap, vl);
+
+  fe25519_invert (&z2, &z2, vl);
+  fe25519_mul    (&x2, &x2, &z2, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    fe25519_tobytes(out[i], &x2, i);
+  }
+}
+
+static int x25519_is_zero(const uint8_t out[X25519_BYTES]) {
+  uint8_t acc = 0;
+  for (int i = 0; i < X25519_BYTES; i++) {
+    acc |= out[i];
+  }
+  return acc == 0;
+}
+
+int x25519(uint8_t out[X25519_BYTES], const uint8_t scalar[X25519_BYTES],
+           const uint8_t point[X25519_BYTES]) {
+
+  x25519_lanes((uint8_t (*)[X25519_BYTES])(out), (const uint8_t (*)[X25519_BYTES])(scalar),
+               (const uint8_t (*)[X25519_BYTES])(point), 1);
+
+  return x25519_is_zero(out) ? X25519_ERR_ZERO : X25519_OK;
+}
+
+void x25519_base(uint8_t out[X25519_BYTES], const uint8_t scalar[X25519_BYTES]) {
+  static const uint8_t base[X25519_BYTES] = {9};
+  x25519(out, scalar, base);
+}
+
+size_t x25519_batch(uint8_t (*out)[X25519_BYTES], const uint8_t (*scalar)[X25519_BYTES],
+                    const uint8_t (*point)[X25519_BYTES], size_t n) {
+
+  size_t lanes = fe25519_lanes();
+  size_t zero  = 0;
+
+  for (size_t i = 0; i < n; i += lanes) {
+    size_t vl = (n - i) < lanes ? (n - i) : lanes;
+    x25519_lanes(out + i, scalar + i, point + i, vl);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    zero += x25519_is_zero(out[i]);
+  }
+
+  return zero;
+}
@@ -0,0 +1,463 @@
+/*
+ * File      : esp.c
+ * Test      : esp_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched ESP encapsulation/decapsulation with AES-GCM.
+ * The counter blocks of all packets of a batch are packed back to back into
+ * e32m4 strips, so that short packets share the AES rounds of one vector
+ * register group. GHASH runs one packet per element group with vghsh, the
+ * packets sorted by length so that the active ones always form a prefix.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/aes/zvkned.h"
+#include "crypto/esp/api_esp.h"
+
+//! Upper bound of blocks per strip (e32m4 at VLEN=512)
+#define ESP_STRIP_BLOCKS  16
+
+#define ESP_NONCE_BYTES   (ESP_SALT_BYTES + ESP_IV_BYTES)
+
+/*
+ * Counter blocks of one strip, encrypted in place into keystream. The
+ * round keys are gathered per block from the SA table when the strip
+ * mixes SAs, otherwise the round keys are broadcast with the .vs forms.
+ */
+typedef struct {
+  uint32_t ctr [ESP_STRIP_BLOCKS][4];
+  uint32_t rko [ESP_STRIP_BLOCKS][4];   // byte offsets of the round keys in the SA table
+  uint8_t  lane[ESP_STRIP_BLOCKS];      // batch lane of every block
+  uint32_t blk [ESP_STRIP_BLOCKS];      // 0: J0, i > 0: payload block i-1
+  uint16_t sa;
+  uint32_t nr;
+  int      mixed;
+  size_t   n;
+} esp_strip_t;
+
+typedef struct {
+  esp_pkt_t* pkt  [ESP_LANES];
+  uint32_t   clen [ESP_LANES];                   // encrypted length with trailer
+  uint8_t    s    [ESP_LANES][AES_BLOCK_BYTES];  // GHASH of AAD and ciphertext
+  uint8_t    ej0  [ESP_LANES][AES_BLOCK_BYTES];  // E(K, J0)
+  size_t     n;
+} esp_batch_t;
+
+static inline uint32_t load_be32(const uint8_t* p) {
+  return ((uint32_t)p[0] << 24) | ((uint32_t)p[1] << 16) | ((uint32_t)p[2] << 8) | p[3];
+}
+
+static inline void store_be32(uint8_t* p, uint32_t x) {
+  p[0] = x >> 24;
+  p[1] = x >> 16;
+  p[2] = x >> 8;
+  p[3] = x;
+}
+
+static size_t esp_strip_blocks(void) {
+  size_t blocks = __riscv_vsetvlmax_e32m4() / 4;
+  return blocks < ESP_STRIP_BLOCKS ? blocks : ESP_STRIP_BLOCKS;
+}
+
+static void aes_strip(const esp_sa_t* sad, esp_strip_t* st) {
+  size_t      vl = 4 * st->n;
+  vuint32m4_t x  = __riscv_vle32_v_u32m4(&st->ctr[0][0], vl);
+
+  if (!st->mixed) {
+    const uint32_t* rk = sad[st->sa].rk;
+
+    x = __riscv_vaesz_vs_u32m1_u32m4(x, __riscv_vle32_v_u32m1(rk, 4), vl);
+    for (uint32_t r = 1; r < st->nr; r++) {
+      x = __riscv_vaesem_vs_u32m1_u32m4(x, __riscv_vle32_v_u32m1(rk + 4 * r, 4), vl);
+    }
+    x = __riscv_vaesef_vs_u32m1_u32m4(x, __riscv_vle32_v_u32m1(rk + 4 * st->nr, 4), vl);
+  } else {
+    const uint32_t* base = (const uint32_t*)sad;
+    vuint32m4_t     off  = __riscv_vle32_v_u32m4(&st->rko[0][0], vl);
+
+    // vaesz only exists as .vs, the first round key addition is a plain xor
+    x = __riscv_vxor_vv_u32m4(x, __riscv_vluxei32_v_u32m4(base, off, vl), vl);
+    for (uint32_t r = 1; r < st->nr; r++) {
+      off = __riscv_vadd_vx_u32m4(off, AES_BLOCK_BYTES, vl);
+      x   = __riscv_vaesem_vv_u32m4(x, __riscv_vluxei32_v_u32m4(base, off, vl), vl);
+    }
+    off = __riscv_vadd_vx_u32m4(off, AES_BLOCK_BYTES, vl);
+    x   = __riscv_vaesef_vv_u32m4(x, __riscv_vluxei32_v_u32m4(base, off, vl), vl);
+  }
+
+  __riscv_vse32_v_u32m4(&st->ctr[0][0], x, vl);
+}
+
+static void xor_run(uint8_t* p, const uint8_t* ks, size_t len) {
+  size_t vl;
+  for (; len > 0; len -= vl, p += vl, ks += vl) {
+    vl = __riscv_vsetvl_e8m4(len);
+    vuint8m4_t a = __riscv_vle8_v_u8m4(p, vl);
+    vuint8m4_t k = __riscv_vle8_v_u8m4(ks, vl);
+    __riscv_vse8_v_u8m4(p, __riscv_vxor_vv_u8m4(a, k, vl), vl);
+  }
+}
+
+static int tag_equal(const uint8_t* a, const uint8_t* b) {
+  uint8_t d = 0;
+  for (int i = 0; i < ESP_ICV_BYTES; i++) {
+    d |= a[i] ^ b[i];
+  }
+  return d == 0;
+}
+
+/*
+ * Apply the keystream of a strip: the J0 block of a packet yields E(K, J0),
+ * which completes the tag, and every run of payload blocks of one packet is
+ * xored in a single strip-mined pass. When verifying, the tag is checked
+ * before the payload of the packet is touched.
+ */
+static void strip_flush(const esp_sa_t* sad, esp_strip_t* st, esp_batch_t* b, int verify) {
+  size_t i = 0;
+
+  if (st->n == 0) {
+    return;
+  }
+  aes_strip(sad, st);
+
+  while (i < st->n) {
+    size_t     l   = st->lane[i];
+    esp_pkt_t* pkt = b->pkt[l];
+
+    if (st->blk[i] == 0) {
+      memcpy(b->ej0[l], st->ctr[i], AES_BLOCK_BYTES);
+      if (verify) {
+        for (int k = 0; k < AES_BLOCK_BYTES; k++) {
+          b->s[l][k] ^= b->ej0[l][k];
+        }
+        if (!tag_equal(b->s[l], pkt->payload + b->clen[l])) {
+          pkt->status = ESP_ERR_ICV;
+        }
+      }
+      i++;
+      continue;
+    }
+
+    size_t j = i;
+    while (j < st->n && st->lane[j] == l) {
+      j++;
+    }
+    if (pkt->status == ESP_OK) {
+      size_t off = (st->blk[i] - 1) * AES_BLOCK_BYTES;
+      size_t end = (st->blk[j - 1]) * AES_BLOCK_BYTES;
+      end = end < b->clen[l] ? end : b->clen[l];
+      xor_run(pkt->payload + off, (const uint8_t*)st->ctr[i], end - off);
+    }
+    i = j;
+  }
+
+  st->n = 0;
+}
+
+// CTR over the J0 block and the payload of every packet of the batch
+static void ctr_batch(const esp_sa_t* sad, esp_batch_t* b, int verify) {
+  esp_strip_t st;
+  size_t      strip = esp_strip_blocks();
+
+  st.n = 0;
+
+  for (size_t l = 0; l < b->n; l++) {
+    esp_pkt_t*      pkt = b->pkt[l];
+    const esp_sa_t* sa  = &sad[pkt->sa];
+    uint32_t        nblk = 1 + (b->clen[l] + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+
+    for (uint32_t k = 0; k < nblk; k++) {
+      if (st.n == strip || (st.n && st.nr != sa->nr)) {
+        strip_flush(sad, &st, b, verify);
+      }
+      if (st.n == 0) {
+        st.sa    = pkt->sa;
+        st.nr    = sa->nr;
+        st.mixed = 0;
+      }
+      st.mixed |= (st.sa != pkt->sa);
+
+      uint8_t* c = (uint8_t*)st.ctr[st.n];
+      memcpy    (c, sa->salt, ESP_SALT_BYTES);
+      memcpy    (c + ESP_SALT_BYTES, pkt->hdr + ESP_HDR_BYTES, ESP_IV_BYTES);
+      store_be32(c + ESP_NONCE_BYTES, k + 1);
+
+      uint32_t off = pkt->sa * sizeof(esp_sa_t) + offsetof(esp_sa_t, rk);
+      for (int e = 0; e < 4; e++) {
+        st.rko[st.n][e] = off + 4 * e;
+      }
+      st.lane[st.n] = l;
+      st.blk [st.n] = k;
+      st.n++;
+    }
+  }
+
+  strip_flush(sad, &st, b, verify);
+}
+
+// block j of the GHASH input: AAD (SPI, sequence number), ciphertext, lengths
+static void ghash_block(uint8_t x[AES_BLOCK_BYTES], const esp_pkt_t* pkt, uint32_t clen, uint32_t j) {
+  uint32_t nc = (clen + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+
+  memset(x, 0, AES_BLOCK_BYTES);
+  if (j == 0) {
+    memcpy(x, pkt->hdr, ESP_HDR_BYTES);
+  } else if (j <= nc) {
+    uint32_t off = (j - 1) * AES_BLOCK_BYTES;
+    uint32_t len = clen - off < AES_BLOCK_BYTES ? clen - off : AES_BLOCK_BYTES;
+    memcpy(x, pkt->payload + off, len);
+  } else {
+    store_be32(x + 4,  ESP_HDR_BYTES * 8);
+    store_be32(x + 8,  clen >> 29);
+    store_be32(x + 12, clen << 3);
+  }
+}
+
+static void ghash_batch(const esp_sa_t* sad, esp_batch_t* b) {
+  uint32_t h     [ESP_LANES][4];
+  uint32_t x     [ESP_LANES][4];
+  uint32_t y     [ESP_LANES][4];
+  uint32_t nblk  [ESP_LANES];
+  uint8_t  order [ESP_LANES];
+
+  // sort by number of blocks (descending), finished lanes drop off the end
+  for (size_t l = 0; l < b->n; l++) {
+    uint32_t nb = 2 + (b->clen[l] + AES_BLOCK_BYTES - 1) / AES_BLOCK_BYTES;
+    size_t   k  = l;
+    for (; k > 0 && nblk[k - 1] < nb; k--) {
+      nblk [k] = nblk [k - 1];
+      order[k] = order[k - 1];
+    }
+    nblk [k] = nb;
+    order[k] = l;
+  }
+
+  for (size_t k = 0; k < b->n; k++) {
+    memcpy(h[k], sad[b->pkt[order[k]]->sa].h, AES_BLOCK_BYTES);
+  }
+
+  size_t      active = b->n;
+  size_t      vl     = 4 * active;
+  vuint32m4_t hv     = __riscv_vle32_v_u32m4(&h[0][0], vl);
+  vuint32m4_t yv     = __riscv_vmv_v_x_u32m4(0, vl);
+
+  for (uint32_t j = 0; active > 0; j++) {
+
+    for (size_t k = 0; k < active; k++) {
+      ghash_block((uint8_t*)x[k], b->pkt[order[k]], b->clen[order[k]], j);
+    }
+    yv = __riscv_vghsh_vv_u32m4(yv, hv, __riscv_vle32_v_u32m4(&x[0][0], vl), vl);
+
+    // keep the state of the lanes that are done before vl shrinks
+    size_t next = active;
+    while (next > 0 && nblk[next - 1] == j + 1) {
+      next--;
+    }
+    if (next != active) {
+      __riscv_vse32_v_u32m4(&y[0][0], yv, vl);
+      active = next;
+      vl     = 4 * active;
+    }
+  }
+
+  for (size_t k = 0; k < b->n; k++) {
+    memcpy(b->s[order[k]], y[k], AES_BLOCK_BYTES);
+  }
+}
+
+int esp_sa_init(esp_sa_t* sa, uint32_t spi, const uint8_t* key, size_t key_bits,
+                const uint8_t salt[ESP_SALT_BYTES]) {
+  uint64_t    k [AES_256_KEY_BYTES / 8];
+  esp_strip_t st;
+
+  memset(sa, 0, sizeof(*sa));
+
+  if (key_bits == AES128_BITS) {
+    memcpy(k, key, AES_128_KEY_BYTES);
+    zvkned_aes128_expand_key(sa->rk, k);
+    sa->nr = AES_128_NR;
+  } else if (key_bits == AES256_BITS) {
+    memcpy(k, key, AES_256_KEY_BYTES);
+    zvkned_aes256_expand_key(sa->rk, k);
+    sa->nr = AES_256_NR;
+  } else {
+    return ESP_ERR_KEY;
+  }
+
+  sa->spi = spi;
+  memcpy(sa->salt, salt, ESP_SALT_BYTES);
+
+  // hash subkey H = E(K, 0^128)
+  memset(st.ctr[0], 0, AES_BLOCK_BYTES);
+  st.n     = 1;
+  st.sa    = 0;
+  st.nr    = sa->nr;
+  st.mixed = 0;
+  aes_strip(sa, &st);
+  memcpy(sa->h, st.ctr[0], AES_BLOCK_BYTES);
+
+  return ESP_OK;
+}
+
+/*
+ * RFC 4303, appendix A: the window covers the ESP_REPLAY_WINDOW sequence
+ * numbers up to the highest one received.
+ */
+static int replay_check(const esp_sa_t* sa, uint32_t seq) {
+  if (seq == 0) {
+    return 0;
+  }
+  if (seq > sa->seq) {
+    return 1;
+  }
+  uint32_t diff = sa->seq - seq;
+  return diff < ESP_REPLAY_WINDOW && !((sa->replay >> diff) & 1);
+}
+
+static void replay_update(esp_sa_t* sa, uint32_t seq) {
+  if (seq > sa->seq) {
+    uint32_t shift = seq - sa->seq;
+    sa->replay = shift < ESP_REPLAY_WINDOW ? (sa->replay << shift) | 1 : 1;
+    sa->seq    = seq;
+  } else {
+    sa->replay |= (uint64_t)1 << (sa->seq - seq);
+  }
+}
+
+static size_t esp_batch_lanes(void) {
+  size_t lanes = __riscv_vsetvlmax_e32m4() / 4;
+  return lanes < ESP_LANES ? lanes : ESP_LANES;
+}
+
+size_t esp_encap_batch(esp_sa_t* sad, esp_pkt_t* pkts, size_t n) {
+  esp_batch_t b;
+  size_t      lanes = esp_batch_lanes();
+  size_t      fail  = 0;
+
+  for (size_t p = 0; p < n; ) {
+
+    // sequence number, header and trailer
+    for (b.n = 0; b.n < lanes && p < n; p++) {
+      esp_pkt_t* pkt = &pkts[p];
+      esp_sa_t*  sa  = &sad[pkt->sa];
+
+      if (sa->seq == UINT32_MAX) {
+        pkt->status = ESP_ERR_SEQ;
+        fail++;
+        continue;
+      }
+      pkt->status = ESP_OK;
+      sa->seq++;
+
+      store_be32(pkt->hdr, sa->spi);
+      store_be32(pkt->hdr + 4, sa->seq);
+      memset    (pkt->hdr + ESP_HDR_BYTES, 0, 4);
+      store_be32(pkt->hdr + ESP_HDR_BYTES + 4, sa->seq);
+
+      // payload, padding and the two trailer bytes end on a 4 byte boundary
+      uint32_t pad = (4 - ((pkt->len + 2) & 3)) & 3;
+      for (uint32_t i = 0; i < pad; i++) {
+        pkt->payload[pkt->len + i] = i + 1;
+      }
+      pkt->payload[pkt->len + pad]     = pad;
+      pkt->payload[pkt->len + pad + 1] = pkt->next_hdr;
+
+      b.pkt [b.n] = pkt;
+      b.clen[b.n] = pkt->len + pad + 2;
+      b.n++;
+    }
+
+    if (b.n == 0) {
+      continue;
+    }
+
+    ctr_batch  (sad, &b, 0);
+    ghash_batch(sad, &b);
+
+    for (size_t l = 0; l < b.n; l++) {
+      uint8_t* icv = b.pkt[l]->payload + b.clen[l];
+      for (int k = 0; k < ESP_ICV_BYTES; k++) {
+        icv[k] = b.s[l][k] ^ b.ej0[l][k];
+      }
+      b.pkt[l]->len = b.clen[l];
+    }
+  }
+
+  return fail;
+}
+
+size_t esp_decap_batch(esp_sa_t* sad, esp_pkt_t* pkts, size_t n) {
+  esp_batch_t b;
+  size_t      lanes = esp_batch_lanes();
+  size_t      fail  = 0;
+
+  for (size_t p = 0; p < n; ) {
+
+    // cheap checks first, packets failing them are not decrypted at all
+    for (b.n = 0; b.n < lanes && p < n; p++) {
+      esp_pkt_t* pkt = &pkts[p];
+      esp_sa_t*  sa  = &sad[pkt->sa];
+
+      if (load_be32(pkt->hdr) != sa->spi) {
+        pkt->status = ESP_ERR_SPI;
+      } else if (!replay_check(sa, load_be32(pkt->hdr + 4))) {
+        pkt->status = ESP_ERR_REPLAY;
+      } else if (pkt->len < 2) {
+        pkt->status = ESP_ERR_PAD;
+      } else {
+        pkt->status = ESP_OK;
+        b.pkt [b.n] = pkt;
+        b.clen[b.n] = pkt->len;
+        b.n++;
+        continue;
+      }
+      fail++;
+    }
+
+    if (b.n == 0) {
+      continue;
+    }
+
+    ghash_batch(sad, &b);
+    ctr_batch  (sad, &b, 1);
+
+    // window update in packet order, a duplicate within the batch is a replay
+    for (size_t l = 0; l < b.n; l++) {
+      esp_pkt_t* pkt = b.pkt[l];
+      esp_sa_t*  sa  = &sad[pkt->sa];
+      uint32_t   seq = load_be32(pkt->hdr + 4);
+
+      if (pkt->status == ESP_OK) {
+        if (!replay_check(sa, seq)) {
+          pkt->status = ESP_ERR_REPLAY;
+        } else {
+          replay_update(sa, seq);
+
+          uint32_t pad = pkt->payload[b.clen[l] - 2];
+          if (pad + 2 > b.clen[l]) {
+            pkt->status = ESP_ERR_PAD;
+          } else {
+            uint32_t len = b.clen[l] - 2 - pad;
+            for (uint32_t i = 0; i < pad; i++) {
+              if (pkt->payload[len + i] != i + 1) {
+                pkt->status = ESP_ERR_PAD;
+                break;
+              }
+            }
+            if (pkt->status == ESP_OK) {
+              pkt->next_hdr = pkt->payload[b.clen[l] - 1];
+              pkt->len      = len;
+            }
+          }
+        }
+      }
+      fail += (pkt->status != ESP_OK);
+    }
+  }
+
+  return fail;
+}
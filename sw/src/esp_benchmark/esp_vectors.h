@@ -0,0 +1,104 @@
+/*
+ * File      : esp_vectors.h
+ * Test      : esp_benchmark
+ * Date      : 19-oct-2026
+ * Description: ESP/AES-GCM test vectors. The expected ICVs were computed
+ * with an independent AES-GCM model (checked against the GCM specification
+ * test cases) over the packets built by test_esp.c.
+ */
+
+#ifndef __ESP_VECTORS_H__
+#define __ESP_VECTORS_H__
+
+#include <stdint.h>
+
+#include "crypto/esp/api_esp.h"
+
+#define ESP_TEST_SAS   4
+#define ESP_TEST_PKTS  16
+
+// SA keys: three AES-128 SAs and one AES-256 SA
+static const uint8_t esp_key_0 [16] = {
+  0x8f, 0x09, 0x80, 0x1b, 0x54, 0x17, 0xd2, 0x98, 0x61, 0x9b, 0x19, 0x2d,
+  0x8e, 0xb5, 0xb0, 0xa2
+};
+
+static const uint8_t esp_key_1 [16] = {
+  0xc0, 0xda, 0x9a, 0x54, 0x89, 0x66, 0xe7, 0x8d, 0x03, 0x84, 0x77, 0x00,
+  0x29, 0x7a, 0xe6, 0xdd
+};
+
+static const uint8_t esp_key_2 [16] = {
+  0x13, 0x16, 0x68, 0xc8, 0xdf, 0x70, 0x75, 0xf5, 0xc4, 0xd4, 0xd6, 0x81,
+  0xef, 0xc1, 0xa5, 0x88
+};
+
+static const uint8_t esp_key_3 [32] = {
+  0x0b, 0x8e, 0x89, 0xc1, 0x34, 0xbb, 0x9c, 0xed, 0x65, 0x96, 0x9d, 0x2e,
+  0xbb, 0xbc, 0xe9, 0x22, 0xe7, 0x44, 0xd4, 0x3a, 0x70, 0x05, 0x5a, 0xf4,
+  0x2f, 0x0d, 0x76, 0xb4, 0xfc, 0x5c, 0xb3, 0x79
+};
+
+static const uint8_t esp_salt [ESP_TEST_SAS][ESP_SALT_BYTES] = {
+  { 0x4d, 0xd2, 0x60, 0x07 },
+  { 0xc0, 0xa1, 0xb7, 0xd6 },
+  { 0xfe, 0x64, 0x5b, 0x0c },
+  { 0x93, 0xd9, 0x13, 0x56 }
+};
+
+static const uint32_t esp_spi [ESP_TEST_SAS] = { 0x00001001, 0x00001002, 0x00001003, 0x00002001 };
+
+static const uint32_t esp_key_bits [ESP_TEST_SAS] = { 128, 128, 128, 256 };
+
+// inner packet lengths, packet i uses SA i % ESP_TEST_SAS
+static const uint32_t esp_len [ESP_TEST_PKTS] = {
+  40, 64, 1, 100, 200, 576, 17, 33, 1400, 60, 80, 128, 256, 15, 48, 1000
+};
+
+// encrypted payload and trailer of packet 1
+static const uint8_t esp_ct_1 [68] = {
+  0xe0, 0xee, 0xe6, 0xe6, 0x3e, 0x0e, 0x4e, 0xa9, 0x64, 0xe6, 0x70, 0xd7,
+  0x5c, 0xfe, 0xa4, 0x7f, 0x2a, 0x7d, 0x73, 0xb0, 0x64, 0xa7, 0x50, 0x6d,
+  0xeb, 0xc8, 0x13, 0x58, 0xec, 0xf8, 0xc2, 0x87, 0x31, 0x21, 0x21, 0x43,
+  0x36, 0x64, 0xee, 0xda, 0x12, 0x18, 0x63, 0xe5, 0xa1, 0x44, 0x08, 0xc4,
+  0x01, 0x32, 0x81, 0xde, 0x48, 0x5f, 0x04, 0x87, 0x10, 0xa9, 0x5c, 0xe6,
+  0x92, 0xb6, 0xd4, 0xe6, 0x1e, 0x9c, 0xb4, 0xe8
+};
+
+// ICV of every packet
+static const uint8_t esp_icv [ESP_TEST_PKTS][ESP_ICV_BYTES] = {
+  { 0xd3, 0x51, 0xa8, 0x66, 0xe3, 0x66, 0xff, 0xdb,
+    0xcb, 0x84, 0xeb, 0xac, 0x94, 0x63, 0xc8, 0xc3 },
+  { 0xd7, 0x3d, 0x0f, 0x71, 0x86, 0xcb, 0xd9, 0x1f,
+    0x13, 0xec, 0xda, 0x4f, 0xd2, 0x3a, 0xde, 0xc4 },
+  { 0x42, 0xa0, 0x39, 0x8a, 0x0e, 0xf5, 0x33, 0x85,
+    0xc9, 0x39, 0xd6, 0xf3, 0xb8, 0x61, 0xd1, 0xa8 },
+  { 0x12, 0x48, 0xac, 0x31, 0x1c, 0x64, 0xb4, 0x24,
+    0x13, 0x30, 0x53, 0x73, 0xcc, 0xb1, 0xd0, 0x07 },
+  { 0xec, 0xa2, 0x2f, 0xa4, 0x34, 0xf0, 0x51, 0x23,
+    0x07, 0x68, 0x61, 0x9a, 0xbe, 0x34, 0x7c, 0x14 },
+  { 0xec, 0x93, 0xed, 0xe0, 0x84, 0x1d, 0x94, 0xe1,
+    0xbb, 0x57, 0xbf, 0x6a, 0xe2, 0x90, 0xdb, 0x9e },
+  { 0x37, 0x11, 0x9b, 0x02, 0x0b, 0xc2, 0xd8, 0x24,
+    0x42, 0x50, 0x3d, 0xdf, 0xae, 0x92, 0x23, 0x6e },
+  { 0x60, 0x0e, 0xe1, 0x83, 0xad, 0xb0, 0xf7, 0xf4,
+    0x65, 0x64, 0xc8, 0xf3, 0x15, 0x7d, 0x91, 0x86 },
+  { 0xb2, 0xbb, 0x30, 0x34, 0x5f, 0x6c, 0xdf, 0x30,
+    0x6b, 0x17, 0x0f, 0x9b, 0x92, 0xcd, 0xd3, 0x16 },
+  { 0x1d, 0x3d, 0x2e, 0xff, 0x16, 0x35, 0xca, 0xa9,
+    0x65, 0xc5, 0x09, 0x12, 0xa6, 0x34, 0xf8, 0xff },
+  { 0xa5, 0x38, 0x69, 0xac, 0x0a, 0x8b, 0xfc, 0xe8,
+    0xc6, 0xf4, 0xe9, 0x24, 0xa7, 0x85, 0xaf, 0xf3 },
+  { 0xb1, 0xdc, 0x14, 0x60, 0xbc, 0x71, 0x0b, 0xd3,
+    0xd3, 0x4c, 0x01, 0x91, 0x2e, 0xa8, 0x40, 0x64 },
+  { 0xe1, 0x12, 0x13, 0x5b, 0x57, 0x08, 0x23, 0x69,
+    0x18, 0xa9, 0x57, 0x07, 0x9e, 0xb1, 0x58, 0x84 },
+  { 0x38, 0x55, 0x71, 0xdb, 0x23, 0x80, 0x20, 0xfe,
+    0x1e, 0x4f, 0x1f, 0xa4, 0xab, 0x78, 0xbb, 0x3b },
+  { 0xc7, 0x1a, 0x21, 0x42, 0xf9, 0x2d, 0x50, 0x28,
+    0xbf, 0x79, 0x50, 0xc0, 0x18, 0x67, 0x45, 0x27 },
+  { 0x0a, 0xce, 0x23, 0xc3, 0xf4, 0x9d, 0x93, 0x44,
+    0xf9, 0xf9, 0x4d, 0x8b, 0xdf, 0xe6, 0xdb, 0x7d }
+};
+
+#endif // __ESP_VECTORS_H__
@@ -0,0 +1,3 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  aes_benchmark/zvkned.s
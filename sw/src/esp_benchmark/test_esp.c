@@ -0,0 +1,276 @@
+/*
+ * File      : test_esp.c
+ * Test      : esp_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of batched ESP/AES-GCM packet processing,
+ * one call per packet against one call per batch.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/esp/api_esp.h"
+
+#include "esp_vectors.h"
+
+#define ESP_TEST_MTU   1500
+
+// SA i is outbound, SA ESP_TEST_SAS + i the matching inbound SA
+#define ESP_INBOUND(sa) ((sa) + ESP_TEST_SAS)
+
+typedef struct {
+  perf_log_t encap_single;
+  perf_log_t encap_batch;
+  perf_log_t decap_single;
+  perf_log_t decap_batch;
+} esp_perf_log_t;
+
+static esp_perf_log_t perf_log = {0};
+
+static esp_sa_t  sad  [2 * ESP_TEST_SAS];
+static esp_pkt_t pkts [ESP_TEST_PKTS];
+static uint8_t   bufs [ESP_TEST_PKTS][ESP_HDR_BYTES + ESP_IV_BYTES + ESP_TEST_MTU + ESP_TAIL_MAX];
+static uint32_t  wire_len [ESP_TEST_PKTS];
+
+static const uint8_t* const esp_keys [ESP_TEST_SAS] = {
+  esp_key_0, esp_key_1, esp_key_2, esp_key_3
+};
+
+static void setup_sas(void) {
+  for (int i = 0; i < ESP_TEST_SAS; i++) {
+    esp_sa_init(&sad[i], esp_spi[i], esp_keys[i], esp_key_bits[i], esp_salt[i]);
+    esp_sa_init(&sad[ESP_INBOUND(i)], esp_spi[i], esp_keys[i], esp_key_bits[i], esp_salt[i]);
+  }
+}
+
+static void setup_packets(void) {
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    pkts[i].hdr      = bufs[i];
+    pkts[i].payload  = bufs[i] + ESP_HDR_BYTES + ESP_IV_BYTES;
+    pkts[i].len      = esp_len[i];
+    pkts[i].sa       = i % ESP_TEST_SAS;
+    pkts[i].next_hdr = (i & 1) ? 41 : 4;
+    pkts[i].status   = ESP_OK;
+    for (uint32_t k = 0; k < esp_len[i]; k++) {
+      pkts[i].payload[k] = (uint8_t)(k * 7 + 13 * i);
+    }
+  }
+}
+
+// switch the descriptors over to the inbound SAs with the wire lengths
+static void to_inbound(void) {
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    pkts[i].sa       = ESP_INBOUND(i % ESP_TEST_SAS);
+    pkts[i].len      = wire_len[i];
+    pkts[i].next_hdr = 0;
+  }
+}
+
+static uint32_t check_encap(void) {
+  uint32_t fail = 0;
+
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    wire_len[i] = pkts[i].len;
+    if (pkts[i].status != ESP_OK ||
+        memcmp(pkts[i].payload + pkts[i].len, esp_icv[i], ESP_ICV_BYTES)) {
+      printf("# ESP: wrong ICV for packet %d!\n", i);
+      fail++;
+    }
+  }
+  if (memcmp(pkts[1].payload, esp_ct_1, sizeof(esp_ct_1))) {
+    printf("# ESP: wrong ciphertext for packet 1!\n");
+    fail++;
+  }
+
+  return fail;
+}
+
+static uint32_t check_decap(void) {
+  uint32_t fail = 0;
+
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    int ok = pkts[i].status == ESP_OK && pkts[i].len == esp_len[i] &&
+             pkts[i].next_hdr == ((i & 1) ? 41 : 4);
+    for (uint32_t k = 0; ok && k < esp_len[i]; k++) {
+      ok = pkts[i].payload[k] == (uint8_t)(k * 7 + 13 * i);
+    }
+    if (!ok) {
+      printf("# ESP: packet %d not recovered (status %d)!\n", i, pkts[i].status);
+      fail++;
+    }
+  }
+
+  return fail;
+}
+
+static uint32_t test_esp(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ESP encap/decap, one call per packet, test %d/%d:\n", i+1, num_tests);
+
+    setup_sas();
+    setup_packets();
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    for (int p = 0; p < ESP_TEST_PKTS; p++) {
+      esp_encap_batch(sad, &pkts[p], 1);
+    }
+    volatile uint64_t enc_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t enc_ccount = test_rdcycle() - start_cycles;
+    perf_log.encap_single.icount[i] = enc_icount;
+    perf_log.encap_single.ccount[i] = enc_ccount;
+
+    fail += check_encap();
+    to_inbound();
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    for (int p = 0; p < ESP_TEST_PKTS; p++) {
+      esp_decap_batch(sad, &pkts[p], 1);
+    }
+    volatile uint64_t dec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t dec_ccount = test_rdcycle() - start_cycles;
+    perf_log.decap_single.icount[i] = dec_icount;
+    perf_log.decap_single.ccount[i] = dec_ccount;
+
+    fail += check_decap();
+
+    printf("#\tencap cycles = %020lu\n", enc_ccount);
+    printf("#\tdecap cycles = %020lu\n", dec_ccount);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ESP encap/decap, batch of %d packets, test %d/%d:\n", ESP_TEST_PKTS, i+1, num_tests);
+
+    setup_sas();
+    setup_packets();
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t enc_fail = esp_encap_batch(sad, pkts, ESP_TEST_PKTS);
+    volatile uint64_t enc_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t enc_ccount = test_rdcycle() - start_cycles;
+    perf_log.encap_batch.icount[i] = enc_icount;
+    perf_log.encap_batch.ccount[i] = enc_ccount;
+
+    fail += (enc_fail != 0) + check_encap();
+    to_inbound();
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t dec_fail = esp_decap_batch(sad, pkts, ESP_TEST_PKTS);
+    volatile uint64_t dec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t dec_ccount = test_rdcycle() - start_cycles;
+    perf_log.decap_batch.icount[i] = dec_icount;
+    perf_log.decap_batch.ccount[i] = dec_ccount;
+
+    fail += (dec_fail != 0) + check_decap();
+
+    printf("#\tencap cycles = %020lu\n", enc_ccount);
+    printf("#\tdecap cycles = %020lu\n", dec_ccount);
+    printf("#\tcycles/packet = %lu / %lu\n", enc_ccount / ESP_TEST_PKTS, dec_ccount / ESP_TEST_PKTS);
+  }
+
+  perf_log.encap_single.ccount_average = average_count(perf_log.encap_single.ccount);
+  perf_log.encap_single.icount_average = average_count(perf_log.encap_single.icount);
+  perf_log.encap_batch.ccount_average  = average_count(perf_log.encap_batch.ccount);
+  perf_log.encap_batch.icount_average  = average_count(perf_log.encap_batch.icount);
+  perf_log.decap_single.ccount_average = average_count(perf_log.decap_single.ccount);
+  perf_log.decap_single.icount_average = average_count(perf_log.decap_single.icount);
+  perf_log.decap_batch.ccount_average  = average_count(perf_log.decap_batch.ccount);
+  perf_log.decap_batch.icount_average  = average_count(perf_log.decap_batch.icount);
+
+  return fail;
+}
+
+/*
+ * Replays, a forged packet and a duplicate within one batch must be caught
+ * without affecting the other packets of the batch.
+ */
+static uint32_t test_esp_errors(void) {
+  uint32_t fail = 0;
+  uint8_t  dup [sizeof(bufs[0])];
+
+  setup_sas();
+  setup_packets();
+  esp_encap_batch(sad, pkts, ESP_TEST_PKTS);
+  to_inbound();
+
+  // packet 0 is replayed by the copy in packet 4's slot, packet 5 is forged
+  memcpy(dup, bufs[0], sizeof(dup));
+  memcpy(bufs[4], dup, sizeof(dup));
+  pkts[4].len = wire_len[0];
+  pkts[5].payload[3] ^= 0x01;
+
+  esp_decap_batch(sad, pkts, ESP_TEST_PKTS);
+
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    int expected = (i == 4) ? ESP_ERR_REPLAY : (i == 5) ? ESP_ERR_ICV : ESP_OK;
+    if (pkts[i].status != expected) {
+      printf("# ESP: unexpected status %d for packet %d!\n", pkts[i].status, i);
+      fail++;
+    }
+  }
+
+  // a later second delivery of packet 1 must hit the window of its SA
+  memcpy(bufs[1] + ESP_HDR_BYTES + ESP_IV_BYTES, esp_ct_1, sizeof(esp_ct_1));
+  memcpy(bufs[1] + ESP_HDR_BYTES + ESP_IV_BYTES + sizeof(esp_ct_1), esp_icv[1], ESP_ICV_BYTES);
+  pkts[1].len = wire_len[1];
+  esp_decap_batch(sad, &pkts[1], 1);
+  if (pkts[1].status != ESP_ERR_REPLAY) {
+    printf("# ESP: replayed packet 1 accepted!\n");
+    fail++;
+  }
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for ESP AES-GCM (%d packets, %d SAs)\n", ESP_TEST_PKTS, ESP_TEST_SAS);
+
+  fail += test_esp(TEST_COUNT);
+  fail += test_esp_errors();
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tESP:\n");
+  printf("#\tencap_single.icount = %05lu\n", perf_log.encap_single.icount_average);
+  printf("#\tencap_single.ccount = %05lu\n", perf_log.encap_single.ccount_average);
+  printf("#\tencap_batch.icount  = %05lu\n", perf_log.encap_batch.icount_average);
+  printf("#\tencap_batch.ccount  = %05lu\n", perf_log.encap_batch.ccount_average);
+  printf("#\tdecap_single.icount = %05lu\n", perf_log.decap_single.icount_average);
+  printf("#\tdecap_single.ccount = %05lu\n", perf_log.decap_single.ccount_average);
+  printf("#\tdecap_batch.icount  = %05lu\n", perf_log.decap_batch.icount_average);
+  printf("#\tdecap_batch.ccount  = %05lu\n", perf_log.decap_batch.ccount_average);
+
+  // the records carry the payload bytes of the whole packet set
+  size_t bytes = 0;
+  for (int i = 0; i < ESP_TEST_PKTS; i++) {
+    bytes += esp_len[i];
+  }
+  bench_record_log("esp encap single", bytes, 4, &perf_log.encap_single);
+  bench_record_log("esp encap batch",  bytes, 4, &perf_log.encap_batch);
+  bench_record_log("esp decap single", bytes, 4, &perf_log.decap_single);
+  bench_record_log("esp decap batch",  bytes, 4, &perf_log.decap_batch);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,11 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  aes_benchmark/zvkned.s \
+  aes_benchmark/zvkned_iov.c \
+  sha_benchmark/sha256.c \
+  sha_benchmark/sha512.c \
+  sha_benchmark/zvknh.s \
+  sm3_benchmark/sm3_api.c \
+  sm3_benchmark/zvksh.s \
+  sm4_benchmark/zvksed.s \
+  sm4_benchmark/zvksed_iov.c
@@ -0,0 +1,289 @@
+/*
+ * File      : test_iovec.c
+ * Test      : iovec_benchmark
+ * Date      : 19-oct-2026
+ * Description: Checks the scatter-gather cipher and hash variants against
+ * the contiguous kernels, and benchmarks them against staging the segments
+ * into one buffer first.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+#include "crypto/share/iovec.h"
+
+#include "crypto/aes/api_aes.h"
+#include "crypto/aes/zvkned.h"
+#include "crypto/sha/api_sha256.h"
+#include "crypto/sha/api_sha512.h"
+#include "crypto/sm3/sm3_api.h"
+#include "crypto/sm4/sm4_api.h"
+#include "crypto/sm4/zvksed.h"
+
+#define MESSAGE_LEN_BYTES 4096
+#define SEGMENTS          14
+
+typedef struct {
+  perf_log_t aes128_staged;
+  perf_log_t aes128_iov;
+  perf_log_t sha256_staged;
+  perf_log_t sha256_iov;
+} iovec_perf_log_t;
+
+static iovec_perf_log_t perf_log = {0};
+
+// odd lengths so that blocks straddle segments and runs start unaligned
+static const size_t seg_len [SEGMENTS] = {
+  1, 63, 16, 100, 7, 512, 33, 1024, 15, 250, 48, 17, 1, 2009
+};
+
+// the same bytes cut differently, for the output side
+static const size_t out_len [SEGMENTS] = {
+  16, 16, 3, 1200, 77, 64, 64, 64, 1, 1, 1, 13, 2000, 576
+};
+
+static uint8_t message [MESSAGE_LEN_BYTES] __attribute__((aligned(16)));
+static uint8_t staging [MESSAGE_LEN_BYTES] __attribute__((aligned(16)));
+static uint8_t result  [MESSAGE_LEN_BYTES] __attribute__((aligned(16)));
+static uint8_t pool_in [MESSAGE_LEN_BYTES + 4 * SEGMENTS] __attribute__((aligned(16)));
+static uint8_t pool_out[MESSAGE_LEN_BYTES + 4 * SEGMENTS] __attribute__((aligned(16)));
+
+static crypto_iovec_t iov_in  [SEGMENTS];
+static crypto_iovec_t iov_out [SEGMENTS];
+
+static uint32_t aes128_rk [AES_128_RK_WORDS] __attribute__((aligned(16)));
+static uint32_t aes256_rk [AES_256_RK_WORDS] __attribute__((aligned(16)));
+
+// lay the segments out in a pool with gaps of 1..4 bytes between them
+static void setup_iov(crypto_iovec_t* iov, uint8_t* pool, const size_t* len) {
+  size_t off = 0;
+
+  for (int i = 0; i < SEGMENTS; i++) {
+    off += 1 + (i & 3);
+    iov[i].base = pool + off;
+    iov[i].len  = len[i];
+    off += len[i];
+  }
+}
+
+static void scatter_message(const crypto_iovec_t* iov, const uint8_t* in) {
+  for (int i = 0; i < SEGMENTS; i++) {
+    memcpy(iov[i].base, in, iov[i].len);
+    in += iov[i].len;
+  }
+}
+
+static void gather_message(uint8_t* out, const crypto_iovec_t* iov) {
+  for (int i = 0; i < SEGMENTS; i++) {
+    memcpy(out, iov[i].base, iov[i].len);
+    out += iov[i].len;
+  }
+}
+
+static uint32_t check(const char* name, const void* result, const void* expected, size_t n) {
+  if (memcmp(result, expected, n)) {
+    printf("# iovec: %s does not match the contiguous kernel!\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+// every cipher variant against its contiguous kernel, and back
+static uint32_t test_ciphers(void) {
+  uint32_t fail = 0;
+  int      ret  = 0;
+
+  scatter_message(iov_in, message);
+
+  zvkned_aes128_encode_vs_lmul4(staging, message, MESSAGE_LEN_BYTES, aes128_rk);
+  ret |= zvkned_aes128_encode_iov(iov_out, SEGMENTS, iov_in, SEGMENTS, aes128_rk);
+  gather_message(result, iov_out);
+  fail += check("AES-128 encode", result, staging, MESSAGE_LEN_BYTES);
+
+  ret |= zvkned_aes128_decode_iov(iov_out, SEGMENTS, iov_out, SEGMENTS, aes128_rk);
+  gather_message(result, iov_out);
+  fail += check("AES-128 decode", result, message, MESSAGE_LEN_BYTES);
+
+  zvkned_aes256_encode_vs_lmul4(staging, message, MESSAGE_LEN_BYTES, aes256_rk);
+  ret |= zvkned_aes256_encode_iov(iov_out, SEGMENTS, iov_in, SEGMENTS, aes256_rk);
+  gather_message(result, iov_out);
+  fail += check("AES-256 encode", result, staging, MESSAGE_LEN_BYTES);
+
+  ret |= zvkned_aes256_decode_iov(iov_out, SEGMENTS, iov_out, SEGMENTS, aes256_rk);
+  gather_message(result, iov_out);
+  fail += check("AES-256 decode", result, message, MESSAGE_LEN_BYTES);
+
+  zvksed_sm4_encode_vv(staging, message, MESSAGE_LEN_BYTES, round_keys_0);
+  ret |= zvksed_sm4_encode_iov(iov_out, SEGMENTS, iov_in, SEGMENTS, round_keys_0);
+  gather_message(result, iov_out);
+  fail += check("SM4 encode", result, staging, MESSAGE_LEN_BYTES);
+
+  ret |= zvksed_sm4_decode_iov(iov_out, SEGMENTS, iov_out, SEGMENTS, round_keys_rev);
+  gather_message(result, iov_out);
+  fail += check("SM4 decode", result, message, MESSAGE_LEN_BYTES);
+
+  fail += ret != CRYPTO_IOV_OK;
+
+  // a length that is not a whole number of blocks must be refused
+  crypto_iovec_t short_iov = { pool_in, 15 };
+  if (zvkned_aes128_encode_iov(&short_iov, 1, &short_iov, 1, aes128_rk) != CRYPTO_IOV_ERR_LEN) {
+    printf("# iovec: partial block accepted!\n");
+    fail++;
+  }
+
+  return fail;
+}
+
+static uint32_t test_hashes(void) {
+  uint32_t         fail = 0;
+  uint32_t         h256 [8], h256_iov [8];
+  uint64_t         h512 [8];
+  uint8_t          h512_iov [64];
+  uint8_t          h_sm3 [32], h_sm3_iov [32];
+  sha512_vec_ctx_t ctx;
+
+  scatter_message(iov_in, message);
+
+  sha256_hash_vec(h256, message, MESSAGE_LEN_BYTES);
+  sha256_hash_vec_iov(h256_iov, iov_in, SEGMENTS);
+  fail += check("SHA-256", h256_iov, h256, sizeof(h256));
+
+  // the first three segments leave a tail shorter than a block
+  sha256_hash_vec(h256, message, 80);
+  sha256_hash_vec_iov(h256_iov, iov_in, 3);
+  fail += check("SHA-256 (short)", h256_iov, h256, sizeof(h256));
+
+  sha512_hash_vec(h512, message, MESSAGE_LEN_BYTES);
+  // the first update ends inside a block
+  sha512_vec_init(&ctx);
+  sha512_vec_update_iov(&ctx, iov_in, 5);
+  sha512_vec_update_iov(&ctx, iov_in + 5, SEGMENTS - 5);
+  sha512_vec_final(&ctx, h512_iov);
+  fail += check("SHA-512", h512_iov, h512, sizeof(h512));
+
+  sm3_256(h_sm3, message, MESSAGE_LEN_BYTES);
+  sm3_256_iov(h_sm3_iov, iov_in, SEGMENTS);
+  fail += check("SM3", h_sm3_iov, h_sm3, sizeof(h_sm3));
+
+  return fail;
+}
+
+static void test_iovec(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t          digest [8];
+
+  scatter_message(iov_in, message);
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# AES-128 over %d segments, test %d/%d:\n", SEGMENTS, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    gather_message(staging, iov_in);
+    zvkned_aes128_encode_vs_lmul4(staging, staging, MESSAGE_LEN_BYTES, aes128_rk);
+    scatter_message(iov_out, staging);
+    volatile uint64_t st_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t st_ccount = test_rdcycle() - start_cycles;
+    perf_log.aes128_staged.icount[i] = st_icount;
+    perf_log.aes128_staged.ccount[i] = st_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    zvkned_aes128_encode_iov(iov_out, SEGMENTS, iov_in, SEGMENTS, aes128_rk);
+    volatile uint64_t iov_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t iov_ccount = test_rdcycle() - start_cycles;
+    perf_log.aes128_iov.icount[i] = iov_icount;
+    perf_log.aes128_iov.ccount[i] = iov_ccount;
+
+    printf("#\tstaged cycles = %020lu\n", st_ccount);
+    printf("#\tiovec cycles  = %020lu\n", iov_ccount);
+
+    printf("#\n# SHA-256 over %d segments, test %d/%d:\n", SEGMENTS, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    gather_message(staging, iov_in);
+    sha256_hash_vec(digest, staging, MESSAGE_LEN_BYTES);
+    st_icount = test_rdinstret() - start_instrs;
+    st_ccount = test_rdcycle() - start_cycles;
+    perf_log.sha256_staged.icount[i] = st_icount;
+    perf_log.sha256_staged.ccount[i] = st_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    sha256_hash_vec_iov(digest, iov_in, SEGMENTS);
+    iov_icount = test_rdinstret() - start_instrs;
+    iov_ccount = test_rdcycle() - start_cycles;
+    perf_log.sha256_iov.icount[i] = iov_icount;
+    perf_log.sha256_iov.ccount[i] = iov_ccount;
+
+    printf("#\tstaged cycles = %020lu\n", st_ccount);
+    printf("#\tiovec cycles  = %020lu\n", iov_ccount);
+  }
+
+  perf_log.aes128_staged.ccount_average = average_count(perf_log.aes128_staged.ccount);
+  perf_log.aes128_staged.icount_average = average_count(perf_log.aes128_staged.icount);
+  perf_log.aes128_iov.ccount_average    = average_count(perf_log.aes128_iov.ccount);
+  perf_log.aes128_iov.icount_average    = average_count(perf_log.aes128_iov.icount);
+  perf_log.sha256_staged.ccount_average = average_count(perf_log.sha256_staged.ccount);
+  perf_log.sha256_staged.icount_average = average_count(perf_log.sha256_staged.icount);
+  perf_log.sha256_iov.ccount_average    = average_count(perf_log.sha256_iov.ccount);
+  perf_log.sha256_iov.icount_average    = average_count(perf_log.sha256_iov.icount);
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+  uint8_t           key [AES_256_KEY_BYTES] __attribute__((aligned(16)));
+
+  printf("\nBenchmark for scatter-gather kernels (%d bytes, %d segments)\n",
+         MESSAGE_LEN_BYTES, SEGMENTS);
+
+  for (int i = 0; i < MESSAGE_LEN_BYTES; i++) {
+    message[i] = (uint8_t)(i * 31 + (i >> 8));
+  }
+  for (int i = 0; i < AES_256_KEY_BYTES; i++) {
+    key[i] = i;
+  }
+  zvkned_aes128_expand_key(aes128_rk, key);
+  zvkned_aes256_expand_key(aes256_rk, key);
+
+  setup_iov(iov_in,  pool_in,  seg_len);
+  setup_iov(iov_out, pool_out, out_len);
+
+  fail += test_ciphers();
+  fail += test_hashes();
+
+  test_iovec(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tAES-128:\n");
+  printf("#\tstaged.icount = %05lu\n", perf_log.aes128_staged.icount_average);
+  printf("#\tstaged.ccount = %05lu\n", perf_log.aes128_staged.ccount_average);
+  printf("#\tiovec.icount  = %05lu\n", perf_log.aes128_iov.icount_average);
+  printf("#\tiovec.ccount  = %05lu\n", perf_log.aes128_iov.ccount_average);
+  printf("#\tSHA-256:\n");
+  printf("#\tstaged.icount = %05lu\n", perf_log.sha256_staged.icount_average);
+  printf("#\tstaged.ccount = %05lu\n", perf_log.sha256_staged.ccount_average);
+  printf("#\tiovec.icount  = %05lu\n", perf_log.sha256_iov.icount_average);
+  printf("#\tiovec.ccount  = %05lu\n", perf_log.sha256_iov.ccount_average);
+
+  bench_record_log("aes128 zvkned staged", MESSAGE_LEN_BYTES, 4, &perf_log.aes128_staged);
+  bench_record_log("aes128 zvkned iovec",  MESSAGE_LEN_BYTES, 4, &perf_log.aes128_iov);
+  bench_record_log("sha256 zvknh staged",  MESSAGE_LEN_BYTES, 1, &perf_log.sha256_staged);
+  bench_record_log("sha256 zvknh iovec",   MESSAGE_LEN_BYTES, 1, &perf_log.sha256_iov);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,338 @@
+/*
+ * File      : test_irq_latency.c
+ * Test      : irq_latency_benchmark
+ * Date      : 19-oct-2026
+ * Description: Interrupt latency and jitter in cycles, from the trigger of
+ * an interrupt to the first instructions of the trap entry and to its C
+ * handler, for:
+ * - the CLINT software interrupt (IPI), triggered by a store to msip;
+ * - the CLINT machine timer, a match of mtimecmp;
+ * - the APB timer compare interrupt, taken through the PLIC.
+ * Every source is sampled IRQ_LAT_SAMPLES times with the core idle and with
+ * a long vector instruction in flight: a strided load, one L2 access per
+ * element, or a divide at e64 and LMUL 8.
+ *
+ * The trap entry is timed by irq_lat_vector.S, installed in mtvec for the
+ * run, which reads the cycle counter before it enters the regular trap
+ * vector. The handler time adds the context save of crt0.S, the dispatch of
+ * mtvec_handler() and for the PLIC the claim.
+ *
+ * The IPI is triggered at a known cycle. The timers are not: each sample
+ * waits for a tick of the counter, arms the compare a few ticks later and
+ * predicts the match from the cycles per tick measured at start-up. The
+ * timer latencies therefore carry an offset of up to one counter read, the
+ * same for every sample, and the cycle jitter of the tick.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "clint.h"
+#include "encoding.h"
+#include "handlers.h"
+#include "plic.h"
+#include "printf.h"
+#include "runtime.h"
+#include "timer.h"
+
+#include "crypto/share/benchmarks.h"
+
+//! Samples of every source and condition
+#ifndef IRQ_LAT_SAMPLES
+#define IRQ_LAT_SAMPLES     64
+#endif
+
+//! Ticks from the synchronising tick to the compare match. mtime runs at the
+//! RTC clock (about 1800 cycles a tick), the APB timer at the system clock.
+#define IRQ_LAT_MTIME_TICKS 2
+#define IRQ_LAT_APB_TICKS   512
+
+//! Ticks over which the cycles per tick are measured
+#define IRQ_LAT_CAL_MTIME   16
+#define IRQ_LAT_CAL_APB     16384
+
+//! Cycles ahead of the predicted match the vector instruction is issued
+#define IRQ_LAT_LEAD        16
+
+//! Longest wait for an interrupt, in cycles
+#define IRQ_LAT_TIMEOUT     1000000
+
+//! Element stride of the vector load, one L2 access per element
+#define IRQ_LAT_VSTRIDE     64
+
+#define IRQ_LAT_VELEMS      (VLEN / 8)  // e64, m8
+
+typedef enum {
+  IRQ_LAT_IPI = 0,
+  IRQ_LAT_MTIMER,
+  IRQ_LAT_APB,
+  IRQ_LAT_SOURCES
+} irq_lat_source_t;
+
+typedef enum {
+  IRQ_LAT_IDLE = 0,
+  IRQ_LAT_VLOAD,
+  IRQ_LAT_VDIV,
+  IRQ_LAT_CONDS
+} irq_lat_cond_t;
+
+static const char* const irq_lat_source_names[IRQ_LAT_SOURCES] = {
+  "ipi", "mtimer", "apb_timer"
+};
+
+static const char* const irq_lat_cond_names[IRQ_LAT_CONDS] = {
+  "idle", "vload", "vdiv"
+};
+
+extern void irq_lat_vector(void);
+
+//! Cycle of the last trap entry, written by irq_lat_vector.S
+volatile uint64_t irq_lat_entry;
+
+static volatile uint64_t irq_lat_handler;
+static volatile uint32_t irq_lat_count;
+
+//! Cycles per tick of the timer sources in 1/256, 0 for the IPI
+static uint64_t irq_lat_cpt [IRQ_LAT_SOURCES];
+
+static uint64_t irq_lat_vbuf [IRQ_LAT_VELEMS * IRQ_LAT_VSTRIDE / 8];
+
+static uint64_t irq_lat_entry_cycles   [IRQ_LAT_SAMPLES];
+static uint64_t irq_lat_handler_cycles [IRQ_LAT_SAMPLES];
+
+static inline void irq_lat_stamp(void) {
+  irq_lat_handler = test_rdcycle();
+  irq_lat_count++;
+}
+
+static void irq_lat_handler_ipi(void) {
+  irq_lat_stamp();
+  CLINT_IPI_REG = 0u;
+}
+
+static void irq_lat_handler_mtimer(void) {
+  irq_lat_stamp();
+  set_timer(UINT32_MAX);
+}
+
+static void irq_lat_handler_apb(void) {
+  irq_lat_stamp();
+  set_cmp_reg(UINT32_MAX);
+}
+
+static uint32_t irq_lat_mtime(void) {
+  return CLINT_MTIME_REG;
+}
+
+static uint32_t irq_lat_apb_count(void) {
+  return get_timer_val();
+}
+
+/*
+@brief Issues the vector instruction of a condition, without waiting for it.
+*/
+static inline void irq_lat_vector_op(irq_lat_cond_t cond) {
+  switch (cond) {
+    case IRQ_LAT_VLOAD:
+      asm volatile("vsetvli zero, %0, e64, m8, ta, ma\n\t"
+                   "vlse64.v v8, (%1), %2"
+                   :: "r"(IRQ_LAT_VELEMS), "r"(irq_lat_vbuf), "r"(IRQ_LAT_VSTRIDE)
+                   : "memory", "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15");
+      break;
+    case IRQ_LAT_VDIV:
+      asm volatile("vsetvli zero, %0, e64, m8, ta, ma\n\t"
+                   "vmv.v.i v24, 7\n\t"
+                   "vdivu.vv v16, v16, v24"
+                   :: "r"(IRQ_LAT_VELEMS)
+                   : "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23",
+                     "v24", "v25", "v26", "v27", "v28", "v29", "v30", "v31");
+      break;
+    default:
+      break;
+  }
+}
+
+/*
+@brief Waits for the next tick of a counter.
+@param [out] v - counter value after the tick
+@return cycle just before the read that saw the tick
+*/
+static uint64_t irq_lat_sync(uint32_t (*count)(void), uint32_t* v) {
+  uint32_t prev = count();
+  uint32_t now;
+  uint64_t c;
+
+  do {
+    c   = test_rdcycle();
+    now = count();
+  } while (now == prev);
+
+  *v = now;
+  return c;
+}
+
+//! Cycles per tick of a counter in 1/256, over at least ticks ticks
+static uint64_t irq_lat_calibrate(uint32_t (*count)(void), uint32_t ticks) {
+  uint32_t v0, v1;
+  uint64_t c0 = irq_lat_sync(count, &v0);
+  uint64_t c1;
+
+  do {
+    c1 = irq_lat_sync(count, &v1);
+  } while (v1 - v0 < ticks);
+
+  return ((c1 - c0) << 8) / (v1 - v0);
+}
+
+/*
+@brief Arms a timer source a few ticks ahead.
+@return predicted cycle of the compare match
+*/
+static uint64_t irq_lat_arm(irq_lat_source_t src) {
+  uint32_t v;
+  uint64_t c;
+
+  if (src == IRQ_LAT_MTIMER) {
+    c = irq_lat_sync(irq_lat_mtime, &v);
+    set_timer(v + IRQ_LAT_MTIME_TICKS);
+    return c + (IRQ_LAT_MTIME_TICKS * irq_lat_cpt[src] >> 8);
+  }
+
+  c = irq_lat_sync(irq_lat_apb_count, &v);
+  set_cmp_reg(v + IRQ_LAT_APB_TICKS);
+  return c + (IRQ_LAT_APB_TICKS * irq_lat_cpt[src] >> 8);
+}
+
+/*
+@brief Takes one sample.
+@param [out] entry - cycles from the trigger to the trap entry
+@param [out] handler - cycles from the trigger to the C handler
+@return 0, or 1 if the interrupt did not arrive
+*/
+static int irq_lat_sample(irq_lat_source_t src, irq_lat_cond_t cond,
+                          uint64_t* entry, uint64_t* handler) {
+  uint32_t count = irq_lat_count;
+  uint64_t t;
+
+  if (src == IRQ_LAT_IPI) {
+    irq_lat_vector_op(cond);
+    t = test_rdcycle();
+    CLINT_IPI_REG = 1u;
+  } else {
+    t = irq_lat_arm(src);
+    while (test_rdcycle() + IRQ_LAT_LEAD < t) {}
+    irq_lat_vector_op(cond);
+  }
+
+  while (irq_lat_count == count) {
+    if (test_rdcycle() - t > IRQ_LAT_TIMEOUT) {
+      return 1;
+    }
+  }
+
+  // let Ara drain before the next sample
+  asm volatile("fence" ::: "memory");
+
+  // a match ahead of its prediction counts as zero
+  *entry   = irq_lat_entry   > t ? irq_lat_entry   - t : 0;
+  *handler = irq_lat_handler > t ? irq_lat_handler - t : 0;
+  return 0;
+}
+
+static void irq_lat_print_stats(const bench_stats_t* s, const uint64_t* sorted) {
+  printf(" %6lu %6lu %6lu %6lu %6lu", s->min, s->median, s->mean, s->stddev,
+         sorted[IRQ_LAT_SAMPLES - 1]);
+}
+
+/*
+@brief Samples one source under one condition, prints a table row and the
+    result records.
+@return number of lost interrupts
+*/
+static uint32_t irq_lat_run(irq_lat_source_t src, irq_lat_cond_t cond) {
+  bench_stats_t e, h;
+  char          name [48];
+
+  for (unsigned i = 0; i < IRQ_LAT_SAMPLES; i++) {
+    if (irq_lat_sample(src, cond, &irq_lat_entry_cycles[i], &irq_lat_handler_cycles[i])) {
+      printf("# %s %s: no interrupt within %u cycles!\n", irq_lat_source_names[src],
+             irq_lat_cond_names[cond], IRQ_LAT_TIMEOUT);
+      return 1;
+    }
+  }
+
+  bench_stats(&e, irq_lat_entry_cycles, IRQ_LAT_SAMPLES);
+  bench_stats(&h, irq_lat_handler_cycles, IRQ_LAT_SAMPLES);
+
+  printf("%-10s %-6s |", irq_lat_source_names[src], irq_lat_cond_names[cond]);
+  irq_lat_print_stats(&e, irq_lat_entry_cycles);
+  printf(" |");
+  irq_lat_print_stats(&h, irq_lat_handler_cycles);
+  printf("\n");
+
+  snprintf(name, sizeof(name), "irq %s %s entry", irq_lat_source_names[src],
+           irq_lat_cond_names[cond]);
+  bench_record(name, 0, 0, 0, e.median);
+  snprintf(name, sizeof(name), "irq %s %s handler", irq_lat_source_names[src],
+           irq_lat_cond_names[cond]);
+  bench_record(name, 0, 0, 0, h.median);
+
+  return 0;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+  uint64_t          trap_vector;
+
+  init_vrf();
+
+  printf("\nInterrupt latency in cycles over %u samples\n", IRQ_LAT_SAMPLES);
+
+  register_callback_irq_handler_m_soft(irq_lat_handler_ipi);
+  register_callback_irq_handler_m_timer(irq_lat_handler_mtimer);
+  register_callback_irq_handler_apb_timer_compare(irq_lat_handler_apb);
+
+  // keep both timers from matching until a sample arms them
+  set_timer(UINT32_MAX);
+  set_cmp_reg(UINT32_MAX);
+  enable_timer();
+
+  irq_lat_cpt[IRQ_LAT_MTIMER] = irq_lat_calibrate(irq_lat_mtime, IRQ_LAT_CAL_MTIME);
+  irq_lat_cpt[IRQ_LAT_APB]    = irq_lat_calibrate(irq_lat_apb_count, IRQ_LAT_CAL_APB);
+  printf("mtime: %lu.%02lu cycles/tick, APB timer: %lu.%02lu cycles/tick\n",
+         irq_lat_cpt[IRQ_LAT_MTIMER] >> 8, (irq_lat_cpt[IRQ_LAT_MTIMER] & 0xff) * 100 >> 8,
+         irq_lat_cpt[IRQ_LAT_APB] >> 8, (irq_lat_cpt[IRQ_LAT_APB] & 0xff) * 100 >> 8);
+
+  trap_vector = read_csr(mtvec);
+  write_csr(mtvec, (uint64_t)irq_lat_vector);
+
+  enable_clint_sw_interrupts();
+  start_timer();
+  enable_plic();
+  plic_set_priority(apb_timer_cmp_irq, 1);
+  plic_enable_irq(apb_timer_cmp_irq);
+
+  printf("\n%-17s | %-34s | %s\n", "", "trap entry", "handler");
+  printf("%-10s %-6s |", "source", "vector");
+  for (unsigned i = 0; i < 2; i++) {
+    printf(" %6s %6s %6s %6s %6s%s", "min", "median", "mean", "stddev", "max", i ? "\n" : " |");
+  }
+
+  for (unsigned src = 0; src < IRQ_LAT_SOURCES; src++) {
+    for (unsigned cond = 0; cond < IRQ_LAT_CONDS; cond++) {
+      fail += irq_lat_run(src, cond);
+    }
+  }
+
+  plic_disable_irq(apb_timer_cmp_irq);
+  disable_timer();
+  write_csr(mtvec, trap_vector);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,170 @@
+/*
+ * File      : merkle.c
+ * Test      : merkle_benchmark
+ * Date      : 19-oct-2026
+ * Description: RFC 6962 Merkle trees on the multi-buffer SHA-256. The leaf
+ * and node prefixes are single bytes, so every level is one batch of
+ * suffixes hashed against a midstate holding just the prefix.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/sha/api_sha256.h"
+#include "crypto/sha/api_merkle.h"
+
+//! Proofs advanced together by merkle_verify_batch
+#define MERKLE_VERIFY_CHUNK  16
+
+#define MERKLE_LEAF_PREFIX  0x00
+#define MERKLE_NODE_PREFIX  0x01
+
+// md[i] = SHA-256(prefix || msg + i * stride, len bytes) for i < n
+static void merkle_hash_prefixed(merkle_hash_t* md, uint8_t prefix, const uint8_t* msg,
+                                 size_t len, size_t stride, size_t n) {
+  sha256_midstate_t ms;
+
+  sha256_midstate_init(&ms, &prefix, 1);
+  sha256_midstate_hash_batch(md, &ms, msg, len, stride, n);
+}
+
+size_t merkle_tree_nodes(size_t n_leaves) {
+  size_t total = 0;
+
+  for (size_t s = n_leaves; s > 1; s = (s + 1) / 2) {
+    total += s;
+  }
+  return total + 1;
+}
+
+void merkle_hash_leaves(merkle_hash_t* md, const uint8_t* leaves, size_t leaf_bytes, size_t n) {
+  merkle_hash_prefixed(md, MERKLE_LEAF_PREFIX, leaves, leaf_bytes, leaf_bytes, n);
+}
+
+int merkle_build(merkle_tree_t* t, merkle_hash_t* nodes, const uint8_t* leaves,
+                 size_t leaf_bytes, size_t n) {
+
+  if (n == 0) {
+    return MERKLE_ERR_EMPTY;
+  }
+
+  t->nodes    = nodes;
+  t->n_leaves = n;
+
+  merkle_hash_leaves(nodes, leaves, leaf_bytes, n);
+
+  // siblings are adjacent, so node i of the next level hashes level[2i..2i+1]
+  merkle_hash_t* level = nodes;
+  for (size_t s = n; s > 1; s = (s + 1) / 2) {
+    merkle_hash_t* next = level + s;
+
+    merkle_hash_prefixed(next, MERKLE_NODE_PREFIX, level[0], 2 * MERKLE_HASH_BYTES,
+                         2 * MERKLE_HASH_BYTES, s / 2);
+    if (s & 1) {
+      memcpy(next[s / 2], level[s - 1], MERKLE_HASH_BYTES);
+    }
+    level = next;
+  }
+
+  return MERKLE_OK;
+}
+
+const uint8_t* merkle_root(const merkle_tree_t* t) {
+  return t->nodes[merkle_tree_nodes(t->n_leaves) - 1];
+}
+
+size_t merkle_proof(merkle_hash_t* path, const merkle_tree_t* t, size_t index) {
+  const merkle_hash_t* level = t->nodes;
+  size_t len = 0;
+
+  if (index >= t->n_leaves) {
+    return 0;
+  }
+
+  for (size_t s = t->n_leaves; s > 1; s = (s + 1) / 2) {
+    size_t sib = index ^ 1;
+    // the promoted last node of an odd level has no sibling
+    if (sib < s) {
+      memcpy(path[len++], level[sib], MERKLE_HASH_BYTES);
+    }
+    level += s;
+    index >>= 1;
+  }
+
+  return len;
+}
+
+/*
+ * The proofs advance one path entry per step. The node hashes of a step are
+ * independent, so the active proofs of a chunk are hashed together.
+ */
+size_t merkle_verify_batch(const uint8_t root[MERKLE_HASH_BYTES], size_t tree_size,
+                           merkle_proof_t* proofs, size_t n) {
+
+  merkle_hash_t r    [MERKLE_VERIFY_CHUNK];
+  uint8_t       pair [MERKLE_VERIFY_CHUNK][2 * MERKLE_HASH_BYTES];
+  size_t        fn   [MERKLE_VERIFY_CHUNK];
+  size_t        sn   [MERKLE_VERIFY_CHUNK];
+  size_t        slot [MERKLE_VERIFY_CHUNK];
+  size_t        fail = 0;
+
+  for (size_t base = 0; base < n; base += MERKLE_VERIFY_CHUNK) {
+    merkle_proof_t* p = proofs + base;
+    size_t c     = n - base < MERKLE_VERIFY_CHUNK ? n - base : MERKLE_VERIFY_CHUNK;
+    size_t steps = 0;
+
+    for (size_t i = 0; i < c; i++) {
+      p[i].status = p[i].index < tree_size ? MERKLE_OK : MERKLE_ERR_INDEX;
+      fn[i] = p[i].index;
+      sn[i] = tree_size - 1;
+      memcpy(r[i], p[i].leaf, MERKLE_HASH_BYTES);
+      steps = p[i].path_len > steps ? p[i].path_len : steps;
+    }
+
+    for (size_t k = 0; k < steps; k++) {
+      size_t m = 0;
+
+      for (size_t i = 0; i < c; i++) {
+        if (p[i].status != MERKLE_OK || k >= p[i].path_len) {
+          continue;
+        }
+        if (sn[i] == 0) {
+          p[i].status = MERKLE_ERR_PROOF;       // path longer than the tree
+          continue;
+        }
+        if ((fn[i] & 1) || fn[i] == sn[i]) {
+          memcpy(pair[m], p[i].path[k], MERKLE_HASH_BYTES);
+          memcpy(pair[m] + MERKLE_HASH_BYTES, r[i], MERKLE_HASH_BYTES);
+          // right edge of a subtree: skip the levels without a sibling
+          while (!(fn[i] & 1) && fn[i]) {
+            fn[i] >>= 1;
+            sn[i] >>= 1;
+          }
+        } else {
+          memcpy(pair[m], r[i], MERKLE_HASH_BYTES);
+          memcpy(pair[m] + MERKLE_HASH_BYTES, p[i].path[k], MERKLE_HASH_BYTES);
+        }
+        fn[i] >>= 1;
+        sn[i] >>= 1;
+        slot[m++] = i;
+      }
+
+      merkle_hash_t md [MERKLE_VERIFY_CHUNK];
+      merkle_hash_prefixed(md, MERKLE_NODE_PREFIX, pair[0], 2 * MERKLE_HASH_BYTES,
+                           2 * MERKLE_HASH_BYTES, m);
+      for (size_t j = 0; j < m; j++) {
+        memcpy(r[slot[j]], md[j], MERKLE_HASH_BYTES);
+      }
+    }
+
+    for (size_t i = 0; i < c; i++) {
+      if (p[i].status == MERKLE_OK && (sn[i] != 0 || memcmp(r[i], root, MERKLE_HASH_BYTES))) {
+        p[i].status = MERKLE_ERR_PROOF;
+      }
+      fail += p[i].status != MERKLE_OK;
+    }
+  }
+
+  return fail;
+}
@@ -0,0 +1,43 @@
+/*
+ * File      : merkle_vectors.h
+ * Test      : merkle_benchmark
+ * Date      : 19-oct-2026
+ * Description: Expected RFC 6962 tree heads over the leaves built by
+ * test_merkle.c, computed with an independent model of MTH.
+ */
+
+#ifndef __MERKLE_VECTORS_H__
+#define __MERKLE_VECTORS_H__
+
+#include <stdint.h>
+
+#define MERKLE_TEST_LEAVES      300
+#define MERKLE_TEST_LEAF_BYTES  64
+#define MERKLE_TEST_NODES       603  // merkle_tree_nodes(MERKLE_TEST_LEAVES)
+#define MERKLE_TEST_DEPTH       9    // longest audit path of the test trees
+
+// leaf j, byte k
+#define MERKLE_LEAF_BYTE(j, k)  ((uint8_t)((k) * 3 + (j) * 11))
+
+static const uint8_t merkle_root_300 [32] = {
+  0xf6, 0xbd, 0x34, 0xe1, 0x2c, 0x8a, 0x09, 0x92,
+  0x41, 0x99, 0x65, 0x9b, 0xb2, 0x06, 0x42, 0x8e,
+  0x9c, 0xd3, 0x44, 0xe2, 0xd6, 0x41, 0x6a, 0x81,
+  0x63, 0xca, 0x11, 0x36, 0x44, 0x51, 0x8e, 0xdc
+};
+
+static const uint8_t merkle_root_37 [32] = {
+  0x6a, 0xb4, 0xc5, 0x8c, 0x88, 0xea, 0x08, 0x4c,
+  0x62, 0x2c, 0x07, 0xb3, 0xf9, 0x44, 0xd4, 0x15,
+  0x06, 0x31, 0xc4, 0x56, 0x97, 0x4f, 0x76, 0x92,
+  0x74, 0x35, 0x8b, 0xeb, 0xcd, 0x84, 0x9f, 0xc7
+};
+
+static const uint8_t merkle_root_1 [32] = {
+  0xf6, 0x24, 0xb8, 0x2e, 0x4f, 0x64, 0xf4, 0xd0,
+  0xe5, 0x71, 0x51, 0xa9, 0xa7, 0x9c, 0x02, 0x31,
+  0xe6, 0xdb, 0xff, 0xda, 0x7a, 0x7a, 0x64, 0x14,
+  0x27, 0x04, 0x33, 0xb2, 0xd7, 0xe6, 0x70, 0x51
+};
+
+#endif // __MERKLE_VECTORS_H__
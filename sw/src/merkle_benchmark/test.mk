@@ -0,0 +1,5 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  sha_benchmark/sha256.c \
+  sha_benchmark/sha256_mb.c \
+  sha_benchmark/zvknh.s
@@ -0,0 +1,292 @@
+/*
+ * File      : test_merkle.c
+ * Test      : merkle_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of Merkle tree builds and inclusion proof
+ * verification, one SHA-256 call per node against multi-buffer levels.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/sha/api_sha256.h"
+#include "crypto/sha/api_merkle.h"
+
+#include "merkle_vectors.h"
+
+//! Proofs generated and verified together, keeps the paths within the L2
+#define MERKLE_TEST_BATCH  50
+
+typedef struct {
+  perf_log_t build_single;
+  perf_log_t build_mb;
+  perf_log_t verify_single;
+  perf_log_t verify_batch;
+} merkle_perf_log_t;
+
+static merkle_perf_log_t perf_log = {0};
+
+static uint8_t        leaves  [MERKLE_TEST_LEAVES][MERKLE_TEST_LEAF_BYTES];
+static merkle_hash_t  nodes   [MERKLE_TEST_NODES];
+static merkle_hash_t  nodes_1 [MERKLE_TEST_NODES];
+static merkle_hash_t  paths   [MERKLE_TEST_BATCH][MERKLE_TEST_DEPTH];
+static merkle_hash_t  leaf_md [MERKLE_TEST_BATCH];
+static merkle_proof_t proofs  [MERKLE_TEST_BATCH];
+
+static void setup_leaves(void) {
+  for (int j = 0; j < MERKLE_TEST_LEAVES; j++) {
+    for (int k = 0; k < MERKLE_TEST_LEAF_BYTES; k++) {
+      leaves[j][k] = MERKLE_LEAF_BYTE(j, k);
+    }
+  }
+}
+
+// SHA-256(prefix || a || b) through the single-buffer zvknh path
+static void hash_single(uint8_t md[32], uint8_t prefix, const uint8_t* a, size_t a_len,
+                        const uint8_t* b, size_t b_len) {
+  uint8_t  msg [1 + 2 * MERKLE_TEST_LEAF_BYTES];
+  uint32_t H   [8];
+
+  msg[0] = prefix;
+  memcpy(msg + 1, a, a_len);
+  if (b_len) {
+    memcpy(msg + 1 + a_len, b, b_len);
+  }
+  sha256_hash_vec(H, msg, 1 + a_len + b_len);
+  memcpy(md, H, 32);
+}
+
+// Same tree layout as merkle_build, one node at a time
+static const uint8_t* build_single(merkle_hash_t* t, size_t n) {
+  for (size_t j = 0; j < n; j++) {
+    hash_single(t[j], 0x00, leaves[j], MERKLE_TEST_LEAF_BYTES, NULL, 0);
+  }
+
+  merkle_hash_t* level = t;
+  for (size_t s = n; s > 1; s = (s + 1) / 2) {
+    merkle_hash_t* next = level + s;
+    for (size_t i = 0; i < s / 2; i++) {
+      hash_single(next[i], 0x01, level[2*i], 32, level[2*i + 1], 32);
+    }
+    if (s & 1) {
+      memcpy(next[s / 2], level[s - 1], 32);
+    }
+    level = next;
+  }
+
+  return level[0];
+}
+
+static uint32_t test_merkle_build(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  merkle_tree_t tree;
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# Merkle build, %d leaves, test %d/%d:\n", MERKLE_TEST_LEAVES, i+1, num_tests);
+
+    setup_leaves();
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    const uint8_t* root_1 = build_single(nodes_1, MERKLE_TEST_LEAVES);
+    volatile uint64_t single_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t single_ccount = test_rdcycle() - start_cycles;
+    perf_log.build_single.icount[i] = single_icount;
+    perf_log.build_single.ccount[i] = single_ccount;
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    merkle_build(&tree, nodes, leaves[0], MERKLE_TEST_LEAF_BYTES, MERKLE_TEST_LEAVES);
+    volatile uint64_t mb_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t mb_ccount = test_rdcycle() - start_cycles;
+    perf_log.build_mb.icount[i] = mb_icount;
+    perf_log.build_mb.ccount[i] = mb_ccount;
+
+    if (memcmp(root_1, merkle_root_300, 32)) {
+      printf("# Merkle: wrong root (single)!\n");
+      fail++;
+    }
+    if (memcmp(merkle_root(&tree), merkle_root_300, 32)) {
+      printf("# Merkle: wrong root (multi-buffer)!\n");
+      fail++;
+    }
+
+    printf("#\tsingle cycles = %020lu\n", single_ccount);
+    printf("#\tmb cycles     = %020lu\n", mb_ccount);
+  }
+
+  perf_log.build_single.ccount_average = average_count(perf_log.build_single.ccount);
+  perf_log.build_single.icount_average = average_count(perf_log.build_single.icount);
+  perf_log.build_mb.ccount_average     = average_count(perf_log.build_mb.ccount);
+  perf_log.build_mb.icount_average     = average_count(perf_log.build_mb.icount);
+
+  return fail;
+}
+
+static void setup_proofs(const merkle_tree_t* t, size_t first, size_t n) {
+  merkle_hash_leaves(leaf_md, leaves[first], MERKLE_TEST_LEAF_BYTES, n);
+
+  for (size_t i = 0; i < n; i++) {
+    proofs[i].leaf     = leaf_md[i];
+    proofs[i].path     = paths[i];
+    proofs[i].path_len = merkle_proof(paths[i], t, first + i);
+    proofs[i].index    = first + i;
+    proofs[i].status   = MERKLE_ERR_PROOF;
+  }
+}
+
+static uint32_t test_merkle_verify(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  merkle_tree_t tree;
+
+  setup_leaves();
+  merkle_build(&tree, nodes, leaves[0], MERKLE_TEST_LEAF_BYTES, MERKLE_TEST_LEAVES);
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# Merkle verify, %d proofs, test %d/%d:\n", MERKLE_TEST_LEAVES, i+1, num_tests);
+
+    uint64_t single_icount = 0, single_ccount = 0;
+    uint64_t batch_icount  = 0, batch_ccount  = 0;
+
+    for (size_t first = 0; first < MERKLE_TEST_LEAVES; first += MERKLE_TEST_BATCH) {
+      size_t n = MERKLE_TEST_LEAVES - first < MERKLE_TEST_BATCH ? MERKLE_TEST_LEAVES - first : MERKLE_TEST_BATCH;
+      size_t bad = 0;
+
+      setup_proofs(&tree, first, n);
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      for (size_t p = 0; p < n; p++) {
+        bad += merkle_verify_batch(merkle_root_300, MERKLE_TEST_LEAVES, &proofs[p], 1);
+      }
+      single_icount += test_rdinstret() - start_instrs;
+      single_ccount += test_rdcycle() - start_cycles;
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      bad += merkle_verify_batch(merkle_root_300, MERKLE_TEST_LEAVES, proofs, n);
+      batch_icount += test_rdinstret() - start_instrs;
+      batch_ccount += test_rdcycle() - start_cycles;
+
+      if (bad) {
+        printf("# Merkle: %lu proofs from leaf %lu rejected!\n", bad, first);
+        fail++;
+      }
+    }
+
+    perf_log.verify_single.icount[i] = single_icount;
+    perf_log.verify_single.ccount[i] = single_ccount;
+    perf_log.verify_batch.icount[i]  = batch_icount;
+    perf_log.verify_batch.ccount[i]  = batch_ccount;
+
+    printf("#\tsingle cycles = %020lu\n", single_ccount);
+    printf("#\tbatch cycles  = %020lu\n", batch_ccount);
+  }
+
+  perf_log.verify_single.ccount_average = average_count(perf_log.verify_single.ccount);
+  perf_log.verify_single.icount_average = average_count(perf_log.verify_single.icount);
+  perf_log.verify_batch.ccount_average  = average_count(perf_log.verify_batch.ccount);
+  perf_log.verify_batch.icount_average  = average_count(perf_log.verify_batch.icount);
+
+  return fail;
+}
+
+/*
+ * Small and degenerate trees, and proofs that must be rejected without
+ * affecting the rest of their batch.
+ */
+static uint32_t test_merkle_errors(void) {
+  uint32_t fail = 0;
+  merkle_tree_t tree;
+
+  setup_leaves();
+
+  merkle_build(&tree, nodes, leaves[0], MERKLE_TEST_LEAF_BYTES, 37);
+  if (memcmp(merkle_root(&tree), merkle_root_37, 32)) {
+    printf("# Merkle: wrong root for 37 leaves!\n");
+    fail++;
+  }
+
+  // proofs 0..4: good, tampered path, wrong index, index past the tree, good
+  setup_proofs(&tree, 30, 5);
+  paths[1][2][7] ^= 0x10;
+  proofs[2].index = 31;
+  proofs[3].index = 37;
+
+  merkle_verify_batch(merkle_root_37, 37, proofs, 5);
+
+  static const int expected [5] = {
+    MERKLE_OK, MERKLE_ERR_PROOF, MERKLE_ERR_PROOF, MERKLE_ERR_INDEX, MERKLE_OK
+  };
+  for (int i = 0; i < 5; i++) {
+    if (proofs[i].status != expected[i]) {
+      printf("# Merkle: unexpected status %d for proof %d!\n", proofs[i].status, i);
+      fail++;
+    }
+  }
+
+  merkle_build(&tree, nodes, leaves[0], MERKLE_TEST_LEAF_BYTES, 1);
+  setup_proofs(&tree, 0, 1);
+  if (memcmp(merkle_root(&tree), merkle_root_1, 32) || proofs[0].path_len != 0 ||
+      merkle_verify_batch(merkle_root_1, 1, proofs, 1)) {
+    printf("# Merkle: single leaf tree failed!\n");
+    fail++;
+  }
+
+  if (merkle_build(&tree, nodes, leaves[0], MERKLE_TEST_LEAF_BYTES, 0) != MERKLE_ERR_EMPTY) {
+    printf("# Merkle: empty tree accepted!\n");
+    fail++;
+  }
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for Merkle trees (%d leaves, %lu SHA-256 lanes)\n",
+         MERKLE_TEST_LEAVES, sha256_mb_lanes());
+
+  fail += test_merkle_build(TEST_COUNT);
+  fail += test_merkle_verify(TEST_COUNT);
+  fail += test_merkle_errors();
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tMerkle:\n");
+  printf("#\tbuild_single.icount  = %05lu\n", perf_log.build_single.icount_average);
+  printf("#\tbuild_single.ccount  = %05lu\n", perf_log.build_single.ccount_average);
+  printf("#\tbuild_mb.icount      = %05lu\n", perf_log.build_mb.icount_average);
+  printf("#\tbuild_mb.ccount      = %05lu\n", perf_log.build_mb.ccount_average);
+  printf("#\tverify_single.icount = %05lu\n", perf_log.verify_single.icount_average);
+  printf("#\tverify_single.ccount = %05lu\n", perf_log.verify_single.ccount_average);
+  printf("#\tverify_batch.icount  = %05lu\n", perf_log.verify_batch.icount_average);
+  printf("#\tverify_batch.ccount  = %05lu\n", perf_log.verify_batch.ccount_average);
+
+  bench_record_log("merkle build single",  MERKLE_TEST_LEAVES * MERKLE_TEST_LEAF_BYTES, 1,
+                   &perf_log.build_single);
+  bench_record_log("merkle build mb",      MERKLE_TEST_LEAVES * MERKLE_TEST_LEAF_BYTES, 1,
+                   &perf_log.build_mb);
+  bench_record_log("merkle verify single", 0, 1, &perf_log.verify_single);
+  bench_record_log("merkle verify batch",  0, 1, &perf_log.verify_batch);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
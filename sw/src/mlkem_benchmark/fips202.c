@@ -0,0 +1,260 @@
+/*
+ * File      : fips202.c
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: Keccak-f[1600] sponge for SHA-3/SHAKE, scalar and batched
+ * over the e64 lanes of the vector unit (vrol/vandn from Zvbb).
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/sha3/fips202.h"
+
+#define KECCAK_ROUNDS 24
+
+static const uint64_t kKeccakRC[KECCAK_ROUNDS] = {
+  0x0000000000000001UL, 0x0000000000008082UL, 0x800000000000808aUL, 0x8000000080008000UL,
+  0x000000000000808bUL, 0x0000000080000001UL, 0x8000000080008081UL, 0x8000000000008009UL,
+  0x000000000000008aUL, 0x0000000000000088UL, 0x0000000080008009UL, 0x000000008000000aUL,
+  0x000000008000808bUL, 0x800000000000008bUL, 0x8000000000008089UL, 0x8000000000008003UL,
+  0x8000000000008002UL, 0x8000000000000080UL, 0x000000000000800aUL, 0x800000008000000aUL,
+  0x8000000080008081UL, 0x8000000000008080UL, 0x0000000080000001UL, 0x8000000080008008UL
+};
+
+// rotation offsets of rho, indexed by x + 5*y
+static const uint8_t kKeccakRho[25] = {
+   0,  1, 62, 28, 27, 36, 44,  6, 55, 20,  3, 10, 43,
+  25, 39, 41, 45, 15, 21,  8, 18,  2, 61, 56, 14
+};
+
+#define ROL64(a, n) (((n) == 0) ? (a) : (((a) << (n)) | ((a) >> (64 - (n)))))
+
+void keccakf1600(uint64_t s[25]) {
+  uint64_t b[25];
+  uint64_t c[5];
+  uint64_t d;
+
+  for (int r = 0; r < KECCAK_ROUNDS; r++) {
+
+    // theta
+    for (int x = 0; x < 5; x++) {
+      c[x] = s[x] ^ s[x + 5] ^ s[x + 10] ^ s[x + 15] ^ s[x + 20];
+    }
+    for (int x = 0; x < 5; x++) {
+      d = c[(x + 4) % 5] ^ ROL64(c[(x + 1) % 5], 1);
+      for (int y = 0; y < 25; y += 5) {
+        s[x + y] ^= d;
+      }
+    }
+
+    // rho and pi
+    for (int x = 0; x < 5; x++) {
+      for (int y = 0; y < 5; y++) {
+        b[y + 5 * ((2 * x + 3 * y) % 5)] = ROL64(s[x + 5 * y], kKeccakRho[x + 5 * y]);
+      }
+    }
+
+    // chi and iota
+    for (int y = 0; y < 25; y += 5) {
+      for (int x = 0; x < 5; x++) {
+        s[x + y] = b[x + y] ^ (~b[(x + 1) % 5 + y] & b[(x + 2) % 5 + y]);
+      }
+    }
+    s[0] ^= kKeccakRC[r];
+  }
+}
+
+static void keccak(uint8_t* out, size_t outlen, const uint8_t* in, size_t inlen,
+                   size_t rate, uint8_t pad) {
+  uint64_t s[25] = {0};
+
+  while (inlen >= rate) {
+    for (size_t i = 0; i < rate; i++) {
+      s[i >> 3] ^= (uint64_t)(in[i]) << (8 * (i & 7));
+    }
+    keccakf1600(s);
+    in    += rate;
+    inlen -= rate;
+  }
+
+  for (size_t i = 0; i < inlen; i++) {
+    s[i >> 3] ^= (uint64_t)(in[i]) << (8 * (i & 7));
+  }
+  s[inlen >> 3]      ^= (uint64_t)(pad) << (8 * (inlen & 7));
+  s[(rate - 1) >> 3] ^= 0x80UL << (8 * ((rate - 1) & 7));
+
+  while (outlen) {
+    size_t n = outlen < rate ? outlen : rate;
+    keccakf1600(s);
+    for (size_t i = 0; i < n; i++) {
+      out[i] = (uint8_t)(s[i >> 3] >> (8 * (i & 7)));
+    }
+    out    += n;
+    outlen -= n;
+  }
+}
+
+void sha3_256(uint8_t h[32], const uint8_t* in, size_t inlen) {
+  keccak(h, 32, in, inlen, SHA3_256_RATE, SHA3_PAD);
+}
+
+void sha3_512(uint8_t h[64], const uint8_t* in, size_t inlen) {
+  keccak(h, 64, in, inlen, SHA3_512_RATE, SHA3_PAD);
+}
+
+void shake128(uint8_t* out, size_t outlen, const uint8_t* in, size_t inlen) {
+  keccak(out, outlen, in, inlen, SHAKE128_RATE, SHAKE_PAD);
+}
+
+void shake256(uint8_t* out, size_t outlen, const uint8_t* in, size_t inlen) {
+  keccak(out, outlen, in, inlen, SHAKE256_RATE, SHAKE_PAD);
+}
+
+/*************************** Batched Keccak ***********************************/
+
+size_t keccak_x_lanes(void) {
+  size_t vlmax = __riscv_vsetvlmax_e64m2();
+  return vlmax < KECCAK_LANES ? vlmax : KECCAK_LANES;
+}
+
+#define LOAD_LANE(i)      __riscv_vle64_v_u64m2(st->s[i], vl)
+#define STORE_LANE(i, v)  __riscv_vse64_v_u64m2(st->s[i], v, vl)
+#define XOR(a, b)         __riscv_vxor_vv_u64m2(a, b, vl)
+
+// theta (with the column parities d), rho and pi of lane i into b[p]
+#define RHO_PI(i, d, rho, p) {                                              \
+  vuint64m2_t a = XOR(LOAD_LANE(i), d);                                     \
+  __riscv_vse64_v_u64m2(b[p], __riscv_vrol_vx_u64m2(a, rho, vl), vl);       \
+}
+
+// chi of the plane starting at lane y, accumulating the column parities of
+// the next round in c0..c4
+#define CHI(y) {                                                            \
+  vuint64m2_t b0 = __riscv_vle64_v_u64m2(b[y + 0], vl);                     \
+  vuint64m2_t b1 = __riscv_vle64_v_u64m2(b[y + 1], vl);                     \
+  vuint64m2_t b2 = __riscv_vle64_v_u64m2(b[y + 2], vl);                     \
+  vuint64m2_t b3 = __riscv_vle64_v_u64m2(b[y + 3], vl);                     \
+  vuint64m2_t b4 = __riscv_vle64_v_u64m2(b[y + 4], vl);                     \
+  vuint64m2_t a0 = XOR(b0, __riscv_vandn_vv_u64m2(b2, b1, vl));             \
+  vuint64m2_t a1 = XOR(b1, __riscv_vandn_vv_u64m2(b3, b2, vl));             \
+  vuint64m2_t a2 = XOR(b2, __riscv_vandn_vv_u64m2(b4, b3, vl));             \
+  vuint64m2_t a3 = XOR(b3, __riscv_vandn_vv_u64m2(b0, b4, vl));             \
+  vuint64m2_t a4 = XOR(b4, __riscv_vandn_vv_u64m2(b1, b0, vl));             \
+  if (y == 0) {                                                             \
+    a0 = __riscv_vxor_vx_u64m2(a0, kKeccakRC[r], vl);                       \
+    c0 = a0; c1 = a1; c2 = a2; c3 = a3; c4 = a4;                            \
+  } else {                                                                  \
+    c0 = XOR(c0, a0); c1 = XOR(c1, a1); c2 = XOR(c2, a2);                   \
+    c3 = XOR(c3, a3); c4 = XOR(c4, a4);                                     \
+  }                                                                         \
+  STORE_LANE(y + 0, a0); STORE_LANE(y + 1, a1); STORE_LANE(y + 2, a2);      \
+  STORE_LANE(y + 3, a3); STORE_LANE(y + 4, a4);                             \
+}
+
+/*
+ * The state lives in memory, every round streams it once through rho/pi
+ * into b and once back through chi. The column parities of theta are
+ * accumulated while chi writes the state, so that only the first round
+ * needs a separate pass over the state.
+ */
+void keccakf1600_x(keccak_x_t* st, size_t vl) {
+  uint64_t b[25][KECCAK_LANES];
+
+  vuint64m2_t c0 = XOR(XOR(XOR(LOAD_LANE(0), LOAD_LANE(5)), XOR(LOAD_LANE(10), LOAD_LANE(15))), LOAD_LANE(20));
+  vuint64m2_t c1 = XOR(XOR(XOR(LOAD_LANE(1), LOAD_LANE(6)), XOR(LOAD_LANE(11), LOAD_LANE(16))), LOAD_LANE(21));
+  vuint64m2_t c2 = XOR(XOR(XOR(LOAD_LANE(2), LOAD_LANE(7)), XOR(LOAD_LANE(12), LOAD_LANE(17))), LOAD_LANE(22));
+  vuint64m2_t c3 = XOR(XOR(XOR(LOAD_LANE(3), LOAD_LANE(8)), XOR(LOAD_LANE(13), LOAD_LANE(18))), LOAD_LANE(23));
+  vuint64m2_t c4 = XOR(XOR(XOR(LOAD_LANE(4), LOAD_LANE(9)), XOR(LOAD_LANE(14), LOAD_LANE(19))), LOAD_LANE(24));
+
+  for (int r = 0; r < KECCAK_ROUNDS; r++) {
+
+    vuint64m2_t d0 = XOR(c4, __riscv_vrol_vx_u64m2(c1, 1, vl));
+    vuint64m2_t d1 = XOR(c0, __riscv_vrol_vx_u64m2(c2, 1, vl));
+    vuint64m2_t d2 = XOR(c1, __riscv_vrol_vx_u64m2(c3, 1, vl));
+    vuint64m2_t d3 = XOR(c2, __riscv_vrol_vx_u64m2(c4, 1, vl));
+    vuint64m2_t d4 = XOR(c3, __riscv_vrol_vx_u64m2(c0, 1, vl));
+
+    RHO_PI( 0, d0,  0,  0)
+    RHO_PI( 1, d1,  1, 10)
+    RHO_PI( 2, d2, 62, 20)
+    RHO_PI( 3, d3, 28,  5)
+    RHO_PI( 4, d4, 27, 15)
+    RHO_PI( 5, d0, 36, 16)
+    RHO_PI( 6, d1, 44,  1)
+    RHO_PI( 7, d2,  6, 11)
+    RHO_PI( 8, d3, 55, 21)
+    RHO_PI( 9, d4, 20,  6)
+    RHO_PI(10, d0,  3,  7)
+    RHO_PI(11, d1, 10, 17)
+    RHO_PI(12, d2, 43,  2)
+    RHO_PI(13, d3, 25, 12)
+    RHO_PI(14, d4, 39, 22)
+    RHO_PI(15, d0, 41, 23)
+    RHO_PI(16, d1, 45,  8)
+    RHO_PI(17, d2, 15, 18)
+    RHO_PI(18, d3, 21,  3)
+    RHO_PI(19, d4,  8, 13)
+    RHO_PI(20, d0, 18, 14)
+    RHO_PI(21, d1,  2, 24)
+    RHO_PI(22, d2, 61,  9)
+    RHO_PI(23, d3, 56, 19)
+    RHO_PI(24, d4, 14,  4)
+    CHI( 0)
+    CHI( 5)
+    CHI(10)
+    CHI(15)
+    CHI(20)
+  }
+}
+
+void keccak_x_absorb_once(keccak_x_t* st, size_t rate, uint8_t pad, const uint8_t* in,
+                          size_t stride, size_t inlen, size_t vl) {
+
+  // one block per lane, gathered with strided loads
+  uint64_t blk [KECCAK_LANES][25];
+  size_t   n;
+
+  for (size_t i = 0; i < 25; i++) {
+    STORE_LANE(i, __riscv_vmv_v_x_u64m2(0, vl));
+  }
+
+  do {
+    n = inlen < rate ? inlen : rate;
+
+    for (size_t l = 0; l < vl; l++) {
+      uint8_t* p = (uint8_t*)(blk[l]);
+      memcpy(p, in + l * stride, n);
+      memset(p + n, 0, rate - n);
+      if (n < rate) {
+        p[n]        ^= pad;
+        p[rate - 1] ^= 0x80;
+      }
+    }
+
+    for (size_t i = 0; i < rate / 8; i++) {
+      vuint64m2_t m = __riscv_vlse64_v_u64m2(&blk[0][i], sizeof(blk[0]), vl);
+      STORE_LANE(i, XOR(LOAD_LANE(i), m));
+    }
+
+    if (n == rate) {
+      keccakf1600_x(st, vl);
+      in    += rate;
+      inlen -= rate;
+    }
+  } while (n == rate);
+}
+
+void keccak_x_squeezeblocks(uint8_t* out, size_t stride, size_t nblocks, keccak_x_t* st,
+                            size_t rate, size_t vl) {
+  while (nblocks--) {
+    keccakf1600_x(st, vl);
+    for (size_t i = 0; i < rate / 8; i++) {
+      __riscv_vsse64_v_u64m2((uint64_t*)(out + 8 * i), stride, LOAD_LANE(i), vl);
+    }
+    out += rate;
+  }
+}
@@ -0,0 +1,216 @@
+/*
+ * File      : mlkem.c
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: ML-KEM-768 key generation, encapsulation and decapsulation
+ * (FIPS 203) on top of the K-PKE scheme.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/mlkem/api_mlkem.h"
+#include "crypto/mlkem/mlkem_poly.h"
+#include "crypto/sha3/fips202.h"
+
+// offsets into the decapsulation key dk_pke || ek || H(ek) || z
+#define SK_EK_OFFSET  MLKEM_POLYVECBYTES
+#define SK_H_OFFSET   (SK_EK_OFFSET + MLKEM768_PUBLICKEYBYTES)
+#define SK_Z_OFFSET   (SK_H_OFFSET + MLKEM_SYMBYTES)
+
+static void polyvec_tobytes(uint8_t r[MLKEM_POLYVECBYTES], const mlkem_polyvec_t* a) {
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_poly_tobytes(r + i * MLKEM_POLYBYTES, &a->vec[i]);
+  }
+}
+
+static void polyvec_frombytes(mlkem_polyvec_t* r, const uint8_t a[MLKEM_POLYVECBYTES]) {
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_poly_frombytes(&r->vec[i], a + i * MLKEM_POLYBYTES);
+  }
+}
+
+static void polyvec_ntt(mlkem_polyvec_t* r) {
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_poly_ntt(&r->vec[i]);
+  }
+}
+
+// G(x) = SHA3-512(x), split into two 32 byte halves
+static void hash_g(uint8_t out[2 * MLKEM_SYMBYTES], const uint8_t* a, size_t alen,
+                   const uint8_t* b, size_t blen) {
+  uint8_t in [2 * MLKEM_SYMBYTES];
+
+  memcpy(in, a, alen);
+  memcpy(in + alen, b, blen);
+  sha3_512(out, in, alen + blen);
+}
+
+/*
+ * K-PKE.Encrypt with the seed r of the noise. The caller provides the
+ * decoded t_hat, the matrix is sampled transposed from rho.
+ */
+static void indcpa_enc(uint8_t ct[MLKEM768_CIPHERTEXTBYTES], const uint8_t m[MLKEM_SYMBYTES],
+                       const mlkem_polyvec_t* t_hat, const uint8_t rho[MLKEM_SYMBYTES],
+                       const uint8_t r[MLKEM_SYMBYTES]) {
+
+  mlkem_polyvec_t at [MLKEM_K];
+  mlkem_polyvec_t y, e1, u;
+  mlkem_poly_t    e2, v, k;
+
+  mlkem_gen_matrix(at, rho, 1);
+
+  // y, e1 and e2 use the consecutive nonces 0 .. 2K
+  mlkem_poly_getnoise(y.vec,  MLKEM_K, r, 0);
+  mlkem_poly_getnoise(e1.vec, MLKEM_K, r, MLKEM_K);
+  mlkem_poly_getnoise(&e2,    1,       r, 2 * MLKEM_K);
+
+  polyvec_ntt(&y);
+
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_polyvec_basemul_acc(&u.vec[i], &at[i], &y);
+    mlkem_poly_invntt_tomont (&u.vec[i]);
+    mlkem_poly_add           (&u.vec[i], &u.vec[i], &e1.vec[i]);
+    mlkem_poly_reduce        (&u.vec[i]);
+  }
+
+  mlkem_polyvec_basemul_acc(&v, t_hat, &y);
+  mlkem_poly_invntt_tomont (&v);
+  mlkem_poly_frommsg       (&k, m);
+  mlkem_poly_add           (&v, &v, &e2);
+  mlkem_poly_add           (&v, &v, &k);
+  mlkem_poly_reduce        (&v);
+
+  mlkem_polyvec_compress(ct, &u);
+  mlkem_poly_compress   (ct + MLKEM_POLYVECCOMPBYTES, &v);
+}
+
+// K-PKE.Decrypt
+static void indcpa_dec(uint8_t m[MLKEM_SYMBYTES], const uint8_t ct[MLKEM768_CIPHERTEXTBYTES],
+                       const uint8_t sk[MLKEM_POLYVECBYTES]) {
+
+  mlkem_polyvec_t u, s_hat;
+  mlkem_poly_t    v, w;
+
+  mlkem_polyvec_decompress(&u, ct);
+  mlkem_poly_decompress   (&v, ct + MLKEM_POLYVECCOMPBYTES);
+  polyvec_frombytes       (&s_hat, sk);
+
+  polyvec_ntt(&u);
+  mlkem_polyvec_basemul_acc(&w, &s_hat, &u);
+  mlkem_poly_invntt_tomont (&w);
+
+  mlkem_poly_sub    (&w, &v, &w);
+  mlkem_poly_reduce (&w);
+  mlkem_poly_tomsg  (m, &w);
+}
+
+int mlkem768_keypair(uint8_t* pk, uint8_t* sk, const uint8_t coins[2 * MLKEM_SYMBYTES]) {
+
+  mlkem_polyvec_t a [MLKEM_K];
+  mlkem_polyvec_t s, e, t;
+  uint8_t         rho_sigma [2 * MLKEM_SYMBYTES];
+  uint8_t         k = MLKEM_K;
+
+  // (rho, sigma) = G(d || k)
+  hash_g(rho_sigma, coins, MLKEM_SYMBYTES, &k, 1);
+  const uint8_t* rho   = rho_sigma;
+  const uint8_t* sigma = rho_sigma + MLKEM_SYMBYTES;
+
+  mlkem_gen_matrix(a, rho, 0);
+  mlkem_poly_getnoise(s.vec, MLKEM_K, sigma, 0);
+  mlkem_poly_getnoise(e.vec, MLKEM_K, sigma, MLKEM_K);
+
+  polyvec_ntt(&s);
+  polyvec_ntt(&e);
+
+  // t_hat = A * s_hat + e_hat
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_polyvec_basemul_acc(&t.vec[i], &a[i], &s);
+    mlkem_poly_tomont        (&t.vec[i]);
+    mlkem_poly_add           (&t.vec[i], &t.vec[i], &e.vec[i]);
+    mlkem_poly_reduce        (&t.vec[i]);
+  }
+
+  polyvec_tobytes(pk, &t);
+  memcpy(pk + MLKEM_POLYVECBYTES, rho, MLKEM_SYMBYTES);
+
+  polyvec_tobytes(sk, &s);
+  memcpy  (sk + SK_EK_OFFSET, pk, MLKEM768_PUBLICKEYBYTES);
+  sha3_256(sk + SK_H_OFFSET, pk, MLKEM768_PUBLICKEYBYTES);
+  memcpy  (sk + SK_Z_OFFSET, coins + MLKEM_SYMBYTES, MLKEM_SYMBYTES);
+
+  return MLKEM_OK;
+}
+
+int mlkem768_enc(uint8_t* ct, uint8_t ss[MLKEM_SSBYTES], const uint8_t* pk,
+                 const uint8_t coins[MLKEM_SYMBYTES]) {
+
+  mlkem_polyvec_t t_hat;
+  uint8_t         buf [MLKEM_POLYVECBYTES];
+  uint8_t         h   [MLKEM_SYMBYTES];
+  uint8_t         kr  [2 * MLKEM_SYMBYTES];
+
+  // modulus check: every coefficient of ek must already be reduced
+  polyvec_frombytes(&t_hat, pk);
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    mlkem_poly_reduce(&t_hat.vec[i]);
+  }
+  polyvec_tobytes(buf, &t_hat);
+  if (memcmp(buf, pk, MLKEM_POLYVECBYTES)) {
+    return MLKEM_ERR_KEY;
+  }
+
+  // (K, r) = G(m || H(ek))
+  sha3_256(h, pk, MLKEM768_PUBLICKEYBYTES);
+  hash_g(kr, coins, MLKEM_SYMBYTES, h, MLKEM_SYMBYTES);
+
+  indcpa_enc(ct, coins, &t_hat, pk + MLKEM_POLYVECBYTES, kr + MLKEM_SYMBYTES);
+  memcpy(ss, kr, MLKEM_SSBYTES);
+
+  return MLKEM_OK;
+}
+
+int mlkem768_dec(uint8_t ss[MLKEM_SSBYTES], const uint8_t* ct, const uint8_t* sk) {
+
+  mlkem_polyvec_t t_hat;
+  uint8_t         m    [MLKEM_SYMBYTES];
+  uint8_t         h    [MLKEM_SYMBYTES];
+  uint8_t         kr   [2 * MLKEM_SYMBYTES];
+  uint8_t         cmp  [MLKEM768_CIPHERTEXTBYTES];
+  uint8_t         zc   [MLKEM_SYMBYTES + MLKEM768_CIPHERTEXTBYTES];
+  uint8_t         diff = 0;
+
+  const uint8_t*  pk = sk + SK_EK_OFFSET;
+
+  // hash check: the stored H(ek) must match ek
+  sha3_256(h, pk, MLKEM768_PUBLICKEYBYTES);
+  if (memcmp(h, sk + SK_H_OFFSET, MLKEM_SYMBYTES)) {
+    return MLKEM_ERR_KEY;
+  }
+
+  indcpa_dec(m, ct, sk);
+
+  // (K', r') = G(m' || h), re-encrypt
+  hash_g(kr, m, MLKEM_SYMBYTES, h, MLKEM_SYMBYTES);
+  polyvec_frombytes(&t_hat, pk);
+  indcpa_enc(cmp, m, &t_hat, pk + MLKEM_POLYVECBYTES, kr + MLKEM_SYMBYTES);
+
+  // implicit rejection key J(z || c)
+  memcpy(zc, sk + SK_Z_OFFSET, MLKEM_SYMBYTES);
+  memcpy(zc + MLKEM_SYMBYTES, ct, MLKEM768_CIPHERTEXTBYTES);
+  shake256(ss, MLKEM_SSBYTES, zc, sizeof(zc));
+
+  // constant time compare and select of K' over the rejection key
+  for (size_t i = 0; i < MLKEM768_CIPHERTEXTBYTES; i++) {
+    diff |= ct[i] ^ cmp[i];
+  }
+  uint8_t mask = (uint8_t)(((uint32_t)diff - 1) >> 8);   // 0xff if equal
+
+  for (size_t i = 0; i < MLKEM_SSBYTES; i++) {
+    ss[i] ^= mask & (ss[i] ^ kr[i]);
+  }
+
+  return MLKEM_OK;
+}
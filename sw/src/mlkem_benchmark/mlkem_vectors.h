@@ -0,0 +1,50 @@
+/*
+ * File      : mlkem_vectors.h
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: ML-KEM-768 known answers for the fixed coins d = 00..1f,
+ * z = 20..3f and m = 40..5f, computed with a straight FIPS 203 model.
+ * Keys and ciphertext are checked through their SHA3-256 digests.
+ */
+
+#ifndef __MLKEM_VECTORS_H__
+#define __MLKEM_VECTORS_H__
+
+#include <stdint.h>
+
+// SHA3-256 of the encapsulation key
+static const uint8_t mlkem_pk_sha3 [32] = {
+  0xa2, 0x4e, 0x16, 0xd8, 0xf8, 0xf9, 0x38, 0x3a, 0x95, 0xb7, 0x70, 0x50,
+  0xf4, 0xd9, 0xfd, 0x2f, 0x57, 0x33, 0xee, 0xc1, 0xd6, 0x3e, 0xf3, 0xc2,
+  0x3e, 0xbf, 0x99, 0x18, 0x17, 0x36, 0x69, 0xa7
+};
+
+// SHA3-256 of the decapsulation key
+static const uint8_t mlkem_sk_sha3 [32] = {
+  0x11, 0x49, 0xf1, 0x7c, 0x3c, 0x4a, 0xc6, 0xab, 0x1e, 0x3e, 0x2d, 0x9d,
+  0x8b, 0xd0, 0x17, 0x13, 0x55, 0xac, 0x0f, 0xa3, 0x1b, 0xb8, 0x85, 0x5c,
+  0x48, 0xce, 0xad, 0xe8, 0x74, 0xc0, 0x86, 0x4b
+};
+
+// SHA3-256 of the ciphertext
+static const uint8_t mlkem_ct_sha3 [32] = {
+  0xb4, 0xcf, 0xbd, 0x24, 0xce, 0xf6, 0x7a, 0xfd, 0x37, 0x64, 0x27, 0x6c,
+  0x69, 0x80, 0xe0, 0xf8, 0x8f, 0x8e, 0x9c, 0xa5, 0x7f, 0x59, 0xb7, 0xf1,
+  0x2f, 0xe1, 0xa9, 0xc1, 0xe7, 0x2f, 0x47, 0x10
+};
+
+// shared key
+static const uint8_t mlkem_ss [32] = {
+  0x9c, 0xdd, 0xd0, 0x89, 0xff, 0xe7, 0x0e, 0x39, 0x96, 0xe7, 0x6f, 0x7c,
+  0x8d, 0x06, 0x74, 0x6d, 0xf3, 0x4d, 0x07, 0xe8, 0x65, 0x7b, 0xc0, 0xfc,
+  0xf2, 0xbb, 0x0e, 0x1c, 0x30, 0x84, 0xae, 0xa1
+};
+
+// implicit rejection key J(z || c') of the ciphertext with bit 0 flipped
+static const uint8_t mlkem_ss_reject [32] = {
+  0xdc, 0xfc, 0x80, 0xc6, 0xdb, 0x46, 0xff, 0x70, 0x28, 0xe3, 0xa4, 0x39,
+  0x86, 0x51, 0xc0, 0x63, 0xae, 0x7a, 0x42, 0xc1, 0x07, 0xa6, 0xdc, 0x8c,
+  0xb0, 0x71, 0x41, 0x86, 0x16, 0x98, 0xab, 0x92
+};
+
+#endif // __MLKEM_VECTORS_H__
@@ -0,0 +1,355 @@
+/*
+ * File      : ntt.c
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: Number theoretic transform and coefficient-wise arithmetic
+ * for ML-KEM on e16 vectors. Montgomery products use the signed high/low
+ * product pair (vmulh/vmul), so that no widening is needed.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/mlkem/api_mlkem.h"
+#include "crypto/mlkem/mlkem_poly.h"
+
+#define MLKEM_QINV      -3327   // q^-1 mod 2^16
+#define MLKEM_BARRETT   20159   // round(2^26 / q)
+
+// 2^16 * 2^16 / 128 mod q and its product with QINV, scales the inverse NTT
+#define MLKEM_F         1441
+#define MLKEM_F_QINV    -10079
+
+// 2^32 mod q and its product with QINV, converts into the Montgomery domain
+#define MLKEM_MONT2       1353
+#define MLKEM_MONT2_QINV  20553
+
+/*
+ * Powers of the root of unity 17 in Montgomery form, bit reversed, along
+ * with their products with QINV (mod 2^16) which save a multiplication in
+ * every Montgomery product. kZetasRev is kZetas reversed for the inverse
+ * NTT, and kZetasMul holds the +/- zeta of each coefficient pair of the
+ * base multiplication.
+ */
+static const int16_t kZetas[128] = {
+   -1044,   -758,   -359,  -1517,   1493,   1422,    287,    202,
+    -171,    622,   1577,    182,    962,  -1202,  -1474,   1468,
+     573,  -1325,    264,    383,   -829,   1458,  -1602,   -130,
+    -681,   1017,    732,    608,  -1542,    411,   -205,  -1571,
+    1223,    652,   -552,   1015,  -1293,   1491,   -282,  -1544,
+     516,     -8,   -320,   -666,  -1618,  -1162,    126,   1469,
+    -853,    -90,   -271,    830,    107,  -1421,   -247,   -951,
+    -398,    961,  -1508,   -725,    448,  -1065,    677,  -1275,
+   -1103,    430,    555,    843,  -1251,    871,   1550,    105,
+     422,    587,    177,   -235,   -291,   -460,   1574,   1653,
+    -246,    778,   1159,   -147,   -777,   1483,   -602,   1119,
+   -1590,    644,   -872,    349,    418,    329,   -156,    -75,
+     817,   1097,    603,    610,   1322,  -1285,  -1465,    384,
+   -1215,   -136,   1218,  -1335,   -874,    220,  -1187,  -1659,
+   -1185,  -1530,  -1278,    794,  -1510,   -854,   -870,    478,
+    -108,   -308,    996,    991,    958,  -1460,   1522,   1628
+};
+
+static const int16_t kZetasQinv[128] = {
+     -20,  31498,  14745,    787,  13525, -12402,  28191, -16694,
+  -20907,  27758,  -3799, -15690,  10690,   1358, -11202,  31164,
+   -5827,  17363, -26360, -29057,   5571,  -1102,  21438, -26242,
+  -28073,  24313, -10532,   8800,  18426,   8859,  26675, -16163,
+   -5689,  -6516,   1496,  30967, -23565,  20179,  20710,  25080,
+  -12796,  26616,  16064, -12442,   9134,   -650, -25986,  27837,
+   19883, -28250, -15887,  -8898, -28309,   9075, -30199,  18249,
+   13426,  14017, -29156, -12757,  16832,   4311, -24155, -17915,
+    -335,  11182, -11477,  13387, -32227, -14233,  20494, -21655,
+  -27738,  13131,    945,  -4587, -14883,  23092,   6182,   5493,
+   32010, -32502,  10631,  30317,  29175, -18741, -28762,  12639,
+  -18486,  20100,  17560,  18525, -14430,  19529,  -5276, -12619,
+  -31183,  20297,  25435,   2146,  -7382,  15355,  24391, -32384,
+  -20927,  -6280,  10946, -14903,  24214, -11044,  16989,  14469,
+   10335, -21498,  -7934, -20198, -22502,  23210,  10906, -17442,
+   31636, -23860,  28644, -20257,  23998,   7756, -17422,  23132
+};
+
+static const int16_t kZetasRev[128] = {
+    1628,   1522,  -1460,    958,    991,    996,   -308,   -108,
+     478,   -870,   -854,  -1510,    794,  -1278,  -1530,  -1185,
+   -1659,  -1187,    220,   -874,  -1335,   1218,   -136,  -1215,
+     384,  -1465,  -1285,   1322,    610,    603,   1097,    817,
+     -75,   -156,    329,    418,    349,   -872,    644,  -1590,
+    1119,   -602,   1483,   -777,   -147,   1159,    778,   -246,
+    1653,   1574,   -460,   -291,   -235,    177,    587,    422,
+     105,   1550,    871,  -1251,    843,    555,    430,  -1103,
+   -1275,    677,  -1065,    448,   -725,  -1508,    961,   -398,
+    -951,   -247,  -1421,    107,    830,   -271,    -90,   -853,
+    1469,    126,  -1162,  -1618,   -666,   -320,     -8,    516,
+   -1544,   -282,   1491,  -1293,   1015,   -552,    652,   1223,
+   -1571,   -205,    411,  -1542,    608,    732,   1017,   -681,
+    -130,  -1602,   1458,   -829,    383,    264,  -1325,    573,
+    1468,  -1474,  -1202,    962,    182,   1577,    622,   -171,
+     202,    287,   1422,   1493,  -1517,   -359,   -758,  -1044
+};
+
+static const int16_t kZetasRevQinv[128] = {
+   23132, -17422,   7756,  23998, -20257,  28644, -23860,  31636,
+  -17442,  10906,  23210, -22502, -20198,  -7934, -21498,  10335,
+   14469,  16989, -11044,  24214, -14903,  10946,  -6280, -20927,
+  -32384,  24391,  15355,  -7382,   2146,  25435,  20297, -31183,
+  -12619,  -5276,  19529, -14430,  18525,  17560,  20100, -18486,
+   12639, -28762, -18741,  29175,  30317,  10631, -32502,  32010,
+    5493,   6182,  23092, -14883,  -4587,    945,  13131, -27738,
+  -21655,  20494, -14233, -32227,  13387, -11477,  11182,   -335,
+  -17915, -24155,   4311,  16832, -12757, -29156,  14017,  13426,
+   18249, -30199,   9075, -28309,  -8898, -15887, -28250,  19883,
+   27837, -25986,   -650,   9134, -12442,  16064,  26616, -12796,
+   25080,  20710,  20179, -23565,  30967,   1496,  -6516,  -5689,
+  -16163,  26675,   8859,  18426,   8800, -10532,  24313, -28073,
+  -26242,  21438,  -1102,   5571, -29057, -26360,  17363,  -5827,
+   31164, -11202,   1358,  10690, -15690,  -3799,  27758, -20907,
+  -16694,  28191, -12402,  13525,    787,  14745,  31498,    -20
+};
+
+static const int16_t kZetasMul[128] = {
+   -1103,   1103,    430,   -430,    555,   -555,    843,   -843,
+   -1251,   1251,    871,   -871,   1550,  -1550,    105,   -105,
+     422,   -422,    587,   -587,    177,   -177,   -235,    235,
+    -291,    291,   -460,    460,   1574,  -1574,   1653,  -1653,
+    -246,    246,    778,   -778,   1159,  -1159,   -147,    147,
+    -777,    777,   1483,  -1483,   -602,    602,   1119,  -1119,
+   -1590,   1590,    644,   -644,   -872,    872,    349,   -349,
+     418,   -418,    329,   -329,   -156,    156,    -75,     75,
+     817,   -817,   1097,  -1097,    603,   -603,    610,   -610,
+    1322,  -1322,  -1285,   1285,  -1465,   1465,    384,   -384,
+   -1215,   1215,   -136,    136,   1218,  -1218,  -1335,   1335,
+    -874,    874,    220,   -220,  -1187,   1187,  -1659,   1659,
+   -1185,   1185,  -1530,   1530,  -1278,   1278,    794,   -794,
+   -1510,   1510,   -854,    854,   -870,    870,    478,   -478,
+    -108,    108,   -308,    308,    996,   -996,    991,   -991,
+     958,   -958,  -1460,   1460,   1522,  -1522,   1628,  -1628
+};
+
+static const int16_t kZetasMulQinv[128] = {
+    -335,    335,  11182, -11182, -11477,  11477,  13387, -13387,
+  -32227,  32227, -14233,  14233,  20494, -20494, -21655,  21655,
+  -27738,  27738,  13131, -13131,    945,   -945,  -4587,   4587,
+  -14883,  14883,  23092, -23092,   6182,  -6182,   5493,  -5493,
+   32010, -32010, -32502,  32502,  10631, -10631,  30317, -30317,
+   29175, -29175, -18741,  18741, -28762,  28762,  12639, -12639,
+  -18486,  18486,  20100, -20100,  17560, -17560,  18525, -18525,
+  -14430,  14430,  19529, -19529,  -5276,   5276, -12619,  12619,
+  -31183,  31183,  20297, -20297,  25435, -25435,   2146,  -2146,
+   -7382,   7382,  15355, -15355,  24391, -24391, -32384,  32384,
+  -20927,  20927,  -6280,   6280,  10946, -10946, -14903,  14903,
+   24214, -24214, -11044,  11044,  16989, -16989,  14469, -14469,
+   10335, -10335, -21498,  21498,  -7934,   7934, -20198,  20198,
+  -22502,  22502,  23210, -23210,  10906, -10906, -17442,  17442,
+   31636, -31636, -23860,  23860,  28644, -28644, -20257,  20257,
+   23998, -23998,   7756,  -7756, -17422,  17422,  23132, -23132
+};
+
+/*
+ * Montgomery product a*b*2^-16 with |result| < q: the high half of a*b
+ * minus the high half of q*(a*b*QINV mod 2^16). bqinv = b*QINV mod 2^16.
+ */
+static inline vint16m1_t fqmul_vx(vint16m1_t a, int16_t b, int16_t bqinv, size_t vl) {
+  vint16m1_t hi = __riscv_vmulh_vx_i16m1(a, b, vl);
+  vint16m1_t t  = __riscv_vmul_vx_i16m1(a, bqinv, vl);
+  t = __riscv_vmulh_vx_i16m1(t, MLKEM_Q, vl);
+  return __riscv_vsub_vv_i16m1(hi, t, vl);
+}
+
+static inline vint16m1_t fqmul_vv(vint16m1_t a, vint16m1_t b, vint16m1_t bqinv, size_t vl) {
+  vint16m1_t hi = __riscv_vmulh_vv_i16m1(a, b, vl);
+  vint16m1_t t  = __riscv_vmul_vv_i16m1(a, bqinv, vl);
+  t = __riscv_vmulh_vx_i16m1(t, MLKEM_Q, vl);
+  return __riscv_vsub_vv_i16m1(hi, t, vl);
+}
+
+static inline vint16m1_t fqmul(vint16m1_t a, vint16m1_t b, size_t vl) {
+  return fqmul_vv(a, b, __riscv_vmul_vx_i16m1(b, MLKEM_QINV, vl), vl);
+}
+
+// a - round(a/q)*q, the quotient is computed as (a*BARRETT + 2^25) >> 26
+static inline vint16m1_t barrett(vint16m1_t a, size_t vl) {
+  vint16m1_t t = __riscv_vmulh_vx_i16m1(a, MLKEM_BARRETT, vl);
+  t = __riscv_vadd_vx_i16m1(t, 1 << 9, vl);
+  t = __riscv_vsra_vx_i16m1(t, 10, vl);
+  return __riscv_vnmsac_vx_i16m1(a, MLKEM_Q, t, vl);
+}
+
+/*
+ * Every layer has `groups` blocks of 2*len coefficients, each block with its
+ * own zeta. Wide layers are vectorised along the block (one zeta per
+ * vector), narrow layers across the blocks with strided accesses (one zeta
+ * per element), so that vl stays at least 16 on every layer.
+ */
+void mlkem_poly_ntt(mlkem_poly_t* r) {
+  int16_t* c = r->coeffs;
+  size_t   vl;
+
+  for (size_t len = 128; len >= 2; len >>= 1) {
+    size_t groups = 128 / len;
+
+    if (len >= groups) {
+      for (size_t g = 0; g < groups; g++) {
+        int16_t* p  = c + 2 * len * g;
+        int16_t  z  = kZetas    [groups + g];
+        int16_t  zq = kZetasQinv[groups + g];
+
+        for (size_t j = 0; j < len; j += vl) {
+          vl = __riscv_vsetvl_e16m1(len - j);
+          vint16m1_t a = __riscv_vle16_v_i16m1(p + j, vl);
+          vint16m1_t b = __riscv_vle16_v_i16m1(p + len + j, vl);
+          vint16m1_t t = fqmul_vx(b, z, zq, vl);
+          __riscv_vse16_v_i16m1(p + len + j, __riscv_vsub_vv_i16m1(a, t, vl), vl);
+          __riscv_vse16_v_i16m1(p + j,       __riscv_vadd_vv_i16m1(a, t, vl), vl);
+        }
+      }
+    } else {
+      ptrdiff_t stride = 2 * len * sizeof(int16_t);
+
+      for (size_t j = 0; j < len; j++) {
+        for (size_t g = 0; g < groups; g += vl) {
+          vl = __riscv_vsetvl_e16m1(groups - g);
+          int16_t*   p  = c + 2 * len * g + j;
+          vint16m1_t z  = __riscv_vle16_v_i16m1(kZetas + groups + g, vl);
+          vint16m1_t zq = __riscv_vle16_v_i16m1(kZetasQinv + groups + g, vl);
+          vint16m1_t a  = __riscv_vlse16_v_i16m1(p, stride, vl);
+          vint16m1_t b  = __riscv_vlse16_v_i16m1(p + len, stride, vl);
+          vint16m1_t t  = fqmul_vv(b, z, zq, vl);
+          __riscv_vsse16_v_i16m1(p + len, stride, __riscv_vsub_vv_i16m1(a, t, vl), vl);
+          __riscv_vsse16_v_i16m1(p,       stride, __riscv_vadd_vv_i16m1(a, t, vl), vl);
+        }
+      }
+    }
+  }
+
+  mlkem_poly_reduce(r);
+}
+
+// Gentleman-Sande butterflies: a' = a + b, b' = zeta * (b - a)
+void mlkem_poly_invntt_tomont(mlkem_poly_t* r) {
+  int16_t* c = r->coeffs;
+  size_t   vl;
+
+  for (size_t len = 2; len <= 128; len <<= 1) {
+    size_t groups = 128 / len;
+    size_t k      = 128 - 2 * groups;   // kZetasRev index of the first block
+
+    if (len >= groups) {
+      for (size_t g = 0; g < groups; g++) {
+        int16_t* p  = c + 2 * len * g;
+        int16_t  z  = kZetasRev    [k + g];
+        int16_t  zq = kZetasRevQinv[k + g];
+
+        for (size_t j = 0; j < len; j += vl) {
+          vl = __riscv_vsetvl_e16m1(len - j);
+          vint16m1_t a = __riscv_vle16_v_i16m1(p + j, vl);
+          vint16m1_t b = __riscv_vle16_v_i16m1(p + len + j, vl);
+          vint16m1_t t = __riscv_vsub_vv_i16m1(b, a, vl);
+          __riscv_vse16_v_i16m1(p + j,       barrett(__riscv_vadd_vv_i16m1(a, b, vl), vl), vl);
+          __riscv_vse16_v_i16m1(p + len + j, fqmul_vx(t, z, zq, vl), vl);
+        }
+      }
+    } else {
+      ptrdiff_t stride = 2 * len * sizeof(int16_t);
+
+      for (size_t j = 0; j < len; j++) {
+        for (size_t g = 0; g < groups; g += vl) {
+          vl = __riscv_vsetvl_e16m1(groups - g);
+          int16_t*   p  = c + 2 * len * g + j;
+          vint16m1_t z  = __riscv_vle16_v_i16m1(kZetasRev + k + g, vl);
+          vint16m1_t zq = __riscv_vle16_v_i16m1(kZetasRevQinv + k + g, vl);
+          vint16m1_t a  = __riscv_vlse16_v_i16m1(p, stride, vl);
+          vint16m1_t b  = __riscv_vlse16_v_i16m1(p + len, stride, vl);
+          vint16m1_t t  = __riscv_vsub_vv_i16m1(b, a, vl);
+          __riscv_vsse16_v_i16m1(p,       stride, barrett(__riscv_vadd_vv_i16m1(a, b, vl), vl), vl);
+          __riscv_vsse16_v_i16m1(p + len, stride, fqmul_vv(t, z, zq, vl), vl);
+        }
+      }
+    }
+  }
+
+  for (size_t i = 0; i < MLKEM_N; i += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N - i);
+    vint16m1_t a = __riscv_vle16_v_i16m1(c + i, vl);
+    __riscv_vse16_v_i16m1(c + i, fqmul_vx(a, MLKEM_F, MLKEM_F_QINV, vl), vl);
+  }
+}
+
+void mlkem_poly_reduce(mlkem_poly_t* r) {
+  size_t vl;
+  for (size_t i = 0; i < MLKEM_N; i += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N - i);
+    vint16m1_t a = __riscv_vle16_v_i16m1(r->coeffs + i, vl);
+    __riscv_vse16_v_i16m1(r->coeffs + i, barrett(a, vl), vl);
+  }
+}
+
+void mlkem_poly_tomont(mlkem_poly_t* r) {
+  size_t vl;
+  for (size_t i = 0; i < MLKEM_N; i += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N - i);
+    vint16m1_t a = __riscv_vle16_v_i16m1(r->coeffs + i, vl);
+    __riscv_vse16_v_i16m1(r->coeffs + i, fqmul_vx(a, MLKEM_MONT2, MLKEM_MONT2_QINV, vl), vl);
+  }
+}
+
+void mlkem_poly_add(mlkem_poly_t* r, const mlkem_poly_t* a, const mlkem_poly_t* b) {
+  size_t vl;
+  for (size_t i = 0; i < MLKEM_N; i += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N - i);
+    vint16m1_t x = __riscv_vle16_v_i16m1(a->coeffs + i, vl);
+    vint16m1_t y = __riscv_vle16_v_i16m1(b->coeffs + i, vl);
+    __riscv_vse16_v_i16m1(r->coeffs + i, __riscv_vadd_vv_i16m1(x, y, vl), vl);
+  }
+}
+
+void mlkem_poly_sub(mlkem_poly_t* r, const mlkem_poly_t* a, const mlkem_poly_t* b) {
+  size_t vl;
+  for (size_t i = 0; i < MLKEM_N; i += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N - i);
+    vint16m1_t x = __riscv_vle16_v_i16m1(a->coeffs + i, vl);
+    vint16m1_t y = __riscv_vle16_v_i16m1(b->coeffs + i, vl);
+    __riscv_vse16_v_i16m1(r->coeffs + i, __riscv_vsub_vv_i16m1(x, y, vl), vl);
+  }
+}
+
+/*
+ * Products in Z_q[X]/(X^2 - zeta) of the 128 coefficient pairs
+ * (a0 + a1*X), with the even and odd coefficients split by strided loads:
+ *   r0 = a0*b0 + a1*b1*zeta,  r1 = a0*b1 + a1*b0
+ * The sum over the K products stays below 6q before the final reduction.
+ */
+void mlkem_polyvec_basemul_acc(mlkem_poly_t* r, const mlkem_polyvec_t* a, const mlkem_polyvec_t* b) {
+  const ptrdiff_t stride = 2 * sizeof(int16_t);
+  size_t vl;
+
+  for (size_t p = 0; p < MLKEM_N / 2; p += vl) {
+    vl = __riscv_vsetvl_e16m1(MLKEM_N / 2 - p);
+
+    vint16m1_t z  = __riscv_vle16_v_i16m1(kZetasMul + p, vl);
+    vint16m1_t zq = __riscv_vle16_v_i16m1(kZetasMulQinv + p, vl);
+    vint16m1_t r0 = __riscv_vmv_v_x_i16m1(0, vl);
+    vint16m1_t r1 = __riscv_vmv_v_x_i16m1(0, vl);
+
+    for (size_t i = 0; i < MLKEM_K; i++) {
+      const int16_t* pa = a->vec[i].coeffs + 2 * p;
+      const int16_t* pb = b->vec[i].coeffs + 2 * p;
+
+      vint16m1_t a0 = __riscv_vlse16_v_i16m1(pa,     stride, vl);
+      vint16m1_t a1 = __riscv_vlse16_v_i16m1(pa + 1, stride, vl);
+      vint16m1_t b0 = __riscv_vlse16_v_i16m1(pb,     stride, vl);
+      vint16m1_t b1 = __riscv_vlse16_v_i16m1(pb + 1, stride, vl);
+
+      vint16m1_t t  = fqmul_vv(fqmul(a1, b1, vl), z, zq, vl);
+      r0 = __riscv_vadd_vv_i16m1(r0, t, vl);
+      r0 = __riscv_vadd_vv_i16m1(r0, fqmul(a0, b0, vl), vl);
+      r1 = __riscv_vadd_vv_i16m1(r1, fqmul(a0, b1, vl), vl);
+      r1 = __riscv_vadd_vv_i16m1(r1, fqmul(a1, b0, vl), vl);
+    }
+
+    __riscv_vsse16_v_i16m1(r->coeffs + 2 * p,     stride, barrett(r0, vl), vl);
+    __riscv_vsse16_v_i16m1(r->coeffs + 2 * p + 1, stride, barrett(r1, vl), vl);
+  }
+}
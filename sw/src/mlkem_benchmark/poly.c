@@ -0,0 +1,239 @@
+/*
+ * File      : poly.c
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: Serialisation, compression and sampling of ML-KEM
+ * polynomials. The SHAKE streams of the matrix and of the noise are
+ * independent and are squeezed together, one stream per vector lane.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/mlkem/api_mlkem.h"
+#include "crypto/mlkem/mlkem_poly.h"
+#include "crypto/sha3/fips202.h"
+
+// SHAKE128 blocks squeezed up front for a matrix entry, enough for 256
+// coefficients with high probability
+#define GEN_MATRIX_NBLOCKS  3
+#define GEN_MATRIX_BUFBYTES (GEN_MATRIX_NBLOCKS * SHAKE128_RATE)
+
+// PRF output of CBD_2 (64*eta bytes) fits into one SHAKE256 block
+#define NOISE_BYTES         (64 * MLKEM_ETA1)
+
+// floor(x / q) = (x * 2^40/q) >> 40 for x < 2^11 * q
+#define DIV_Q(x)            ((uint32_t)(((uint64_t)(x) * 330282857UL) >> 40))
+
+// map a coefficient from (-q, q) to [0, q)
+static inline uint16_t to_unsigned(int16_t a) {
+  a += (a >> 15) & MLKEM_Q;
+  return (uint16_t)a;
+}
+
+void mlkem_poly_tobytes(uint8_t r[MLKEM_POLYBYTES], const mlkem_poly_t* a) {
+  for (size_t i = 0; i < MLKEM_N / 2; i++) {
+    uint16_t t0 = to_unsigned(a->coeffs[2 * i]);
+    uint16_t t1 = to_unsigned(a->coeffs[2 * i + 1]);
+    r[3 * i + 0] = (uint8_t)(t0);
+    r[3 * i + 1] = (uint8_t)((t0 >> 8) | (t1 << 4));
+    r[3 * i + 2] = (uint8_t)(t1 >> 4);
+  }
+}
+
+void mlkem_poly_frombytes(mlkem_poly_t* r, const uint8_t a[MLKEM_POLYBYTES]) {
+  for (size_t i = 0; i < MLKEM_N / 2; i++) {
+    r->coeffs[2 * i]     = ((a[3 * i + 0] >> 0) | ((uint16_t)a[3 * i + 1] << 8)) & 0xfff;
+    r->coeffs[2 * i + 1] = ((a[3 * i + 1] >> 4) | ((uint16_t)a[3 * i + 2] << 4)) & 0xfff;
+  }
+}
+
+// Compress_4: round(16 * a / q) mod 16, two coefficients per byte
+void mlkem_poly_compress(uint8_t r[MLKEM_POLYCOMPBYTES], const mlkem_poly_t* a) {
+  uint8_t t[8];
+
+  for (size_t i = 0; i < MLKEM_N / 8; i++) {
+    for (size_t j = 0; j < 8; j++) {
+      uint32_t u = to_unsigned(a->coeffs[8 * i + j]);
+      t[j] = DIV_Q((u << 4) + MLKEM_Q / 2) & 0xf;
+    }
+    r[4 * i + 0] = t[0] | (t[1] << 4);
+    r[4 * i + 1] = t[2] | (t[3] << 4);
+    r[4 * i + 2] = t[4] | (t[5] << 4);
+    r[4 * i + 3] = t[6] | (t[7] << 4);
+  }
+}
+
+void mlkem_poly_decompress(mlkem_poly_t* r, const uint8_t a[MLKEM_POLYCOMPBYTES]) {
+  for (size_t i = 0; i < MLKEM_N / 2; i++) {
+    r->coeffs[2 * i]     = (((uint16_t)(a[i] & 0xf) * MLKEM_Q) + 8) >> 4;
+    r->coeffs[2 * i + 1] = (((uint16_t)(a[i] >> 4)  * MLKEM_Q) + 8) >> 4;
+  }
+}
+
+// Compress_10: four coefficients into five bytes
+void mlkem_polyvec_compress(uint8_t r[MLKEM_POLYVECCOMPBYTES], const mlkem_polyvec_t* a) {
+  uint16_t t[4];
+
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    for (size_t j = 0; j < MLKEM_N / 4; j++) {
+      for (size_t k = 0; k < 4; k++) {
+        uint32_t u = to_unsigned(a->vec[i].coeffs[4 * j + k]);
+        t[k] = DIV_Q((u << 10) + MLKEM_Q / 2) & 0x3ff;
+      }
+      r[0] = (uint8_t)(t[0]);
+      r[1] = (uint8_t)((t[0] >> 8) | (t[1] << 2));
+      r[2] = (uint8_t)((t[1] >> 6) | (t[2] << 4));
+      r[3] = (uint8_t)((t[2] >> 4) | (t[3] << 6));
+      r[4] = (uint8_t)(t[3] >> 2);
+      r += 5;
+    }
+  }
+}
+
+void mlkem_polyvec_decompress(mlkem_polyvec_t* r, const uint8_t a[MLKEM_POLYVECCOMPBYTES]) {
+  uint16_t t[4];
+
+  for (size_t i = 0; i < MLKEM_K; i++) {
+    for (size_t j = 0; j < MLKEM_N / 4; j++) {
+      t[0] = (a[0] >> 0) | ((uint16_t)a[1] << 8);
+      t[1] = (a[1] >> 2) | ((uint16_t)a[2] << 6);
+      t[2] = (a[2] >> 4) | ((uint16_t)a[3] << 4);
+      t[3] = (a[3] >> 6) | ((uint16_t)a[4] << 2);
+      a += 5;
+      for (size_t k = 0; k < 4; k++) {
+        r->vec[i].coeffs[4 * j + k] = ((uint32_t)(t[k] & 0x3ff) * MLKEM_Q + 512) >> 10;
+      }
+    }
+  }
+}
+
+// Decompress_1 of the message bits, selected without branches
+void mlkem_poly_frommsg(mlkem_poly_t* r, const uint8_t msg[MLKEM_SYMBYTES]) {
+  for (size_t i = 0; i < MLKEM_N / 8; i++) {
+    for (size_t j = 0; j < 8; j++) {
+      int16_t mask = -(int16_t)((msg[i] >> j) & 1);
+      r->coeffs[8 * i + j] = mask & ((MLKEM_Q + 1) / 2);
+    }
+  }
+}
+
+void mlkem_poly_tomsg(uint8_t msg[MLKEM_SYMBYTES], const mlkem_poly_t* a) {
+  for (size_t i = 0; i < MLKEM_N / 8; i++) {
+    msg[i] = 0;
+    for (size_t j = 0; j < 8; j++) {
+      uint32_t u = to_unsigned(a->coeffs[8 * i + j]);
+      msg[i] |= (DIV_Q((u << 1) + MLKEM_Q / 2) & 1) << j;
+    }
+  }
+}
+
+/*
+ * SampleNTT: parse 12b candidates from the stream and keep those below q.
+ * Returns the number of coefficients in r, which continues at offset ctr.
+ */
+static size_t rej_uniform(int16_t* r, size_t ctr, const uint8_t* buf, size_t buflen) {
+  for (size_t pos = 0; ctr < MLKEM_N && pos + 3 <= buflen; pos += 3) {
+    uint16_t d1 = ((buf[pos + 0] >> 0) | ((uint16_t)buf[pos + 1] << 8)) & 0xfff;
+    uint16_t d2 = ((buf[pos + 1] >> 4) | ((uint16_t)buf[pos + 2] << 4)) & 0xfff;
+
+    if (d1 < MLKEM_Q) {
+      r[ctr++] = d1;
+    }
+    if (d2 < MLKEM_Q && ctr < MLKEM_N) {
+      r[ctr++] = d2;
+    }
+  }
+  return ctr;
+}
+
+/*
+ * The K*K entries are sampled in batches of keccak_x_lanes() streams. Any
+ * stream that rejected too many candidates squeezes further blocks, which
+ * are squeezed for the whole batch since the lanes share one instruction
+ * stream anyway.
+ */
+void mlkem_gen_matrix(mlkem_polyvec_t a[MLKEM_K], const uint8_t rho[MLKEM_SYMBYTES], int transposed) {
+
+  keccak_x_t st;
+  uint8_t    seed [KECCAK_LANES][MLKEM_SYMBYTES + 2];
+  uint64_t   buf  [KECCAK_LANES][GEN_MATRIX_BUFBYTES / 8];
+  size_t     ctr  [KECCAK_LANES];
+  size_t     lanes = keccak_x_lanes();
+
+  for (size_t e = 0; e < MLKEM_K * MLKEM_K; e += lanes) {
+    size_t vl   = (MLKEM_K * MLKEM_K - e) < lanes ? (MLKEM_K * MLKEM_K - e) : lanes;
+    size_t done = 0;
+
+    for (size_t l = 0; l < vl; l++) {
+      size_t i = (e + l) / MLKEM_K;
+      size_t j = (e + l) % MLKEM_K;
+      memcpy(seed[l], rho, MLKEM_SYMBYTES);
+      seed[l][MLKEM_SYMBYTES + 0] = transposed ? i : j;
+      seed[l][MLKEM_SYMBYTES + 1] = transposed ? j : i;
+    }
+
+    keccak_x_absorb_once(&st, SHAKE128_RATE, SHAKE_PAD, seed[0], sizeof(seed[0]),
+                         sizeof(seed[0]), vl);
+    keccak_x_squeezeblocks((uint8_t*)buf, sizeof(buf[0]), GEN_MATRIX_NBLOCKS, &st,
+                           SHAKE128_RATE, vl);
+
+    for (size_t l = 0; l < vl; l++) {
+      int16_t* r = a[(e + l) / MLKEM_K].vec[(e + l) % MLKEM_K].coeffs;
+      ctr[l] = rej_uniform(r, 0, (uint8_t*)buf[l], GEN_MATRIX_BUFBYTES);
+      done  += (ctr[l] == MLKEM_N);
+    }
+
+    while (done < vl) {
+      keccak_x_squeezeblocks((uint8_t*)buf, sizeof(buf[0]), 1, &st, SHAKE128_RATE, vl);
+
+      for (size_t l = 0; l < vl; l++) {
+        if (ctr[l] < MLKEM_N) {
+          int16_t* r = a[(e + l) / MLKEM_K].vec[(e + l) % MLKEM_K].coeffs;
+          ctr[l] = rej_uniform(r, ctr[l], (uint8_t*)buf[l], SHAKE128_RATE);
+          done  += (ctr[l] == MLKEM_N);
+        }
+      }
+    }
+  }
+}
+
+// CBD_2: each coefficient is the difference of two sums of 2 bits
+static void cbd2(mlkem_poly_t* r, const uint8_t buf[NOISE_BYTES]) {
+  for (size_t i = 0; i < MLKEM_N / 8; i++) {
+    uint32_t t = (uint32_t)buf[4 * i] | ((uint32_t)buf[4 * i + 1] << 8) |
+                 ((uint32_t)buf[4 * i + 2] << 16) | ((uint32_t)buf[4 * i + 3] << 24);
+    uint32_t d = (t & 0x55555555) + ((t >> 1) & 0x55555555);
+
+    for (size_t j = 0; j < 8; j++) {
+      int16_t x = (d >> (4 * j + 0)) & 0x3;
+      int16_t y = (d >> (4 * j + 2)) & 0x3;
+      r->coeffs[8 * i + j] = x - y;
+    }
+  }
+}
+
+void mlkem_poly_getnoise(mlkem_poly_t* r, size_t n, const uint8_t seed[MLKEM_SYMBYTES], uint8_t nonce) {
+
+  keccak_x_t st;
+  uint8_t    in  [KECCAK_LANES][MLKEM_SYMBYTES + 1];
+  uint64_t   buf [KECCAK_LANES][SHAKE256_RATE / 8];
+  size_t     lanes = keccak_x_lanes();
+
+  for (size_t p = 0; p < n; p += lanes) {
+    size_t vl = (n - p) < lanes ? (n - p) : lanes;
+
+    for (size_t l = 0; l < vl; l++) {
+      memcpy(in[l], seed, MLKEM_SYMBYTES);
+      in[l][MLKEM_SYMBYTES] = nonce + p + l;
+    }
+
+    keccak_x_absorb_once(&st, SHAKE256_RATE, SHAKE_PAD, in[0], sizeof(in[0]), sizeof(in[0]), vl);
+    keccak_x_squeezeblocks((uint8_t*)buf, sizeof(buf[0]), 1, &st, SHAKE256_RATE, vl);
+
+    for (size_t l = 0; l < vl; l++) {
+      cbd2(&r[p + l], (uint8_t*)buf[l]);
+    }
+  }
+}
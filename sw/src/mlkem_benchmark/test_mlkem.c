@@ -0,0 +1,164 @@
+/*
+ * File      : test_mlkem.c
+ * Test      : mlkem_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of ML-KEM-768 key generation,
+ * encapsulation and decapsulation.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/mlkem/api_mlkem.h"
+#include "crypto/sha3/fips202.h"
+
+#include "mlkem_vectors.h"
+
+typedef struct {
+  perf_log_t keypair;
+  perf_log_t enc;
+  perf_log_t dec;
+} mlkem_perf_log_t;
+
+static mlkem_perf_log_t perf_log = {0};
+
+static uint8_t pk [MLKEM768_PUBLICKEYBYTES];
+static uint8_t sk [MLKEM768_SECRETKEYBYTES];
+static uint8_t ct [MLKEM768_CIPHERTEXTBYTES];
+
+static uint32_t check_digest(const char* name, const uint8_t* in, size_t inlen,
+                             const uint8_t expected[32]) {
+  uint8_t md [32];
+
+  sha3_256(md, in, inlen);
+  if (memcmp(md, expected, sizeof(md))) {
+    printf("# ML-KEM: %s does not match the known answer!\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+static uint32_t test_mlkem(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  uint8_t  coins   [2 * MLKEM_SYMBYTES];
+  uint8_t  msg     [MLKEM_SYMBYTES];
+  uint8_t  ss_enc  [MLKEM_SSBYTES];
+  uint8_t  ss_dec  [MLKEM_SSBYTES];
+
+  for (int i = 0; i < 2 * MLKEM_SYMBYTES; i++) {
+    coins[i] = i;
+  }
+  for (int i = 0; i < MLKEM_SYMBYTES; i++) {
+    msg[i] = 2 * MLKEM_SYMBYTES + i;
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# ML-KEM-768 test %d/%d:\n", i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    mlkem768_keypair(pk, sk, coins);
+    volatile uint64_t kg_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t kg_ccount = test_rdcycle() - start_cycles;
+    perf_log.keypair.icount[i] = kg_icount;
+    perf_log.keypair.ccount[i] = kg_ccount;
+
+    printf("# keygen:\n");
+    printf("#\tinstret = %020lu\n", kg_icount);
+    printf("#\tcycles  = %020lu\n", kg_ccount);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret_enc = mlkem768_enc(ct, ss_enc, pk, msg);
+    volatile uint64_t enc_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t enc_ccount = test_rdcycle() - start_cycles;
+    perf_log.enc.icount[i] = enc_icount;
+    perf_log.enc.ccount[i] = enc_ccount;
+
+    printf("# encaps:\n");
+    printf("#\tinstret = %020lu\n", enc_icount);
+    printf("#\tcycles  = %020lu\n", enc_ccount);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret_dec = mlkem768_dec(ss_dec, ct, sk);
+    volatile uint64_t dec_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t dec_ccount = test_rdcycle() - start_cycles;
+    perf_log.dec.icount[i] = dec_icount;
+    perf_log.dec.ccount[i] = dec_ccount;
+
+    printf("# decaps:\n");
+    printf("#\tinstret = %020lu\n", dec_icount);
+    printf("#\tcycles  = %020lu\n", dec_ccount);
+
+    fail += (ret_enc != MLKEM_OK) || (ret_dec != MLKEM_OK);
+    fail += check_digest("encapsulation key", pk, sizeof(pk), mlkem_pk_sha3);
+    fail += check_digest("decapsulation key", sk, sizeof(sk), mlkem_sk_sha3);
+    fail += check_digest("ciphertext", ct, sizeof(ct), mlkem_ct_sha3);
+    fail += memcmp(ss_enc, mlkem_ss, MLKEM_SSBYTES) != 0;
+    fail += memcmp(ss_dec, mlkem_ss, MLKEM_SSBYTES) != 0;
+  }
+
+  // a modified ciphertext must decapsulate to the implicit rejection key
+  ct[0] ^= 0x01;
+  mlkem768_dec(ss_dec, ct, sk);
+  if (memcmp(ss_dec, mlkem_ss_reject, MLKEM_SSBYTES)) {
+    printf("# ML-KEM: implicit rejection failed!\n");
+    fail++;
+  }
+
+  // an encapsulation key with a coefficient >= q must be rejected
+  pk[0]  = 0xff;
+  pk[1] |= 0x0f;
+  if (mlkem768_enc(ct, ss_enc, pk, msg) != MLKEM_ERR_KEY) {
+    printf("# ML-KEM: modulus check failed!\n");
+    fail++;
+  }
+
+  perf_log.keypair.ccount_average = average_count(perf_log.keypair.ccount);
+  perf_log.keypair.icount_average = average_count(perf_log.keypair.icount);
+  perf_log.enc.ccount_average     = average_count(perf_log.enc.ccount);
+  perf_log.enc.icount_average     = average_count(perf_log.enc.icount);
+  perf_log.dec.ccount_average     = average_count(perf_log.dec.ccount);
+  perf_log.dec.icount_average     = average_count(perf_log.dec.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for ML-KEM-768 (%lu SHAKE lanes per batch)\n", keccak_x_lanes());
+
+  fail += test_mlkem(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tML-KEM-768:\n");
+  printf("#\tkeypair.icount = %05lu\n", perf_log.keypair.icount_average);
+  printf("#\tkeypair.ccount = %05lu\n", perf_log.keypair.ccount_average);
+  printf("#\tenc.icount     = %05lu\n", perf_log.enc.icount_average);
+  printf("#\tenc.ccount     = %05lu\n", perf_log.enc.ccount_average);
+  printf("#\tdec.icount     = %05lu\n", perf_log.dec.icount_average);
+  printf("#\tdec.ccount     = %05lu\n", perf_log.dec.ccount_average);
+
+  bench_record_log("mlkem768 keypair", 0, 1, &perf_log.keypair);
+  bench_record_log("mlkem768 enc",     0, 1, &perf_log.enc);
+  bench_record_log("mlkem768 dec",     0, 1, &perf_log.dec);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
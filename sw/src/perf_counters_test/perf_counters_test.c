@@ -0,0 +1,105 @@
+/*
+ * File      : perf_counters_test.c
+ * Test      : perf_counters_test
+ * Date      : 19-oct-2026
+ * Description: Smoke test of the CTRL performance counters (perf_counters.h).
+ * Encrypts a few AES-128 blocks with the Zvkned kernel while counting and
+ * checks that the cycles, the AES busy cycles, the crypto unit issues and
+ * the VLSU bytes moved while the other crypto types stayed idle, that a
+ * stopped counter holds its value and that a start clears it.
+ */
+
+#include <stdint.h>
+#include <string.h>
+
+#include "printf.h"
+#include "perf_counters.h"
+#include "runtime.h"
+
+#include "crypto/aes/zvkned.h"
+
+#define PERF_TEST_BLOCKS 16
+#define PERF_TEST_BYTES  (16 * PERF_TEST_BLOCKS)
+
+// FIPS-197 appendix C.1
+static const uint8_t aes128_key [16] = {
+  0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e, 0x0f
+};
+static const uint8_t aes128_pt  [16] = {
+  0x00, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99, 0xaa, 0xbb, 0xcc, 0xdd, 0xee, 0xff
+};
+static const uint8_t aes128_ct  [16] = {
+  0x69, 0xc4, 0xe0, 0xd8, 0x6a, 0x7b, 0x04, 0x30, 0xd8, 0xcd, 0xb7, 0x80, 0x70, 0xb4, 0xc5, 0x5a
+};
+
+static uint32_t rk  [44];
+static uint8_t  in  [PERF_TEST_BYTES];
+static uint8_t  out [PERF_TEST_BYTES];
+
+static uint32_t check(const char* what, int ok) {
+  if (!ok) {
+    printf("# perf counters: %s failed!\n", what);
+  }
+  return !ok;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+  perf_counters_t   s, held;
+
+  init_vrf();
+
+  printf("\nCTRL performance counters\n");
+
+  for (unsigned b = 0; b < PERF_TEST_BLOCKS; b++) {
+    memcpy(in + 16 * b, aes128_pt, 16);
+  }
+  zvkned_aes128_expand_key(rk, aes128_key);
+
+  perf_counters_start();
+  zvkned_aes128_encode_vs_lmul1(out, in, PERF_TEST_BYTES, rk);
+  // wait for Ara to finish the stores before stopping
+  asm volatile("fence" ::: "memory");
+  perf_counters_stop();
+
+  perf_counters_sample(&s);
+  perf_counters_print(&s);
+
+  for (unsigned b = 0; b < PERF_TEST_BLOCKS; b++) {
+    fail += check("AES-128 result", memcmp(out + 16 * b, aes128_ct, 16) == 0);
+  }
+
+  fail += check("cycles", s.count[PERF_CNT_CYCLES] > 0);
+  fail += check("AES busy", s.count[PERF_CNT_CRYPTO_BUSY(PERF_CRYPTO_AES)] > 0);
+  fail += check("AES busy within cycles",
+                s.count[PERF_CNT_CRYPTO_BUSY(PERF_CRYPTO_AES)] <= s.count[PERF_CNT_CYCLES]);
+  for (unsigned t = 0; t < PERF_CRYPTO_TYPES; t++) {
+    if (t != PERF_CRYPTO_AES) {
+      fail += check("idle crypto types", s.count[PERF_CNT_CRYPTO_BUSY(t)] == 0);
+    }
+  }
+  fail += check("crypto unit issues", s.count[PERF_CNT_VINSN_ISSUED(PERF_VFU_CRYPTO)] > 0);
+  fail += check("load bytes", s.count[PERF_CNT_LOAD_BYTES] >= PERF_TEST_BYTES);
+  fail += check("store bytes", s.count[PERF_CNT_STORE_BYTES] >= PERF_TEST_BYTES);
+
+  // stopped counters hold
+  perf_counters_sample(&held);
+  fail += check("stopped counters hold",
+                memcmp(&held, &s, sizeof(s)) == 0);
+
+  // a start clears, nothing ran in between
+  perf_counters_start();
+  perf_counters_stop();
+  fail += check("start clears", perf_counters_read(PERF_CNT_CRYPTO_BUSY(PERF_CRYPTO_AES)) == 0 &&
+                                perf_counters_read(PERF_CNT_LOAD_BYTES) == 0 &&
+                                perf_counters_read(PERF_CNT_CYCLES) < s.count[PERF_CNT_CYCLES]);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    printf("\nperf counters test passed\n");
+    return 0;
+  }
+}
@@ -0,0 +1,308 @@
+/*
+ * File      : bignum.c
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: Radix 2^32 Montgomery multiplication (scalar CIOS and vector)
+ * and sliding-window modular exponentiation.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/rsa/bignum.h"
+
+//  default to the vector implementations
+bn_mont_mul_func bn_mont_mul = &bn_mont_mul_vec;
+void (*bn_mont_sqr)(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a)
+  = &bn_mont_sqr_vec;
+
+/********************************** helpers ***********************************/
+
+int bn_cmp(const uint32_t* a, const uint32_t* b, size_t limbs) {
+  for (size_t i = limbs; i-- > 0; ) {
+    if (a[i] != b[i]) {
+      return (a[i] > b[i]) ? 1 : -1;
+    }
+  }
+  return 0;
+}
+
+// r = a - b, returns the borrow
+static uint32_t bn_sub(uint32_t* r, const uint32_t* a, const uint32_t* b, size_t limbs) {
+  uint64_t borrow = 0;
+  for (size_t i = 0; i < limbs; i++) {
+    uint64_t d = (uint64_t)a[i] - b[i] - borrow;
+    r[i]   = (uint32_t)d;
+    borrow = (d >> 32) & 1;
+  }
+  return (uint32_t)borrow;
+}
+
+// final step of a Montgomery product: t has limbs+1 limbs and t < 2N
+static void bn_mont_final_sub(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* t) {
+  size_t n = ctx->limbs;
+  if (t[n] || bn_cmp(t, ctx->n, n) >= 0) {
+    bn_sub(r, t, ctx->n, n);
+  } else {
+    memcpy(r, t, n * sizeof(uint32_t));
+  }
+}
+
+void bn_from_bytes_be(uint32_t* r, size_t limbs, const uint8_t* in, size_t len) {
+  memset(r, 0, limbs * sizeof(uint32_t));
+  for (size_t i = 0; i < len; i++) {
+    size_t byte = len - 1 - i;   // significance of in[i]
+    r[byte / 4] |= (uint32_t)(in[i]) << (8 * (byte % 4));
+  }
+}
+
+void bn_to_bytes_be(uint8_t* out, size_t len, const uint32_t* a, size_t limbs) {
+  for (size_t i = 0; i < len; i++) {
+    size_t byte = len - 1 - i;
+    out[i] = (byte / 4 < limbs) ? (uint8_t)(a[byte / 4] >> (8 * (byte % 4))) : 0;
+  }
+}
+
+/*************************** Montgomery (scalar) ******************************/
+
+// Coarsely Integrated Operand Scanning, see Koc et al. "Analyzing and
+// Comparing Montgomery Multiplication Algorithms".
+void bn_mont_mul_scalar(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a, const uint32_t* b) {
+  size_t   n = ctx->limbs;
+  uint32_t t[BN_MAX_LIMBS + 2] = {0};
+
+  for (size_t i = 0; i < n; i++) {
+    uint64_t c = 0;
+    for (size_t j = 0; j < n; j++) {
+      c    = (uint64_t)t[j] + (uint64_t)a[i] * b[j] + (c >> 32);
+      t[j] = (uint32_t)c;
+    }
+    c      = (uint64_t)t[n] + (c >> 32);
+    t[n]   = (uint32_t)c;
+    t[n+1] = (uint32_t)(c >> 32);
+
+    uint32_t u = t[0] * ctx->n0;
+    c = (uint64_t)t[0] + (uint64_t)u * ctx->n[0];
+    for (size_t j = 1; j < n; j++) {
+      c      = (uint64_t)t[j] + (uint64_t)u * ctx->n[j] + (c >> 32);
+      t[j-1] = (uint32_t)c;
+    }
+    c      = (uint64_t)t[n] + (c >> 32);
+    t[n-1] = (uint32_t)c;
+    t[n]   = t[n+1] + (uint32_t)(c >> 32);
+  }
+
+  bn_mont_final_sub(ctx, r, t);
+}
+
+void bn_mont_sqr_scalar(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a) {
+  bn_mont_mul_scalar(ctx, r, a, a);
+}
+
+/*************************** Montgomery (vector) ******************************/
+
+/*
+ * Operand scanning over a, with the whole of b/N held in one register group
+ * (one 32b limb per element). For every limb a[i]:
+ *
+ *   T += a[i]*B  ;  u = T[0]*n0  ;  T += u*N  ;  T >>= 32
+ *
+ * The 64b partial products are split with vmul (low half, added at limb j)
+ * and vmulhu (high half, slid up to limb j+1). Carries out of each element
+ * are not propagated inside the loop, they are accumulated in C instead
+ * (C[j] has the weight of limb j+1, at most 4 per iteration), which keeps the
+ * loop free of serial dependencies except for the u = T[0]*n0 extraction.
+ * Shifting T down by one limb moves C[j] to the weight of limb j, so C is
+ * folded back into T with a single add at the end of each iteration.
+ *
+ * Squaring uses the same kernel: every row is a single vector operation
+ * regardless of its length, so exploiting the symmetry of a*a would only
+ * shorten the vectors without removing any instruction.
+ */
+static void bn_mont_mul_vec_core(const bn_mont_ctx_t* ctx, uint32_t* t, const uint32_t* a, const uint32_t* b) {
+  size_t n  = ctx->limbs;
+  size_t vl = __riscv_vsetvl_e32m8(n + 1);
+
+  vuint32m8_t vzero = __riscv_vmv_v_x_u32m8(0, vl);
+  // b and N zero extended by one limb
+  vuint32m8_t vb    = __riscv_vle32_v_u32m8_tu(vzero, b, n);
+  vuint32m8_t vn    = __riscv_vle32_v_u32m8_tu(vzero, ctx->n, n);
+  vuint32m8_t vt    = vzero;
+  vuint32m8_t vc    = vzero;
+  vuint32m8_t vlo, vhi;
+  vbool4_t    carry;
+
+  for (size_t i = 0; i < n; i++) {
+    // T += a[i]*B
+    vlo   = __riscv_vmul_vx_u32m8(vb, a[i], vl);
+    vhi   = __riscv_vmulhu_vx_u32m8(vb, a[i], vl);
+    carry = __riscv_vmadc_vv_u32m8_b4(vt, vlo, vl);
+    vt    = __riscv_vadd_vv_u32m8(vt, vlo, vl);
+    vc    = __riscv_vadc_vxm_u32m8(vc, 0, carry, vl);
+    vhi   = __riscv_vslide1up_vx_u32m8(vhi, 0, vl);
+    carry = __riscv_vmadc_vv_u32m8_b4(vt, vhi, vl);
+    vt    = __riscv_vadd_vv_u32m8(vt, vhi, vl);
+    vc    = __riscv_vadc_vxm_u32m8(vc, 0, carry, vl);
+
+    // T += u*N, clears the least significant limb of T
+    uint32_t u = __riscv_vmv_x_s_u32m8_u32(vt) * ctx->n0;
+    vlo   = __riscv_vmul_vx_u32m8(vn, u, vl);
+    vhi   = __riscv_vmulhu_vx_u32m8(vn, u, vl);
+    carry = __riscv_vmadc_vv_u32m8_b4(vt, vlo, vl);
+    vt    = __riscv_vadd_vv_u32m8(vt, vlo, vl);
+    vc    = __riscv_vadc_vxm_u32m8(vc, 0, carry, vl);
+    vhi   = __riscv_vslide1up_vx_u32m8(vhi, 0, vl);
+    carry = __riscv_vmadc_vv_u32m8_b4(vt, vhi, vl);
+    vt    = __riscv_vadd_vv_u32m8(vt, vhi, vl);
+    vc    = __riscv_vadc_vxm_u32m8(vc, 0, carry, vl);
+
+    // T >>= 32 and fold the pending carries back in
+    vt    = __riscv_vslide1down_vx_u32m8(vt, 0, vl);
+    carry = __riscv_vmadc_vv_u32m8_b4(vt, vc, vl);
+    vt    = __riscv_vadd_vv_u32m8(vt, vc, vl);
+    vc    = __riscv_vadc_vxm_u32m8(vzero, 0, carry, vl);
+  }
+
+  // resolve the remaining carries (each at most 1) into n+1 limbs
+  uint32_t c[BN_MAX_LIMBS + 1];
+  __riscv_vse32_v_u32m8(t, vt, vl);
+  __riscv_vse32_v_u32m8(c, vc, vl);
+
+  uint64_t acc = 0;
+  for (size_t j = 0; j <= n; j++) {
+    acc  = (uint64_t)t[j] + (acc >> 32);
+    t[j] = (uint32_t)acc;
+    acc += (uint64_t)c[j] << 32;
+  }
+}
+
+void bn_mont_mul_vec(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a, const uint32_t* b) {
+  uint32_t t[BN_MAX_LIMBS + 1];
+
+  bn_mont_mul_vec_core(ctx, t, a, b);
+  bn_mont_final_sub(ctx, r, t);
+}
+
+void bn_mont_sqr_vec(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a) {
+  uint32_t t[BN_MAX_LIMBS + 1];
+
+  bn_mont_mul_vec_core(ctx, t, a, a);
+  bn_mont_final_sub(ctx, r, t);
+}
+
+/******************************** contexts ************************************/
+
+int bn_mont_init(bn_mont_ctx_t* ctx, const uint32_t* n, size_t limbs) {
+
+  if (limbs == 0 || limbs > BN_MAX_LIMBS || !(n[0] & 1) || !n[limbs - 1]) {
+    return -1;
+  }
+  // whole modulus (plus headroom) must fit into one e32/m8 register group
+  if (__riscv_vsetvlmax_e32m8() < limbs + 1) {
+    return -1;
+  }
+
+  memset(ctx, 0, sizeof(*ctx));
+  memcpy(ctx->n, n, limbs * sizeof(uint32_t));
+  ctx->limbs = limbs;
+
+  // n0 = -N^-1 mod 2^32 (Newton iteration, each step doubles correct bits)
+  uint32_t inv = 1;
+  for (int i = 0; i < 5; i++) {
+    inv *= 2 - n[0] * inv;
+  }
+  ctx->n0 = -inv;
+
+  // RR = 2^(64*limbs) mod N, by repeated modular doubling of 1
+  uint32_t* rr = ctx->rr;
+  rr[0] = 1;
+  for (size_t bit = 0; bit < 2 * BN_LIMB_BITS * limbs; bit++) {
+    uint32_t top = rr[limbs - 1] >> 31;
+    for (size_t j = limbs - 1; j > 0; j--) {
+      rr[j] = (rr[j] << 1) | (rr[j-1] >> 31);
+    }
+    rr[0] <<= 1;
+    if (top || bn_cmp(rr, ctx->n, limbs) >= 0) {
+      bn_sub(rr, rr, ctx->n, limbs);
+    }
+  }
+
+  return 0;
+}
+
+void bn_to_mont(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a) {
+  bn_mont_mul(ctx, r, a, ctx->rr);
+}
+
+void bn_from_mont(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a) {
+  uint32_t one[BN_MAX_LIMBS] = {1};
+  bn_mont_mul(ctx, r, a, one);
+}
+
+/****************************** exponentiation ********************************/
+
+static inline uint32_t bn_exp_bit(const uint32_t* e, size_t bit) {
+  return (e[bit / BN_LIMB_BITS] >> (bit % BN_LIMB_BITS)) & 1;
+}
+
+// Left-to-right sliding window (HAC 14.85) over odd powers a^1..a^(2^w - 1).
+void bn_mod_exp(const bn_mont_ctx_t* ctx, uint32_t* r, const uint32_t* a,
+                const uint32_t* e, size_t e_limbs) {
+
+  uint32_t pow [1 << (BN_EXP_WINDOW - 1)][BN_MAX_LIMBS];
+  uint32_t acc [BN_MAX_LIMBS];
+  uint32_t a2  [BN_MAX_LIMBS];
+  size_t   n = ctx->limbs;
+  size_t   bits = e_limbs * BN_LIMB_BITS;
+
+  while (bits && !bn_exp_bit(e, bits - 1)) {
+    bits--;
+  }
+  if (!bits) {
+    // a^0 = 1
+    memset(r, 0, n * sizeof(uint32_t));
+    r[0] = 1;
+    return;
+  }
+
+  // pow[k] = a^(2k+1) in Montgomery form
+  bn_to_mont(ctx, pow[0], a);
+  bn_mont_sqr(ctx, a2, pow[0]);
+  for (size_t k = 1; k < (1 << (BN_EXP_WINDOW - 1)); k++) {
+    bn_mont_mul(ctx, pow[k], pow[k-1], a2);
+  }
+
+  int    first = 1;
+  size_t i     = bits;
+  while (i > 0) {
+    if (!bn_exp_bit(e, i - 1)) {
+      bn_mont_sqr(ctx, acc, acc);
+      i--;
+      continue;
+    }
+    // longest window e[i-1 .. l] (at most BN_EXP_WINDOW bits) ending in a 1
+    size_t l = (i >= BN_EXP_WINDOW) ? i - BN_EXP_WINDOW : 0;
+    while (!bn_exp_bit(e, l)) {
+      l++;
+    }
+    uint32_t win = 0;
+    for (size_t k = i; k > l; k--) {
+      win = (win << 1) | bn_exp_bit(e, k - 1);
+    }
+    if (first) {
+      memcpy(acc, pow[win >> 1], n * sizeof(uint32_t));
+      first = 0;
+    } else {
+      for (size_t k = i; k > l; k--) {
+        bn_mont_sqr(ctx, acc, acc);
+      }
+      bn_mont_mul(ctx, acc, acc, pow[win >> 1]);
+    }
+    i = l;
+  }
+
+  bn_from_mont(ctx, r, acc);
+}
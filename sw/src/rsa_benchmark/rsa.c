@@ -0,0 +1,103 @@
+/*
+ * File      : rsa.c
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: RSASSA-PKCS1-v1_5 signature verification (RFC 8017) with
+ * SHA-256 digests.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/rsa/api_rsa.h"
+#include "crypto/sha/api_sha256.h"
+
+// DER encoded DigestInfo prefix for SHA-256 (RFC 8017, section 9.2 note 1)
+static const uint8_t kSha256DigestInfo[19] = {
+  0x30, 0x31, 0x30, 0x0d, 0x06, 0x09, 0x60, 0x86, 0x48, 0x01,
+  0x65, 0x03, 0x04, 0x02, 0x01, 0x05, 0x00, 0x04, 0x20
+};
+
+int rsa_pubkey_init(rsa_pubkey_t* key, const uint8_t* modulus, size_t len, uint32_t e) {
+
+  uint32_t n[BN_MAX_LIMBS];
+  size_t   limbs = BN_LIMBS(8 * len);
+
+  if ((len != RSA_2048_BYTES && len != RSA_3072_BYTES) || e < 3 || !(e & 1)) {
+    return RSA_ERR_KEY;
+  }
+
+  bn_from_bytes_be(n, limbs, modulus, len);
+
+  if (bn_mont_init(&key->mont, n, limbs)) {
+    return RSA_ERR_KEY;
+  }
+
+  key->e     = e;
+  key->bytes = len;
+
+  return RSA_OK;
+}
+
+int rsa_public(const rsa_pubkey_t* key, uint8_t* em, const uint8_t* sig) {
+
+  uint32_t s [BN_MAX_LIMBS];
+  uint32_t m [BN_MAX_LIMBS];
+  size_t   limbs = key->mont.limbs;
+
+  bn_from_bytes_be(s, limbs, sig, key->bytes);
+
+  if (bn_cmp(s, key->mont.n, limbs) >= 0) {
+    return RSA_ERR_SIGNATURE;
+  }
+
+  bn_mod_exp(&key->mont, m, s, &key->e, 1);
+  bn_to_bytes_be(em, key->bytes, m, limbs);
+
+  return RSA_OK;
+}
+
+int rsa_verify_pkcs1_sha256_digest(const rsa_pubkey_t* key, const uint8_t digest[32],
+                                   const uint8_t* sig, size_t sig_len) {
+
+  uint8_t em [RSA_3072_BYTES];
+  size_t  k = key->bytes;
+  int     ret;
+
+  if (sig_len != k) {
+    return RSA_ERR_SIGNATURE;
+  }
+
+  if ((ret = rsa_public(key, em, sig)) != RSA_OK) {
+    return ret;
+  }
+
+  // EM = 0x00 || 0x01 || PS (0xff..) || 0x00 || DigestInfo || H
+  size_t   t_len  = sizeof(kSha256DigestInfo) + 32;
+  size_t   ps_end = k - t_len - 1;
+  uint32_t diff   = em[0] | (em[1] ^ 0x01) | em[ps_end];
+
+  for (size_t i = 2; i < ps_end; i++) {
+    diff |= em[i] ^ 0xff;
+  }
+  for (size_t i = 0; i < sizeof(kSha256DigestInfo); i++) {
+    diff |= em[ps_end + 1 + i] ^ kSha256DigestInfo[i];
+  }
+  for (size_t i = 0; i < 32; i++) {
+    diff |= em[k - 32 + i] ^ digest[i];
+  }
+
+  return diff ? RSA_ERR_MISMATCH : RSA_OK;
+}
+
+int rsa_verify_pkcs1_sha256(const rsa_pubkey_t* key, const uint8_t* msg, size_t msg_len,
+                            const uint8_t* sig, size_t sig_len) {
+
+  uint32_t digest [8] __attribute__((aligned(16)));
+
+  // digest words are stored big endian, i.e. in SHA-256 byte order
+  sha256_hash_vec(digest, (uint8_t*)(msg), msg_len);
+
+  return rsa_verify_pkcs1_sha256_digest(key, (const uint8_t*)(digest), sig, sig_len);
+}
@@ -0,0 +1,142 @@
+/*
+ * File      : rsa_vectors.h
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: RSA-2048/3072 (e = 65537) test keys and PKCS#1 v1.5 SHA-256
+ * signatures, generated with OpenSSL (openssl dgst -sha256 -sign).
+ */
+
+#ifndef __RSA_VECTORS_H__
+#define __RSA_VECTORS_H__
+
+#include <stdint.h>
+
+//! Signed message (92 bytes)
+static const char rsa_message[] =
+  "Marian vector-crypto subsystem: RSA PKCS#1 v1.5 SHA-256 signature verification test message.";
+
+//! RSA-2048 modulus (big endian)
+static const uint8_t rsa2048_modulus[256] = {
+  0xc7, 0x18, 0x7c, 0x65, 0x9c, 0x16, 0xa8, 0xe3, 0x5c, 0x3a, 0x55, 0x64,
+  0xb2, 0x87, 0x38, 0x56, 0x51, 0x87, 0xd9, 0x4c, 0xe2, 0x14, 0xcf, 0x7b,
+  0xa6, 0xfe, 0x9a, 0x7a, 0x4d, 0x86, 0x10, 0x6c, 0x76, 0xc3, 0xf9, 0x81,
+  0xbd, 0xf4, 0x4e, 0x5b, 0x7d, 0xd5, 0xbc, 0xc7, 0x20, 0x4b, 0x85, 0x15,
+  0xb3, 0xf4, 0x6a, 0xb0, 0xd2, 0x76, 0x51, 0x1c, 0x12, 0xf9, 0x71, 0xfc,
+  0x38, 0xcc, 0x90, 0x75, 0x89, 0xfc, 0xff, 0x9c, 0x8e, 0x53, 0x0b, 0x40,
+  0xb9, 0xf8, 0xb6, 0x19, 0x8f, 0x7f, 0x7b, 0x10, 0x23, 0x84, 0x3e, 0xae,
+  0x80, 0x72, 0x24, 0x8f, 0xe4, 0x2d, 0xe1, 0xbf, 0xe0, 0x8e, 0x38, 0xd5,
+  0x74, 0x8e, 0x6d, 0xab, 0x82, 0x76, 0x7a, 0x5e, 0x7b, 0x6e, 0x57, 0xe8,
+  0x23, 0x71, 0xa3, 0xd2, 0x5d, 0x8e, 0xdb, 0xec, 0xd7, 0x11, 0x6c, 0xd4,
+  0x10, 0xf1, 0x66, 0x2e, 0xf0, 0x3a, 0x47, 0x19, 0xc3, 0x9c, 0xe8, 0x06,
+  0x5e, 0xba, 0xf7, 0xfa, 0x84, 0x65, 0xe4, 0xe1, 0x49, 0xfb, 0xc3, 0x0e,
+  0xa2, 0xd4, 0xa3, 0x4b, 0xcc, 0xb5, 0xc8, 0xd5, 0x5b, 0xd6, 0xa8, 0x80,
+  0x4d, 0x4e, 0xf9, 0x35, 0x13, 0x90, 0xd3, 0xed, 0xb0, 0x88, 0xc5, 0x20,
+  0x77, 0xd6, 0xab, 0x32, 0x60, 0x13, 0x1a, 0xb1, 0x45, 0x09, 0x8c, 0xaa,
+  0x25, 0x1a, 0x14, 0xc0, 0x01, 0x6d, 0x17, 0xa7, 0x29, 0x88, 0xb7, 0x63,
+  0x77, 0x3a, 0xdf, 0x47, 0x0a, 0x1e, 0x16, 0x3c, 0x72, 0xfe, 0x8a, 0x98,
+  0xa9, 0xc1, 0xc8, 0xa1, 0x9e, 0x0f, 0x24, 0x76, 0x61, 0x13, 0x61, 0x62,
+  0x5f, 0x4e, 0x8b, 0x5a, 0x24, 0x0d, 0xea, 0x0c, 0x5b, 0x54, 0x8e, 0xbd,
+  0xba, 0x0c, 0x61, 0x38, 0x54, 0x89, 0x4e, 0x46, 0xb0, 0x7c, 0xa8, 0x52,
+  0x2e, 0xd8, 0x6b, 0x92, 0x02, 0x4a, 0x9e, 0xcc, 0x58, 0xf9, 0x76, 0xca,
+  0xf6, 0xd2, 0x60, 0x83
+};
+
+//! RSA-2048 signature of rsa_message (big endian)
+static const uint8_t rsa2048_signature[256] = {
+  0xb2, 0xc2, 0xa1, 0x42, 0x8f, 0x65, 0xb1, 0xac, 0x02, 0x97, 0x80, 0xc9,
+  0x3a, 0x48, 0xf9, 0x15, 0xd9, 0xa9, 0xa9, 0x26, 0x6c, 0x82, 0x4b, 0x8a,
+  0xe1, 0x63, 0xfc, 0x45, 0x44, 0x46, 0x52, 0x7e, 0x63, 0x18, 0x41, 0x58,
+  0x14, 0x71, 0xc8, 0x05, 0x7b, 0xca, 0xc4, 0x21, 0x83, 0x66, 0x58, 0xf0,
+  0x54, 0x17, 0xfa, 0xc3, 0xc3, 0x6d, 0xb5, 0xc6, 0xcb, 0xb8, 0x73, 0x3c,
+  0xd3, 0x19, 0xb6, 0x75, 0x96, 0x18, 0xd2, 0xd6, 0xf8, 0x9d, 0xb3, 0x0f,
+  0x58, 0x92, 0x29, 0x3b, 0x31, 0x1f, 0x4a, 0x5e, 0xd4, 0x6e, 0x0f, 0xb9,
+  0x4d, 0x8d, 0xfb, 0xda, 0x8d, 0xfa, 0xf2, 0x34, 0x34, 0x7a, 0x3f, 0x26,
+  0x28, 0xc1, 0x7b, 0xf4, 0x29, 0xdd, 0xf8, 0x6b, 0x31, 0xee, 0xa5, 0xb4,
+  0xb4, 0x6b, 0x24, 0xbe, 0x4d, 0xc3, 0xbe, 0x1a, 0x12, 0xd3, 0xd4, 0x6d,
+  0xa4, 0x0a, 0xb4, 0xb8, 0x4c, 0x0e, 0x73, 0x2c, 0x76, 0x3d, 0x72, 0x6c,
+  0xea, 0x39, 0x8c, 0xa2, 0x02, 0x31, 0x95, 0x13, 0x89, 0xc7, 0xa8, 0x3b,
+  0x7b, 0xfd, 0xfe, 0x18, 0x5d, 0x4c, 0xbc, 0x47, 0x11, 0xea, 0x02, 0xcd,
+  0x51, 0x36, 0x90, 0x48, 0xf7, 0x49, 0xaa, 0xa7, 0x05, 0xdb, 0x9e, 0x77,
+  0x3a, 0x32, 0xc1, 0xf6, 0x9a, 0x73, 0x63, 0x09, 0x93, 0x5f, 0x25, 0x25,
+  0xe3, 0xa8, 0x91, 0xdf, 0x29, 0xcc, 0x25, 0x8b, 0xee, 0xc1, 0xb2, 0x93,
+  0x06, 0x4c, 0x2a, 0x4d, 0x2f, 0x9c, 0xf3, 0x4f, 0x20, 0x45, 0xbb, 0xf2,
+  0x0a, 0x34, 0xfd, 0x57, 0xd8, 0xfc, 0xcd, 0x4b, 0x49, 0xe2, 0xd6, 0xe6,
+  0x21, 0x1b, 0x84, 0xbc, 0xc4, 0x71, 0xb8, 0x54, 0xaf, 0xfb, 0xf9, 0x42,
+  0x2f, 0xb4, 0x2a, 0xc4, 0x1b, 0x0b, 0x47, 0xe3, 0x2d, 0x9d, 0x3e, 0x81,
+  0x79, 0x4c, 0xcc, 0xc2, 0xba, 0x6a, 0x9a, 0xfd, 0x2b, 0x93, 0x07, 0xac,
+  0xc1, 0xec, 0xa6, 0xf4
+};
+
+//! RSA-3072 modulus (big endian)
+static const uint8_t rsa3072_modulus[384] = {
+  0x9d, 0x4a, 0x59, 0xe2, 0xbe, 0x9d, 0x84, 0xf0, 0x22, 0xc7, 0xd9, 0xf2,
+  0xb5, 0x9d, 0x2f, 0x4a, 0x67, 0xd7, 0xfe, 0x80, 0x8f, 0xe1, 0xf2, 0x15,
+  0x57, 0xd1, 0xb0, 0xb2, 0xb7, 0xe2, 0xe1, 0x70, 0xfa, 0x53, 0x95, 0xf5,
+  0xd2, 0x49, 0xf7, 0x1f, 0x36, 0xbb, 0x87, 0x29, 0xe5, 0xda, 0x0a, 0xb4,
+  0x4a, 0x9c, 0x9c, 0xd0, 0xd2, 0x6a, 0x5b, 0xc1, 0x29, 0x4b, 0x5a, 0xb1,
+  0xaa, 0xf2, 0x77, 0x51, 0xf1, 0x80, 0x1b, 0xa4, 0x61, 0x01, 0x4f, 0xfe,
+  0x75, 0x1a, 0x0a, 0x08, 0x7f, 0x9c, 0x36, 0x36, 0x5c, 0xea, 0xfc, 0x00,
+  0x5e, 0xaa, 0xef, 0x0a, 0x50, 0x44, 0x7f, 0xd8, 0xe8, 0x82, 0xdc, 0x86,
+  0x41, 0x84, 0x76, 0x61, 0xff, 0x92, 0xdc, 0xc7, 0xd7, 0x0f, 0xbe, 0x73,
+  0x49, 0x6d, 0x8e, 0xa1, 0x9c, 0xff, 0x57, 0x80, 0x4e, 0x3f, 0xc8, 0x36,
+  0xdf, 0x03, 0x28, 0x0a, 0xa9, 0xe7, 0xb5, 0xe1, 0x5f, 0xd3, 0x19, 0xff,
+  0xf4, 0xd4, 0xc1, 0x19, 0xe2, 0x17, 0x04, 0xe2, 0xee, 0x1e, 0x53, 0xea,
+  0x73, 0x59, 0x40, 0x6b, 0x57, 0xab, 0xe4, 0x5a, 0x82, 0xfd, 0x14, 0x06,
+  0xf1, 0xf7, 0xe2, 0x22, 0x61, 0xbc, 0x0d, 0x74, 0x38, 0x09, 0xd4, 0x52,
+  0x87, 0x0d, 0x81, 0xfb, 0x3c, 0x2c, 0x2c, 0x75, 0x37, 0x89, 0x4e, 0x9f,
+  0x0e, 0xec, 0x15, 0xa5, 0xb7, 0xf1, 0x9c, 0xba, 0xa5, 0x41, 0x50, 0x78,
+  0x6f, 0x34, 0x0b, 0xe9, 0xf5, 0x86, 0x5b, 0xa3, 0x2d, 0xdc, 0x8b, 0x50,
+  0x92, 0x79, 0x2a, 0x75, 0xae, 0x7a, 0x8d, 0x56, 0x0d, 0xb6, 0x4c, 0x0d,
+  0x72, 0x86, 0x23, 0xe7, 0xf6, 0x4c, 0xbb, 0x44, 0x0d, 0xc4, 0x50, 0x87,
+  0xf0, 0xef, 0x9c, 0xcd, 0x3f, 0x45, 0xcd, 0xbd, 0xd3, 0xa3, 0xbe, 0xeb,
+  0x32, 0x3c, 0xd0, 0xd8, 0x7d, 0x9a, 0x54, 0xa5, 0xd9, 0x4b, 0x01, 0xa3,
+  0x86, 0xd4, 0x31, 0x7b, 0xcf, 0x9e, 0xeb, 0x4f, 0x35, 0x93, 0x17, 0xdd,
+  0x30, 0xd7, 0xc8, 0xcb, 0xfb, 0xc6, 0x54, 0xa8, 0xf4, 0xe5, 0x86, 0x63,
+  0xff, 0xf6, 0x2d, 0x2d, 0xde, 0x42, 0x61, 0x9e, 0xb8, 0xa3, 0x45, 0xef,
+  0x48, 0x67, 0xb1, 0xfa, 0x10, 0xd5, 0x12, 0xd2, 0x78, 0xaf, 0xfe, 0x0f,
+  0xdb, 0xee, 0x43, 0xed, 0x37, 0xbf, 0x65, 0x86, 0x17, 0x21, 0xaf, 0x44,
+  0x66, 0x1d, 0x04, 0x51, 0x74, 0x98, 0x6d, 0x7d, 0xc6, 0xb0, 0x61, 0x37,
+  0x9a, 0x14, 0x3d, 0xe0, 0x30, 0x9c, 0x6e, 0xfc, 0xa3, 0x3c, 0xbe, 0x18,
+  0x32, 0x93, 0x85, 0x96, 0xe7, 0x4b, 0x27, 0xcf, 0xdf, 0x4a, 0xbd, 0x3f,
+  0x1a, 0xc0, 0x17, 0x5a, 0xab, 0xf7, 0x9c, 0xab, 0x32, 0x66, 0xd4, 0x99,
+  0x86, 0x5b, 0x20, 0x2a, 0xf9, 0x1d, 0x20, 0x35, 0x9f, 0xf3, 0x49, 0x5f,
+  0x04, 0xfe, 0xe9, 0x84, 0xe1, 0xc8, 0xe9, 0x7a, 0x17, 0x68, 0xf4, 0x1d
+};
+
+//! RSA-3072 signature of rsa_message (big endian)
+static const uint8_t rsa3072_signature[384] = {
+  0x5d, 0x0f, 0x70, 0x03, 0x82, 0xb0, 0x91, 0xd6, 0x0f, 0x4f, 0x5f, 0x4a,
+  0x52, 0xaf, 0xec, 0x30, 0x06, 0xae, 0xc8, 0xaf, 0x57, 0xe8, 0xf2, 0xca,
+  0x0c, 0xe4, 0xfd, 0x4a, 0xf4, 0x07, 0x56, 0x68, 0x92, 0xc9, 0x6d, 0x51,
+  0x16, 0x2b, 0x6d, 0xb7, 0x8d, 0x38, 0x5a, 0x0d, 0x3b, 0x76, 0x03, 0xc3,
+  0x55, 0xee, 0xd4, 0xaf, 0x45, 0xaa, 0xab, 0xd0, 0x41, 0xfa, 0x90, 0x6d,
+  0xa4, 0x2c, 0xab, 0xb1, 0xe1, 0x89, 0x56, 0x83, 0xab, 0xad, 0xc5, 0xce,
+  0xd2, 0x27, 0x0d, 0xc7, 0xa5, 0xbb, 0xe7, 0xb5, 0x33, 0xf9, 0xb2, 0xb3,
+  0xe1, 0xe7, 0xfc, 0xa5, 0x99, 0x48, 0xdf, 0x5d, 0xf6, 0x6d, 0xcf, 0xa3,
+  0xc2, 0x0a, 0x16, 0xd8, 0xb1, 0x31, 0x40, 0xa7, 0x66, 0x55, 0x52, 0xac,
+  0x18, 0xd6, 0x1e, 0x18, 0x6e, 0x67, 0x8d, 0x57, 0x42, 0xa7, 0xbe, 0x42,
+  0xc7, 0xab, 0x4e, 0x0e, 0xc9, 0x6b, 0x83, 0x4f, 0xbc, 0x0d, 0x19, 0x58,
+  0x19, 0xa0, 0x0b, 0x48, 0xff, 0xef, 0xa8, 0xd5, 0xae, 0x6d, 0x38, 0xf6,
+  0x50, 0x0d, 0xfe, 0x8a, 0xbf, 0x50, 0xd1, 0x7c, 0x9f, 0xb8, 0x06, 0x57,
+  0xce, 0x8f, 0xef, 0xf9, 0xf7, 0xfe, 0x78, 0xf7, 0x83, 0xa7, 0x94, 0x89,
+  0xa2, 0x65, 0x79, 0xbd, 0xd4, 0x4c, 0x92, 0xec, 0xea, 0xc8, 0xc5, 0x24,
+  0x0d, 0x52, 0x7c, 0xd8, 0x21, 0x1c, 0xe5, 0x45, 0x68, 0x7c, 0x27, 0x22,
+  0x01, 0xec, 0x4d, 0x73, 0x98, 0xfe, 0x21, 0x49, 0x90, 0x11, 0x49, 0x50,
+  0x1a, 0x6c, 0xe8, 0x93, 0xe5, 0x56, 0xb1, 0xb1, 0xe7, 0xcf, 0x76, 0x71,
+  0xd9, 0xab, 0x78, 0x23, 0x2f, 0xb9, 0x35, 0x98, 0xbc, 0x6a, 0xbf, 0x72,
+  0x76, 0x4f, 0xa9, 0x4b, 0x6a, 0xe0, 0xb4, 0x1c, 0xcd, 0x06, 0x41, 0xa1,
+  0xe1, 0xc0, 0x65, 0xf1, 0xb0, 0x64, 0xbf, 0x39, 0x67, 0xfe, 0x44, 0x0a,
+  0xbf, 0x48, 0x87, 0x97, 0x3a, 0x07, 0x84, 0x21, 0xff, 0x4e, 0x22, 0x4b,
+  0x05, 0xb5, 0x0c, 0x00, 0x39, 0x8e, 0x92, 0x40, 0x69, 0x19, 0xaf, 0x0d,
+  0xe9, 0x4c, 0x20, 0x90, 0x12, 0x44, 0x1e, 0x66, 0xb5, 0x24, 0x9e, 0x69,
+  0xe8, 0x7c, 0x52, 0x84, 0xc1, 0x20, 0xab, 0x63, 0xfd, 0xff, 0xc2, 0xba,
+  0x74, 0xb5, 0x21, 0xfa, 0x6f, 0x3b, 0xa4, 0x7a, 0x92, 0xd5, 0xc7, 0xc8,
+  0x81, 0x0c, 0x7b, 0x2d, 0x92, 0x2f, 0x10, 0xbb, 0xe0, 0x36, 0xa1, 0x1e,
+  0xf0, 0xad, 0x09, 0x81, 0xfa, 0x64, 0x2e, 0x30, 0x76, 0xd8, 0xef, 0x33,
+  0xc3, 0xaa, 0xa0, 0x92, 0x70, 0xbf, 0xaa, 0xef, 0x0a, 0x9e, 0xeb, 0x3c,
+  0x47, 0xc6, 0x0f, 0xe9, 0x47, 0xf3, 0xc7, 0x53, 0x4a, 0x68, 0x46, 0x01,
+  0x50, 0x2d, 0xcc, 0xfc, 0x2a, 0xd0, 0x02, 0x14, 0x2f, 0x02, 0x98, 0xb2,
+  0xbf, 0x93, 0x23, 0xd1, 0x30, 0x25, 0x3d, 0xb3, 0xb4, 0xf6, 0x14, 0x7f
+};
+
+#endif // __RSA_VECTORS_H__
@@ -0,0 +1,150 @@
+/*
+ * File      : test_rsa.c
+ * Test      : rsa_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of RSA-2048/3072 PKCS#1 v1.5 SHA-256
+ * signature verification with scalar and vector Montgomery multiplication.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/rsa/api_rsa.h"
+#include "crypto/rsa/bignum.h"
+
+#include "rsa_vectors.h"
+
+#define RSA_VARIANT_2048
+#define RSA_VARIANT_3072
+
+typedef struct {
+  perf_log_t rsa2048_scalar;
+  perf_log_t rsa2048_vector;
+  perf_log_t rsa3072_scalar;
+  perf_log_t rsa3072_vector;
+} rsa_perf_log_t;
+
+static rsa_perf_log_t perf_log = {0};
+
+static rsa_pubkey_t key __attribute__((aligned(16)));
+
+static uint8_t bad_signature [RSA_3072_BYTES] __attribute__((aligned(16))) = {0};
+
+static uint32_t test_rsa(const char* name, perf_log_t* log, int num_tests,
+                         const uint8_t* modulus, const uint8_t* signature, size_t len) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  if (rsa_pubkey_init(&key, modulus, len, RSA_F4) != RSA_OK) {
+    printf("# %s: key setup failed!\n", name);
+    return 1;
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# %s verify test %d/%d:\n", name, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = rsa_verify_pkcs1_sha256(&key, (const uint8_t*)(rsa_message),
+                                      sizeof(rsa_message) - 1, signature, len);
+    volatile uint64_t rsa_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t rsa_ccount = test_rdcycle() - start_cycles;
+    log->icount[i] = rsa_icount;
+    log->ccount[i] = rsa_ccount;
+
+    printf("#\tresult  = %d\n", ret);
+    printf("#\tinstret = %020lu\n", rsa_icount);
+    printf("#\tcycles  = %020lu\n", rsa_ccount);
+
+    fail += (ret != RSA_OK);
+  }
+
+  // a corrupted signature must be rejected
+  memcpy(bad_signature, signature, len);
+  bad_signature[len / 2] ^= 0x10;
+
+  if (rsa_verify_pkcs1_sha256(&key, (const uint8_t*)(rsa_message), sizeof(rsa_message) - 1,
+                              bad_signature, len) == RSA_OK) {
+    printf("# %s: corrupted signature accepted!\n", name);
+    fail++;
+  }
+
+  log->ccount_average = average_count(log->ccount);
+  log->icount_average = average_count(log->icount);
+
+  return fail;
+}
+
+static void use_scalar(void) {
+  bn_mont_mul = &bn_mont_mul_scalar;
+  bn_mont_sqr = &bn_mont_sqr_scalar;
+}
+
+static void use_vector(void) {
+  bn_mont_mul = &bn_mont_mul_vec;
+  bn_mont_sqr = &bn_mont_sqr_vec;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+#ifdef RSA_VARIANT_2048
+
+  printf("\nBenchmark for RSA-2048 (e = %d) signature verification\n", RSA_F4);
+
+  use_scalar();
+  fail += test_rsa("RSA-2048 Scalar", &perf_log.rsa2048_scalar, TEST_COUNT,
+                   rsa2048_modulus, rsa2048_signature, RSA_2048_BYTES);
+  use_vector();
+  fail += test_rsa("RSA-2048 Vector", &perf_log.rsa2048_vector, TEST_COUNT,
+                   rsa2048_modulus, rsa2048_signature, RSA_2048_BYTES);
+
+#endif
+
+#ifdef RSA_VARIANT_3072
+
+  printf("\nBenchmark for RSA-3072 (e = %d) signature verification\n", RSA_F4);
+
+  use_scalar();
+  fail += test_rsa("RSA-3072 Scalar", &perf_log.rsa3072_scalar, TEST_COUNT,
+                   rsa3072_modulus, rsa3072_signature, RSA_3072_BYTES);
+  use_vector();
+  fail += test_rsa("RSA-3072 Vector", &perf_log.rsa3072_vector, TEST_COUNT,
+                   rsa3072_modulus, rsa3072_signature, RSA_3072_BYTES);
+
+#endif
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tScalar:\n");
+  printf("#\trsa2048_scalar.icount = %05lu\n", perf_log.rsa2048_scalar.icount_average);
+  printf("#\trsa2048_scalar.ccount = %05lu\n", perf_log.rsa2048_scalar.ccount_average);
+  printf("#\trsa3072_scalar.icount = %05lu\n", perf_log.rsa3072_scalar.icount_average);
+  printf("#\trsa3072_scalar.ccount = %05lu\n", perf_log.rsa3072_scalar.ccount_average);
+
+  printf("#\tVector:\n");
+  printf("#\trsa2048_vector.icount = %05lu\n", perf_log.rsa2048_vector.icount_average);
+  printf("#\trsa2048_vector.ccount = %05lu\n", perf_log.rsa2048_vector.ccount_average);
+  printf("#\trsa3072_vector.icount = %05lu\n", perf_log.rsa3072_vector.icount_average);
+  printf("#\trsa3072_vector.ccount = %05lu\n", perf_log.rsa3072_vector.ccount_average);
+
+  bench_record_log("rsa2048 verify", 0, 0, &perf_log.rsa2048_scalar);
+  bench_record_log("rsa3072 verify", 0, 0, &perf_log.rsa3072_scalar);
+  bench_record_log("rsa2048 verify", 0, 8, &perf_log.rsa2048_vector);
+  bench_record_log("rsa3072 verify", 0, 8, &perf_log.rsa3072_vector);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,317 @@
+/*
+ * File      : scrypt.c
+ * Test      : scrypt_benchmark
+ * Date      : 19-oct-2026
+ * Description: scrypt (RFC 7914) with the Salsa20/8 core on RVV.
+ *
+ * A Salsa20 block is held as 4 rows of 4 words along its diagonals, row i
+ * holding the words (4i + 5j) mod 16 for j < 4, so the column and the row
+ * rounds are both plain element-wise operations, with a word rotation of
+ * three rows in between (vrgather). The rows of m independent ROMix
+ * instances are laid next to each other, a vector of 4m elements then
+ * carries the same row of every instance. The working set is kept in this
+ * layout from the first BlockMix to the last, and V[j] of every instance is
+ * gathered with one indexed load per row.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/kdf/api_scrypt.h"
+#include "crypto/sha/api_sha256.h"
+#include "crypto/share/iovec.h"
+#include "crypto/share/util.h"
+
+//! Words of one instance in a row vector
+#define SCRYPT_GROUP  4
+
+//! Block word held by element j of row i, at position 4i + j
+static const uint8_t kSalsaDiag[16] = {
+   0,  5, 10, 15,
+   4,  9, 14,  3,
+   8, 13,  2,  7,
+  12,  1,  6, 11
+};
+
+/******************************** PBKDF2 **************************************/
+
+//! HMAC-SHA256 key, midstates after K ^ ipad and K ^ opad
+typedef struct {
+  uint32_t          ipad[16];
+  sha256_midstate_t inner;
+  sha256_midstate_t outer;
+} hmac_sha256_key_t;
+
+static void hmac_sha256_init(hmac_sha256_key_t* h, const uint8_t* key, size_t len) {
+  uint32_t k[16] = {0};
+  uint32_t opad[16];
+
+  if (len > 64) {
+    sha256_hash_vec(k, (uint8_t*)key, len);
+  } else {
+    memcpy(k, key, len);
+  }
+
+  for (int i = 0; i < 16; i++) {
+    h->ipad[i] = k[i] ^ 0x36363636;
+    opad[i]    = k[i] ^ 0x5c5c5c5c;
+  }
+
+  sha256_midstate_init(&h->inner, (const uint8_t*)h->ipad, 64);
+  sha256_midstate_init(&h->outer, (const uint8_t*)opad, 64);
+}
+
+void pbkdf2_hmac_sha256(uint8_t* dk, size_t dk_len, const uint8_t* pw, size_t pw_len,
+                        const uint8_t* salt, size_t salt_len, uint32_t c) {
+  hmac_sha256_key_t h;
+  uint32_t U[8], T[8], t[8];
+  uint8_t  ctr[4];
+
+  hmac_sha256_init(&h, pw, pw_len);
+
+  for (uint32_t i = 1; dk_len; i++) {
+    // U_1 = HMAC(P, S || INT(i)), the salt is hashed in place
+    crypto_iovec_t iov[3] = {
+      { h.ipad, 64 }, { (void*)salt, salt_len }, { ctr, 4 }
+    };
+    ctr[0] = i >> 24;
+    ctr[1] = i >> 16;
+    ctr[2] = i >>  8;
+    ctr[3] = i;
+
+    sha256_hash_vec_iov(t, iov, 3);
+    sha256_midstate_hash(U, &h.outer, (const uint8_t*)t, 32);
+    memcpy(T, U, sizeof(T));
+
+    for (uint32_t j = 1; j < c; j++) {
+      sha256_midstate_hash(t, &h.inner, (const uint8_t*)U, 32);
+      sha256_midstate_hash(U, &h.outer, (const uint8_t*)t, 32);
+      for (int w = 0; w < 8; w++) {
+        T[w] ^= U[w];
+      }
+    }
+
+    size_t n = dk_len < 32 ? dk_len : 32;
+    memcpy(dk, T, n);
+    dk     += n;
+    dk_len -= n;
+  }
+}
+
+/******************************** ROMix ***************************************/
+
+//! a ^= (b + c) <<< s
+#define SALSA_STEP(a, b, c, s)                                                  \
+  a = __riscv_vxor_vv_u32m1(a, __riscv_vrol_vx_u32m1(                           \
+        __riscv_vadd_vv_u32m1(b, c, vl), s, vl), vl)
+
+//! Rotate the words of every instance, element j takes word (j + k) mod 4
+#define SALSA_ROT(a, idx)  a = __riscv_vrgather_vv_u32m1(a, idx, vl)
+
+//! Row q of X, xored with row q of V[j] of every instance if vin is set
+static inline vuint32m1_t scrypt_row(const uint32_t* X, const uint32_t* vin, vuint32m1_t voff,
+                                     size_t q, size_t vl) {
+  vuint32m1_t x = __riscv_vle32_v_u32m1(X + q * vl, vl);
+
+  if (vin) {
+    x = __riscv_vxor_vv_u32m1(x, __riscv_vluxei32_v_u32m1(vin + q * vl, voff, vl), vl);
+  }
+  return x;
+}
+
+/*!
+@brief Y = BlockMix(X ^ V[j]) over the 8r rows of every instance.
+@details With vin set, row q of V[j] is read at byte offset voff[e] from
+vin + q * vl for element e. With vout set (and vin not), X is copied there
+on the fly. rot1..rot3 are the vrgather indices rotating the words of every
+instance by 1..3 positions.
+*/
+static void scrypt_blockmix(uint32_t* Y, const uint32_t* X, const uint32_t* vin,
+                            vuint32m1_t voff, uint32_t* vout, size_t r, size_t vl,
+                            vuint32m1_t rot1, vuint32m1_t rot2, vuint32m1_t rot3) {
+  size_t last = 8 * r - 4;
+
+  vuint32m1_t x0 = scrypt_row(X, vin, voff, last + 0, vl);
+  vuint32m1_t x1 = scrypt_row(X, vin, voff, last + 1, vl);
+  vuint32m1_t x2 = scrypt_row(X, vin, voff, last + 2, vl);
+  vuint32m1_t x3 = scrypt_row(X, vin, voff, last + 3, vl);
+
+  for (size_t b = 0; b < 2 * r; b++) {
+    size_t q = 4 * b;
+
+    vuint32m1_t t0 = scrypt_row(X, vin, voff, q + 0, vl);
+    vuint32m1_t t1 = scrypt_row(X, vin, voff, q + 1, vl);
+    vuint32m1_t t2 = scrypt_row(X, vin, voff, q + 2, vl);
+    vuint32m1_t t3 = scrypt_row(X, vin, voff, q + 3, vl);
+
+    if (vout) {
+      __riscv_vse32_v_u32m1(vout + (q + 0) * vl, t0, vl);
+      __riscv_vse32_v_u32m1(vout + (q + 1) * vl, t1, vl);
+      __riscv_vse32_v_u32m1(vout + (q + 2) * vl, t2, vl);
+      __riscv_vse32_v_u32m1(vout + (q + 3) * vl, t3, vl);
+    }
+
+    x0 = __riscv_vxor_vv_u32m1(x0, t0, vl);
+    x1 = __riscv_vxor_vv_u32m1(x1, t1, vl);
+    x2 = __riscv_vxor_vv_u32m1(x2, t2, vl);
+    x3 = __riscv_vxor_vv_u32m1(x3, t3, vl);
+
+    vuint32m1_t s0 = x0, s1 = x1, s2 = x2, s3 = x3;
+
+    for (int i = 0; i < 8; i += 2) {
+      // columns, rows i hold y_i of the column quarter rounds
+      SALSA_STEP(x1, x0, x3,  7);
+      SALSA_STEP(x2, x1, x0,  9);
+      SALSA_STEP(x3, x2, x1, 13);
+      SALSA_STEP(x0, x3, x2, 18);
+
+      // rows 3, 2, 1 become y_1, y_2, y_3 of the row quarter rounds
+      SALSA_ROT(x1, rot3);
+      SALSA_ROT(x2, rot2);
+      SALSA_ROT(x3, rot1);
+
+      SALSA_STEP(x3, x0, x1,  7);
+      SALSA_STEP(x2, x3, x0,  9);
+      SALSA_STEP(x1, x2, x3, 13);
+      SALSA_STEP(x0, x1, x2, 18);
+
+      SALSA_ROT(x1, rot1);
+      SALSA_ROT(x2, rot2);
+      SALSA_ROT(x3, rot3);
+    }
+
+    x0 = __riscv_vadd_vv_u32m1(x0, s0, vl);
+    x1 = __riscv_vadd_vv_u32m1(x1, s1, vl);
+    x2 = __riscv_vadd_vv_u32m1(x2, s2, vl);
+    x3 = __riscv_vadd_vv_u32m1(x3, s3, vl);
+
+    // even blocks go to the first half of Y, odd blocks to the second
+    uint32_t* y = Y + 4 * ((b >> 1) + (b & 1) * r) * vl;
+    __riscv_vse32_v_u32m1(y + 0 * vl, x0, vl);
+    __riscv_vse32_v_u32m1(y + 1 * vl, x1, vl);
+    __riscv_vse32_v_u32m1(y + 2 * vl, x2, vl);
+    __riscv_vse32_v_u32m1(y + 3 * vl, x3, vl);
+  }
+}
+
+//! B (m instances of 128r bytes) to the row layout of X
+static void scrypt_shuffle(uint32_t* X, const uint8_t* B, size_t r, size_t m) {
+  size_t vl = SCRYPT_GROUP * m;
+
+  for (size_t k = 0; k < m; k++) {
+    for (size_t b = 0; b < 2 * r; b++) {
+      const uint8_t* s = B + 128 * r * k + 64 * b;
+      for (size_t q = 0; q < 16; q++) {
+        X[(4 * b + (q >> 2)) * vl + 4 * k + (q & 3)] = U8_TO_U32LE(s + 4 * kSalsaDiag[q]);
+      }
+    }
+  }
+}
+
+static void scrypt_unshuffle(uint8_t* B, const uint32_t* X, size_t r, size_t m) {
+  size_t vl = SCRYPT_GROUP * m;
+
+  for (size_t k = 0; k < m; k++) {
+    for (size_t b = 0; b < 2 * r; b++) {
+      uint8_t* s = B + 128 * r * k + 64 * b;
+      for (size_t q = 0; q < 16; q++) {
+        U32_TO_U8LE(s, X[(4 * b + (q >> 2)) * vl + 4 * k + (q & 3)], 4 * kSalsaDiag[q]);
+      }
+    }
+  }
+}
+
+/*!
+@brief ROMix of m instances at once, B holds the m blocks of 128r bytes.
+@details V takes 128 * r * N * m bytes, X and Y 128 * r * m bytes each.
+*/
+static void scrypt_romix(uint8_t* B, size_t r, uint64_t N, size_t m,
+                         uint32_t* V, uint32_t* X, uint32_t* Y) {
+  size_t   vl = __riscv_vsetvl_e32m1(SCRYPT_GROUP * m);
+  size_t   W  = 8 * r * vl;             // words of V[j], all instances
+  uint32_t* t;
+
+  vuint32m1_t lane = __riscv_vid_v_u32m1(vl);
+  vuint32m1_t grp  = __riscv_vand_vx_u32m1(lane, ~(uint32_t)3, vl);
+  vuint32m1_t rot1 = __riscv_vor_vv_u32m1(grp, __riscv_vand_vx_u32m1(
+                       __riscv_vadd_vx_u32m1(lane, 1, vl), 3, vl), vl);
+  vuint32m1_t rot2 = __riscv_vor_vv_u32m1(grp, __riscv_vand_vx_u32m1(
+                       __riscv_vadd_vx_u32m1(lane, 2, vl), 3, vl), vl);
+  vuint32m1_t rot3 = __riscv_vor_vv_u32m1(grp, __riscv_vand_vx_u32m1(
+                       __riscv_vadd_vx_u32m1(lane, 3, vl), 3, vl), vl);
+  vuint32m1_t lane4 = __riscv_vsll_vx_u32m1(lane, 2, vl);
+
+  scrypt_shuffle(X, B, r, m);
+
+  // V[i] = X, X = BlockMix(X), the copy is stored while X is read
+  for (uint64_t i = 0; i < N; i++) {
+    scrypt_blockmix(Y, X, NULL, lane4, V + i * W, r, vl, rot1, rot2, rot3);
+    t = X; X = Y; Y = t;
+  }
+
+  // j = Integerify(X) mod N per instance, X = BlockMix(X ^ V[j])
+  for (uint64_t i = 0; i < N; i++) {
+    vuint32m1_t j = __riscv_vle32_v_u32m1(X + (8 * r - 4) * vl, vl);
+    j = __riscv_vrgather_vv_u32m1(j, grp, vl);
+    j = __riscv_vand_vx_u32m1(j, (uint32_t)(N - 1), vl);
+    j = __riscv_vmacc_vx_u32m1(lane4, (uint32_t)(4 * W), j, vl);
+
+    scrypt_blockmix(Y, X, V, j, NULL, r, vl, rot1, rot2, rot3);
+    t = X; X = Y; Y = t;
+  }
+
+  scrypt_unshuffle(B, X, r, m);
+}
+
+size_t scrypt_lanes(void) {
+  return __riscv_vsetvlmax_e32m1() / SCRYPT_GROUP;
+}
+
+int scrypt(uint8_t* dk, size_t dk_len, const uint8_t* pw, size_t pw_len,
+           const uint8_t* salt, size_t salt_len, uint64_t N, uint32_t r, uint32_t p,
+           crypto_arena_t* arena) {
+  uint64_t blk = 128 * (uint64_t)r;
+
+  // V is addressed with 32b offsets, which bounds one instance
+  if (N < 2 || (N & (N - 1)) || r == 0 || p == 0 ||
+      (uint64_t)r * p >= (1u << 30) || blk * N > UINT32_MAX) {
+    return SCRYPT_ERR_PARAM;
+  }
+
+  uintptr_t mark = crypto_arena_mark(arena);
+  uint8_t*  B    = crypto_arena_alloc(arena, blk * p);
+  size_t    m    = 0;
+
+  if (B) {
+    m = crypto_arena_avail(arena) / (blk * (N + 2));
+  }
+  m = m < scrypt_lanes() ? m : scrypt_lanes();
+  m = m < p ? m : p;
+  while (m > 1 && blk * N * m > UINT32_MAX) {
+    m--;
+  }
+
+  if (m == 0) {
+    crypto_arena_release(arena, mark);
+    return SCRYPT_ERR_MEMORY;
+  }
+
+  uint32_t* V = crypto_arena_alloc(arena, blk * N * m);
+  uint32_t* X = crypto_arena_alloc(arena, blk * m);
+  uint32_t* Y = crypto_arena_alloc(arena, blk * m);
+
+  pbkdf2_hmac_sha256(B, blk * p, pw, pw_len, salt, salt_len, 1);
+
+  for (size_t k = 0; k < p; k += m) {
+    size_t n = p - k < m ? p - k : m;
+    scrypt_romix(B + blk * k, r, N, n, V, X, Y);
+  }
+
+  pbkdf2_hmac_sha256(dk, dk_len, pw, pw_len, B, blk * p, 1);
+
+  crypto_arena_release(arena, mark);
+  return SCRYPT_OK;
+}
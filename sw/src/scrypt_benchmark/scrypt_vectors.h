@@ -0,0 +1,94 @@
+/*
+ * File      : scrypt_vectors.h
+ * Test      : scrypt_benchmark
+ * Date      : 19-oct-2026
+ * Description: scrypt and PBKDF2-HMAC-SHA256 test vectors, from RFC 7914
+ * and computed with Python hashlib (scrypt, pbkdf2_hmac).
+ */
+
+#ifndef __SCRYPT_VECTORS_H__
+#define __SCRYPT_VECTORS_H__
+
+#include <stdint.h>
+#include <stddef.h>
+
+typedef struct {
+  const char*    pw;
+  const char*    salt;
+  uint32_t       c;
+  const uint8_t* dk;
+  size_t         dk_len;
+} pbkdf2_vector_t;
+
+typedef struct {
+  const char*    pw;
+  const char*    salt;
+  uint64_t       N;
+  uint32_t       r;
+  uint32_t       p;
+  const uint8_t* dk;
+  size_t         dk_len;
+} scrypt_vector_t;
+
+// RFC 7914, section 11
+static const uint8_t pbkdf2_dk0 [64] = {
+  0x55, 0xac, 0x04, 0x6e, 0x56, 0xe3, 0x08, 0x9f, 0xec, 0x16, 0x91, 0xc2,
+  0x25, 0x44, 0xb6, 0x05, 0xf9, 0x41, 0x85, 0x21, 0x6d, 0xde, 0x04, 0x65,
+  0xe6, 0x8b, 0x9d, 0x57, 0xc2, 0x0d, 0xac, 0xbc, 0x49, 0xca, 0x9c, 0xcc,
+  0xf1, 0x79, 0xb6, 0x45, 0x99, 0x16, 0x64, 0xb3, 0x9d, 0x77, 0xef, 0x31,
+  0x7c, 0x71, 0xb8, 0x45, 0xb1, 0xe3, 0x0b, 0xd5, 0x09, 0x11, 0x20, 0x41,
+  0xd3, 0xa1, 0x97, 0x83
+};
+
+// key longer than a block, c = 3
+static const uint8_t pbkdf2_dk1 [40] = {
+  0x88, 0xed, 0x2e, 0x1b, 0x23, 0xec, 0x17, 0x6a, 0x49, 0xae, 0x4d, 0xd0,
+  0xd1, 0x13, 0xa3, 0x97, 0x5e, 0xb3, 0x15, 0x02, 0x96, 0x5d, 0x5f, 0xe7,
+  0x98, 0x62, 0x45, 0x4f, 0x66, 0xa3, 0x6a, 0xa9, 0x74, 0x8f, 0x87, 0x33,
+  0xb0, 0xff, 0x46, 0x53
+};
+
+// RFC 7914, test vector 1
+static const uint8_t scrypt_dk0 [64] = {
+  0x77, 0xd6, 0x57, 0x62, 0x38, 0x65, 0x7b, 0x20, 0x3b, 0x19, 0xca, 0x42,
+  0xc1, 0x8a, 0x04, 0x97, 0xf1, 0x6b, 0x48, 0x44, 0xe3, 0x07, 0x4a, 0xe8,
+  0xdf, 0xdf, 0xfa, 0x3f, 0xed, 0xe2, 0x14, 0x42, 0xfc, 0xd0, 0x06, 0x9d,
+  0xed, 0x09, 0x48, 0xf8, 0x32, 0x6a, 0x75, 0x3a, 0x0f, 0xc8, 0x1f, 0x17,
+  0xe8, 0xd3, 0xe0, 0xfb, 0x2e, 0x0d, 0x36, 0x28, 0xcf, 0x35, 0xe2, 0x0c,
+  0x38, 0xd1, 0x89, 0x06
+};
+
+// p = 4 instances side by side
+static const uint8_t scrypt_dk1 [64] = {
+  0x37, 0x1b, 0x38, 0x86, 0x21, 0x13, 0x09, 0x3b, 0xae, 0xcd, 0xd5, 0x08,
+  0xf3, 0xa8, 0x7b, 0xdb, 0x37, 0x8e, 0x5f, 0x82, 0x35, 0x73, 0x2a, 0x3a,
+  0xaf, 0xb8, 0x9f, 0x12, 0x92, 0x83, 0x3b, 0x72, 0x66, 0x1f, 0x83, 0x1c,
+  0xf9, 0x5c, 0xdd, 0xe2, 0xe2, 0x64, 0xfe, 0xef, 0x01, 0xc2, 0x31, 0xa8,
+  0x48, 0x3b, 0x93, 0xb9, 0x4b, 0x54, 0xb5, 0x65, 0x3b, 0x70, 0xc9, 0x8e,
+  0xed, 0x74, 0xf3, 0x0e
+};
+
+// r = 2, p = 5 does not fill whole passes
+static const uint8_t scrypt_dk2 [32] = {
+  0x54, 0xf8, 0x9e, 0xa3, 0x3d, 0x72, 0xdc, 0xe0, 0xe8, 0x99, 0x65, 0x31,
+  0x56, 0x66, 0x16, 0xc9, 0x42, 0x6c, 0x5c, 0xdd, 0x16, 0xfb, 0xae, 0xc0,
+  0x3c, 0xc1, 0x7c, 0x69, 0x16, 0x92, 0x18, 0x93
+};
+
+#define PBKDF2_TEST_VECTORS 2
+
+static const pbkdf2_vector_t pbkdf2_vectors [PBKDF2_TEST_VECTORS] = {
+  { "passwd", "salt", 1, pbkdf2_dk0, sizeof(pbkdf2_dk0) },
+  { "passwordpasswordpasswordpasswordpassword"
+    "passwordpasswordpasswordpasswordpassword", "NaCl", 3, pbkdf2_dk1, sizeof(pbkdf2_dk1) }
+};
+
+#define SCRYPT_TEST_VECTORS 3
+
+static const scrypt_vector_t scrypt_vectors [SCRYPT_TEST_VECTORS] = {
+  { "", "", 16, 1, 1, scrypt_dk0, sizeof(scrypt_dk0) },
+  { "password", "NaCl", 1024, 1, 4, scrypt_dk1, sizeof(scrypt_dk1) },
+  { "pleaseletmein", "SodiumChloride", 256, 2, 5, scrypt_dk2, sizeof(scrypt_dk2) }
+};
+
+#endif // __SCRYPT_VECTORS_H__
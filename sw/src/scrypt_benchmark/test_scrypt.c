@@ -0,0 +1,133 @@
+/*
+ * File      : test_scrypt.c
+ * Test      : scrypt_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of scrypt, with the ROMix working set in
+ * the L2 arena, and known answer tests of PBKDF2-HMAC-SHA256.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+#include "crypto/share/arena.h"
+
+#include "crypto/kdf/api_scrypt.h"
+
+#include "scrypt_vectors.h"
+
+#define SCRYPT_MAX_DK_BYTES 64
+
+typedef struct {
+  perf_log_t scrypt [SCRYPT_TEST_VECTORS];
+} scrypt_perf_log_t;
+
+static scrypt_perf_log_t perf_log = {0};
+
+static crypto_arena_t arena;
+
+static uint32_t test_pbkdf2(void) {
+
+  uint8_t  dk [SCRYPT_MAX_DK_BYTES];
+  uint32_t fail = 0;
+
+  for (int i = 0; i < PBKDF2_TEST_VECTORS; i++) {
+    const pbkdf2_vector_t* v = &pbkdf2_vectors[i];
+
+    pbkdf2_hmac_sha256(dk, v->dk_len, (const uint8_t*)v->pw, strlen(v->pw),
+                       (const uint8_t*)v->salt, strlen(v->salt), v->c);
+
+    if (memcmp(dk, v->dk, v->dk_len)) {
+      printf("# PBKDF2: known answer test %d failed!\n", i);
+      fail++;
+    }
+  }
+
+  return fail;
+}
+
+static uint32_t test_scrypt(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint8_t  dk [SCRYPT_MAX_DK_BYTES];
+  uint32_t fail = 0;
+
+  for (int k = 0; k < SCRYPT_TEST_VECTORS; k++) {
+    const scrypt_vector_t* v = &scrypt_vectors[k];
+
+    for (int i = 0; i < num_tests; i++) {
+
+      printf("#\n# scrypt (N = %lu, r = %u, p = %u) test %d/%d:\n",
+             v->N, v->r, v->p, i+1, num_tests);
+
+      start_instrs = test_rdinstret();
+      start_cycles = test_rdcycle();
+      int ret = scrypt(dk, v->dk_len, (const uint8_t*)v->pw, strlen(v->pw),
+                       (const uint8_t*)v->salt, strlen(v->salt), v->N, v->r, v->p, &arena);
+      volatile uint64_t sc_icount = test_rdinstret() - start_instrs;
+      volatile uint64_t sc_ccount = test_rdcycle() - start_cycles;
+      perf_log.scrypt[k].icount[i] = sc_icount;
+      perf_log.scrypt[k].ccount[i] = sc_ccount;
+
+      printf("#\tresult  = %d\n", ret);
+      printf("#\tinstret = %020lu\n", sc_icount);
+      printf("#\tcycles  = %020lu\n", sc_ccount);
+
+      if (ret != SCRYPT_OK || memcmp(dk, v->dk, v->dk_len)) {
+        printf("# scrypt: known answer test %d failed!\n", k);
+        fail++;
+      }
+    }
+
+    perf_log.scrypt[k].ccount_average = average_count(perf_log.scrypt[k].ccount);
+    perf_log.scrypt[k].icount_average = average_count(perf_log.scrypt[k].icount);
+  }
+
+  // N must be a power of 2, and a working set beyond the arena is refused
+  fail += scrypt(dk, 32, NULL, 0, NULL, 0, 1000, 1, 1, &arena) != SCRYPT_ERR_PARAM;
+  fail += scrypt(dk, 32, NULL, 0, NULL, 0, (uint64_t)1 << 24, 1, 1, &arena) != SCRYPT_ERR_MEMORY;
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  crypto_arena_init_l2(&arena);
+  uintptr_t mark = crypto_arena_mark(&arena);
+
+  printf("\nBenchmark for scrypt (%lu instances side by side, %lu arena bytes)\n",
+         scrypt_lanes(), crypto_arena_avail(&arena));
+
+  fail += test_pbkdf2();
+  fail += test_scrypt(TEST_COUNT);
+
+  // every derivation releases its working set
+  fail += crypto_arena_mark(&arena) != mark;
+
+  printf("\n\n# Result Averages:\n");
+
+  for (int k = 0; k < SCRYPT_TEST_VECTORS; k++) {
+    printf("#\tscrypt (N = %lu, r = %u, p = %u):\n",
+           scrypt_vectors[k].N, scrypt_vectors[k].r, scrypt_vectors[k].p);
+    printf("#\tscrypt.icount = %05lu\n", perf_log.scrypt[k].icount_average);
+    printf("#\tscrypt.ccount = %05lu\n", perf_log.scrypt[k].ccount_average);
+  }
+
+  // one record per parameter set, len is the working set of ROMix
+  for (int k = 0; k < SCRYPT_TEST_VECTORS; k++) {
+    const scrypt_vector_t* v = &scrypt_vectors[k];
+    bench_record_log("scrypt", 128 * v->r * v->N, 1, &perf_log.scrypt[k]);
+  }
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -4,6 +4,7 @@
 
 #include "crypto/sha/api_sha256.h"
 #include "crypto/sha/zvknh.h"
+#include "crypto/share/mdpad.h"
 
 static uint32_t K [64] = {
     0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
@@ -222,14 +223,33 @@ void sha256_hash (
     }
 }
 
+// Pad the last len (< 64) message bytes, digest them and store the digest
+// in the scalar word order. The padding is built in vector registers.
+static void sha256_vec_final (
+    uint32_t        p_H[ 8], //!< in - hash state in the zvknh word order
+    const uint8_t*  tail   , //!< in - last partial block
+    size_t          len    , //!< bytes in the partial block
+    uint64_t        len_bits,//!< message length in bits
+    uint32_t        H[ 8]    //!< out - message digest
+){
+    uint32_t   p_B[32];                 // One or two padded blocks
+
+    size_t     n = crypto_md_pad((uint8_t*)p_B, tail, len, 64, len_bits);
+
+    for(size_t i = 0; i < n / 4; i += 16) {
+        sha256_block_lmul1((uint8_t*)(p_H), p_B + i);
+    }
+
+    // reorder hash words to match scalar digest ordering, big endian
+    crypto_md_store_be32((uint8_t*)H, p_H, crypto_md_zvknh_off32, 8);
+}
+
 void sha256_hash_vec (
     uint32_t    H[ 8], //!< in,out - message block hash
     uint8_t*    M    , //!< in - The message to be hashed
     size_t      len    //!< Length of the message in *bytes*.
 ){
     uint32_t   p_H        [ 8];
-    uint32_t   H_unordered[ 8];
-    uint32_t   p_B        [16];
 
     uint8_t*   p_M      = M ;
     size_t     len_bits = len << 3;
@@ -237,49 +257,100 @@ void sha256_hash_vec (
     sha256_hash_init_vec(p_H);
 
     while(len >= 64) {
-        memcpy(p_B, p_M, 64);           // Copy 64 bytes/512 bits to process. 
-
-        sha256_block_lmul1((uint8_t*)(p_H), p_B);   // Digest another block
+        sha256_block_lmul1((uint8_t*)(p_H), p_M);   // Digest straight from M
 
         p_M += 64;                      // Adjust pointers and length.
         len -= 64;
     }
 
-    memcpy(p_B, p_M, len);              // Copy remaining bytes into block
-
-    uint8_t * bp = (uint8_t*)p_B;
-    bp[len++] = 0x80;                   // Append `1` to end of message
+    sha256_vec_final(p_H, p_M, len, len_bits, H);   // Pads straight from M
+}
 
-    if(len > 56) {                      // Do we spill into another block?
-        memset(bp+len, 0, 64-len);      // If yes, clear rest of this block
-        sha256_block_lmul1((uint8_t*)(p_H), p_B);    // Length will be added in a new block
-        len = 0;                        //
+// crypto_iov_hash_fn over the single-block kernel
+static void sha256_blocks_vec(void* state, const void* src, uint64_t n) {
+    for(uint64_t i = 0; i < n; i += 64) {
+        sha256_block_lmul1((uint8_t*)state, (const uint8_t*)src + i);
     }
+}
 
-    size_t i = 64;
-    while(len_bits) {                   // Add length to end of this block
-        bp[--i] = len_bits  & 0xFF;
-        len_bits= len_bits >>    8;
+void sha256_hash_vec_iov (
+    uint32_t              H[ 8], //!< out - message digest
+    const crypto_iovec_t* iov  , //!< in - message segments
+    size_t                cnt    //!< number of segments
+){
+    crypto_iov_cursor_t c;
+    uint32_t   p_H[ 8];
+    uint32_t   p_B[16];
+
+    size_t     len      = crypto_iov_len(iov, cnt);
+    size_t     len_bits = len << 3;
+    size_t     full     = len & ~(size_t)63;
+
+    sha256_hash_init_vec(p_H);
+
+    crypto_iov_init(&c, iov, cnt);
+    crypto_iov_hash(p_H, &c, full, 64, sha256_blocks_vec);
+    crypto_iov_gather((uint8_t*)p_B, &c, len - full);
+
+    sha256_vec_final(p_H, (uint8_t*)p_B, len - full, len_bits, H);
+}
+
+void sha256_midstate_init (
+    sha256_midstate_t*  ms    , //!< out - snapshot after the prefix
+    const uint8_t*      prefix, //!< in - the common prefix
+    size_t              len     //!< Length of the prefix in *bytes*.
+){
+    sha256_hash_init_vec(ms->H);
+    ms->len = len;
+
+    while(len >= 64) {
+        sha256_block_lmul1((uint8_t*)(ms->H), prefix);
+        prefix += 64;
+        len    -= 64;
     }
 
-    memset(bp + len, 0, i-len);         // Clear fstart of block/EoM to len
+    memcpy(ms->B, prefix, len);         // Kept for the first suffix block
+    ms->num = len;
+}
 
-    sha256_block_lmul1((uint8_t*)(p_H),p_B);
+void sha256_midstate_hash (
+    uint32_t                  H[ 8], //!< out - message digest
+    const sha256_midstate_t*  ms   , //!< in - snapshot after the prefix
+    const uint8_t*            M    , //!< in - the suffix
+    size_t                    len    //!< Length of the suffix in *bytes*.
+){
+    uint32_t   p_H        [ 8];
+    uint32_t   p_B        [16];
 
-    for(size_t i = 0; i < 8; i ++) {    // Store result in big endian
-        uint32_t x = p_H[i];
-        SHA256_STORE32_BE(x,H_unordered,i);
+    uint8_t*   bp       = (uint8_t*)p_B;
+    size_t     num      = ms->num;
+    size_t     len_bits = (ms->len + len) << 3;
+
+    memcpy(p_H, ms->H, sizeof(p_H));
+    memcpy(p_B, ms->B, num);
+
+    if(num && num + len >= 64) {        // Complete the pending partial block
+        size_t n = 64 - num;
+        memcpy(bp + num, M, n);
+        sha256_block_lmul1((uint8_t*)(p_H), p_B);
+        M   += n;
+        len -= n;
+        num  = 0;
+    }
+
+    while(len >= 64) {                  // Whole blocks straight from M
+        sha256_block_lmul1((uint8_t*)(p_H), M);
+        M   += 64;
+        len -= 64;
+    }
+
+    if(num) {                           // The tail joins the pending bytes
+        memcpy(bp + num, M, len);
+        M    = bp;
+        len += num;
     }
 
-    // reorder hash words to match scalar digest ordering
-    H[0] = H_unordered[3];
-    H[1] = H_unordered[2];
-    H[2] = H_unordered[7];
-    H[3] = H_unordered[6];
-    H[4] = H_unordered[1];
-    H[5] = H_unordered[0];
-    H[6] = H_unordered[5];
-    H[7] = H_unordered[4];
+    sha256_vec_final(p_H, M, len, len_bits, H);
 }
 
 /**********************************OpenSSL*************************************/
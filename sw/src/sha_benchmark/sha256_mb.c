@@ -0,0 +1,167 @@
+/*
+ * File      : sha256_mb.c
+ * Test      : sha_benchmark
+ * Date      : 19-oct-2026
+ * Description: Multi-buffer SHA-256 compression with zvknh. Every element
+ * group of 4 x e32 carries the state and message schedule of a different
+ * message, so one pass of the 16 quad-rounds compresses a block of each.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/sha/api_sha256.h"
+#include "crypto/share/mdpad.h"
+
+static const uint32_t sha256_mb_k [64] = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5, 0x3956c25b, 0x59f111f1,
+    0x923f82a4, 0xab1c5ed5, 0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174, 0xe49b69c1, 0xefbe4786,
+    0x0fc19dc6, 0x240ca1cc, 0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7, 0xc6e00bf3, 0xd5a79147,
+    0x06ca6351, 0x14292967, 0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85, 0xa2bfe8a1, 0xa81a664b,
+    0xc24b8b70, 0xc76c51a3, 0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5, 0x391c0cb3, 0x4ed8aa4a,
+    0x5b9cca4f, 0x682e6ff3, 0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+/*
+ * One quad-round as in sha256_block_lmul1, the schedule registers rotate
+ * through the macro arguments. The round constants are replicated to every
+ * element group by the indexed load.
+ */
+#define SHA256_MB_QUAD(q, W0, W1, W2, W3)                                           \
+  wk = __riscv_vluxei32_v_u32m2(sha256_mb_k + 4 * (q), ik, vl);                     \
+  wk = __riscv_vadd_vv_u32m2(wk, W0, vl);                                           \
+  s1 = __riscv_vsha2cl_vv_u32m2(s1, s0, wk, vl);                                    \
+  s0 = __riscv_vsha2ch_vv_u32m2(s0, s1, wk, vl);                                    \
+  if ((q) < 12) {                                                                   \
+    wk = __riscv_vmerge_vvm_u32m2(W2, W1, first, vl);                               \
+    W0 = __riscv_vsha2ms_vv_u32m2(W0, wk, W3, vl);                                  \
+  }
+
+size_t sha256_mb_lanes(void) {
+  return __riscv_vsetvlmax_e32m2() / 4;
+}
+
+void sha256_block_mb(uint32_t (*H)[8], const uint8_t (*B)[64], size_t n) {
+
+  size_t lanes = sha256_mb_lanes();
+
+  while (n) {
+    size_t g  = n < lanes ? n : lanes;
+    size_t vl = __riscv_vsetvl_e32m2(4 * g);
+
+    // element i is word i & 3 of message i >> 2
+    vuint32m2_t idx  = __riscv_vid_v_u32m2(vl);
+    vuint32m2_t lane = __riscv_vand_vx_u32m2(idx, 3, vl);
+    vuint32m2_t grp  = __riscv_vsrl_vx_u32m2(idx, 2, vl);
+    vuint32m2_t ik   = __riscv_vsll_vx_u32m2(lane, 2, vl);
+    vuint32m2_t ib   = __riscv_vmacc_vx_u32m2(ik, 64, grp, vl);
+    vuint32m2_t ih   = __riscv_vmacc_vx_u32m2(ik, 32, grp, vl);
+    vbool16_t first  = __riscv_vmseq_vx_u32m2_b16(lane, 0, vl);
+
+    const uint8_t* b = B[0];
+    vuint32m2_t w0 = __riscv_vrev8_v_u32m2(__riscv_vluxei32_v_u32m2((const uint32_t*)(b +  0), ib, vl), vl);
+    vuint32m2_t w1 = __riscv_vrev8_v_u32m2(__riscv_vluxei32_v_u32m2((const uint32_t*)(b + 16), ib, vl), vl);
+    vuint32m2_t w2 = __riscv_vrev8_v_u32m2(__riscv_vluxei32_v_u32m2((const uint32_t*)(b + 32), ib, vl), vl);
+    vuint32m2_t w3 = __riscv_vrev8_v_u32m2(__riscv_vluxei32_v_u32m2((const uint32_t*)(b + 48), ib, vl), vl);
+
+    // {f,e,b,a} and {h,g,d,c} of every state
+    vuint32m2_t s0 = __riscv_vluxei32_v_u32m2(H[0] + 0, ih, vl);
+    vuint32m2_t s1 = __riscv_vluxei32_v_u32m2(H[0] + 4, ih, vl);
+    vuint32m2_t wk;
+
+    for (int q = 0; q < 16; q += 4) {
+      SHA256_MB_QUAD(q + 0, w0, w1, w2, w3)
+      SHA256_MB_QUAD(q + 1, w1, w2, w3, w0)
+      SHA256_MB_QUAD(q + 2, w2, w3, w0, w1)
+      SHA256_MB_QUAD(q + 3, w3, w0, w1, w2)
+    }
+
+    // H' = H + {a..h}, the initial state is reloaded rather than kept live
+    s0 = __riscv_vadd_vv_u32m2(s0, __riscv_vluxei32_v_u32m2(H[0] + 0, ih, vl), vl);
+    s1 = __riscv_vadd_vv_u32m2(s1, __riscv_vluxei32_v_u32m2(H[0] + 4, ih, vl), vl);
+    __riscv_vsuxei32_v_u32m2(H[0] + 0, ih, s0, vl);
+    __riscv_vsuxei32_v_u32m2(H[0] + 4, ih, s1, vl);
+
+    H += g;
+    B += g;
+    n -= g;
+  }
+}
+
+void sha256_mb_digest(uint8_t md[32], const uint32_t H[8]) {
+  // vector word order {f,e,b,a,h,g,d,c} to a..h, big endian
+  crypto_md_store_be32(md, H, crypto_md_zvknh_off32, 8);
+}
+
+//! Messages staged per sha256_block_mb call
+#define SHA256_MB_CHUNK  16
+
+/*
+ * Block b of the padded suffix stream B[0..num) || M[0..len), nb blocks in
+ * total. Only the bytes of the block are copied.
+ */
+static void sha256_mb_block(uint8_t blk[64], const sha256_midstate_t* ms,
+                            const uint8_t* M, size_t len, size_t b, size_t nb) {
+  const uint8_t* tail  = (const uint8_t*)ms->B;
+  size_t         total = ms->num + len;
+  size_t         pos   = 64 * b;
+  size_t         k     = 0;
+
+  memset(blk, 0, 64);
+
+  if (pos < ms->num) {
+    k = ms->num - pos;
+    memcpy(blk, tail + pos, k);
+  }
+  if (pos + k < total) {
+    size_t n = total - (pos + k);
+    n = n < 64 - k ? n : 64 - k;
+    memcpy(blk + k, M + (pos + k - ms->num), n);
+    k += n;
+  }
+  if (pos + k == total && k < 64) {
+    blk[k] = 0x80;
+  }
+
+  if (b == nb - 1) {
+    crypto_md_store_len(blk + 56, (ms->len + len) << 3);
+  }
+}
+
+void sha256_midstate_hash_batch(uint8_t (*md)[32], const sha256_midstate_t* ms,
+                                const uint8_t* M, size_t len, size_t stride, size_t n) {
+  uint32_t H [SHA256_MB_CHUNK][8];
+  uint8_t  B [SHA256_MB_CHUNK][64];
+  size_t   nb = (ms->num + len + 8) / 64 + 1;
+
+  while (n) {
+    size_t c = n < SHA256_MB_CHUNK ? n : SHA256_MB_CHUNK;
+
+    for (size_t i = 0; i < c; i++) {
+      memcpy(H[i], ms->H, sizeof(H[i]));
+    }
+
+    for (size_t b = 0; b < nb; b++) {
+      for (size_t i = 0; i < c; i++) {
+        sha256_mb_block(B[i], ms, M + i * stride, len, b, nb);
+      }
+      sha256_block_mb(H, (const uint8_t (*)[64])B, c);
+    }
+
+    for (size_t i = 0; i < c; i++) {
+      sha256_mb_digest(md[i], H[i]);
+    }
+
+    md += c;
+    M  += c * stride;
+    n  -= c;
+  }
+}
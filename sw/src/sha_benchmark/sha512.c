@@ -5,6 +5,7 @@
 
 #include "crypto/sha/api_sha512.h"
 #include "crypto/sha/zvknh.h"
+#include "crypto/share/mdpad.h"
 
 static uint64_t K [80] = {
     0x428a2f98d728ae22L, 0x7137449123ef65cdL, 0xb5c0fbcfec4d3b2fL,
@@ -253,8 +254,7 @@ void sha512_hash_vec (
     size_t      len    //!< Length of the message in *bytes*.
 ){
     uint64_t   p_H        [ 8];
-    uint64_t   H_unordered[ 8];
-    uint64_t   p_B        [16];
+    uint64_t   p_B        [32];
 
     uint8_t*   p_M      = M;
     size_t     len_bits = len << 3;
@@ -262,49 +262,143 @@ void sha512_hash_vec (
     sha512_hash_init_vec(p_H);
 
     while(len >= 128) {
-        memcpy(p_B, p_M, 128);          // Copy 128 bytes / 1024 bits . 
-
-        sha512_block_lmul1((uint8_t*)(p_H), p_B);   // Digest another block
+        sha512_block_lmul1((uint8_t*)(p_H), p_M);   // Digest straight from M
 
         p_M += 128;                     // Adjust pointers and length.
         len -= 128;
     }
 
-    memcpy(p_B, p_M, len);              // Copy remaining bytes into block
+    // Pad straight from M, one or two blocks
+    size_t n = crypto_md_pad((uint8_t*)p_B, p_M, len, 128, len_bits);
 
-    uint8_t * bp = (uint8_t*)p_B;
-    bp[len++] = 0x80;                   // Append `1` to end of message
+    for(size_t i = 0; i < n / 8; i += 16) {
+        sha512_block_lmul1((uint8_t*)(p_H), p_B + i);
+    }
 
-    if(len > 112) {                     // Do we spill into another block?
-        memset(bp+len, 0, 128-len);     // If yes, clear rest of this block
-        sha512_block_lmul1((uint8_t*)(p_H), p_B);    // Length will be added in a new block
-        len = 0;                        //
+    // reorder hash words to match scalar digest ordering, big endian
+    crypto_md_store_be64((uint8_t*)H, p_H, crypto_md_zvknh_off64, 8);
+}
+
+void sha512_vec_init (
+    sha512_vec_ctx_t* ctx
+){
+    sha512_hash_init_vec(ctx->H);
+    ctx->num = 0;
+    ctx->len = 0;
+}
+
+void sha512_vec_update (
+    sha512_vec_ctx_t* ctx,
+    const uint8_t*    M  , //!< in - next part of the message
+    size_t            len  //!< Length of the part in *bytes*.
+){
+    uint8_t * bp = (uint8_t*)ctx->B;
+
+    ctx->len += len;
+
+    if(ctx->num) {                      // Fill up the partial block
+        size_t n = 128 - ctx->num;
+        n = n < len ? n : len;
+
+        memcpy(bp + ctx->num, M, n);
+        ctx->num += n;
+        M        += n;
+        len      -= n;
+
+        if(ctx->num < 128) {
+            return;
+        }
+        sha512_block_lmul2((uint8_t*)(ctx->H), ctx->B);
+        ctx->num = 0;
     }
 
-    size_t i = 128;
-    while(len_bits) {                   // Add length to end of this block
-        bp[--i] = len_bits  & 0xFF;
-        len_bits= len_bits >>    8;
+    while(len >= 128) {                 // Whole blocks straight from M
+        sha512_block_lmul2((uint8_t*)(ctx->H), M);
+        M   += 128;
+        len -= 128;
     }
 
-    memset(bp + len, 0, i-len);         // Clear fstart of block/EoM to len
+    memcpy(bp, M, len);
+    ctx->num = len;
+}
 
-    sha512_block_lmul1((uint8_t*)(p_H),p_B);
+// crypto_iov_hash_fn over the single-block kernel
+static void sha512_blocks_vec(void* state, const void* src, uint64_t n) {
+    for(uint64_t i = 0; i < n; i += 128) {
+        sha512_block_lmul2((uint8_t*)state, (const uint8_t*)src + i);
+    }
+}
 
-    for(size_t i = 0; i < 8; i ++) {    // Store result in big endian
-        uint64_t x = p_H[i];
-        SHA512_STORE64_BE(x,H_unordered,i);
+void sha512_vec_update_iov (
+    sha512_vec_ctx_t*     ctx,
+    const crypto_iovec_t* iov, //!< in - next parts of the message
+    size_t                cnt  //!< number of segments
+){
+    crypto_iov_cursor_t c;
+    uint8_t * bp  = (uint8_t*)ctx->B;
+    size_t    len = crypto_iov_len(iov, cnt);
+
+    crypto_iov_init(&c, iov, cnt);
+    ctx->len += len;
+
+    if(ctx->num) {                      // Complete the pending partial block
+        size_t n = 128 - ctx->num;
+        n = n < len ? n : len;
+
+        crypto_iov_gather(bp + ctx->num, &c, n);
+        ctx->num += n;
+        len      -= n;
+
+        if(ctx->num == 128) {
+            sha512_block_lmul2((uint8_t*)(ctx->H), ctx->B);
+            ctx->num = 0;
+        }
+    }
+
+    size_t full = len & ~(size_t)127;   // Whole blocks straight from the segments
+    crypto_iov_hash(ctx->H, &c, full, 128, sha512_blocks_vec);
+    len -= full;
+
+    crypto_iov_gather(bp + ctx->num, &c, len);
+    ctx->num += len;
+}
+
+void sha512_vec_final (
+    sha512_vec_ctx_t* ctx,
+    uint8_t           md[64] //!< out - message digest
+){
+    uint64_t   p_B[32];                 // One or two padded blocks
+
+    size_t     n = crypto_md_pad((uint8_t*)p_B, (uint8_t*)ctx->B, ctx->num, 128,
+                                 ctx->len << 3);
+
+    for(size_t i = 0; i < n / 8; i += 16) {
+        sha512_block_lmul2((uint8_t*)(ctx->H), p_B + i);
     }
 
-    // reorder hash words to match scalar digest ordering
-    H[0] = H_unordered[3];
-    H[1] = H_unordered[2];
-    H[2] = H_unordered[7];
-    H[3] = H_unordered[6];
-    H[4] = H_unordered[1];
-    H[5] = H_unordered[0];
-    H[6] = H_unordered[5];
-    H[7] = H_unordered[4];
+    // reorder hash words to match scalar digest ordering, big endian
+    crypto_md_store_be64(md, ctx->H, crypto_md_zvknh_off64, 8);
+}
+
+void sha512_midstate_init (
+    sha512_midstate_t*  ms    , //!< out - snapshot after the prefix
+    const uint8_t*      prefix, //!< in - the common prefix
+    size_t              len     //!< Length of the prefix in *bytes*.
+){
+    sha512_vec_init(ms);
+    sha512_vec_update(ms, prefix, len);
+}
+
+void sha512_midstate_hash (
+    uint8_t                   md[64], //!< out - message digest
+    const sha512_midstate_t*  ms    , //!< in - snapshot after the prefix
+    const uint8_t*            M     , //!< in - the suffix
+    size_t                    len     //!< Length of the suffix in *bytes*.
+){
+    sha512_vec_ctx_t ctx = *ms;         // The snapshot stays reusable
+
+    sha512_vec_update(&ctx, M, len);
+    sha512_vec_final(&ctx, md);
 }
 
 /**********************************OpenSSL*************************************/
@@ -3,7 +3,8 @@
  * Test      : sha_benchmark
  * Author(s) : Tom Szymkowiak <thomas.szymkowiak@tuni.fi>
  * Date      : 27-jul-2024
- * Description: Basic benchmarking of SHA256/512.
+ * Description: Basic benchmarking of SHA256/512, the scalar, vector and
+ * midstate variants swept over the message length.
  */
 
 #include <stddef.h>
@@ -11,143 +12,199 @@
 
 #include "printf.h"
 
+#include "crypto/share/arena.h"
 #include "crypto/share/benchmarks.h"
 #include "crypto/share/util.h"
 
 #include "crypto/sha/api_sha256.h"
 #include "crypto/sha/api_sha512.h"
+#include "crypto/sha/zvknh.h"
 
 #define MESSAGE_LEN_BYTES 1024
 
+// fixed prefix (three blocks and a tail) and the suffixes hashed after it
+#define PREFIX_LEN_BYTES  200
+#define SUFFIX_LEN_BYTES  40
+#define SUFFIX_COUNT      16
+
+// short messages, where padding and digest output are a large share
+#define SHORT_COUNT       6
+
 #define SHA_VARIANT_256
 #define SHA_VARIANT_512
 
-typedef struct {
-  // scalar AES128
-  perf_log_t sha256_scalar;
-  perf_log_t sha256_vector;
-  perf_log_t sha512_scalar;
-  perf_log_t sha512_vector;
-} sha_perf_log_t;
-
-static uint32_t scalar_digest_256  [8]  __attribute__((aligned(16))) = {0};
-static uint64_t scalar_digest_512  [8]  __attribute__((aligned(16))) = {0};
-static uint32_t vector_digest_256  [8]  __attribute__((aligned(16))) = {0};
-static uint64_t vector_digest_512  [8]  __attribute__((aligned(16))) = {0};
+static const size_t short_len [SHORT_COUNT] = { 0, 32, 55, 56, 100, 127 };
 
 static uint8_t message [1024] __attribute__((aligned(16))) = {0};
 
-static sha_perf_log_t perf_log = {0};
+static crypto_arena_t arena;
 
-void print_elems(const char* name, const uint32_t* arr, const size_t n) {
+//
+// Kernels of the size sweep
+// ----------------------------------------------------------------------
 
-  printf("\n%s:\n", name);
+static uint32_t bench_H256 [8];
+static uint64_t bench_H512 [8];
 
-  for(size_t idx = 0; idx < n; idx++) {
-    printf("[%02lu] - 0x%08X\n", idx, arr[idx]);
-  }
-}
+static void run_sha256_openssl(const bench_io_t* io) {
+  SHA256_CTX hash_state;
 
-static void test_sha256(int num_tests) {
-
-  volatile uint64_t start_instrs;
-  volatile uint64_t start_cycles;
-
-  for(int i = 0; i < num_tests; i++) {
-
-    printf("#\n# SHA 256 Scalar test %d/%d:\n", i+1, num_tests);
+  SHA256_Init(&hash_state);
+  SHA256_Update(&hash_state, io->in, io->len);
+  SHA256_Final(io->out, &hash_state);
+}
 
-    SHA256_CTX hash_state;
+static void run_sha256_vec(const bench_io_t* io) {
+  sha256_hash_vec(bench_H256, (uint8_t*)io->in, io->len);
+}
 
-    start_instrs        = test_rdinstret();
-    start_cycles        = test_rdcycle();
-    //sha256_hash(scalar_digest_256, message, MESSAGE_LEN_BYTES);
-    SHA256_Init(&hash_state);
-    SHA256_Update(&hash_state, message, MESSAGE_LEN_BYTES);
-    SHA256_Final((uint8_t*)(scalar_digest_256), &hash_state);
-    volatile uint64_t sha_icount = test_rdinstret() - start_instrs;
-    volatile uint64_t sha_ccount = test_rdcycle() - start_cycles;
-    perf_log.sha256_scalar.icount[i] = sha_icount;
-    perf_log.sha256_scalar.ccount[i] = sha_ccount;
+// bare compression function, whole blocks without padding
+static void run_sha256_blocks(const bench_io_t* io) {
+  void (*block)(uint8_t*, const void*) = io->arg;
 
-    print_elems("Digest", (uint32_t*)(scalar_digest_256), 8);    
-    printf("#\tinstret = %020lu\n", sha_icount);
-    printf("#\tcycles  = %020lu\n", sha_ccount);
+  for (size_t i = 0; i < io->len; i += SHA256_BLOCK_SIZE) {
+    block((uint8_t*)bench_H256, io->in + i);
   }
 }
 
-static void test_sha512(int num_tests) {
+static void run_sha512_openssl(const bench_io_t* io) {
+  SHA512_CTX hash_state;
 
-  volatile uint64_t start_instrs;
-  volatile uint64_t start_cycles;
+  SHA512_Init(&hash_state);
+  SHA512_Update(&hash_state, io->in, io->len);
+  SHA512_Final(io->out, &hash_state);
+}
 
-  for(int i = 0; i < num_tests; i++) {
+static void run_sha512_vec(const bench_io_t* io) {
+  sha512_hash_vec(bench_H512, (uint8_t*)io->in, io->len);
+}
 
-    printf("#\n# SHA 512 Scalar test %d/%d:\n", i+1, num_tests);
+static void run_sha512_vec_ctx(const bench_io_t* io) {
+  sha512_vec_ctx_t ctx;
+
+  sha512_vec_init(&ctx);
+  sha512_vec_update(&ctx, io->in, io->len);
+  sha512_vec_final(&ctx, io->out);
+}
 
-    SHA512_CTX hash_state;
+/*
+ * SUFFIX_COUNT messages sharing the first PREFIX_LEN_BYTES of the input:
+ * hashed whole, resumed from a midstate one at a time, and resumed as one
+ * multi-buffer batch. The length of a run is the suffix bytes.
+ */
+static void run_sha256_full(const bench_io_t* io) {
+  static uint8_t full [PREFIX_LEN_BYTES + SUFFIX_LEN_BYTES];
+  const uint8_t* suffix = io->in + PREFIX_LEN_BYTES;
+
+  for (int m = 0; m < SUFFIX_COUNT; m++) {
+    memcpy(full, io->in, PREFIX_LEN_BYTES);
+    memcpy(full + PREFIX_LEN_BYTES, suffix + m * SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES);
+    sha256_hash_vec(bench_H256, full, sizeof(full));
+  }
+}
 
-    start_instrs        = test_rdinstret();
-    start_cycles        = test_rdcycle();
-    //sha512_hash(scalar_digest_512, message, MESSAGE_LEN_BYTES);    
-    SHA512_Init(&hash_state);
-    SHA512_Update(&hash_state, message, MESSAGE_LEN_BYTES);
-    SHA512_Final((uint8_t*)(scalar_digest_512), &hash_state);
-    volatile uint64_t sha_icount = test_rdinstret() - start_instrs;
-    volatile uint64_t sha_ccount = test_rdcycle() - start_cycles;
-    perf_log.sha512_scalar.icount[i] = sha_icount;
-    perf_log.sha512_scalar.ccount[i] = sha_ccount;
+static void run_sha256_midstate(const bench_io_t* io) {
+  sha256_midstate_t ms;
+  const uint8_t* suffix = io->in + PREFIX_LEN_BYTES;
 
-    print_elems("Digest", (uint32_t*)(scalar_digest_512), 16);
-    printf("#\tinstret = %020lu\n", sha_icount);
-    printf("#\tcycles  = %020lu\n", sha_ccount);
+  sha256_midstate_init(&ms, io->in, PREFIX_LEN_BYTES);
+  for (int m = 0; m < SUFFIX_COUNT; m++) {
+    sha256_midstate_hash(bench_H256, &ms, suffix + m * SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES);
   }
 }
 
-static void test_sha256_vec(int num_tests) {
+static void run_sha256_midstate_mb(const bench_io_t* io) {
+  sha256_midstate_t ms;
 
-  volatile uint64_t start_instrs = 0;
-  volatile uint64_t start_cycles = 0;
+  sha256_midstate_init(&ms, io->in, PREFIX_LEN_BYTES);
+  sha256_midstate_hash_batch((uint8_t (*)[32])io->out, &ms, io->in + PREFIX_LEN_BYTES,
+                             SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES, SUFFIX_COUNT);
+}
 
-  for(int i = 0; i < num_tests; i++) {
+#define SUFFIX_BYTES (SUFFIX_COUNT * SUFFIX_LEN_BYTES)
+
+static const bench_kernel_t sha256_kernels[] = {
+  { "sha256 openssl",          0, 0, 0, NULL, run_sha256_openssl, NULL },
+  { "sha256 zvknh",            1, 0, 0, NULL, run_sha256_vec,     NULL },
+  { "sha256 zvknh blocks",     1, SHA256_BLOCK_SIZE, 0, NULL, run_sha256_blocks,
+    (void*)sha256_block_lmul1 },
+  { "sha256 zvknh vslide blocks", 1, SHA256_BLOCK_SIZE, 0, NULL, run_sha256_blocks,
+    (void*)sha256_block_vslide_lmul1 },
+  { "sha256 full x16",         1, 0, SUFFIX_BYTES, NULL, run_sha256_full,        NULL },
+  { "sha256 midstate x16",     1, 0, SUFFIX_BYTES, NULL, run_sha256_midstate,    NULL },
+  { "sha256 midstate batch x16", 1, 0, SUFFIX_BYTES, NULL, run_sha256_midstate_mb, NULL },
+};
 
-    printf("#\n# SHA 256 Vector test %d/%d:\n", i+1, num_tests);
+static const bench_kernel_t sha512_kernels[] = {
+  { "sha512 openssl",          0, 0, 0, NULL, run_sha512_openssl, NULL },
+  { "sha512 zvknh",            1, 0, 0, NULL, run_sha512_vec,     NULL },
+  { "sha512 zvknh ctx",        2, 0, 0, NULL, run_sha512_vec_ctx, NULL },
+};
 
-    start_instrs        = test_rdinstret();
-    start_cycles        = test_rdcycle();
-    sha256_hash_vec(vector_digest_256, message, MESSAGE_LEN_BYTES);
-    volatile uint64_t sha_icount = test_rdinstret() - start_instrs;
-    volatile uint64_t sha_ccount = test_rdcycle() - start_cycles;
-    perf_log.sha256_vector.icount[i] = sha_icount;
-    perf_log.sha256_vector.ccount[i] = sha_ccount;
-    
-    print_elems("Digest", (uint32_t*)(vector_digest_256), 8);    
-    printf("#\tinstret = %020lu\n", sha_icount);
-    printf("#\tcycles  = %020lu\n", sha_ccount);
+static void register_kernels(const bench_kernel_t* k, size_t n) {
+  for (size_t i = 0; i < n; i++) {
+    bench_register(&k[i]);
   }
 }
 
-static void test_sha512_vec(int num_tests) {
+//
+// Known answer checks
+// ----------------------------------------------------------------------
 
-  volatile uint64_t start_instrs;
-  volatile uint64_t start_cycles;
+/*
+ * The midstate and batch digests of SUFFIX_COUNT messages sharing a prefix
+ * must match the digests of the whole messages.
+ */
+static uint32_t test_sha256_midstate(void) {
 
-  for(int i = 0; i < num_tests; i++) {
+  uint32_t fail = 0;
+
+  static uint8_t  full [PREFIX_LEN_BYTES + SUFFIX_LEN_BYTES];
+  static uint32_t md_full [SUFFIX_COUNT][8];
+  static uint32_t md_mid  [SUFFIX_COUNT][8];
+  static uint8_t  md_mb   [SUFFIX_COUNT][32];
 
-    printf("#\n# SHA 512 Vector test %d/%d:\n", i+1, num_tests);
+  const uint8_t* suffix = message + PREFIX_LEN_BYTES;
+  sha256_midstate_t ms;
 
-    start_instrs        = test_rdinstret();
-    start_cycles        = test_rdcycle();
-    sha512_hash_vec(vector_digest_512, message, MESSAGE_LEN_BYTES);
-    volatile uint64_t sha_icount = test_rdinstret() - start_instrs;
-    volatile uint64_t sha_ccount = test_rdcycle() - start_cycles;
-    perf_log.sha512_vector.icount[i] = sha_icount;
-    perf_log.sha512_vector.ccount[i] = sha_ccount;
+  sha256_midstate_init(&ms, message, PREFIX_LEN_BYTES);
+  for (int m = 0; m < SUFFIX_COUNT; m++) {
+    memcpy(full, message, PREFIX_LEN_BYTES);
+    memcpy(full + PREFIX_LEN_BYTES, suffix + m * SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES);
+    sha256_hash_vec(md_full[m], full, sizeof(full));
+    sha256_midstate_hash(md_mid[m], &ms, suffix + m * SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES);
+  }
+  sha256_midstate_hash_batch(md_mb, &ms, suffix, SUFFIX_LEN_BYTES, SUFFIX_LEN_BYTES, SUFFIX_COUNT);
 
-    print_elems("Digest", (uint32_t*)(vector_digest_512), 16);    
-    printf("#\tinstret = %020lu\n", sha_icount);
-    printf("#\tcycles  = %020lu\n", sha_ccount);
+  for (int m = 0; m < SUFFIX_COUNT; m++) {
+    if (memcmp(md_full[m], md_mid[m], 32) || memcmp(md_full[m], md_mb[m], 32)) {
+      printf("# SHA 256 Midstate: digest %d differs!\n", m);
+      fail++;
+    }
+  }
+
+  return fail;
+}
+
+static uint32_t test_sha512_midstate(void) {
+  uint32_t fail = 0;
+  uint64_t md_full [8];
+  uint8_t  md_mid  [64];
+  sha512_midstate_t ms;
+
+  sha512_midstate_init(&ms, message, PREFIX_LEN_BYTES);
+
+  // the same snapshot must serve several suffixes
+  for (int len = 0; len <= 2 * SUFFIX_LEN_BYTES; len += SUFFIX_LEN_BYTES) {
+    sha512_hash_vec(md_full, message, PREFIX_LEN_BYTES + len);
+    sha512_midstate_hash(md_mid, &ms, message + PREFIX_LEN_BYTES, len);
+    if (memcmp(md_full, md_mid, 64)) {
+      printf("# SHA 512 Midstate: digest for a %d byte suffix differs!\n", len);
+      fail++;
+    }
   }
+
+  return fail;
 }
 
 static void init(void) {
@@ -177,74 +234,72 @@ static uint32_t check_hash_512(uint64_t* H_s, uint64_t* H_v) {
   return fail;
 };
 
+/*
+ * Vector hashes of the whole message, and of short messages on both sides
+ * of the one/two padding block boundary at varying alignment, checked
+ * against the scalar code.
+ */
+static uint32_t test_sha_kat(void) {
+
+  uint32_t fail = 0;
+  uint32_t H_s [8], H_v [8];
+  uint64_t G_s [8], G_v [8];
+
+  sha256_hash(H_s, message, MESSAGE_LEN_BYTES);
+  sha256_hash_vec(H_v, message, MESSAGE_LEN_BYTES);
+  fail += check_hash_256(H_s, H_v);
+
+  sha512_hash(G_s, message, MESSAGE_LEN_BYTES);
+  sha512_hash_vec(G_v, message, MESSAGE_LEN_BYTES);
+  fail += check_hash_512(G_s, G_v);
+
+  for (int k = 0; k < SHORT_COUNT; k++) {
+    size_t   len = short_len[k];
+    uint8_t* m   = message + (k & 3);   // also covers unaligned messages
+
+    sha256_hash_vec(H_v, m, len);
+    sha512_hash_vec(G_v, m, len);
+    sha256_hash(H_s, m, len);
+    sha512_hash(G_s, m, len);
+    if (check_hash_256(H_s, H_v) || check_hash_512(G_s, G_v)) {
+      printf("# SHA 256/512: wrong digest for a %lu byte message!\n", len);
+      fail++;
+    }
+  }
+
+  return fail;
+}
+
 int main(void) {
 
   volatile uint32_t fail = 0;
+  bench_config_t    config;
 
   // initialise "random" message
   init();
 
-#ifdef SHA_VARIANT_256
-
-  printf("\nBenchmark for SHA256 with %d Byte Message \n", MESSAGE_LEN_BYTES);
-
-  test_sha256(TEST_COUNT);
-  test_sha256_vec(TEST_COUNT);
-
-  fail += check_hash_256(scalar_digest_256, vector_digest_256);
-
-  #ifdef SHA_VARIANT_512
-
-  printf("\nBenchmark for SHA512 with %d Byte Message \n", MESSAGE_LEN_BYTES);
-
-  test_sha512(TEST_COUNT);
-  test_sha512_vec(TEST_COUNT);
-
-  fail += check_hash_512(scalar_digest_512, vector_digest_512);
-
-  #endif
-
-#else
-
-  #ifdef SHA_VARIANT_512
-
-  printf("\nBenchmark for SHA512 with %d Byte Message \n", MESSAGE_LEN_BYTES);
-
-  test_sha512(TEST_COUNT);
-  test_sha512_vec(TEST_COUNT);
-
-  fail += check_hash_512(scalar_digest_512, vector_digest_512);
+  crypto_arena_init_l2(&arena);
+  if (bench_init(&arena) != BENCH_OK) {
+    printf("# SHA: the benchmark buffers do not fit the L2 arena!\n");
+    return 1;
+  }
 
-  #else
-  
-    printf("No benchmark selected.\n");
+  fail += test_sha_kat();
+  fail += test_sha256_midstate();
+  fail += test_sha512_midstate();
 
-  #endif
+#ifdef SHA_VARIANT_256
+  register_kernels(sha256_kernels, sizeof(sha256_kernels) / sizeof(sha256_kernels[0]));
+#endif
+#ifdef SHA_VARIANT_512
+  register_kernels(sha512_kernels, sizeof(sha512_kernels) / sizeof(sha512_kernels[0]));
 #endif
 
-  perf_log.sha256_scalar.ccount_average = average_count(perf_log.sha256_scalar.ccount);
-  perf_log.sha256_scalar.icount_average = average_count(perf_log.sha256_scalar.icount);
-  perf_log.sha256_vector.ccount_average = average_count(perf_log.sha256_vector.ccount);
-  perf_log.sha256_vector.icount_average = average_count(perf_log.sha256_vector.icount);
-
-  perf_log.sha512_scalar.ccount_average = average_count(perf_log.sha512_scalar.ccount);
-  perf_log.sha512_scalar.icount_average = average_count(perf_log.sha512_scalar.icount);
-  perf_log.sha512_vector.ccount_average = average_count(perf_log.sha512_vector.ccount);
-  perf_log.sha512_vector.icount_average = average_count(perf_log.sha512_vector.icount); 
-
-  printf("\n\n# Result Averages:\n");
-
-  printf("#\tScalar:\n");
-  printf("#\tsha256_scalar.icount = %05lu\n", perf_log.sha256_scalar.icount_average);
-  printf("#\tsha256_scalar.ccount = %05lu\n", perf_log.sha256_scalar.ccount_average);
-  printf("#\tsha512_scalar.icount = %05lu\n", perf_log.sha512_scalar.icount_average);
-  printf("#\tsha512_scalar.ccount = %05lu\n", perf_log.sha512_scalar.ccount_average);
+  printf("\nBenchmark for SHA256/512 with %d to %d Byte Messages\n", BENCH_MIN_BYTES,
+         BENCH_MAX_BYTES);
 
-  printf("#\tVector:\n");
-  printf("#\tsha256_vector.icount = %05lu\n", perf_log.sha256_vector.icount_average);
-  printf("#\tsha256_vector.ccount = %05lu\n", perf_log.sha256_vector.ccount_average);
-  printf("#\tsha512_vector.icount = %05lu\n", perf_log.sha512_vector.icount_average);
-  printf("#\tsha512_vector.ccount = %05lu\n", perf_log.sha512_vector.ccount_average);
+  bench_config_default(&config);
+  bench_run(&config);
 
   if(fail) {
     printf("\n %u Failures!\n\n", fail);
@@ -252,4 +307,4 @@ int main(void) {
   } else {
     return 0;
   }
-}
\ No newline at end of file
+}
@@ -174,16 +174,19 @@ sha256_block_lmul1:
     #    vrgather.vv v13, v23, v24
     #    # Switch back to SEW=32
     #    vsetivli x0, 4, e32, m1, ta, ma
-    vle32.v v10, (a1)
-    vrev8.v v10, v10
+    # Byte loads, the block needs no particular alignment.
+    vsetivli x0, 16, e8, m1, ta, ma
+    vle8.v v10, (a1)
     add a1, a1, 16
-    vle32.v v11, (a1)
-    vrev8.v v11, v11
+    vle8.v v11, (a1)
     add a1, a1, 16
-    vle32.v v12, (a1)
-    vrev8.v v12, v12
+    vle8.v v12, (a1)
     add a1, a1, 16
-    vle32.v v13, (a1)
+    vle8.v v13, (a1)
+    vsetivli x0, 4, e32, m1, ta, ma
+    vrev8.v v10, v10
+    vrev8.v v11, v11
+    vrev8.v v12, v12
     vrev8.v v13, v13
 
     # Load H[0..8] to produce
@@ -573,16 +576,19 @@ sha256_block_vslide_lmul1:
     #    vrgather.vv v13, v23, v24
     #    # Switch back to SEW=32
     #    vsetivli x0, 4, e32, m1, ta, ma
-    vle32.v v10, (a1)
-    vrev8.v v10, v10
+    # Byte loads, the block needs no particular alignment.
+    vsetivli x0, 16, e8, m1, ta, ma
+    vle8.v v10, (a1)
     add a1, a1, 16
-    vle32.v v11, (a1)
-    vrev8.v v11, v11
+    vle8.v v11, (a1)
     add a1, a1, 16
-    vle32.v v12, (a1)
-    vrev8.v v12, v12
+    vle8.v v12, (a1)
     add a1, a1, 16
-    vle32.v v13, (a1)
+    vle8.v v13, (a1)
+    vsetivli x0, 4, e32, m1, ta, ma
+    vrev8.v v10, v10
+    vrev8.v v11, v11
+    vrev8.v v12, v12
     vrev8.v v13, v13
 
     # Load H[0..8] to produce
@@ -979,16 +985,20 @@ sha512_block_lmul1:
     #  sequence = [3 2 1 0   7 6 5 4  11 10 9 8   15 14 13 12]
     #   <https://oeis.org/A004444> gives us "N ^ 3" as a nice formula to generate
     #  this sequence. 'vid' gives us the N.
-    vle64.v v10, (a1)
-    vrev8.v v10, v10
+    # Byte loads, the block needs no particular alignment.
+    li t0, 32
+    vsetvli x0, t0, e8, m1, ta, ma
+    vle8.v v10, (a1)
     add a1, a1, 32
-    vle64.v v11, (a1)
-    vrev8.v v11, v11
+    vle8.v v11, (a1)
     add a1, a1, 32
-    vle64.v v12, (a1)
-    vrev8.v v12, v12
+    vle8.v v12, (a1)
     add a1, a1, 32
-    vle64.v v13, (a1)
+    vle8.v v13, (a1)
+    vsetivli x0, 4, e64, m1, ta, ma
+    vrev8.v v10, v10
+    vrev8.v v11, v11
+    vrev8.v v12, v12
     vrev8.v v13, v13
 
     # Load H[0..8] to produce
@@ -1391,16 +1401,20 @@ sha512_block_lmul2:
     #  sequence = [3 2 1 0   7 6 5 4  11 10 9 8   15 14 13 12]
     #   <https://oeis.org/A004444> gives us "N ^ 3" as a nice formula to generate
     #  this sequence. 'vid' gives us the N.
-    vle64.v v10, (a1)
-    vrev8.v v10, v10
+    # Byte loads, the block needs no particular alignment.
+    li t0, 32
+    vsetvli x0, t0, e8, m2, ta, ma
+    vle8.v v10, (a1)
     add a1, a1, 32
-    vle64.v v12, (a1)
-    vrev8.v v12, v12
+    vle8.v v12, (a1)
     add a1, a1, 32
-    vle64.v v14, (a1)
-    vrev8.v v14, v14
+    vle8.v v14, (a1)
     add a1, a1, 32
-    vle64.v v16, (a1)
+    vle8.v v16, (a1)
+    vsetivli x0, 4, e64, m2, ta, ma
+    vrev8.v v10, v10
+    vrev8.v v12, v12
+    vrev8.v v14, v14
     vrev8.v v16, v16
 
     # Load H[0..8] to produce
@@ -0,0 +1,473 @@
+/*
+ * File      : ecp256.c
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched point arithmetic in Jacobian coordinates on
+ * y^2 = x^3 - 3x + b, on top of the lane-parallel Montgomery arithmetic
+ * of fp256.c.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/ecc/fp256.h"
+#include "crypto/ecc/ecp256.h"
+
+// r = a - b on 32 big endian bytes, returns the borrow
+static uint32_t be_sub(uint8_t r[32], const uint8_t a[32], const uint8_t b[32]) {
+  uint32_t borrow = 0;
+
+  for (int i = 31; i >= 0; i--) {
+    uint32_t d = (uint32_t)(a[i]) - b[i] - borrow;
+    r[i]   = (uint8_t)(d);
+    borrow = d >> 31;
+  }
+  return borrow;
+}
+
+// limbs of the Montgomery form of the 32 big endian bytes s < 2^256
+static void to_mont_limbs(const fp256_mod_t* m, uint32_t r[FP256_LIMBS], const uint8_t s[32]) {
+  fp256_t f;
+
+  fp256_frombytes(&f, 0, s);
+  fp256_to_mont(m, &f, &f, 1);
+  for (int i = 0; i < FP256_LIMBS; i++) {
+    r[i] = f.v[i][0];
+  }
+}
+
+int ecp256_curve_init(ecp256_curve_t* c, const uint8_t params[6][32]) {
+  uint8_t t [32];
+  uint8_t three [32] = {0};
+
+  fp256_mod_init(&c->p, params[0]);
+  fp256_mod_init(&c->n, params[5]);
+
+  three[31] = 3;
+  be_sub(t, params[0], three);
+  if (memcmp(t, params[1], 32)) {
+    return ECP256_ERR_PARAM;
+  }
+
+  memcpy(c->a_be,  params[1], 32);
+  memcpy(c->b_be,  params[2], 32);
+  memcpy(c->gx_be, params[3], 32);
+  memcpy(c->gy_be, params[4], 32);
+
+  to_mont_limbs(&c->p, c->b,  params[2]);
+  to_mont_limbs(&c->p, c->gx, params[3]);
+  to_mont_limbs(&c->p, c->gy, params[4]);
+
+  if (be_sub(c->pn_be, params[0], params[5])) {
+    memset(c->pn_be, 0, 32);
+  }
+
+  return ECP256_OK;
+}
+
+void ecp256_0(const ecp256_curve_t* c, ecp256_t* r, size_t vl) {
+  static const uint32_t zero [FP256_LIMBS] = {0};
+
+  fp256_set(&r->X, c->p.one, vl);
+  fp256_set(&r->Y, c->p.one, vl);
+  fp256_set(&r->Z, zero, vl);
+}
+
+void ecp256_base(const ecp256_curve_t* c, ecp256_t* r, size_t vl) {
+  fp256_set(&r->X, c->gx, vl);
+  fp256_set(&r->Y, c->gy, vl);
+  fp256_set(&r->Z, c->p.one, vl);
+}
+
+void ecp256_copy(ecp256_t* r, const ecp256_t* p, size_t vl) {
+  fp256_copy(&r->X, &p->X, vl);
+  fp256_copy(&r->Y, &p->Y, vl);
+  fp256_copy(&r->Z, &p->Z, vl);
+}
+
+void ecp256_cmov(ecp256_t* r, const ecp256_t* p, const uint32_t* sel, size_t vl) {
+  fp256_cmov(&r->X, &p->X, sel, vl);
+  fp256_cmov(&r->Y, &p->Y, sel, vl);
+  fp256_cmov(&r->Z, &p->Z, sel, vl);
+}
+
+void ecp256_select(ecp256_t* r, const ecp256_t* table, const uint32_t* idx, size_t vl) {
+  uint32_t off [FP256_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    off[i] = idx[i] * sizeof(ecp256_t) + i * sizeof(uint32_t);
+  }
+
+  fp256_gather(&r->X, &table->X, off, sizeof(table->X.v[0]), vl);
+  fp256_gather(&r->Y, &table->Y, off, sizeof(table->Y.v[0]), vl);
+  fp256_gather(&r->Z, &table->Z, off, sizeof(table->Z.v[0]), vl);
+}
+
+/*
+ * dbl-2001-b (a = -3), Z = 0 stays at Z3 = 0:
+ *   delta = Z^2, gamma = Y^2, beta = X*gamma
+ *   alpha = 3*(X-delta)*(X+delta)
+ *   X3 = alpha^2 - 8*beta
+ *   Z3 = (Y+Z)^2 - gamma - delta
+ *   Y3 = alpha*(4*beta - X3) - 8*gamma^2
+ */
+void ecp256_dbl(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  fp256_t delta, gamma, beta, alpha, t, u;
+
+  fp256_sq (m, &delta, &p->Z, vl);
+  fp256_sq (m, &gamma, &p->Y, vl);
+  fp256_mul(m, &beta,  &p->X, &gamma, vl);
+
+  fp256_sub(m, &t, &p->X, &delta, vl);
+  fp256_add(m, &u, &p->X, &delta, vl);
+  fp256_mul(m, &alpha, &t, &u, vl);
+  fp256_add(m, &t, &alpha, &alpha, vl);
+  fp256_add(m, &alpha, &alpha, &t, vl);
+
+  // Z3 before X and Y are overwritten (r may alias p)
+  fp256_add(m, &t, &p->Y, &p->Z, vl);
+  fp256_sq (m, &t, &t, vl);
+  fp256_sub(m, &t, &t, &gamma, vl);
+  fp256_sub(m, &r->Z, &t, &delta, vl);
+
+  fp256_add(m, &beta, &beta, &beta, vl);
+  fp256_add(m, &beta, &beta, &beta, vl);     // 4*beta
+  fp256_sq (m, &t, &alpha, vl);
+  fp256_sub(m, &t, &t, &beta, vl);
+  fp256_sub(m, &r->X, &t, &beta, vl);
+
+  fp256_sub(m, &t, &beta, &r->X, vl);
+  fp256_mul(m, &t, &alpha, &t, vl);
+  fp256_sq (m, &u, &gamma, vl);
+  fp256_add(m, &u, &u, &u, vl);
+  fp256_add(m, &u, &u, &u, vl);
+  fp256_add(m, &u, &u, &u, vl);              // 8*gamma^2
+  fp256_sub(m, &r->Y, &t, &u, vl);
+}
+
+/*
+ * add-1998-cmo-2:
+ *   U1 = X1*Z2^2, U2 = X2*Z1^2, S1 = Y1*Z2^3, S2 = Y2*Z1^3
+ *   H = U2-U1, R = S2-S1, V = U1*H^2
+ *   X3 = R^2 - H^3 - 2*V
+ *   Y3 = R*(V-X3) - S1*H^3
+ *   Z3 = Z1*Z2*H
+ * The formula fails for O and for p == q. O is patched in with a select,
+ * p == q (H = R = 0) falls back to the doubling, which is only computed
+ * when a lane needs it.
+ */
+void ecp256_add(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, const ecp256_t* q,
+                size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  ecp256_t s;
+  fp256_t  z1z1, z2z2, u1, u2, s1, s2, h, rr, hh, hhh, v, t;
+  uint32_t z1 [FP256_LANES];
+  uint32_t z2 [FP256_LANES];
+  uint32_t h0 [FP256_LANES];
+  uint32_t r0 [FP256_LANES];
+  uint32_t dbl = 0;
+
+  fp256_sq (m, &z1z1, &p->Z, vl);
+  fp256_sq (m, &z2z2, &q->Z, vl);
+  fp256_mul(m, &u1, &p->X, &z2z2, vl);
+  fp256_mul(m, &u2, &q->X, &z1z1, vl);
+  fp256_mul(m, &s1, &p->Y, &q->Z, vl);
+  fp256_mul(m, &s1, &s1, &z2z2, vl);
+  fp256_mul(m, &s2, &q->Y, &p->Z, vl);
+  fp256_mul(m, &s2, &s2, &z1z1, vl);
+
+  fp256_sub(m, &h,  &u2, &u1, vl);
+  fp256_sub(m, &rr, &s2, &s1, vl);
+  fp256_sq (m, &hh, &h, vl);
+  fp256_mul(m, &hhh, &h, &hh, vl);
+  fp256_mul(m, &v, &u1, &hh, vl);
+
+  fp256_sq (m, &t, &rr, vl);
+  fp256_sub(m, &t, &t, &hhh, vl);
+  fp256_sub(m, &t, &t, &v, vl);
+  fp256_sub(m, &s.X, &t, &v, vl);
+
+  fp256_sub(m, &t, &v, &s.X, vl);
+  fp256_mul(m, &t, &rr, &t, vl);
+  fp256_mul(m, &s1, &s1, &hhh, vl);
+  fp256_sub(m, &s.Y, &t, &s1, vl);
+
+  fp256_mul(m, &t, &p->Z, &q->Z, vl);
+  fp256_mul(m, &s.Z, &t, &h, vl);
+
+  fp256_is_zero(z1, &p->Z, vl);
+  fp256_is_zero(z2, &q->Z, vl);
+  fp256_is_zero(h0, &h, vl);
+  fp256_is_zero(r0, &rr, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    h0[i] &= r0[i] & !z1[i] & !z2[i];
+    dbl   |= h0[i];
+  }
+
+  if (dbl) {
+    ecp256_t d;
+    ecp256_dbl (c, &d, p, vl);
+    ecp256_cmov(&s, &d, h0, vl);
+  }
+
+  ecp256_cmov(&s, p, z2, vl);
+  ecp256_cmov(&s, q, z1, vl);
+  ecp256_copy(r, &s, vl);
+}
+
+/*
+ * madd-2007-bl, the addend has Z2 = 1:
+ *   U2 = X2*Z1^2, S2 = Y2*Z1^3, H = U2-X1, I = 4*H^2, J = H*I
+ *   R = 2*(S2-Y1), V = X1*I
+ *   X3 = R^2 - J - 2*V
+ *   Y3 = R*(V-X3) - 2*Y1*J
+ *   Z3 = (Z1+H)^2 - Z1^2 - H^2
+ * with the same exceptional cases as ecp256_add().
+ */
+void ecp256_add_precomp(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p,
+                        const ecp256_precomp_t* table, const uint32_t* idx, size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  ecp256_t s, q;
+  fp256_t  z1z1, u2, s2, h, hh, i4, j, rr, v, t;
+  uint32_t off  [FP256_LANES];
+  uint32_t z1   [FP256_LANES];
+  uint32_t h0   [FP256_LANES];
+  uint32_t r0   [FP256_LANES];
+  uint32_t keep [FP256_LANES];
+  uint32_t dbl = 0;
+
+  for (size_t i = 0; i < vl; i++) {
+    off [i] = idx[i] * sizeof(ecp256_precomp_t);
+    keep[i] = (idx[i] == 0);
+  }
+
+  fp256_gather(&q.X, table->x, off, sizeof(uint32_t), vl);
+  fp256_gather(&q.Y, table->y, off, sizeof(uint32_t), vl);
+  fp256_set   (&q.Z, m->one, vl);
+
+  fp256_sq (m, &z1z1, &p->Z, vl);
+  fp256_mul(m, &u2, &q.X, &z1z1, vl);
+  fp256_mul(m, &s2, &q.Y, &p->Z, vl);
+  fp256_mul(m, &s2, &s2, &z1z1, vl);
+
+  fp256_sub(m, &h,  &u2, &p->X, vl);
+  fp256_sub(m, &rr, &s2, &p->Y, vl);
+  fp256_is_zero(h0, &h, vl);
+  fp256_is_zero(r0, &rr, vl);
+  fp256_add(m, &rr, &rr, &rr, vl);
+
+  fp256_sq (m, &hh, &h, vl);
+  fp256_add(m, &i4, &hh, &hh, vl);
+  fp256_add(m, &i4, &i4, &i4, vl);
+  fp256_mul(m, &j, &h, &i4, vl);
+  fp256_mul(m, &v, &p->X, &i4, vl);
+
+  fp256_sq (m, &t, &rr, vl);
+  fp256_sub(m, &t, &t, &j, vl);
+  fp256_sub(m, &t, &t, &v, vl);
+  fp256_sub(m, &s.X, &t, &v, vl);
+
+  fp256_sub(m, &t, &v, &s.X, vl);
+  fp256_mul(m, &t, &rr, &t, vl);
+  fp256_mul(m, &j, &p->Y, &j, vl);
+  fp256_add(m, &j, &j, &j, vl);
+  fp256_sub(m, &s.Y, &t, &j, vl);
+
+  fp256_add(m, &t, &p->Z, &h, vl);
+  fp256_sq (m, &t, &t, vl);
+  fp256_sub(m, &t, &t, &z1z1, vl);
+  fp256_sub(m, &s.Z, &t, &hh, vl);
+
+  fp256_is_zero(z1, &p->Z, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    h0[i] &= r0[i] & !z1[i] & !keep[i];
+    dbl   |= h0[i];
+  }
+
+  if (dbl) {
+    ecp256_t d;
+    ecp256_dbl (c, &d, p, vl);
+    ecp256_cmov(&s, &d, h0, vl);
+  }
+
+  ecp256_cmov(&s, &q, z1, vl);
+  ecp256_cmov(&s, p, keep, vl);
+  ecp256_copy(r, &s, vl);
+}
+
+void ecp256_frombytes(const ecp256_curve_t* c, ecp256_t* r, uint32_t* valid,
+                      const uint8_t* const* s, size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  fp256_t  t, u, b;
+  uint32_t ok [FP256_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    fp256_frombytes(&r->X, i, s[i]);
+    fp256_frombytes(&r->Y, i, s[i] + 32);
+    valid[i] = memcmp(s[i], m->be, 32) < 0 && memcmp(s[i] + 32, m->be, 32) < 0;
+  }
+
+  fp256_to_mont(m, &r->X, &r->X, vl);
+  fp256_to_mont(m, &r->Y, &r->Y, vl);
+  fp256_set    (&r->Z, m->one, vl);
+
+  // y^2 == (x^2 - 3)*x + b
+  fp256_set(&b, m->one, vl);
+  fp256_add(m, &t, &b, &b, vl);
+  fp256_add(m, &t, &t, &b, vl);
+  fp256_sq (m, &u, &r->X, vl);
+  fp256_sub(m, &u, &u, &t, vl);
+  fp256_mul(m, &u, &u, &r->X, vl);
+  fp256_set(&b, c->b, vl);
+  fp256_add(m, &u, &u, &b, vl);
+  fp256_sq (m, &t, &r->Y, vl);
+  fp256_sub(m, &t, &t, &u, vl);
+  fp256_is_zero(ok, &t, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    valid[i] &= ok[i];
+  }
+}
+
+void ecp256_tobytes(const ecp256_curve_t* c, uint8_t (*s)[64], uint32_t* finite,
+                    const ecp256_t* p, size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  fp256_t zi, zi2, x, y;
+
+  // 0^(p-2) = 0 maps O to (0, 0)
+  fp256_invert(m, &zi, &p->Z, vl);
+  fp256_sq    (m, &zi2, &zi, vl);
+  fp256_mul   (m, &x, &p->X, &zi2, vl);
+  fp256_mul   (m, &zi, &zi, &zi2, vl);
+  fp256_mul   (m, &y, &p->Y, &zi, vl);
+  fp256_from_mont(m, &x, &x, vl);
+  fp256_from_mont(m, &y, &y, vl);
+  fp256_is_zero(finite, &p->Z, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    finite[i] = !finite[i];
+    fp256_tobytes(s[i],      &x, i);
+    fp256_tobytes(s[i] + 32, &y, i);
+  }
+}
+
+// bit t of a 32 byte big endian scalar
+#define SCALAR_BIT(k, t)  (((k)[31 - ((t) >> 3)] >> ((t) & 7)) & 1)
+
+void ecp256_mul2(const ecp256_curve_t* c, ecp256_t* r, const ecp256_t* p, const uint8_t (*k1)[32],
+                 const ecp256_t* q, const uint8_t (*k2)[32], size_t vl) {
+  ecp256_t table [4];
+  ecp256_t acc, addend;
+  uint32_t sel [4][FP256_LANES];
+
+  // addends indexed by (bit of k2) << 1 | (bit of k1): O, p, q, p+q
+  ecp256_0   (c, &table[0], vl);
+  ecp256_copy(&table[1], p, vl);
+  ecp256_copy(&table[2], q, vl);
+  ecp256_add (c, &table[3], p, q, vl);
+
+  ecp256_0(c, &acc, vl);
+
+  for (int t = 255; t >= 0; t--) {
+
+    ecp256_dbl(c, &acc, &acc, vl);
+
+    for (size_t i = 0; i < vl; i++) {
+      uint32_t idx = SCALAR_BIT(k1[i], t) | (SCALAR_BIT(k2[i], t) << 1);
+      sel[1][i] = (idx == 1);
+      sel[2][i] = (idx == 2);
+      sel[3][i] = (idx == 3);
+    }
+
+    ecp256_copy(&addend, &table[0], vl);
+    ecp256_cmov(&addend, &table[1], sel[1], vl);
+    ecp256_cmov(&addend, &table[2], sel[2], vl);
+    ecp256_cmov(&addend, &table[3], sel[3], vl);
+
+    ecp256_add(c, &acc, &acc, &addend, vl);
+  }
+
+  ecp256_copy(r, &acc, vl);
+}
+
+// the 4 bits of a 32 byte big endian scalar starting at bit t, t = 0 mod 4
+#define SCALAR_NIBBLE(k, t)  (((k)[31 - ((t) >> 3)] >> ((t) & 7)) & 15)
+
+void ecp256_mul2_comb(const ecp256_curve_t* c, ecp256_t* r, const ecp256_precomp_t* comb,
+                      const uint8_t (*k1)[32], const ecp256_t* q, const uint8_t (*k2)[32],
+                      size_t vl) {
+  ecp256_t table [16];
+  ecp256_t acc, addend;
+  uint32_t idx [FP256_LANES];
+
+  // table[j] = [j]q
+  ecp256_0   (c, &table[0], vl);
+  ecp256_copy(&table[1], q, vl);
+  ecp256_dbl (c, &table[2], q, vl);
+  for (int j = 3; j < 16; j++) {
+    ecp256_add(c, &table[j], &table[j - 1], q, vl);
+  }
+
+  ecp256_0(c, &acc, vl);
+
+  for (int t = 255; t >= 0; t--) {
+
+    ecp256_dbl(c, &acc, &acc, vl);
+
+    if ((t & 3) == 0) {
+      for (size_t i = 0; i < vl; i++) {
+        idx[i] = SCALAR_NIBBLE(k2[i], t);
+      }
+      ecp256_select(&addend, table, idx, vl);
+      ecp256_add   (c, &acc, &acc, &addend, vl);
+    }
+
+    // the comb teeth of k1 are 64 bits apart
+    if (t < 64) {
+      for (size_t i = 0; i < vl; i++) {
+        idx[i] = SCALAR_BIT(k1[i], t)             | (SCALAR_BIT(k1[i], t + 64)  << 1) |
+                 (SCALAR_BIT(k1[i], t + 128) << 2) | (SCALAR_BIT(k1[i], t + 192) << 3);
+      }
+      ecp256_add_precomp(c, &acc, &acc, comb, idx, vl);
+    }
+  }
+
+  ecp256_copy(r, &acc, vl);
+}
+
+void ecp256_x_equals(const ecp256_curve_t* c, uint32_t* eq, const ecp256_t* p,
+                     const uint8_t (*r)[32], size_t vl) {
+  const fp256_mod_t* m = &c->p;
+  fp256_t  z2, x, t, n;
+  uint32_t inf  [FP256_LANES];
+  uint32_t eq2  [FP256_LANES];
+
+  // r < n < 2^256, the conversion reduces both mod p
+  for (size_t i = 0; i < vl; i++) {
+    fp256_frombytes(&x, i, r[i]);
+    fp256_frombytes(&n, i, c->n.be);
+  }
+  fp256_to_mont(m, &x, &x, vl);
+  fp256_to_mont(m, &n, &n, vl);
+
+  fp256_sq (m, &z2, &p->Z, vl);
+  fp256_mul(m, &t, &x, &z2, vl);
+  fp256_sub(m, &t, &t, &p->X, vl);
+  fp256_is_zero(eq, &t, vl);
+
+  fp256_add(m, &x, &x, &n, vl);
+  fp256_mul(m, &t, &x, &z2, vl);
+  fp256_sub(m, &t, &t, &p->X, vl);
+  fp256_is_zero(eq2, &t, vl);
+
+  fp256_is_zero(inf, &p->Z, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    eq2[i] &= memcmp(r[i], c->pn_be, 32) < 0;
+    eq [i]  = (eq[i] | eq2[i]) & !inf[i];
+  }
+}
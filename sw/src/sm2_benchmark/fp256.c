@@ -0,0 +1,401 @@
+/*
+ * File      : fp256.c
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: Batched Montgomery arithmetic modulo a 256b prime with one
+ * element per e32 lane. The CIOS rounds accumulate the limb products with
+ * vwmaccu into e64 and only carry once, after the last round.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include <riscv_vector.h>
+
+#include "crypto/ecc/fp256.h"
+
+#define MASK29  0x1fffffffu
+
+#define LOAD_FP(P, f)                                                   \
+  vuint32m1_t P##0 = __riscv_vle32_v_u32m1((f)->v[0], vl);              \
+  vuint32m1_t P##1 = __riscv_vle32_v_u32m1((f)->v[1], vl);              \
+  vuint32m1_t P##2 = __riscv_vle32_v_u32m1((f)->v[2], vl);              \
+  vuint32m1_t P##3 = __riscv_vle32_v_u32m1((f)->v[3], vl);              \
+  vuint32m1_t P##4 = __riscv_vle32_v_u32m1((f)->v[4], vl);              \
+  vuint32m1_t P##5 = __riscv_vle32_v_u32m1((f)->v[5], vl);              \
+  vuint32m1_t P##6 = __riscv_vle32_v_u32m1((f)->v[6], vl);              \
+  vuint32m1_t P##7 = __riscv_vle32_v_u32m1((f)->v[7], vl);              \
+  vuint32m1_t P##8 = __riscv_vle32_v_u32m1((f)->v[8], vl);
+
+#define STORE_FP(h, P) {                                                \
+  __riscv_vse32_v_u32m1((h)->v[0], P##0, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[1], P##1, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[2], P##2, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[3], P##3, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[4], P##4, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[5], P##5, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[6], P##6, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[7], P##7, vl);                           \
+  __riscv_vse32_v_u32m1((h)->v[8], P##8, vl);                           \
+}
+
+// move the bits of limb a above 29 into limb b (unsigned)
+#define CARRY(a, b) {                                                   \
+  b = __riscv_vadd_vv_u32m1(b, __riscv_vsrl_vx_u32m1(a, FP256_RADIX, vl), vl); \
+  a = __riscv_vand_vx_u32m1(a, MASK29, vl);                             \
+}
+
+#define CARRY_CHAIN(h) {                                                \
+  CARRY(h##0, h##1) CARRY(h##1, h##2) CARRY(h##2, h##3) CARRY(h##3, h##4) \
+  CARRY(h##4, h##5) CARRY(h##5, h##6) CARRY(h##6, h##7) CARRY(h##7, h##8) \
+}
+
+// signed carry: c is the arithmetic shift of limb a, 0 or -1 for a borrow
+#define SCARRY(a, c) {                                                  \
+  c = __riscv_vreinterpret_v_i32m1_u32m1(__riscv_vsra_vx_i32m1(          \
+        __riscv_vreinterpret_v_u32m1_i32m1(a), FP256_RADIX, vl));       \
+  a = __riscv_vand_vx_u32m1(a, MASK29, vl);                             \
+}
+
+// d##i = h##i + k * p[i] + c, with the signed carry chain through c
+#define ADD_P_LIMB(d, h, i, op) {                                       \
+  d##i = __riscv_vadd_vv_u32m1(op(h##i, m->p[i], vl), c, vl);           \
+  SCARRY(d##i, c)                                                       \
+}
+
+#define ADD_P(d, h, op)                                                 \
+  ADD_P_LIMB(d, h, 0, op) ADD_P_LIMB(d, h, 1, op) ADD_P_LIMB(d, h, 2, op) \
+  ADD_P_LIMB(d, h, 3, op) ADD_P_LIMB(d, h, 4, op) ADD_P_LIMB(d, h, 5, op) \
+  ADD_P_LIMB(d, h, 6, op) ADD_P_LIMB(d, h, 7, op) ADD_P_LIMB(d, h, 8, op)
+
+#define SEL(h, d, k)                                                    \
+  h##k = __riscv_vmerge_vvm_u32m1(h##k, d##k, sel, vl);
+
+#define SELECT(h, d)                                                    \
+  SEL(h, d, 0) SEL(h, d, 1) SEL(h, d, 2) SEL(h, d, 3) SEL(h, d, 4)       \
+  SEL(h, d, 5) SEL(h, d, 6) SEL(h, d, 7) SEL(h, d, 8)
+
+/*
+ * h = h - p in the lanes where h >= p, for carried limbs with h < 2p. The
+ * subtraction is done in every lane and its final borrow picks the result.
+ */
+#define REDUCE(h) {                                                     \
+  vuint32m1_t d0, d1, d2, d3, d4, d5, d6, d7, d8;                       \
+  vuint32m1_t c = __riscv_vmv_v_x_u32m1(0, vl);                         \
+  ADD_P(d, h, __riscv_vsub_vx_u32m1)                                    \
+  vbool32_t sel = __riscv_vmseq_vx_u32m1_b32(c, 0, vl);                 \
+  SELECT(h, d)                                                          \
+}
+
+size_t fp256_lanes(void) {
+  size_t vlmax = __riscv_vsetvlmax_e32m1();
+  return vlmax < FP256_LANES ? vlmax : FP256_LANES;
+}
+
+/*
+ * The constants are computed once per modulus with scalar code, on limbs
+ * in the 29b radix.
+ */
+static void limbs_frombytes(uint32_t r[FP256_LIMBS], const uint8_t s[32]) {
+  uint64_t acc  = 0;
+  int      bits = 0;
+  int      j    = 0;
+
+  for (int i = 31; i >= 0; i--) {
+    acc  |= (uint64_t)(s[i]) << bits;
+    bits += 8;
+    if (bits >= FP256_RADIX) {
+      r[j++] = (uint32_t)(acc) & MASK29;
+      acc  >>= FP256_RADIX;
+      bits  -= FP256_RADIX;
+    }
+  }
+  r[j] = (uint32_t)(acc);
+}
+
+static void limbs_tobytes(uint8_t s[32], const uint32_t r[FP256_LIMBS]) {
+  uint64_t acc  = 0;
+  int      bits = 0;
+  int      k    = 31;
+
+  for (int j = 0; j < FP256_LIMBS; j++) {
+    acc  |= (uint64_t)(r[j]) << bits;
+    bits += FP256_RADIX;
+    while (bits >= 8 && k >= 0) {
+      s[k--] = (uint8_t)(acc);
+      acc  >>= 8;
+      bits  -= 8;
+    }
+  }
+}
+
+// r = 2r mod p, for r < p
+static void limbs_dbl_mod(uint32_t r[FP256_LIMBS], const uint32_t p[FP256_LIMBS]) {
+  uint32_t d [FP256_LIMBS];
+  uint32_t c = 0;
+  int32_t  b = 0;
+
+  for (int i = 0; i < FP256_LIMBS; i++) {
+    r[i] = (r[i] << 1) | c;
+    c    = r[i] >> FP256_RADIX;
+    r[i] &= MASK29;
+  }
+  for (int i = 0; i < FP256_LIMBS; i++) {
+    int32_t x = (int32_t)(r[i]) - (int32_t)(p[i]) + b;
+    b    = x >> FP256_RADIX;
+    d[i] = (uint32_t)(x) & MASK29;
+  }
+  // 2r < 2p < 2^261 never carries out of the top limb
+  if (b == 0) {
+    memcpy(r, d, sizeof(d));
+  }
+}
+
+void fp256_mod_init(fp256_mod_t* m, const uint8_t p[32]) {
+  uint32_t r [FP256_LIMBS] = {1};
+  uint32_t x = 1;
+
+  memcpy(m->be, p, 32);
+  limbs_frombytes(m->p, p);
+
+  // Newton iteration for p^-1 mod 2^32, every step doubles the good bits
+  for (int i = 0; i < 5; i++) {
+    x *= 2 - m->p[0] * x;
+  }
+  m->n0 = (0 - x) & MASK29;
+
+  // 1 doubled 261 times is R, 522 times R^2
+  for (int i = 1; i <= 2 * 9 * FP256_RADIX; i++) {
+    limbs_dbl_mod(r, m->p);
+    if (i == 9 * FP256_RADIX) {
+      memcpy(m->one, r, sizeof(r));
+    }
+  }
+  memcpy(m->rr, r, sizeof(r));
+}
+
+void fp256_set(fp256_t* h, const uint32_t c[FP256_LIMBS], size_t vl) {
+  for (size_t i = 0; i < FP256_LIMBS; i++) {
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vmv_v_x_u32m1(c[i], vl), vl);
+  }
+}
+
+void fp256_copy(fp256_t* h, const fp256_t* f, size_t vl) {
+  for (size_t i = 0; i < FP256_LIMBS; i++) {
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vle32_v_u32m1(f->v[i], vl), vl);
+  }
+}
+
+#define ADD_LIMB(i) vuint32m1_t h##i = __riscv_vadd_vv_u32m1(f##i, g##i, vl);
+
+void fp256_add(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl) {
+  LOAD_FP(f, f)
+  LOAD_FP(g, g)
+  ADD_LIMB(0) ADD_LIMB(1) ADD_LIMB(2) ADD_LIMB(3) ADD_LIMB(4)
+  ADD_LIMB(5) ADD_LIMB(6) ADD_LIMB(7) ADD_LIMB(8)
+  CARRY_CHAIN(h)
+  REDUCE(h)
+  STORE_FP(h, h)
+}
+
+#define SUB_LIMB(i) {                                                   \
+  h##i = __riscv_vadd_vv_u32m1(__riscv_vsub_vv_u32m1(f##i, g##i, vl), c, vl); \
+  SCARRY(h##i, c)                                                       \
+}
+
+/*
+ * h = f - g with a signed borrow chain. The difference is corrected by
+ * adding p in the lanes where the final borrow is set, the carry out of the
+ * top limb then cancels the borrow.
+ */
+void fp256_sub(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl) {
+  vuint32m1_t h0, h1, h2, h3, h4, h5, h6, h7, h8;
+  vuint32m1_t d0, d1, d2, d3, d4, d5, d6, d7, d8;
+  vuint32m1_t c = __riscv_vmv_v_x_u32m1(0, vl);
+
+  LOAD_FP(f, f)
+  LOAD_FP(g, g)
+  SUB_LIMB(0) SUB_LIMB(1) SUB_LIMB(2) SUB_LIMB(3) SUB_LIMB(4)
+  SUB_LIMB(5) SUB_LIMB(6) SUB_LIMB(7) SUB_LIMB(8)
+
+  vbool32_t sel = __riscv_vmsne_vx_u32m1_b32(c, 0, vl);
+
+  c = __riscv_vmv_v_x_u32m1(0, vl);
+  ADD_P(d, h, __riscv_vadd_vx_u32m1)
+  SELECT(h, d)
+  STORE_FP(h, h)
+}
+
+/*
+ * One CIOS round: t += f * g_i, then q = t0 * n0 mod 2^29 and t += q * p,
+ * which clears the low 29 bits of t0, and shift t down by one limb. Only
+ * the carry out of t0 is propagated, the other columns keep growing.
+ *
+ * Moduli with p = -1 mod 2^29 (n0 = 1: SM2, P-256 and their relatives of
+ * the form 2^256 - ... - 1) take the quotient digit straight from t0, and
+ * zero limbs of p are skipped. This is the Montgomery-side equivalent of
+ * a Solinas reduction, the sparse p is only ever added, never divided by.
+ */
+#define QUOTIENT_N0                                                     \
+  __riscv_vand_vx_u32m1(__riscv_vmul_vx_u32m1(                          \
+    __riscv_vncvt_x_x_w_u32m1(t0, vl), m->n0, vl), MASK29, vl)
+
+#define QUOTIENT_ONE                                                    \
+  __riscv_vand_vx_u32m1(__riscv_vncvt_x_x_w_u32m1(t0, vl), MASK29, vl)
+
+#define ACC_P(j)                                                        \
+  if (m->p[j] != 0) {                                                   \
+    t##j = __riscv_vwmaccu_vx_u64m2(t##j, m->p[j], q, vl);              \
+  }
+
+#define MUL_ROUND(i, QUOTIENT) {                                        \
+  t0 = __riscv_vwmaccu_vv_u64m2(t0, f0, g##i, vl);                      \
+  t1 = __riscv_vwmaccu_vv_u64m2(t1, f1, g##i, vl);                      \
+  t2 = __riscv_vwmaccu_vv_u64m2(t2, f2, g##i, vl);                      \
+  t3 = __riscv_vwmaccu_vv_u64m2(t3, f3, g##i, vl);                      \
+  t4 = __riscv_vwmaccu_vv_u64m2(t4, f4, g##i, vl);                      \
+  t5 = __riscv_vwmaccu_vv_u64m2(t5, f5, g##i, vl);                      \
+  t6 = __riscv_vwmaccu_vv_u64m2(t6, f6, g##i, vl);                      \
+  t7 = __riscv_vwmaccu_vv_u64m2(t7, f7, g##i, vl);                      \
+  t8 = __riscv_vwmaccu_vv_u64m2(t8, f8, g##i, vl);                      \
+  vuint32m1_t q = QUOTIENT;                                             \
+  ACC_P(0) ACC_P(1) ACC_P(2) ACC_P(3) ACC_P(4)                          \
+  ACC_P(5) ACC_P(6) ACC_P(7) ACC_P(8)                                   \
+  t0 = __riscv_vadd_vv_u64m2(t1, __riscv_vsrl_vx_u64m2(t0, FP256_RADIX, vl), vl); \
+  t1 = t2; t2 = t3; t3 = t4; t4 = t5; t5 = t6; t6 = t7; t7 = t8;        \
+  t8 = __riscv_vmv_v_x_u64m2(0, vl);                                    \
+}
+
+#define MUL_ROUNDS(QUOTIENT)                                            \
+  MUL_ROUND(0, QUOTIENT) MUL_ROUND(1, QUOTIENT) MUL_ROUND(2, QUOTIENT)  \
+  MUL_ROUND(3, QUOTIENT) MUL_ROUND(4, QUOTIENT) MUL_ROUND(5, QUOTIENT)  \
+  MUL_ROUND(6, QUOTIENT) MUL_ROUND(7, QUOTIENT) MUL_ROUND(8, QUOTIENT)
+
+// carry column i of the accumulators into its 29b limb
+#define COLUMN(i) {                                                     \
+  c    = __riscv_vadd_vv_u64m2(t##i, __riscv_vsrl_vx_u64m2(c, FP256_RADIX, vl), vl); \
+  h##i = __riscv_vand_vx_u32m1(__riscv_vncvt_x_x_w_u32m1(c, vl), MASK29, vl); \
+}
+
+void fp256_mul(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, const fp256_t* g, size_t vl) {
+  vuint32m1_t h0, h1, h2, h3, h4, h5, h6, h7, h8;
+  vuint64m2_t t0, t1, t2, t3, t4, t5, t6, t7, t8, c;
+
+  LOAD_FP(f, f)
+  LOAD_FP(g, g)
+
+  t0 = t1 = t2 = t3 = t4 = t5 = t6 = t7 = t8 = __riscv_vmv_v_x_u64m2(0, vl);
+
+  if (m->n0 == 1) {
+    MUL_ROUNDS(QUOTIENT_ONE)
+  } else {
+    MUL_ROUNDS(QUOTIENT_N0)
+  }
+
+  // t < 2p < 2^258, so the carried top limb stays below 2^29
+  c  = t0;
+  h0 = __riscv_vand_vx_u32m1(__riscv_vncvt_x_x_w_u32m1(c, vl), MASK29, vl);
+  COLUMN(1) COLUMN(2) COLUMN(3) COLUMN(4)
+  COLUMN(5) COLUMN(6) COLUMN(7) COLUMN(8)
+
+  REDUCE(h)
+  STORE_FP(h, h)
+}
+
+void fp256_sq(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl) {
+  fp256_mul(m, h, f, f, vl);
+}
+
+// left-to-right square and multiply over the public exponent p - 2
+void fp256_invert(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl) {
+  uint8_t  e [32];
+  fp256_t  x, r;
+  uint32_t b = 2;
+
+  // e = p - 2, p is odd and far above 2
+  for (int i = 31; i >= 0; i--) {
+    uint32_t d = (uint32_t)(m->be[i]) - b;
+    e[i] = (uint8_t)(d);
+    b    = d >> 31;
+  }
+
+  fp256_copy(&x, f, vl);
+  fp256_set (&r, m->one, vl);
+
+  for (int i = 0; i < 256; i++) {
+    fp256_sq(m, &r, &r, vl);
+    if ((e[i >> 3] >> (7 - (i & 7))) & 1) {
+      fp256_mul(m, &r, &r, &x, vl);
+    }
+  }
+
+  fp256_copy(h, &r, vl);
+}
+
+void fp256_to_mont(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl) {
+  fp256_t rr;
+
+  fp256_set(&rr, m->rr, vl);
+  fp256_mul(m, h, f, &rr, vl);
+}
+
+void fp256_from_mont(const fp256_mod_t* m, fp256_t* h, const fp256_t* f, size_t vl) {
+  static const uint32_t one [FP256_LIMBS] = {1};
+  fp256_t u;
+
+  fp256_set(&u, one, vl);
+  fp256_mul(m, h, f, &u, vl);
+}
+
+void fp256_cmov(fp256_t* h, const fp256_t* f, const uint32_t* sel, size_t vl) {
+  vbool32_t m = __riscv_vmsne_vx_u32m1_b32(__riscv_vle32_v_u32m1(sel, vl), 0, vl);
+
+  for (size_t i = 0; i < FP256_LIMBS; i++) {
+    vuint32m1_t a = __riscv_vle32_v_u32m1(h->v[i], vl);
+    vuint32m1_t b = __riscv_vle32_v_u32m1(f->v[i], vl);
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vmerge_vvm_u32m1(a, b, m, vl), vl);
+  }
+}
+
+void fp256_gather(fp256_t* h, const void* base, const uint32_t* off, size_t stride, size_t vl) {
+  vuint32m1_t o = __riscv_vle32_v_u32m1(off, vl);
+
+  for (size_t i = 0; i < FP256_LIMBS; i++) {
+    __riscv_vse32_v_u32m1(h->v[i], __riscv_vluxei32_v_u32m1((const uint32_t*)(base), o, vl), vl);
+    o = __riscv_vadd_vx_u32m1(o, (uint32_t)(stride), vl);
+  }
+}
+
+void fp256_is_zero(uint32_t* zero, const fp256_t* f, size_t vl) {
+  vuint32m1_t a = __riscv_vle32_v_u32m1(f->v[0], vl);
+
+  for (size_t i = 1; i < FP256_LIMBS; i++) {
+    a = __riscv_vor_vv_u32m1(a, __riscv_vle32_v_u32m1(f->v[i], vl), vl);
+  }
+
+  vbool32_t z = __riscv_vmseq_vx_u32m1_b32(a, 0, vl);
+  __riscv_vse32_v_u32m1(zero, __riscv_vmerge_vxm_u32m1(__riscv_vmv_v_x_u32m1(0, vl), 1, z, vl), vl);
+}
+
+/*
+ * Conversion from/to bytes works on a single lane with scalar code, it is
+ * only needed when a batch is loaded or its results are checked.
+ */
+void fp256_frombytes(fp256_t* h, size_t lane, const uint8_t s[32]) {
+  uint32_t r [FP256_LIMBS];
+
+  limbs_frombytes(r, s);
+  for (int i = 0; i < FP256_LIMBS; i++) {
+    h->v[i][lane] = r[i];
+  }
+}
+
+void fp256_tobytes(uint8_t s[32], const fp256_t* f, size_t lane) {
+  uint32_t r [FP256_LIMBS];
+
+  for (int i = 0; i < FP256_LIMBS; i++) {
+    r[i] = f->v[i][lane];
+  }
+  limbs_tobytes(s, r);
+}
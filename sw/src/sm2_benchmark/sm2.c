@@ -0,0 +1,344 @@
+/*
+ * File      : sm2.c
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: SM2 signature verification and key exchange. A batch
+ * verifies one signature per vector lane: the scalars mod n are derived
+ * for all lanes at once with the fp256 arithmetic over the group order, and
+ * [s]G + [t]P is computed with a uniform Shamir loop. The x coordinate is
+ * checked projectively, so verification needs no field inversion.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+
+#include "crypto/sm2/api_sm2.h"
+#include "crypto/ecc/fp256.h"
+#include "crypto/ecc/ecp256.h"
+#include "crypto/sm3/sm3_api.h"
+
+// curve parameters p, a, b, Gx, Gy, n (GB/T 32918.5)
+static const uint8_t kSm2Params[6][32] = {
+  { 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff },
+  { 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfc },
+  { 0x28, 0xe9, 0xfa, 0x9e, 0x9d, 0x9f, 0x5e, 0x34, 0x4d, 0x5a, 0x9e, 0x4b, 0xcf, 0x65, 0x09, 0xa7,
+    0xf3, 0x97, 0x89, 0xf5, 0x15, 0xab, 0x8f, 0x92, 0xdd, 0xbc, 0xbd, 0x41, 0x4d, 0x94, 0x0e, 0x93 },
+  { 0x32, 0xc4, 0xae, 0x2c, 0x1f, 0x19, 0x81, 0x19, 0x5f, 0x99, 0x04, 0x46, 0x6a, 0x39, 0xc9, 0x94,
+    0x8f, 0xe3, 0x0b, 0xbf, 0xf2, 0x66, 0x0b, 0xe1, 0x71, 0x5a, 0x45, 0x89, 0x33, 0x4c, 0x74, 0xc7 },
+  { 0xbc, 0x37, 0x36, 0xa2, 0xf4, 0xf6, 0x77, 0x9c, 0x59, 0xbd, 0xce, 0xe3, 0x6b, 0x69, 0x21, 0x53,
+    0xd0, 0xa9, 0x87, 0x7c, 0xc6, 0x2a, 0x47, 0x40, 0x02, 0xdf, 0x32, 0xe5, 0x21, 0x39, 0xf0, 0xa0 },
+  { 0xff, 0xff, 0xff, 0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+    0x72, 0x03, 0xdf, 0x6b, 0x21, 0xc6, 0x05, 0x2b, 0x53, 0xbb, 0xf4, 0x09, 0x39, 0xd5, 0x41, 0x23 }
+};
+
+static ecp256_curve_t sm2_curve;
+static int            sm2_curve_ready = 0;
+
+// the Montgomery constants are derived on first use
+static const ecp256_curve_t* sm2_get_curve(void) {
+  if (!sm2_curve_ready) {
+    ecp256_curve_init(&sm2_curve, kSm2Params);
+    sm2_curve_ready = 1;
+  }
+  return &sm2_curve;
+}
+
+static const uint32_t kZero[FP256_LIMBS] = {0};
+
+// 0 < s < n
+static int sc_in_range(const ecp256_curve_t* c, const uint8_t s[32]) {
+  uint8_t any = 0;
+
+  for (int i = 0; i < 32; i++) {
+    any |= s[i];
+  }
+  return any != 0 && memcmp(s, c->n.be, 32) < 0;
+}
+
+// r = a * b mod n, for a < 2^256 and b < n
+static void sc_mul(const ecp256_curve_t* c, uint8_t r[32], const uint8_t a[32], const uint8_t b[32]) {
+  fp256_t f, g;
+
+  fp256_frombytes(&f, 0, a);
+  fp256_frombytes(&g, 0, b);
+  fp256_to_mont(&c->n, &f, &f, 1);
+  fp256_mul    (&c->n, &f, &f, &g, 1);
+  fp256_tobytes(r, &f, 0);
+}
+
+// r = a + b mod n, for a, b < n
+static void sc_add(const ecp256_curve_t* c, uint8_t r[32], const uint8_t a[32], const uint8_t b[32]) {
+  fp256_t f, g;
+
+  fp256_frombytes(&f, 0, a);
+  fp256_frombytes(&g, 0, b);
+  fp256_add    (&c->n, &f, &f, &g, 1);
+  fp256_tobytes(r, &f, 0);
+}
+
+int sm2_compute_za(uint8_t za[SM2_DIGEST_BYTES], const uint8_t* id, size_t id_len,
+                   const uint8_t pk[SM2_PUBLIC_KEY_BYTES]) {
+
+  const ecp256_curve_t* c = sm2_get_curve();
+  uint8_t               entl [2];
+
+  // ENTL is the identity length in bits, on 16 bits
+  if (id_len >= 8192) {
+    return SM2_ERR_PARAM;
+  }
+  entl[0] = (uint8_t)(id_len >> 5);
+  entl[1] = (uint8_t)(id_len << 3);
+
+  crypto_iovec_t iov[7] = {
+    { entl,             2      },
+    { (void*)(id),      id_len },
+    { (void*)(c->a_be),  32     },
+    { (void*)(c->b_be),  32     },
+    { (void*)(c->gx_be), 32     },
+    { (void*)(c->gy_be), 32     },
+    { (void*)(pk),      SM2_PUBLIC_KEY_BYTES }
+  };
+
+  sm3_256_iov(za, iov, 7);
+
+  return SM2_OK;
+}
+
+// e = SM3(ZA || M)
+static int sm2_digest(uint8_t e[SM2_DIGEST_BYTES], const sm2_item_t* item) {
+  uint8_t za [SM2_DIGEST_BYTES];
+  int     ret;
+
+  ret = sm2_compute_za(za, item->id, item->id_len, item->pk);
+
+  crypto_iovec_t iov[2] = {
+    { za,                   SM2_DIGEST_BYTES },
+    { (void*)(item->msg),   item->msg_len    }
+  };
+
+  sm3_256_iov(e, iov, 2);
+
+  return ret;
+}
+
+static void sm2_verify_lanes(const sm2_item_t* items, int* result, size_t vl) {
+
+  const ecp256_curve_t* c = sm2_get_curve();
+  ecp256_t       a, g, p;
+  fp256_t        fr, fs, fe, ft, zero;
+  const uint8_t* pk    [FP256_LANES];
+  uint8_t        s     [FP256_LANES][32];
+  uint8_t        t     [FP256_LANES][32];
+  uint8_t        x     [FP256_LANES][32];
+  uint8_t        e     [32];
+  uint32_t       valid [FP256_LANES];
+  uint32_t       eq    [FP256_LANES];
+  uint32_t       t0    [FP256_LANES];
+
+  for (size_t i = 0; i < vl; i++) {
+    const uint8_t* r = items[i].sig;
+
+    pk[i] = items[i].pk;
+    memcpy(s[i], items[i].sig + 32, 32);
+
+    if (!sc_in_range(c, r) || !sc_in_range(c, s[i])) {
+      result[i] = SM2_ERR_ENCODING;
+    } else {
+      result[i] = SM2_OK;
+    }
+    if (sm2_digest(e, &items[i]) != SM2_OK) {
+      result[i] = SM2_ERR_PARAM;
+    }
+
+    fp256_frombytes(&fr, i, r);
+    fp256_frombytes(&fs, i, s[i]);
+    fp256_frombytes(&fe, i, e);
+  }
+
+  // t = r + s and x = r - e mod n, as plain (non-Montgomery) residues
+  fp256_set(&zero, kZero, vl);
+  fp256_add(&c->n, &fe, &fe, &zero, vl);
+  fp256_add(&c->n, &ft, &fr, &fs, vl);
+  fp256_sub(&c->n, &fr, &fr, &fe, vl);
+  fp256_is_zero(t0, &ft, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    fp256_tobytes(t[i], &ft, i);
+    fp256_tobytes(x[i], &fr, i);
+  }
+
+  ecp256_frombytes(c, &a, valid, pk, vl);
+
+  // p = [s]G + [t]P, its x coordinate must be r - e mod n
+  ecp256_base    (c, &g, vl);
+  ecp256_mul2    (c, &p, &g, s, &a, t, vl);
+  ecp256_x_equals(c, eq, &p, x, vl);
+
+  for (size_t i = 0; i < vl; i++) {
+    if (result[i] == SM2_OK && !valid[i]) {
+      result[i] = SM2_ERR_ENCODING;
+    }
+    if (result[i] == SM2_OK && (t0[i] || !eq[i])) {
+      result[i] = SM2_ERR_MISMATCH;
+    }
+  }
+}
+
+int sm2_verify(const uint8_t sig[SM2_SIGNATURE_BYTES], const uint8_t* msg, size_t msg_len,
+               const uint8_t* id, size_t id_len, const uint8_t pk[SM2_PUBLIC_KEY_BYTES]) {
+
+  sm2_item_t item = { pk, sig, id, id_len, msg, msg_len };
+  int        result;
+
+  sm2_verify_lanes(&item, &result, 1);
+
+  return result;
+}
+
+size_t sm2_verify_batch(const sm2_item_t* items, int* result, size_t n) {
+
+  size_t lanes = fp256_lanes();
+  size_t fail  = 0;
+
+  for (size_t i = 0; i < n; i += lanes) {
+    size_t vl = (n - i) < lanes ? (n - i) : lanes;
+    sm2_verify_lanes(items + i, result + i, vl);
+  }
+
+  for (size_t i = 0; i < n; i++) {
+    fail += (result[i] != SM2_OK);
+  }
+
+  return fail;
+}
+
+int sm2_public_key(uint8_t pk[SM2_PUBLIC_KEY_BYTES], const uint8_t d[32]) {
+
+  const ecp256_curve_t* c = sm2_get_curve();
+  ecp256_t g, p;
+  uint8_t  nm1   [32];
+  uint8_t  k     [1][32];
+  uint8_t  zero  [1][32] = {{0}};
+  uint8_t  xy    [1][64];
+  uint32_t finite;
+
+  // d in [1, n-2], n is odd so n-1 does not borrow
+  memcpy(nm1, c->n.be, 32);
+  nm1[31]--;
+  if (!sc_in_range(c, d) || memcmp(d, nm1, 32) >= 0) {
+    return SM2_ERR_PARAM;
+  }
+  memcpy(k[0], d, 32);
+
+  ecp256_base   (c, &g, 1);
+  ecp256_mul2   (c, &p, &g, k, &g, zero, 1);
+  ecp256_tobytes(c, xy, &finite, &p, 1);
+  memcpy(pk, xy[0], SM2_PUBLIC_KEY_BYTES);
+
+  return SM2_OK;
+}
+
+// x~ = 2^127 + (x mod 2^127) for the x coordinate of an ephemeral key
+static void sm2_xbar(uint8_t xb[32], const uint8_t* x) {
+  memset(xb, 0, 16);
+  memcpy(xb + 16, x + 16, 16);
+  xb[16] |= 0x80;
+}
+
+int sm2_kx(uint8_t* key, size_t key_len, uint8_t confirm[2][SM2_DIGEST_BYTES],
+           const sm2_kx_party_t* self, const sm2_kx_party_t* peer, int initiator) {
+
+  const ecp256_curve_t* c = sm2_get_curve();
+  ecp256_t       pp, rp, u;
+  const uint8_t* s     [1];
+  uint8_t        xb    [32];
+  uint8_t        k1    [1][32];
+  uint8_t        k2    [1][32];
+  uint8_t        uxy   [1][64];
+  uint8_t        z     [2][SM2_DIGEST_BYTES];
+  uint8_t        inner [SM2_DIGEST_BYTES];
+  uint8_t        ctr   [4];
+  uint8_t        md    [SM2_DIGEST_BYTES];
+  uint8_t        tag;
+  uint32_t       valid [2];
+  uint32_t       finite;
+
+  // z[0] = ZA of the initiator, z[1] = ZB of the responder
+  const sm2_kx_party_t* pa = initiator ? self : peer;
+  const sm2_kx_party_t* pb = initiator ? peer : self;
+
+  if (sm2_compute_za(z[0], pa->id, pa->id_len, pa->pk) != SM2_OK ||
+      sm2_compute_za(z[1], pb->id, pb->id_len, pb->pk) != SM2_OK) {
+    return SM2_ERR_PARAM;
+  }
+
+  s[0] = peer->pk;
+  ecp256_frombytes(c, &pp, &valid[0], s, 1);
+  s[0] = peer->r_pub;
+  ecp256_frombytes(c, &rp, &valid[1], s, 1);
+  if (!valid[0] || !valid[1]) {
+    return SM2_ERR_ENCODING;
+  }
+
+  // t = d + x~_self * r mod n, U = [t]P_peer + [t * x~_peer]R_peer
+  sm2_xbar(xb, self->r_pub);
+  sc_mul  (c, k1[0], xb, self->r);
+  sc_add  (c, k1[0], k1[0], self->d);
+  sm2_xbar(xb, peer->r_pub);
+  sc_mul  (c, k2[0], xb, k1[0]);
+
+  ecp256_mul2   (c, &u, &pp, k1, &rp, k2, 1);
+  ecp256_tobytes(c, uxy, &finite, &u, 1);
+  if (!finite) {
+    return SM2_ERR_MISMATCH;
+  }
+
+  // K = SM3(xU || yU || ZA || ZB || ct) for ct = 1, 2, ...
+  for (uint32_t ct = 1, off = 0; off < key_len; ct++, off += SM2_DIGEST_BYTES) {
+    size_t len = key_len - off < SM2_DIGEST_BYTES ? key_len - off : SM2_DIGEST_BYTES;
+
+    ctr[0] = (uint8_t)(ct >> 24);
+    ctr[1] = (uint8_t)(ct >> 16);
+    ctr[2] = (uint8_t)(ct >> 8);
+    ctr[3] = (uint8_t)(ct);
+
+    crypto_iovec_t iov[4] = {
+      { uxy[0], 64               },
+      { z[0],   SM2_DIGEST_BYTES },
+      { z[1],   SM2_DIGEST_BYTES },
+      { ctr,    4                }
+    };
+
+    sm3_256_iov(md, iov, 4);
+    memcpy(key + off, md, len);
+  }
+
+  if (confirm != NULL) {
+    crypto_iovec_t iov[5] = {
+      { uxy[0],             32               },
+      { z[0],               SM2_DIGEST_BYTES },
+      { z[1],               SM2_DIGEST_BYTES },
+      { (void*)(pa->r_pub), 64               },
+      { (void*)(pb->r_pub), 64               }
+    };
+
+    sm3_256_iov(inner, iov, 5);
+
+    for (int i = 0; i < 2; i++) {
+      tag = (uint8_t)(2 + i);
+
+      crypto_iovec_t fin[3] = {
+        { &tag,        1                },
+        { uxy[0] + 32, 32               },
+        { inner,       SM2_DIGEST_BYTES }
+      };
+
+      sm3_256_iov(confirm[i], fin, 3);
+    }
+  }
+
+  return SM2_OK;
+}
@@ -0,0 +1,620 @@
+/*
+ * File      : sm2_vectors.h
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: SM2 test vectors. Keys and signatures were generated with
+ * OpenSSL (openssl genpkey / pkeyutl -digest sm3 -pkeyopt distid:...), the
+ * key exchange values with an independent big integer model of
+ * GB/T 32918.3.
+ */
+
+#ifndef __SM2_VECTORS_H__
+#define __SM2_VECTORS_H__
+
+#include <stdint.h>
+
+#include "crypto/sm2/api_sm2.h"
+
+// default distinguishing identifier
+static const uint8_t sm2_default_id [16] = {
+  '1', '2', '3', '4', '5', '6', '7', '8', '1', '2', '3', '4', '5', '6', '7', '8'
+};
+
+// public keys, signatures, identities and messages
+#define SM2_TEST_ITEMS 16
+
+static const uint8_t sm2_pk0 [64] = {
+  0xb5, 0x9c, 0xf3, 0xd0, 0x90, 0xed, 0x95, 0xc4, 0xb8, 0x49, 0xe9, 0x30,
+  0x2a, 0x8a, 0xa0, 0xa4, 0x5c, 0x52, 0xbb, 0xf1, 0xf1, 0x09, 0x75, 0xcf,
+  0x8d, 0xf8, 0x77, 0xd3, 0xd0, 0x1a, 0x47, 0x22, 0xd3, 0xb9, 0x30, 0xa4,
+  0x7c, 0x42, 0x7c, 0x48, 0x6f, 0x4e, 0xc9, 0xf6, 0xac, 0x11, 0x3a, 0x13,
+  0x17, 0xa1, 0x39, 0x62, 0x38, 0xed, 0xac, 0x09, 0xc7, 0x07, 0x57, 0x93,
+  0x09, 0x0b, 0x34, 0xc7
+};
+
+static const uint8_t sm2_sig0 [64] = {
+  0x88, 0x9f, 0x33, 0xeb, 0xf5, 0xe5, 0x27, 0x78, 0xad, 0xdb, 0xba, 0xec,
+  0xbd, 0xee, 0xc0, 0x82, 0x7f, 0xe3, 0x79, 0x43, 0x36, 0x1d, 0x71, 0xb3,
+  0xf5, 0xc3, 0x23, 0xb3, 0x7b, 0x25, 0xe1, 0xea, 0xc3, 0xa8, 0xfb, 0x4c,
+  0x6b, 0x99, 0x7c, 0xb0, 0xb3, 0x59, 0xe3, 0x02, 0x2a, 0x52, 0xa0, 0x13,
+  0x8d, 0x94, 0x6c, 0x45, 0x29, 0xb1, 0x31, 0x13, 0x00, 0x1f, 0x1a, 0x75,
+  0x12, 0x31, 0x10, 0x33
+};
+
+static const uint8_t sm2_msg0 [1] = {0};
+
+static const uint8_t sm2_pk1 [64] = {
+  0x57, 0x11, 0x04, 0xd7, 0x5b, 0x50, 0x64, 0x17, 0x7e, 0x4e, 0x0c, 0x64,
+  0x66, 0x22, 0xb7, 0x35, 0x9b, 0x01, 0xc5, 0xe0, 0xbf, 0x9c, 0xdb, 0x36,
+  0xb2, 0x38, 0x79, 0xa2, 0x51, 0x70, 0x22, 0x84, 0x3e, 0x95, 0x7c, 0x7f,
+  0x47, 0x84, 0x1f, 0x94, 0x29, 0xf7, 0xd2, 0x54, 0x17, 0xe2, 0x9b, 0xdf,
+  0x96, 0xf8, 0x90, 0xd2, 0x0e, 0xc5, 0x67, 0xd6, 0xfc, 0x0b, 0x56, 0x3c,
+  0xa3, 0x0c, 0xdc, 0x0a
+};
+
+static const uint8_t sm2_sig1 [64] = {
+  0xc4, 0x76, 0xc8, 0x56, 0x59, 0xd4, 0x85, 0x73, 0x43, 0xb3, 0x6a, 0x97,
+  0xce, 0x9c, 0x7c, 0x7a, 0xdb, 0x94, 0x08, 0x73, 0x12, 0xac, 0x56, 0x4d,
+  0x92, 0xbf, 0x80, 0x69, 0xdc, 0x08, 0x14, 0x1c, 0xcc, 0xdb, 0xed, 0xe6,
+  0xba, 0x68, 0xf3, 0xfb, 0xf3, 0x17, 0xaa, 0xd0, 0x7a, 0x99, 0x92, 0xe2,
+  0xd6, 0x87, 0x91, 0x3e, 0xc5, 0x52, 0x5a, 0xe2, 0xdd, 0x97, 0x4d, 0xb9,
+  0xf1, 0x95, 0xe1, 0xd7
+};
+
+static const uint8_t sm2_msg1 [3] = {
+  0x2e, 0x12, 0xbd
+};
+
+static const uint8_t sm2_pk2 [64] = {
+  0xad, 0xcd, 0xdc, 0x21, 0x5d, 0xc3, 0x87, 0x7f, 0x79, 0xa0, 0xc9, 0x97,
+  0x1b, 0x5d, 0xa6, 0xa5, 0xd8, 0x6f, 0x50, 0xb3, 0x7a, 0x3f, 0x1e, 0x06,
+  0x59, 0xf4, 0x84, 0x56, 0x46, 0x19, 0x83, 0x47, 0x7d, 0x8c, 0x3a, 0xbf,
+  0x5a, 0x67, 0xe7, 0x8b, 0x8b, 0xd4, 0x85, 0x85, 0x51, 0x1f, 0xa9, 0xd4,
+  0x47, 0xc6, 0x2b, 0xe7, 0x75, 0xf5, 0xb9, 0xaa, 0xdf, 0x0e, 0xc5, 0x13,
+  0x49, 0x23, 0xfb, 0x76
+};
+
+static const uint8_t sm2_sig2 [64] = {
+  0x97, 0xf6, 0x86, 0x63, 0xc4, 0x15, 0x97, 0x63, 0xda, 0x26, 0x64, 0xc5,
+  0x4c, 0xb2, 0x32, 0x9d, 0x1a, 0xc0, 0xab, 0xb1, 0xe1, 0x80, 0x75, 0xc0,
+  0x95, 0xb6, 0x30, 0x7b, 0xcd, 0x9b, 0xe4, 0x31, 0x7e, 0x1d, 0xda, 0x57,
+  0x95, 0x55, 0x29, 0x0a, 0xb7, 0xeb, 0xf4, 0xde, 0x69, 0x86, 0xf1, 0x43,
+  0x2a, 0x64, 0x07, 0x2a, 0x31, 0x9d, 0x76, 0x12, 0xc4, 0x3a, 0xcf, 0x9c,
+  0x4e, 0x33, 0xc7, 0x6e
+};
+
+static const uint8_t sm2_msg2 [32] = {
+  0xe0, 0x37, 0xe9, 0x90, 0xc1, 0xd8, 0xe3, 0x49, 0x19, 0x2e, 0xd3, 0x26,
+  0x93, 0xb8, 0xdd, 0xbb, 0x11, 0x6d, 0xd5, 0x20, 0x04, 0x03, 0xb8, 0x23,
+  0x73, 0x0c, 0xa5, 0xb4, 0x51, 0x0b, 0x06, 0x6f
+};
+
+static const uint8_t sm2_pk3 [64] = {
+  0x17, 0x2c, 0xd3, 0xaf, 0xe0, 0x7d, 0x02, 0xe5, 0x7d, 0xa6, 0xe2, 0x7e,
+  0x55, 0x4d, 0x78, 0x19, 0x22, 0xba, 0xcb, 0xac, 0xc0, 0xa5, 0x7b, 0xc5,
+  0x8d, 0x2b, 0xec, 0x85, 0x9b, 0xb3, 0x0b, 0x80, 0xfc, 0xe8, 0x76, 0x3e,
+  0x2e, 0xda, 0x36, 0x92, 0x80, 0x56, 0x13, 0xfe, 0xfe, 0x1d, 0xba, 0xc0,
+  0x0c, 0xfc, 0xa8, 0xd2, 0xd3, 0xec, 0x02, 0x76, 0x47, 0x7c, 0xf6, 0xe8,
+  0x58, 0xf9, 0x79, 0x37
+};
+
+static const uint8_t sm2_sig3 [64] = {
+  0xe7, 0x19, 0xa2, 0x1f, 0x06, 0xa2, 0x1e, 0x2c, 0xa0, 0x35, 0x84, 0x96,
+  0x50, 0x3a, 0x2c, 0xba, 0xc1, 0x4e, 0xff, 0x09, 0x55, 0xee, 0x27, 0xc8,
+  0x53, 0xba, 0x3a, 0x0d, 0xa2, 0x6f, 0x62, 0xcc, 0x7a, 0xf8, 0xd1, 0x0f,
+  0x50, 0x7e, 0x4e, 0x85, 0x50, 0xc8, 0x29, 0x03, 0x19, 0x46, 0x78, 0x13,
+  0x4d, 0x69, 0x2a, 0x0e, 0xea, 0xc3, 0xe6, 0x22, 0x45, 0x16, 0x64, 0xc3,
+  0xff, 0xcc, 0xcd, 0x18
+};
+
+static const uint8_t sm2_id3 [17] = "ALICE3@YAHOO.COM";
+
+static const uint8_t sm2_msg3 [64] = {
+  0x9f, 0x74, 0x9a, 0x15, 0x90, 0x8b, 0x68, 0xf6, 0x49, 0x6d, 0x88, 0x18,
+  0xe0, 0xe5, 0x35, 0x01, 0x88, 0x7a, 0x2d, 0xe2, 0x42, 0xae, 0xb3, 0x0f,
+  0x32, 0x4c, 0x20, 0x50, 0x7d, 0x93, 0xf2, 0x0d, 0x5c, 0x96, 0x45, 0x6c,
+  0x39, 0x54, 0xdb, 0x04, 0xb6, 0x8d, 0x22, 0x1b, 0x72, 0x57, 0xcd, 0xe4,
+  0xa1, 0x22, 0x63, 0x2e, 0x9e, 0x17, 0x6f, 0x78, 0xe0, 0xfe, 0xb1, 0x8f,
+  0x14, 0x64, 0x99, 0x02
+};
+
+static const uint8_t sm2_pk4 [64] = {
+  0xf1, 0x4b, 0x34, 0x52, 0x56, 0x22, 0xb8, 0x64, 0x01, 0xbe, 0x89, 0x87,
+  0xbe, 0x05, 0x91, 0x15, 0xf9, 0x7d, 0xd8, 0x00, 0x6e, 0xcb, 0x81, 0x12,
+  0xfd, 0xd7, 0x5d, 0xfd, 0xb2, 0x9d, 0xf3, 0xe9, 0xc1, 0xca, 0x92, 0x57,
+  0x8b, 0xf6, 0xca, 0xee, 0x27, 0xbb, 0x2d, 0x23, 0x2a, 0x7d, 0x52, 0xf4,
+  0xaf, 0x93, 0x9c, 0x0c, 0x57, 0x46, 0x84, 0x43, 0x14, 0x8f, 0x37, 0x57,
+  0xc6, 0x29, 0xc0, 0xeb
+};
+
+static const uint8_t sm2_sig4 [64] = {
+  0x3f, 0xb3, 0x4a, 0x2e, 0x6d, 0x6e, 0xe0, 0x1b, 0x38, 0x17, 0x33, 0x83,
+  0x18, 0xdf, 0x6a, 0x11, 0x85, 0x0b, 0xcd, 0x0f, 0x2e, 0x8f, 0x8c, 0x70,
+  0xbe, 0xf2, 0x00, 0x4c, 0xe7, 0x9a, 0xdc, 0xa5, 0x13, 0x22, 0x1b, 0x4e,
+  0x7a, 0x95, 0xf1, 0x22, 0xac, 0x7f, 0xbe, 0x92, 0x8d, 0x66, 0xc6, 0x5c,
+  0x7e, 0xf6, 0xae, 0xf5, 0x9a, 0x61, 0xc3, 0x14, 0xc7, 0xa0, 0x6f, 0xfc,
+  0x9d, 0xae, 0xba, 0xd3
+};
+
+static const uint8_t sm2_msg4 [111] = {
+  0x88, 0x0e, 0x85, 0xe3, 0x70, 0xaa, 0xb6, 0x68, 0xb9, 0x3a, 0xbe, 0xf9,
+  0x23, 0xe4, 0x55, 0x2c, 0x91, 0xa3, 0x12, 0xfb, 0x49, 0x16, 0xa0, 0xe9,
+  0x2c, 0xfa, 0x59, 0x4a, 0xbd, 0x65, 0x54, 0x51, 0x77, 0xa3, 0x27, 0x56,
+  0x36, 0x8c, 0xf4, 0x70, 0x32, 0x09, 0x39, 0xb8, 0x01, 0x50, 0xa9, 0xf4,
+  0x26, 0x23, 0x97, 0x74, 0xc9, 0x7f, 0x1d, 0xd5, 0xfe, 0x89, 0x54, 0x0f,
+  0xeb, 0x68, 0x20, 0x4e, 0x7f, 0xfd, 0xe8, 0xe6, 0xbd, 0x7d, 0x53, 0x39,
+  0x4f, 0x04, 0x83, 0xf5, 0xab, 0x51, 0x4d, 0x45, 0xf1, 0x13, 0x28, 0x0e,
+  0x47, 0x17, 0x7f, 0x81, 0x81, 0x7c, 0x75, 0xfa, 0x91, 0xb7, 0xcb, 0xfa,
+  0xfb, 0xcc, 0x20, 0x72, 0xa6, 0xfe, 0xb7, 0x3b, 0xd9, 0x23, 0x56, 0xfe,
+  0xdd, 0xcf, 0xb9
+};
+
+static const uint8_t sm2_pk5 [64] = {
+  0x67, 0x55, 0x79, 0x42, 0x2c, 0x0a, 0xbc, 0x2c, 0xd2, 0xef, 0xa9, 0x90,
+  0xbf, 0x89, 0x1b, 0xda, 0x27, 0x52, 0x5a, 0xd4, 0x9a, 0xbb, 0x9c, 0x54,
+  0xb3, 0xc4, 0x9c, 0xf8, 0xe1, 0xa5, 0x27, 0x2a, 0x47, 0x85, 0x89, 0xea,
+  0x11, 0xbd, 0x59, 0x35, 0xf9, 0x9d, 0x73, 0xb1, 0x41, 0x80, 0x20, 0x1f,
+  0x92, 0xeb, 0x5d, 0x12, 0x95, 0x0f, 0xce, 0x18, 0x99, 0xb8, 0xa3, 0xa0,
+  0xbe, 0xa7, 0xb0, 0x24
+};
+
+static const uint8_t sm2_sig5 [64] = {
+  0x90, 0xdf, 0x7d, 0x71, 0x08, 0x13, 0x19, 0x78, 0x25, 0x2a, 0xca, 0xcb,
+  0x0b, 0x3e, 0xab, 0x03, 0xc3, 0xf2, 0x86, 0x5e, 0x5d, 0x5a, 0x3d, 0xa6,
+  0xe7, 0x12, 0x12, 0x29, 0x7b, 0x81, 0xc3, 0xf5, 0x28, 0x82, 0x23, 0x77,
+  0x67, 0xfe, 0x0e, 0x97, 0x43, 0x93, 0xdb, 0x7c, 0x6d, 0x9b, 0x81, 0xf8,
+  0xbb, 0x3c, 0xb2, 0x50, 0x33, 0x94, 0x64, 0xdb, 0x18, 0xb8, 0x1b, 0xac,
+  0xf6, 0xe0, 0x7b, 0x4a
+};
+
+static const uint8_t sm2_msg5 [112] = {
+  0x94, 0x49, 0xeb, 0x7f, 0x73, 0xde, 0xe3, 0x48, 0x95, 0x30, 0xc0, 0x1f,
+  0x74, 0x3a, 0x2d, 0x9d, 0x1a, 0x14, 0x8c, 0x79, 0x14, 0xff, 0x83, 0xc0,
+  0xb1, 0x1f, 0x4e, 0x2a, 0xcf, 0x52, 0xa1, 0xed, 0x66, 0xb0, 0xe9, 0xb4,
+  0x81, 0x66, 0xf4, 0xd7, 0xb7, 0xb6, 0x21, 0x48, 0xc8, 0xf8, 0x3b, 0x56,
+  0x03, 0x5b, 0x58, 0x06, 0x76, 0x68, 0xf3, 0x26, 0x92, 0x4e, 0xea, 0xfd,
+  0x58, 0x00, 0x56, 0xee, 0xa6, 0xe6, 0x9a, 0x50, 0x3c, 0x41, 0xc6, 0xfe,
+  0x4f, 0xc1, 0xc1, 0x5e, 0x3a, 0x7a, 0x7a, 0x1a, 0x22, 0x9b, 0xab, 0x3d,
+  0x71, 0x35, 0x93, 0x70, 0xa2, 0xac, 0xfc, 0xa1, 0x50, 0x55, 0xef, 0x2c,
+  0x24, 0x7d, 0x1b, 0x27, 0xdb, 0x92, 0x8a, 0x17, 0xbc, 0x93, 0xed, 0x84,
+  0xd0, 0xae, 0xb3, 0xe4
+};
+
+static const uint8_t sm2_pk6 [64] = {
+  0x4e, 0xa5, 0x86, 0xb9, 0x44, 0x36, 0x10, 0xfc, 0xcd, 0x84, 0xbb, 0x03,
+  0x93, 0x49, 0xbe, 0xdf, 0x2e, 0x02, 0x07, 0x60, 0x54, 0x7b, 0x23, 0x97,
+  0x47, 0x2c, 0x1d, 0x8f, 0xc1, 0x12, 0x67, 0xf2, 0x3d, 0x9e, 0x54, 0x85,
+  0x97, 0xb0, 0x52, 0x14, 0xfa, 0x7c, 0xab, 0x50, 0xab, 0xb3, 0xb6, 0x94,
+  0xf5, 0x03, 0xd1, 0xbf, 0xeb, 0x18, 0xdd, 0xa8, 0x0b, 0x01, 0xb0, 0x25,
+  0x67, 0x90, 0x12, 0x87
+};
+
+static const uint8_t sm2_sig6 [64] = {
+  0x00, 0x0b, 0xe3, 0xd8, 0xcc, 0x44, 0xd2, 0xf2, 0x50, 0x5a, 0x98, 0xde,
+  0xca, 0xea, 0xd2, 0xe1, 0xc0, 0x3d, 0x3d, 0x3a, 0x53, 0x72, 0xf4, 0xd9,
+  0x7f, 0x84, 0x92, 0x19, 0x22, 0x73, 0x23, 0x0a, 0x64, 0x09, 0xae, 0xab,
+  0x08, 0x01, 0xe9, 0xda, 0x17, 0x0c, 0x2b, 0x0e, 0x1c, 0x12, 0x92, 0x69,
+  0x5a, 0xdb, 0x9f, 0x20, 0xd1, 0x5f, 0x16, 0x82, 0x0f, 0xad, 0x13, 0xa3,
+  0x1e, 0xdd, 0xb6, 0x57
+};
+
+static const uint8_t sm2_msg6 [127] = {
+  0xf2, 0x84, 0x89, 0xd6, 0x3b, 0xe6, 0x54, 0x78, 0xef, 0xe7, 0xa2, 0xe8,
+  0x97, 0x5d, 0xf3, 0x3d, 0x06, 0x9d, 0x0c, 0xa3, 0xa7, 0xc4, 0xbe, 0xdd,
+  0x05, 0x55, 0xc1, 0x91, 0x1e, 0xe5, 0xd5, 0x72, 0xc4, 0xb7, 0x2b, 0xcf,
+  0x1a, 0x23, 0x4a, 0xd6, 0x95, 0x60, 0x91, 0x96, 0xae, 0xa7, 0xd4, 0xe8,
+  0x16, 0x41, 0x3a, 0xec, 0x7b, 0xe8, 0x6c, 0x55, 0x43, 0x7e, 0xc5, 0xca,
+  0xad, 0x6c, 0xd8, 0xaa, 0x50, 0xf9, 0xd1, 0xa3, 0x7c, 0x56, 0xb5, 0x69,
+  0xbe, 0x43, 0x86, 0x6c, 0xbb, 0xc8, 0x82, 0xa8, 0x96, 0x3d, 0xe3, 0xdb,
+  0x66, 0xeb, 0xa5, 0x18, 0xa1, 0xd8, 0x6f, 0x95, 0x28, 0x90, 0x4a, 0xbe,
+  0x19, 0x31, 0xfe, 0x64, 0xa7, 0x5b, 0xc7, 0x66, 0x25, 0x38, 0x8e, 0xbc,
+  0x82, 0xff, 0x46, 0x02, 0x03, 0xab, 0xfb, 0x2f, 0xc5, 0xc6, 0xb6, 0x86,
+  0x97, 0x2a, 0xbd, 0x14, 0xb6, 0x14, 0x66
+};
+
+static const uint8_t sm2_pk7 [64] = {
+  0x09, 0x51, 0xc4, 0xb5, 0x8e, 0xae, 0x50, 0x1c, 0xca, 0xe3, 0xd2, 0x43,
+  0x95, 0xd9, 0xe7, 0xc5, 0x8f, 0x45, 0x28, 0xbc, 0x94, 0x68, 0xe6, 0xa2,
+  0x84, 0x00, 0x68, 0x06, 0x02, 0xc6, 0x35, 0x72, 0x0e, 0xe0, 0xe9, 0xfa,
+  0xc0, 0xd0, 0x92, 0xd9, 0xb8, 0xed, 0x89, 0x91, 0x89, 0x56, 0x23, 0x51,
+  0xc1, 0x58, 0x41, 0xb3, 0xf0, 0xd2, 0x0d, 0xe8, 0x27, 0x2a, 0x43, 0x47,
+  0xe4, 0x89, 0x6c, 0xc9
+};
+
+static const uint8_t sm2_sig7 [64] = {
+  0xcc, 0x8b, 0xc7, 0xc2, 0xa0, 0x82, 0x24, 0x8d, 0xc9, 0xad, 0xe3, 0x37,
+  0x3a, 0x5a, 0x76, 0xed, 0x87, 0xbe, 0x71, 0xb2, 0xd4, 0x06, 0x97, 0xb4,
+  0x6c, 0xb1, 0xf3, 0xf2, 0x7c, 0xc7, 0xa8, 0xcc, 0x7c, 0xa5, 0x6d, 0x8a,
+  0x15, 0x84, 0x34, 0x11, 0xc5, 0x80, 0x0e, 0xc4, 0x97, 0x22, 0x39, 0xe6,
+  0x8e, 0x70, 0x36, 0x3f, 0x61, 0x5d, 0x6c, 0xd2, 0x5e, 0x91, 0xc9, 0x62,
+  0x8d, 0x9e, 0xb3, 0xb5
+};
+
+static const uint8_t sm2_id7 [17] = "ALICE7@YAHOO.COM";
+
+static const uint8_t sm2_msg7 [128] = {
+  0xc1, 0xa3, 0x41, 0xf0, 0xf3, 0xc0, 0xce, 0xd5, 0xa8, 0xd9, 0xad, 0xc0,
+  0xde, 0xba, 0x36, 0x0a, 0xb6, 0xac, 0xb3, 0x27, 0x11, 0x36, 0x71, 0xb1,
+  0x9e, 0xe6, 0x1c, 0x29, 0x7d, 0x21, 0x6d, 0x3f, 0xb5, 0xd2, 0x3a, 0x56,
+  0xde, 0xdb, 0xf1, 0x66, 0xb1, 0x8e, 0x8a, 0xd6, 0x30, 0xe2, 0x56, 0x8d,
+  0x3c, 0x99, 0x70, 0xe7, 0x4d, 0x7c, 0x31, 0x01, 0xa6, 0xd2, 0x2c, 0x5f,
+  0x6a, 0x5f, 0xd5, 0xe3, 0x42, 0xfa, 0x26, 0x68, 0xe9, 0x6b, 0x0f, 0x69,
+  0x70, 0xb4, 0x4d, 0xdb, 0xf4, 0xd4, 0x80, 0xf1, 0x39, 0xd3, 0xb2, 0x59,
+  0x63, 0x36, 0xb3, 0xf0, 0x70, 0x33, 0xfb, 0xfe, 0xd7, 0x99, 0x53, 0x4e,
+  0xc3, 0x0e, 0x36, 0xbb, 0xaa, 0xd1, 0x15, 0x5d, 0x7d, 0x60, 0x47, 0x30,
+  0x95, 0x58, 0xa9, 0x3e, 0x2e, 0xbe, 0x02, 0x18, 0x7d, 0x6d, 0xdd, 0x7e,
+  0x23, 0x39, 0xe9, 0x65, 0x8e, 0xec, 0xfc, 0x84
+};
+
+static const uint8_t sm2_pk8 [64] = {
+  0xd8, 0x3a, 0x74, 0x96, 0x1c, 0x39, 0xad, 0x68, 0xc9, 0x96, 0x64, 0x44,
+  0xf7, 0xa0, 0xa8, 0x3e, 0xad, 0x27, 0x54, 0x85, 0x2c, 0x6a, 0x84, 0xf9,
+  0x93, 0x04, 0xb2, 0x86, 0xbf, 0x1c, 0xf0, 0x85, 0xf3, 0xd8, 0xa1, 0x3e,
+  0x98, 0xec, 0x7d, 0x4d, 0x93, 0x48, 0x5d, 0x3f, 0x1b, 0xd7, 0x52, 0x71,
+  0xbc, 0xbc, 0xca, 0x3d, 0x2c, 0xff, 0x1c, 0xc3, 0x3e, 0x57, 0x1c, 0xab,
+  0xb8, 0x8c, 0x62, 0x52
+};
+
+static const uint8_t sm2_sig8 [64] = {
+  0x2c, 0xa3, 0x2f, 0xb3, 0x93, 0xf5, 0xef, 0xee, 0x56, 0x65, 0x7c, 0xd6,
+  0xbe, 0xf1, 0xab, 0xc8, 0x78, 0x7b, 0x69, 0xe5, 0x7c, 0xb9, 0xf3, 0x59,
+  0x96, 0xda, 0x6a, 0xb4, 0x51, 0x13, 0x19, 0xbe, 0x0a, 0xc2, 0x68, 0x94,
+  0x0b, 0xce, 0xfe, 0x94, 0xed, 0x33, 0xf7, 0x35, 0xf1, 0xeb, 0xf0, 0xed,
+  0x84, 0x69, 0x6c, 0xbc, 0x17, 0x22, 0x90, 0xc0, 0x63, 0xcd, 0x56, 0xa1,
+  0x2a, 0x38, 0x99, 0x32
+};
+
+static const uint8_t sm2_msg8 [200] = {
+  0xdb, 0x14, 0xaf, 0xad, 0xcf, 0x3a, 0x6c, 0xcd, 0x5f, 0xd7, 0xd0, 0x98,
+  0x87, 0xf2, 0x97, 0x92, 0x0a, 0x9e, 0xa0, 0xd2, 0xa7, 0xf1, 0x59, 0x9d,
+  0x2c, 0xa9, 0x7e, 0xcc, 0x19, 0xf7, 0x05, 0x69, 0x00, 0x12, 0xac, 0x84,
+  0xd4, 0x35, 0xe4, 0xd9, 0xa0, 0x07, 0x95, 0x30, 0xd4, 0x1a, 0x53, 0x99,
+  0x40, 0xd3, 0xce, 0xab, 0xfc, 0xa1, 0xf4, 0x33, 0xb7, 0xce, 0x20, 0x9e,
+  0xb0, 0x07, 0x9a, 0x14, 0x64, 0xdc, 0xf9, 0x56, 0xeb, 0x56, 0xdf, 0x1e,
+  0x2e, 0xc9, 0x7f, 0x96, 0x58, 0x9d, 0x9e, 0xa6, 0x83, 0x98, 0xbf, 0x92,
+  0xe0, 0xe1, 0x35, 0x4c, 0x73, 0x3c, 0x38, 0x49, 0xae, 0x55, 0x89, 0x26,
+  0x99, 0xab, 0xa3, 0x8b, 0x81, 0xea, 0xdc, 0x2a, 0xea, 0xf1, 0x93, 0x93,
+  0x82, 0xa0, 0x6a, 0x90, 0x2f, 0x2c, 0x6a, 0x1c, 0xf5, 0xc4, 0x8e, 0x86,
+  0x8d, 0xb2, 0x08, 0xe9, 0x35, 0x56, 0x9e, 0x53, 0xd6, 0x06, 0xa7, 0x68,
+  0x34, 0x9c, 0xfb, 0x4d, 0x75, 0x56, 0x52, 0xbf, 0xec, 0x20, 0x59, 0xdd,
+  0x8e, 0x65, 0xc9, 0xb1, 0x86, 0x2b, 0x44, 0x67, 0x63, 0x4b, 0x10, 0x6f,
+  0xad, 0x3b, 0x05, 0x65, 0x13, 0x21, 0x62, 0x79, 0x50, 0x02, 0xc5, 0xe4,
+  0x0d, 0x16, 0x4f, 0xcb, 0x02, 0x52, 0xb1, 0x41, 0x8a, 0x36, 0xb9, 0x38,
+  0x28, 0x74, 0x96, 0x09, 0xce, 0x0a, 0xde, 0x5c, 0xba, 0x68, 0xce, 0xfb,
+  0xa5, 0x37, 0x1a, 0x6b, 0xb1, 0xd4, 0x8a, 0x31
+};
+
+static const uint8_t sm2_pk9 [64] = {
+  0x62, 0x7e, 0x7d, 0x41, 0xab, 0xac, 0xfc, 0x12, 0x64, 0x75, 0x42, 0xd6,
+  0x79, 0x3c, 0x13, 0xf8, 0x89, 0x46, 0x5a, 0xba, 0x99, 0xb5, 0x81, 0x68,
+  0xf3, 0xea, 0x99, 0x60, 0xbd, 0x87, 0x16, 0xc7, 0xe7, 0x3e, 0x7e, 0x7f,
+  0x73, 0x55, 0xe8, 0x65, 0xd5, 0x3b, 0x49, 0xdd, 0xab, 0x1e, 0x60, 0xbe,
+  0x9d, 0x07, 0x91, 0xea, 0xa4, 0x66, 0xd1, 0x75, 0x04, 0xb0, 0x85, 0x72,
+  0x91, 0x8a, 0x58, 0xe5
+};
+
+static const uint8_t sm2_sig9 [64] = {
+  0x9f, 0x48, 0xd8, 0x93, 0x33, 0xc6, 0x43, 0x05, 0x33, 0x42, 0x9d, 0xc6,
+  0x09, 0xb5, 0x10, 0xd4, 0x85, 0x0c, 0x56, 0xb2, 0x91, 0x6f, 0x1c, 0x01,
+  0x4f, 0x60, 0x7e, 0xfe, 0xc4, 0x3b, 0x3f, 0x7e, 0x1d, 0xe1, 0xb2, 0xbd,
+  0xec, 0x86, 0x04, 0x81, 0xad, 0xd6, 0x5b, 0x0e, 0xcc, 0x2b, 0xe2, 0xf8,
+  0xab, 0x9e, 0xaf, 0xfb, 0x85, 0xc0, 0xde, 0x14, 0x11, 0xc8, 0x58, 0xb3,
+  0xc3, 0x7b, 0x6e, 0x5f
+};
+
+static const uint8_t sm2_msg9 [256] = {
+  0x84, 0x99, 0x64, 0x6d, 0x1b, 0x55, 0xac, 0x96, 0x25, 0x52, 0xc9, 0xf1,
+  0x51, 0xbf, 0x6d, 0x21, 0xf3, 0xbb, 0xab, 0x85, 0x53, 0x40, 0x8b, 0x68,
+  0x6c, 0x98, 0xf6, 0x53, 0x3c, 0x6d, 0xcf, 0x47, 0xa4, 0x0f, 0x34, 0xa4,
+  0xe0, 0x23, 0x6f, 0xf3, 0x5e, 0x4e, 0x7c, 0x77, 0xe0, 0x0e, 0xfa, 0xa9,
+  0x6c, 0xba, 0x5f, 0xdf, 0x17, 0x5d, 0xec, 0xcf, 0xc0, 0xc6, 0x80, 0x98,
+  0xaf, 0x8f, 0x93, 0x31, 0xff, 0x8d, 0x43, 0x74, 0x07, 0x96, 0x96, 0x54,
+  0x39, 0x72, 0x0c, 0x03, 0x8a, 0x7b, 0xc6, 0x3b, 0x00, 0x82, 0xef, 0xb5,
+  0x85, 0x9b, 0x25, 0xdd, 0x42, 0xd9, 0xc0, 0xae, 0xd2, 0xeb, 0x07, 0x8e,
+  0xda, 0xe4, 0x8d, 0xe7, 0x96, 0x99, 0xb0, 0xf3, 0x19, 0x9f, 0x6a, 0x45,
+  0x88, 0x5c, 0x91, 0x4f, 0x7a, 0x0d, 0xd9, 0x08, 0x1c, 0x6f, 0x5b, 0x34,
+  0x8c, 0x40, 0x30, 0x6a, 0x87, 0xc0, 0x2d, 0x4f, 0x5c, 0xc1, 0xd4, 0x30,
+  0x2f, 0xfa, 0x3a, 0x33, 0x2f, 0x34, 0xd5, 0xa3, 0x5e, 0xa5, 0xb9, 0x21,
+  0x31, 0x04, 0xd2, 0x7b, 0xed, 0x7e, 0x68, 0xb4, 0x01, 0x24, 0xd2, 0x67,
+  0xac, 0x85, 0xed, 0xcb, 0x1e, 0xb1, 0xd6, 0x0a, 0x81, 0x4d, 0xa1, 0x84,
+  0xd7, 0x91, 0x4f, 0x51, 0xd7, 0xf7, 0x22, 0xda, 0x40, 0x50, 0xe6, 0xed,
+  0x51, 0x02, 0xdf, 0x86, 0x20, 0x03, 0x13, 0xb4, 0x48, 0x51, 0x26, 0x20,
+  0x2b, 0xbe, 0xcf, 0xcb, 0x3c, 0x15, 0x95, 0x0f, 0xa7, 0xcc, 0x09, 0x8c,
+  0x26, 0x42, 0xe9, 0x73, 0x75, 0x4e, 0x03, 0x2b, 0xb6, 0xd8, 0x45, 0x8c,
+  0xad, 0xa0, 0x74, 0xe9, 0x4a, 0x56, 0xe5, 0xd8, 0xda, 0x47, 0xd6, 0x79,
+  0x80, 0xea, 0x89, 0xce, 0x0c, 0x3e, 0x16, 0x99, 0xb8, 0x5c, 0x56, 0xfc,
+  0x32, 0x77, 0xa9, 0x6f, 0x2e, 0xc9, 0x99, 0xb2, 0x92, 0x41, 0xc7, 0x7d,
+  0xc1, 0x5f, 0xfd, 0x8b
+};
+
+static const uint8_t sm2_pk10 [64] = {
+  0x25, 0xf2, 0x91, 0xdf, 0x02, 0x92, 0x97, 0xdc, 0x23, 0x73, 0x6b, 0x5f,
+  0x04, 0xe5, 0x30, 0x18, 0x08, 0x42, 0x3c, 0xe5, 0xc4, 0xc5, 0xc3, 0xb9,
+  0x29, 0x47, 0x17, 0x3e, 0xb7, 0xde, 0x07, 0xf9, 0xae, 0x0f, 0xb8, 0x82,
+  0xc8, 0x03, 0x96, 0x73, 0xb7, 0x16, 0x5b, 0x32, 0xa0, 0xfa, 0x78, 0x3a,
+  0x6d, 0x64, 0x95, 0x9a, 0x83, 0xef, 0x41, 0xb6, 0xbd, 0x96, 0x13, 0x92,
+  0xbb, 0xe0, 0x4b, 0x9b
+};
+
+static const uint8_t sm2_sig10 [64] = {
+  0xd3, 0x7f, 0x81, 0x67, 0x5d, 0x39, 0xcc, 0x06, 0xcb, 0x71, 0xa4, 0x27,
+  0xaf, 0x9e, 0xbc, 0x7c, 0x85, 0x40, 0x43, 0x34, 0x31, 0xfe, 0x3b, 0xd0,
+  0xac, 0x6e, 0x52, 0x65, 0xc9, 0x94, 0x56, 0xa9, 0xae, 0xd2, 0x37, 0xde,
+  0x52, 0x19, 0x4e, 0x65, 0xc7, 0x4c, 0x8f, 0x1b, 0xb2, 0x52, 0x8f, 0xae,
+  0xff, 0x95, 0x88, 0x89, 0xea, 0x98, 0x83, 0xe0, 0xa0, 0x6e, 0x71, 0x24,
+  0x63, 0x32, 0x25, 0xf7
+};
+
+static const uint8_t sm2_msg10 [1] = {
+  0x66
+};
+
+static const uint8_t sm2_pk11 [64] = {
+  0xd4, 0x4a, 0x69, 0xc5, 0x3a, 0x95, 0x3b, 0xf1, 0x45, 0xf4, 0x89, 0xcd,
+  0x76, 0xf1, 0xd9, 0xd4, 0xcc, 0x9a, 0xc7, 0x34, 0x0e, 0xa4, 0xca, 0xfd,
+  0xa8, 0x6f, 0x0a, 0x52, 0xbf, 0xd5, 0x44, 0x11, 0x88, 0xc8, 0x29, 0x53,
+  0xc2, 0x15, 0xe6, 0x5e, 0x03, 0x3f, 0xe1, 0xb6, 0x5d, 0xbf, 0xaa, 0x70,
+  0x5f, 0x60, 0x86, 0x5b, 0x8d, 0xef, 0x05, 0x40, 0x34, 0x62, 0xb0, 0xdc,
+  0x8d, 0x22, 0xf7, 0x9f
+};
+
+static const uint8_t sm2_sig11 [64] = {
+  0x5e, 0x29, 0x40, 0x66, 0x56, 0x08, 0x72, 0x67, 0xd0, 0x9c, 0xfa, 0x5e,
+  0x2b, 0x4c, 0x31, 0x8c, 0x8f, 0x3a, 0xa7, 0xb1, 0xbc, 0xe2, 0x64, 0xd9,
+  0xda, 0x4e, 0x17, 0x77, 0xa1, 0x83, 0xb3, 0xf5, 0x14, 0x49, 0xb1, 0x10,
+  0x8d, 0x46, 0x41, 0x14, 0x93, 0xd8, 0x9b, 0xfa, 0xa4, 0x0e, 0xa4, 0x5f,
+  0x11, 0x73, 0xe9, 0xfe, 0x9a, 0x55, 0x2f, 0xf4, 0x9c, 0xe2, 0x99, 0xac,
+  0x01, 0xee, 0x12, 0x19
+};
+
+static const uint8_t sm2_id11 [18] = "ALICE11@YAHOO.COM";
+
+static const uint8_t sm2_msg11 [17] = {
+  0x03, 0xe9, 0xba, 0x9e, 0x5d, 0x9f, 0x75, 0x10, 0xe5, 0xbb, 0xe1, 0x18,
+  0x88, 0x4a, 0x64, 0x91, 0xd3
+};
+
+static const uint8_t sm2_pk12 [64] = {
+  0xe1, 0x14, 0x0d, 0x21, 0xdf, 0x5b, 0x98, 0x7d, 0xf5, 0x31, 0xb4, 0xe4,
+  0x1d, 0xc6, 0x8e, 0x0b, 0x9f, 0x16, 0x22, 0x37, 0x6d, 0xb2, 0x13, 0x73,
+  0x4b, 0xdc, 0xd8, 0x95, 0xfd, 0x7f, 0x39, 0xa0, 0x94, 0x95, 0x25, 0x1d,
+  0xd8, 0x64, 0xb3, 0x62, 0xd6, 0xdb, 0xd5, 0x5a, 0x51, 0xf1, 0x7f, 0x92,
+  0xc0, 0xb4, 0x4c, 0x35, 0x6d, 0xc5, 0xfc, 0x1c, 0xc9, 0x58, 0x00, 0x27,
+  0xfa, 0xbd, 0xae, 0x68
+};
+
+static const uint8_t sm2_sig12 [64] = {
+  0x9b, 0x8e, 0x7e, 0x98, 0xd2, 0x00, 0x6b, 0x18, 0x16, 0x72, 0x68, 0xe9,
+  0x87, 0x8b, 0x5b, 0x19, 0x7b, 0x3a, 0xa8, 0xad, 0xa7, 0xf3, 0x6b, 0xdc,
+  0xd8, 0x12, 0x62, 0x5b, 0xa1, 0x18, 0x98, 0x1f, 0xd3, 0x3f, 0x33, 0x10,
+  0x46, 0xbf, 0x6d, 0x28, 0x5a, 0xb7, 0x8a, 0x61, 0xae, 0xfb, 0x2f, 0xb0,
+  0xb2, 0x8a, 0x25, 0x75, 0xf2, 0xf2, 0x02, 0x3a, 0x5c, 0x19, 0x01, 0x16,
+  0x60, 0xce, 0xfe, 0x4b
+};
+
+static const uint8_t sm2_msg12 [95] = {
+  0xb6, 0xc0, 0x90, 0xc2, 0xa7, 0xd4, 0x9a, 0x12, 0xb2, 0xa0, 0x43, 0x67,
+  0x10, 0xd1, 0x57, 0x26, 0xfa, 0x96, 0x50, 0x1a, 0x6c, 0x62, 0x3b, 0x81,
+  0x43, 0xb8, 0x66, 0x9c, 0x0d, 0xbb, 0x67, 0x8e, 0xcc, 0xde, 0x8b, 0xff,
+  0xa2, 0x64, 0xc5, 0x52, 0x8b, 0x08, 0x22, 0x1b, 0x41, 0x2f, 0x50, 0x63,
+  0x22, 0x96, 0x6f, 0x8f, 0x7e, 0x47, 0x13, 0x6e, 0x0e, 0x92, 0xd3, 0xc7,
+  0x16, 0xdb, 0x22, 0x21, 0xd8, 0x28, 0xa3, 0x5c, 0x3c, 0x6b, 0x03, 0x46,
+  0x43, 0x6d, 0x6e, 0x62, 0x00, 0xd7, 0x1b, 0x2b, 0x34, 0x83, 0x5c, 0xa6,
+  0xbe, 0x4d, 0x28, 0xc3, 0x82, 0x9c, 0x38, 0x13, 0x0b, 0x01, 0x4a
+};
+
+static const uint8_t sm2_pk13 [64] = {
+  0x8d, 0x68, 0xf3, 0xfa, 0xe6, 0xfd, 0xf9, 0x3a, 0xc1, 0xd8, 0x76, 0x18,
+  0xfe, 0xcd, 0x9a, 0x05, 0x2a, 0xa4, 0x23, 0x28, 0x5b, 0x27, 0xd7, 0xaa,
+  0xe5, 0x07, 0xa2, 0x76, 0x93, 0x89, 0x76, 0xbf, 0x34, 0x66, 0x84, 0xc3,
+  0x60, 0x3e, 0xfd, 0x3c, 0x2a, 0x32, 0xfe, 0xa5, 0x44, 0xbb, 0xdb, 0x89,
+  0x40, 0x75, 0xea, 0xbe, 0x98, 0xe8, 0x05, 0x8f, 0x88, 0x52, 0xbc, 0x56,
+  0x29, 0x4f, 0x96, 0x0e
+};
+
+static const uint8_t sm2_sig13 [64] = {
+  0x12, 0xb4, 0xe5, 0x56, 0xd9, 0x5d, 0x7f, 0x6b, 0x6e, 0xf0, 0x2d, 0x2c,
+  0x60, 0x28, 0x79, 0x93, 0xdf, 0xea, 0x72, 0x1a, 0xac, 0xa8, 0x5e, 0x11,
+  0x43, 0x74, 0x8d, 0x80, 0xbf, 0xf3, 0xe6, 0x81, 0x87, 0x52, 0x8c, 0x69,
+  0xfa, 0x00, 0xbd, 0x89, 0x65, 0x05, 0xe7, 0x05, 0x77, 0x1c, 0x34, 0x22,
+  0x1e, 0x86, 0xdf, 0xd5, 0xf5, 0x96, 0x52, 0x7f, 0x49, 0xcb, 0x02, 0xaa,
+  0x70, 0x89, 0xa7, 0x52
+};
+
+static const uint8_t sm2_msg13 [140] = {
+  0x6c, 0x08, 0xf6, 0x90, 0xb2, 0xa3, 0xb8, 0x9e, 0x82, 0x60, 0xf3, 0x4b,
+  0xdf, 0x45, 0x17, 0xd5, 0xf1, 0x72, 0x46, 0xf5, 0x5c, 0x57, 0x02, 0x46,
+  0x18, 0xd3, 0x94, 0x8f, 0x5e, 0x0b, 0xc6, 0xe3, 0x56, 0xdf, 0x34, 0xe8,
+  0x62, 0x6f, 0x7b, 0x9a, 0x49, 0xfa, 0xed, 0x88, 0x3f, 0xcd, 0x45, 0x62,
+  0x67, 0x57, 0x1f, 0xe6, 0x3a, 0x85, 0x2a, 0xf4, 0x15, 0x3d, 0x72, 0x9d,
+  0x47, 0x47, 0x4e, 0x13, 0x23, 0x64, 0x49, 0x64, 0x18, 0x40, 0x2f, 0x41,
+  0x45, 0x87, 0x63, 0xe2, 0x21, 0xa9, 0x23, 0x8f, 0xdd, 0x48, 0xb1, 0x70,
+  0x54, 0xc0, 0x04, 0x39, 0x2c, 0x88, 0x57, 0x96, 0x57, 0x05, 0x71, 0x1c,
+  0x18, 0x3f, 0x22, 0xa4, 0x33, 0xc4, 0x12, 0xef, 0x4d, 0x40, 0x5f, 0x56,
+  0x1b, 0xa9, 0x5b, 0x79, 0x40, 0x7c, 0x28, 0x15, 0x30, 0xff, 0xc5, 0xa5,
+  0xfc, 0x7c, 0x98, 0xfb, 0xee, 0xda, 0xf7, 0x92, 0xf6, 0x95, 0x44, 0x5b,
+  0x35, 0xbc, 0xfe, 0xd7, 0x51, 0x10, 0xfb, 0xde
+};
+
+static const uint8_t sm2_pk14 [64] = {
+  0xa1, 0xd1, 0xe9, 0xdd, 0x1e, 0xc0, 0xc9, 0xc4, 0xe3, 0xc7, 0x01, 0xf2,
+  0x05, 0x46, 0x66, 0x9f, 0x70, 0xbc, 0xd3, 0xe0, 0x3f, 0x25, 0xdb, 0xf3,
+  0xa8, 0x43, 0x63, 0xde, 0xa7, 0x08, 0xb1, 0x96, 0xe7, 0xf7, 0x12, 0x10,
+  0xa4, 0xb3, 0xe5, 0x43, 0x2d, 0x9c, 0x41, 0x97, 0x2e, 0x48, 0xb8, 0x22,
+  0x5a, 0x53, 0xad, 0x53, 0x32, 0xe8, 0x49, 0xc9, 0x14, 0x3b, 0x31, 0x89,
+  0x04, 0xcf, 0x13, 0x3b
+};
+
+static const uint8_t sm2_sig14 [64] = {
+  0x33, 0x19, 0xfc, 0xec, 0x50, 0x1f, 0xa3, 0xce, 0x98, 0x22, 0xb6, 0xcc,
+  0x59, 0x9a, 0x80, 0x97, 0x8b, 0x2d, 0x8f, 0xfb, 0xd8, 0xe5, 0x41, 0x68,
+  0x8d, 0x5d, 0xc1, 0xc0, 0x95, 0xcf, 0x94, 0x11, 0x9a, 0xa5, 0x99, 0x3c,
+  0x3c, 0x04, 0xdc, 0x19, 0xde, 0x7d, 0x5f, 0x4a, 0x7b, 0x81, 0x22, 0xe2,
+  0x7a, 0x6a, 0x2c, 0x67, 0x3f, 0x6f, 0xd8, 0x20, 0xe0, 0x98, 0xe9, 0xb4,
+  0x8a, 0xdc, 0x75, 0x9d
+};
+
+static const uint8_t sm2_msg14 [63] = {
+  0x12, 0x05, 0xea, 0xf0, 0x90, 0x78, 0x58, 0xb5, 0x67, 0x37, 0x4f, 0xe8,
+  0xfb, 0x2d, 0xc2, 0xe9, 0x1a, 0x96, 0x3f, 0x43, 0x15, 0x9b, 0x00, 0x53,
+  0xe1, 0x6c, 0xbe, 0x5c, 0xb9, 0xa5, 0x65, 0x97, 0x36, 0xc7, 0x7f, 0x88,
+  0x8b, 0x4c, 0x64, 0xdf, 0x57, 0x34, 0x60, 0x99, 0xc4, 0x7e, 0xc0, 0x72,
+  0x27, 0x24, 0xd7, 0x48, 0xd0, 0xe6, 0x43, 0xb2, 0x85, 0xc3, 0xb2, 0x1c,
+  0xb4, 0x88, 0x3e
+};
+
+static const uint8_t sm2_pk15 [64] = {
+  0x93, 0x75, 0x59, 0x1b, 0xe0, 0x26, 0x0f, 0x74, 0x8a, 0x2f, 0x67, 0x55,
+  0x17, 0xb2, 0xa1, 0x6a, 0x83, 0x19, 0xbb, 0x90, 0x8b, 0xaf, 0x1d, 0xe4,
+  0xc7, 0xcb, 0x98, 0x90, 0xdf, 0xc5, 0x32, 0x44, 0xb6, 0xa2, 0xc9, 0x68,
+  0xc5, 0xc1, 0xa3, 0xef, 0x3d, 0xf9, 0x03, 0x12, 0x69, 0xef, 0xc9, 0x5f,
+  0x4a, 0x2d, 0x25, 0xb3, 0xa9, 0x96, 0xef, 0xa3, 0x2a, 0xad, 0x7c, 0x88,
+  0xc9, 0x8a, 0x3c, 0xf3
+};
+
+static const uint8_t sm2_sig15 [64] = {
+  0x87, 0x41, 0x8d, 0x43, 0xee, 0x8e, 0xe3, 0xa7, 0xb6, 0x25, 0xb1, 0x47,
+  0x8b, 0x10, 0x1f, 0xb6, 0xa3, 0xc2, 0x68, 0x65, 0xe4, 0x20, 0x23, 0x30,
+  0x7d, 0xbc, 0xa6, 0xa5, 0xb2, 0xa9, 0x90, 0x62, 0x79, 0xaf, 0x67, 0x94,
+  0x3f, 0x09, 0xa2, 0xe3, 0x46, 0x48, 0x2d, 0x56, 0xa0, 0xe7, 0x66, 0x99,
+  0x10, 0xc6, 0x88, 0x5d, 0x74, 0xc3, 0x8a, 0x9d, 0xcf, 0xb0, 0x76, 0x78,
+  0x85, 0xfa, 0x04, 0xc0
+};
+
+static const uint8_t sm2_id15 [18] = "ALICE15@YAHOO.COM";
+
+static const uint8_t sm2_msg15 [300] = {
+  0x79, 0x74, 0x15, 0x94, 0xdd, 0xda, 0xc7, 0x13, 0xf8, 0x83, 0xb7, 0xf7,
+  0x1e, 0x98, 0x5d, 0x8d, 0x4c, 0x94, 0x63, 0x7f, 0x47, 0x77, 0x21, 0xba,
+  0x26, 0xb9, 0x66, 0x44, 0x17, 0xa9, 0xcc, 0x33, 0xe1, 0x78, 0x0f, 0x3b,
+  0x9b, 0x63, 0xb3, 0x54, 0x2b, 0xb3, 0x76, 0x2b, 0x4d, 0xb7, 0x3f, 0x13,
+  0xcf, 0xf6, 0x03, 0x4e, 0x8c, 0x2e, 0x18, 0x3a, 0x80, 0x2f, 0x87, 0x35,
+  0x3f, 0x96, 0x0a, 0xd0, 0x9f, 0x52, 0xf6, 0x39, 0xc0, 0x0b, 0xbc, 0xdc,
+  0x07, 0xd6, 0xd4, 0xcb, 0x3b, 0x21, 0x31, 0x65, 0x7f, 0xe9, 0x84, 0xf3,
+  0x20, 0xe2, 0x7a, 0xb8, 0xc2, 0x13, 0x73, 0xf2, 0xa0, 0x75, 0x48, 0x65,
+  0xde, 0x89, 0x8e, 0xde, 0x08, 0xb6, 0x25, 0xbf, 0x65, 0x5a, 0xf2, 0x80,
+  0x92, 0x72, 0x51, 0xc4, 0x2f, 0x3c, 0x90, 0x43, 0x38, 0x16, 0xc0, 0x8d,
+  0x74, 0xec, 0xa4, 0xce, 0x22, 0x39, 0x34, 0xef, 0x0a, 0x4c, 0x14, 0xcb,
+  0xfe, 0xab, 0x4f, 0xaf, 0xe3, 0x1a, 0x33, 0x8c, 0x11, 0x60, 0xc8, 0x6f,
+  0x85, 0xa2, 0xf0, 0xa7, 0x92, 0x2c, 0xae, 0x49, 0x8a, 0xbf, 0x82, 0x82,
+  0x92, 0xa6, 0xa1, 0x2a, 0x09, 0x7c, 0x86, 0xcc, 0xd6, 0x94, 0x6e, 0x19,
+  0x2e, 0x6f, 0x27, 0xea, 0xf8, 0xb5, 0xc8, 0x99, 0x97, 0x1a, 0x97, 0xc1,
+  0xcf, 0xf6, 0xb2, 0x07, 0x51, 0x82, 0xeb, 0xde, 0x4b, 0xa2, 0x3e, 0x7e,
+  0x0e, 0x44, 0xa4, 0xc5, 0x3e, 0x99, 0xc9, 0x63, 0xb0, 0x02, 0x67, 0x0a,
+  0xbc, 0x86, 0x19, 0x15, 0x06, 0x6e, 0xeb, 0xe0, 0x66, 0x12, 0xd0, 0xa0,
+  0x2d, 0x8e, 0x85, 0x83, 0xb5, 0x33, 0x5c, 0x7f, 0xe8, 0x44, 0xae, 0x0f,
+  0x8e, 0x26, 0x77, 0xd1, 0x37, 0x61, 0x2c, 0xed, 0xa3, 0xea, 0x43, 0x25,
+  0xb7, 0x26, 0x2a, 0x3e, 0x2e, 0xcb, 0x7a, 0x8f, 0xba, 0x50, 0xd2, 0xaf,
+  0x70, 0x8b, 0x46, 0x22, 0xe6, 0xe4, 0xf7, 0x70, 0x4c, 0xb3, 0xcc, 0xeb,
+  0x75, 0x36, 0x7c, 0x8b, 0x4f, 0x27, 0xff, 0x97, 0xa1, 0x89, 0x96, 0xce,
+  0x3e, 0x9c, 0xa4, 0x7d, 0x88, 0x29, 0xc8, 0x12, 0x5c, 0x75, 0x48, 0xb4,
+  0xd1, 0xdb, 0xc0, 0x54, 0x46, 0x4b, 0x05, 0xa3, 0x45, 0xa5, 0x5e, 0x93
+};
+
+static const sm2_item_t sm2_items [SM2_TEST_ITEMS] = {
+  { sm2_pk0, sm2_sig0, sm2_default_id, 16, sm2_msg0, 0 },
+  { sm2_pk1, sm2_sig1, sm2_default_id, 16, sm2_msg1, 3 },
+  { sm2_pk2, sm2_sig2, sm2_default_id, 16, sm2_msg2, 32 },
+  { sm2_pk3, sm2_sig3, sm2_id3, 16, sm2_msg3, 64 },
+  { sm2_pk4, sm2_sig4, sm2_default_id, 16, sm2_msg4, 111 },
+  { sm2_pk5, sm2_sig5, sm2_default_id, 16, sm2_msg5, 112 },
+  { sm2_pk6, sm2_sig6, sm2_default_id, 16, sm2_msg6, 127 },
+  { sm2_pk7, sm2_sig7, sm2_id7, 16, sm2_msg7, 128 },
+  { sm2_pk8, sm2_sig8, sm2_default_id, 16, sm2_msg8, 200 },
+  { sm2_pk9, sm2_sig9, sm2_default_id, 16, sm2_msg9, 256 },
+  { sm2_pk10, sm2_sig10, sm2_default_id, 16, sm2_msg10, 1 },
+  { sm2_pk11, sm2_sig11, sm2_id11, 17, sm2_msg11, 17 },
+  { sm2_pk12, sm2_sig12, sm2_default_id, 16, sm2_msg12, 95 },
+  { sm2_pk13, sm2_sig13, sm2_default_id, 16, sm2_msg13, 140 },
+  { sm2_pk14, sm2_sig14, sm2_default_id, 16, sm2_msg14, 63 },
+  { sm2_pk15, sm2_sig15, sm2_id15, 17, sm2_msg15, 300 },
+};
+
+// key exchange between A (initiator) and B: static and ephemeral key pairs
+static const uint8_t sm2_kx_a_d [32] = {
+  0x9c, 0x3e, 0x66, 0xb3, 0x95, 0x74, 0x4f, 0x64, 0xb1, 0xe2, 0x10, 0x65,
+  0x57, 0xa3, 0x13, 0xeb, 0x3e, 0x12, 0xb0, 0xc9, 0xae, 0xea, 0xdd, 0x6b,
+  0x89, 0xbe, 0x9c, 0xa6, 0x05, 0xa4, 0xaa, 0xb5
+};
+
+static const uint8_t sm2_kx_a_pk [64] = {
+  0xf9, 0xc4, 0xc1, 0x6c, 0x48, 0xe9, 0xda, 0x6f, 0x00, 0x77, 0x17, 0x5f,
+  0x93, 0xa7, 0xa3, 0xc1, 0x92, 0x9a, 0x9c, 0xcd, 0xda, 0x4a, 0x0d, 0x4a,
+  0x1e, 0x0d, 0x7c, 0x29, 0xe7, 0x4d, 0xe3, 0xfa, 0x97, 0xe4, 0xc7, 0xf3,
+  0x10, 0x3e, 0x4a, 0x2b, 0xfe, 0xc4, 0x8d, 0x4f, 0xf1, 0x2e, 0xbd, 0x5f,
+  0xc0, 0x80, 0x14, 0x97, 0x89, 0x81, 0x1f, 0x80, 0xe4, 0x51, 0xc6, 0xe6,
+  0x1a, 0xd6, 0x75, 0x58
+};
+
+static const uint8_t sm2_kx_a_r [32] = {
+  0x39, 0x29, 0xf1, 0xf9, 0xec, 0x96, 0x40, 0x4a, 0x13, 0x3f, 0xb6, 0x11,
+  0xfa, 0x28, 0xa8, 0xee, 0xa1, 0x9e, 0xd6, 0x35, 0xc8, 0xf8, 0xac, 0xf4,
+  0xad, 0x36, 0x31, 0x07, 0x42, 0xb4, 0x71, 0x68
+};
+
+static const uint8_t sm2_kx_a_r_pub [64] = {
+  0x97, 0x40, 0xbd, 0x88, 0x7f, 0xd0, 0xf3, 0x56, 0x7e, 0xcb, 0x92, 0xbf,
+  0xec, 0xf3, 0xd6, 0x55, 0xaf, 0xbe, 0xad, 0xa5, 0x50, 0x8d, 0x3b, 0xf7,
+  0x20, 0x7c, 0xd9, 0xf3, 0x18, 0x2b, 0x9d, 0x04, 0x19, 0xe8, 0x60, 0xd0,
+  0xff, 0x6f, 0xee, 0xc6, 0xe1, 0x65, 0x07, 0x17, 0x54, 0xaa, 0xcb, 0x06,
+  0xc6, 0x9a, 0xca, 0x07, 0x57, 0x84, 0xe0, 0xd4, 0x71, 0x72, 0x37, 0x87,
+  0xe5, 0xa6, 0xa5, 0xdd
+};
+
+static const uint8_t sm2_kx_a_id [19] = "ALICE123@YAHOO.COM";
+
+static const uint8_t sm2_kx_b_d [32] = {
+  0xac, 0xb0, 0x76, 0x79, 0x5f, 0x01, 0xac, 0x0c, 0x79, 0x9d, 0x3f, 0xfc,
+  0x1d, 0xa9, 0x3a, 0x22, 0x5c, 0x5a, 0xef, 0xdb, 0x78, 0xe4, 0xa4, 0x5a,
+  0x09, 0xf3, 0x68, 0x93, 0x82, 0xb3, 0x05, 0xa9
+};
+
+static const uint8_t sm2_kx_b_pk [64] = {
+  0x6f, 0x61, 0x32, 0xe3, 0xeb, 0xde, 0x69, 0x11, 0x9f, 0xaf, 0x49, 0x97,
+  0xc4, 0x01, 0xf5, 0xb6, 0x9a, 0x87, 0x90, 0x21, 0xca, 0xfc, 0x69, 0x9b,
+  0x63, 0xc8, 0xb1, 0x2a, 0x01, 0xd5, 0x61, 0x70, 0xf9, 0xa1, 0xfd, 0x24,
+  0x05, 0xac, 0xbc, 0x95, 0x9c, 0x83, 0xc9, 0x38, 0x2b, 0x65, 0xb3, 0x4e,
+  0xd4, 0x4a, 0xb5, 0xbb, 0xd5, 0x5e, 0xc4, 0xef, 0x2a, 0x3e, 0xf5, 0xda,
+  0xea, 0x1b, 0xbe, 0x4f
+};
+
+static const uint8_t sm2_kx_b_r [32] = {
+  0xb9, 0xfb, 0x40, 0x63, 0x45, 0x77, 0x8a, 0x56, 0xe2, 0xb3, 0x5f, 0xae,
+  0xe3, 0x9c, 0x6a, 0xa9, 0xa9, 0x91, 0xe4, 0xde, 0x1d, 0x60, 0xdc, 0xd9,
+  0x91, 0xfc, 0xfb, 0x6d, 0xdd, 0x03, 0xac, 0x9e
+};
+
+static const uint8_t sm2_kx_b_r_pub [64] = {
+  0x8b, 0xdf, 0x0d, 0x5f, 0x19, 0x18, 0xa4, 0x6e, 0x70, 0x5d, 0x58, 0x32,
+  0x76, 0xbb, 0x16, 0x5f, 0x8f, 0x4c, 0x13, 0xc7, 0x92, 0xe8, 0x91, 0xb4,
+  0x22, 0x4d, 0x43, 0xb1, 0x9d, 0x83, 0xa0, 0x43, 0x94, 0xfa, 0xf5, 0x3c,
+  0x23, 0x87, 0x5b, 0x7f, 0xbd, 0xba, 0xcc, 0xc2, 0x84, 0xab, 0x9b, 0x1e,
+  0x5e, 0x14, 0x61, 0x6f, 0x8a, 0x5a, 0x07, 0x2b, 0xcb, 0x01, 0x45, 0xc8,
+  0xca, 0x2d, 0xf7, 0xb3
+};
+
+static const uint8_t sm2_kx_b_id [18] = "BILL456@YAHOO.COM";
+
+#define SM2_KX_KEY_BYTES 48
+
+// shared key and the confirmation values S_B (0x02) and S_A (0x03)
+static const uint8_t sm2_kx_key [48] = {
+  0xe2, 0xa3, 0x33, 0xd7, 0xaa, 0x5d, 0x17, 0x7f, 0xb5, 0x34, 0xcc, 0x60,
+  0xeb, 0x70, 0xf8, 0x20, 0x77, 0x94, 0x3e, 0x5d, 0xd1, 0xd4, 0xa5, 0x79,
+  0xdd, 0xd8, 0x6f, 0x99, 0x81, 0xa6, 0xf1, 0x5b, 0xc4, 0xb9, 0x1d, 0xaa,
+  0x09, 0x8a, 0xd5, 0x2e, 0xa5, 0x0b, 0x9d, 0x30, 0xb4, 0x53, 0xb6, 0x5f
+};
+
+static const uint8_t sm2_kx_sb [32] = {
+  0x26, 0xca, 0x57, 0x73, 0xb1, 0x33, 0xf1, 0xea, 0x7b, 0x0c, 0xb0, 0xf7,
+  0x06, 0x63, 0xad, 0x29, 0x38, 0x93, 0x79, 0x2d, 0xe4, 0xd1, 0xcc, 0xe6,
+  0x04, 0xf7, 0xfd, 0x78, 0xb5, 0xa9, 0xbc, 0x19
+};
+
+static const uint8_t sm2_kx_sa [32] = {
+  0xb0, 0x2b, 0x26, 0x69, 0xaf, 0x09, 0xc0, 0x9b, 0xbf, 0x57, 0xbb, 0x04,
+  0x54, 0x4d, 0x20, 0xfe, 0x11, 0xa0, 0x27, 0x49, 0x13, 0xe9, 0xef, 0x49,
+  0x6b, 0x4c, 0x10, 0x88, 0x6f, 0x6e, 0xce, 0xb8
+};
+
+#endif // __SM2_VECTORS_H__
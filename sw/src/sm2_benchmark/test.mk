@@ -0,0 +1,4 @@
+# sources reused from other tests, relative to src/
+TEST_EXT_SRC := \
+  sm3_benchmark/sm3_api.c \
+  sm3_benchmark/zvksh.s
@@ -0,0 +1,202 @@
+/*
+ * File      : test_sm2.c
+ * Test      : sm2_benchmark
+ * Date      : 19-oct-2026
+ * Description: Basic benchmarking of SM2 signature verification, single
+ * against batches with one signature per vector lane, and of the SM2 key
+ * exchange.
+ */
+
+#include <stddef.h>
+#include <string.h>
+
+#include "printf.h"
+
+#include "crypto/share/benchmarks.h"
+
+#include "crypto/sm2/api_sm2.h"
+#include "crypto/ecc/fp256.h"
+
+#include "sm2_vectors.h"
+
+typedef struct {
+  perf_log_t sm2_single;
+  perf_log_t sm2_batch;
+  perf_log_t sm2_kx;
+} sm2_perf_log_t;
+
+static sm2_perf_log_t perf_log = {0};
+
+static sm2_item_t bad_items   [SM2_TEST_ITEMS];
+static uint8_t    bad_sigs    [2][SM2_SIGNATURE_BYTES];
+static int        sm2_results [SM2_TEST_ITEMS];
+
+static const uint8_t zero_sig [SM2_SIGNATURE_BYTES] = {0};
+
+static uint32_t test_sm2_verify(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# SM2 single verify test %d/%d:\n", i+1, num_tests);
+
+    const sm2_item_t* item = &sm2_items[i % SM2_TEST_ITEMS];
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = sm2_verify(item->sig, item->msg, item->msg_len, item->id, item->id_len, item->pk);
+    volatile uint64_t sm_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t sm_ccount = test_rdcycle() - start_cycles;
+    perf_log.sm2_single.icount[i] = sm_icount;
+    perf_log.sm2_single.ccount[i] = sm_ccount;
+
+    printf("#\tresult  = %d\n", ret);
+    printf("#\tinstret = %020lu\n", sm_icount);
+    printf("#\tcycles  = %020lu\n", sm_ccount);
+
+    fail += (ret != SM2_OK);
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# SM2 batch (%d) verify test %d/%d:\n", SM2_TEST_ITEMS, i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    size_t bad = sm2_verify_batch(sm2_items, sm2_results, SM2_TEST_ITEMS);
+    volatile uint64_t sm_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t sm_ccount = test_rdcycle() - start_cycles;
+    perf_log.sm2_batch.icount[i] = sm_icount;
+    perf_log.sm2_batch.ccount[i] = sm_ccount;
+
+    printf("#\tfailed  = %lu\n", bad);
+    printf("#\tinstret = %020lu\n", sm_icount);
+    printf("#\tcycles  = %020lu\n", sm_ccount);
+    printf("#\tcycles/op = %lu\n", sm_ccount / SM2_TEST_ITEMS);
+
+    fail += (bad != 0);
+  }
+
+  // a corrupted r (item 1), s (item 2) and identity (item 3) must be
+  // pinpointed within the batch, r = 0 (item 4) is rejected as encoding
+  memcpy(bad_items, sm2_items, sizeof(bad_items));
+  memcpy(bad_sigs[0], sm2_items[1].sig, SM2_SIGNATURE_BYTES);
+  memcpy(bad_sigs[1], sm2_items[2].sig, SM2_SIGNATURE_BYTES);
+  bad_sigs[0][5]  ^= 0x01;
+  bad_sigs[1][40] ^= 0x01;
+  bad_items[1].sig = bad_sigs[0];
+  bad_items[2].sig = bad_sigs[1];
+  bad_items[3].id_len--;
+  bad_items[4].sig = zero_sig;
+
+  sm2_verify_batch(bad_items, sm2_results, SM2_TEST_ITEMS);
+
+  for (int i = 0; i < SM2_TEST_ITEMS; i++) {
+    int expected = (i >= 1 && i <= 3) ? SM2_ERR_MISMATCH :
+                   (i == 4)           ? SM2_ERR_ENCODING : SM2_OK;
+    if (sm2_results[i] != expected) {
+      printf("# SM2: unexpected result %d for corrupted batch item %d!\n",
+             sm2_results[i], i);
+      fail++;
+    }
+  }
+
+  perf_log.sm2_single.ccount_average = average_count(perf_log.sm2_single.ccount);
+  perf_log.sm2_single.icount_average = average_count(perf_log.sm2_single.icount);
+  perf_log.sm2_batch.ccount_average  = average_count(perf_log.sm2_batch.ccount);
+  perf_log.sm2_batch.icount_average  = average_count(perf_log.sm2_batch.icount);
+
+  return fail;
+}
+
+static uint32_t test_sm2_kx(int num_tests) {
+
+  volatile uint64_t start_instrs;
+  volatile uint64_t start_cycles;
+  uint32_t fail = 0;
+  uint8_t  pk  [SM2_PUBLIC_KEY_BYTES];
+  uint8_t  key [2][SM2_KX_KEY_BYTES];
+  uint8_t  confirm [2][2][SM2_DIGEST_BYTES];
+
+  const sm2_kx_party_t a = {
+    sm2_kx_a_d, sm2_kx_a_pk, sm2_kx_a_r, sm2_kx_a_r_pub, sm2_kx_a_id, sizeof(sm2_kx_a_id) - 1
+  };
+  const sm2_kx_party_t b = {
+    sm2_kx_b_d, sm2_kx_b_pk, sm2_kx_b_r, sm2_kx_b_r_pub, sm2_kx_b_id, sizeof(sm2_kx_b_id) - 1
+  };
+
+  // known answer for the key generation
+  fail += (sm2_public_key(pk, sm2_kx_a_d) != SM2_OK) ||
+          memcmp(pk, sm2_kx_a_pk, SM2_PUBLIC_KEY_BYTES);
+  if (fail) {
+    printf("# SM2: public key known answer test failed!\n");
+  }
+
+  for(int i = 0; i < num_tests; i++) {
+
+    printf("#\n# SM2 key exchange test %d/%d:\n", i+1, num_tests);
+
+    start_instrs = test_rdinstret();
+    start_cycles = test_rdcycle();
+    int ret = sm2_kx(key[0], SM2_KX_KEY_BYTES, confirm[0], &a, &b, 1);
+    volatile uint64_t sm_icount = test_rdinstret() - start_instrs;
+    volatile uint64_t sm_ccount = test_rdcycle() - start_cycles;
+    perf_log.sm2_kx.icount[i] = sm_icount;
+    perf_log.sm2_kx.ccount[i] = sm_ccount;
+
+    printf("#\tresult  = %d\n", ret);
+    printf("#\tinstret = %020lu\n", sm_icount);
+    printf("#\tcycles  = %020lu\n", sm_ccount);
+
+    fail += (ret != SM2_OK);
+  }
+
+  // the responder side must agree on the key and both confirmations
+  fail += sm2_kx(key[1], SM2_KX_KEY_BYTES, confirm[1], &b, &a, 0) != SM2_OK;
+  fail += memcmp(key[0], sm2_kx_key, SM2_KX_KEY_BYTES) != 0;
+  fail += memcmp(key[1], sm2_kx_key, SM2_KX_KEY_BYTES) != 0;
+  fail += memcmp(confirm[0][0], sm2_kx_sb, SM2_DIGEST_BYTES) != 0;
+  fail += memcmp(confirm[0][1], sm2_kx_sa, SM2_DIGEST_BYTES) != 0;
+  fail += memcmp(confirm[1], confirm[0], sizeof(confirm[0])) != 0;
+
+  perf_log.sm2_kx.ccount_average = average_count(perf_log.sm2_kx.ccount);
+  perf_log.sm2_kx.icount_average = average_count(perf_log.sm2_kx.icount);
+
+  return fail;
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+
+  printf("\nBenchmark for SM2 (%lu lanes per batch)\n", fp256_lanes());
+
+  fail += test_sm2_verify(TEST_COUNT);
+  fail += test_sm2_kx(TEST_COUNT);
+
+  printf("\n\n# Result Averages:\n");
+
+  printf("#\tSM2 verify:\n");
+  printf("#\tsm2_single.icount = %05lu\n", perf_log.sm2_single.icount_average);
+  printf("#\tsm2_single.ccount = %05lu\n", perf_log.sm2_single.ccount_average);
+  printf("#\tsm2_batch.icount  = %05lu\n", perf_log.sm2_batch.icount_average);
+  printf("#\tsm2_batch.ccount  = %05lu\n", perf_log.sm2_batch.ccount_average);
+
+  printf("#\tSM2 key exchange:\n");
+  printf("#\tsm2_kx.icount     = %05lu\n", perf_log.sm2_kx.icount_average);
+  printf("#\tsm2_kx.ccount     = %05lu\n", perf_log.sm2_kx.ccount_average);
+
+  bench_record_log("sm2 verify single", 0, 1, &perf_log.sm2_single);
+  bench_record_log("sm2 verify batch",  0, 1, &perf_log.sm2_batch);
+  bench_record_log("sm2 key exchange",  0, 1, &perf_log.sm2_kx);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
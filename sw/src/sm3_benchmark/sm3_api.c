@@ -8,17 +8,35 @@
  */
 #include <string.h>
 #include "crypto/sm3/sm3_api.h"
+#include "crypto/share/mdpad.h"
 
 //	pointer to the compression function
 void (*sm3_compress)(uint32_t *sp, const uint32_t *mp, size_t n)
 	= &sm3_cf256_zvksh_lmul1;		//	vector version, lmul1
 
+//	Compress "n" bytes with the selected function. The Zvksh kernels load
+//	the message bytewise (input of any alignment); the scalar one reads it
+//	as words, so misaligned blocks are staged through an aligned buffer
+static void sm3_compress_any(uint32_t *sp, const uint8_t *p, size_t n)
+{
+	uint32_t m[16];
+
+	if (sm3_compress != &sm3_cf256_zksh || ((uintptr_t) p & 3) == 0) {
+		sm3_compress(sp, (const uint32_t *) p, n);
+		return;
+	}
+	for (; n >= 64; n -= 64, p += 64) {
+		memcpy(m, p, 64);
+		sm3_compress(sp, m, 64);
+	}
+}
+
 //	Compute 32-byte message digest to "md" from "in" which has "inlen" bytes
 void sm3_256(uint8_t *md, const void *in, size_t inlen)
 {
 	size_t i;
 	uint64_t x;
-	uint32_t s[8], m[16];
+	uint32_t s[8], m[32];
 
 	uint8_t *bp = (uint8_t *) m;
 	const uint8_t *p = in;
@@ -38,28 +56,57 @@ void sm3_256(uint8_t *md, const void *in, size_t inlen)
 	
 	while (inlen >= 64) {					//	full blocks
 		i = inlen & ~63;
-		//	(assigns aligned input)
-		sm3_compress(s, (uint32_t *) p, i);
+		sm3_compress_any(s, p, i);
 		inlen -= i;
 		p += i;
 	}
-	memcpy(bp, p, inlen);					//	last data block
-	bp[inlen++] = 0x80;
-	if (inlen > 56) {
-		memset(bp + inlen, 0x00, 64 - inlen);
-		sm3_compress(s, m, 64);
-		inlen = 0;
-	}
-	i = 64;									//	process length
-	while (x > 0) {
-		bp[--i] = x & 0xFF;
-		x >>= 8;
-	}
-	memset(&bp[inlen], 0x00, i - inlen);
-	sm3_compress(s, m, 64);
+	//	last data block, padded in vector registers
+	i = crypto_md_pad(bp, p, inlen, 64, x);
+	sm3_compress(s, m, i);
 
 	//	store output
 	memcpy(md, s, 32);
 }
 
+//	crypto_iov_hash_fn over the selected compression function
+static void sm3_compress_iov(void *sp, const void *mp, uint64_t n)
+{
+	sm3_compress_any((uint32_t *) sp, (const uint8_t *) mp, n);
+}
+
+//	As sm3_256() for a message scattered over "cnt" segments; whole blocks
+//	inside a segment are compressed in place
+void sm3_256_iov(uint8_t *md, const crypto_iovec_t *iov, size_t cnt)
+{
+	size_t i, inlen, full;
+	uint64_t x;
+	uint32_t s[8], m[32];
+	crypto_iov_cursor_t c;
+
+	uint8_t *bp = (uint8_t *) m;
+
+	//	initial values (represented as little endian)
+	s[0] = 0x6f168073;
+	s[1] = 0xb9b21449;
+	s[2] = 0xd7422417;
+	s[3] = 0x00068ada;
+	s[4] = 0xbc306fa9;
+	s[5] = 0xaa383116;
+	s[6] = 0x4dee8de3;
+	s[7] = 0x4e0efbb0;
+
+	inlen = crypto_iov_len(iov, cnt);
+	x = inlen << 3;							//	length in bits
+	full = inlen & ~(size_t)63;
+
+	crypto_iov_init(&c, iov, cnt);
+	crypto_iov_hash(s, &c, full, 64, sm3_compress_iov);
+	inlen -= full;
 
+	crypto_iov_gather(bp, &c, inlen);		//	last data block
+	i = crypto_md_pad(bp, bp, inlen, 64, x);
+	sm3_compress(s, m, i);
+
+	//	store output
+	memcpy(md, s, 32);
+}
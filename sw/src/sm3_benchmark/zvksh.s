@@ -102,10 +102,14 @@ sm3_cf256_zvksh_lmul1:
     vmv.v.v v8, v4
 
     # Load the 64B message block in 2x32B chunks.
-    vle32.v v12, (a1)  # v12 <- {w7,w6,w5,w4,w3,w2,w1,w0}
+    # Byte loads, the block needs no particular alignment.
+    li t0, 32
+    vsetvli x0, t0, e8, m1, ta, ma
+    vle8.v  v12, (a1)  # v12 <- {w7,w6,w5,w4,w3,w2,w1,w0}
     add a1, a1, 32
-    vle32.v v16, (a1)  # v16 <- {w15,w14,w13,w12,w11,w10,w9,w8}
+    vle8.v  v16, (a1)  # v16 <- {w15,w14,w13,w12,w11,w10,w9,w8}
     add a1, a1, 32
+    vsetivli x0, 8, e32, m1, ta, ma
     # As vsm3c consumes only elements at indices {0,2,4,5} in vs2, we need to
     # slide down he input by 2 elements down to use {w7,w6,w3,w2}.
     #   v20 <- {_, _, w7, w6, w5, w4, w3, w2}   (where _ may be random values)
@@ -293,10 +297,14 @@ sm3_cf256_zvksh_lmul2:
     add a2, a2, -64
     vmv.v.v v8, v4
 
-    vle32.v v12, (a1)
+    # Byte loads, the block needs no particular alignment.
+    li t0, 32
+    vsetvli x0, t0, e8, m2, ta, ma
+    vle8.v  v12, (a1)
     add a1, a1, 32
-    vle32.v v16, (a1)
+    vle8.v  v16, (a1)
     add a1, a1, 32
+    vsetivli x0, 8, e32, m2, ta, ma
     vslidedown.vi v20, v12, 2
 
     vsm3c.vi v4, v12, 0
@@ -449,10 +457,14 @@ sm3_cf256_zvksh_lmul4:
     add a2, a2, -64
     vmv.v.v v8, v4
 
-    vle32.v v12, (a1)
+    # Byte loads, the block needs no particular alignment.
+    li t0, 32
+    vsetvli x0, t0, e8, m4, ta, ma
+    vle8.v  v12, (a1)
     add a1, a1, 32
-    vle32.v v16, (a1)
+    vle8.v  v16, (a1)
     add a1, a1, 32
+    vsetivli x0, 8, e32, m4, ta, ma
     vslidedown.vi v20, v12, 2
 
     vsm3c.vi v4, v12, 0
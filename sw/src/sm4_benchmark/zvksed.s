@@ -65,24 +65,29 @@ zvksed_sm4_encode_vv:
 
     # Generate round keys.
     vle32.v v11, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v12, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v13, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v14, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v15, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v16, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v17, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v18, (a3)
 
 1:
     # Load a 16B block of data to process.
-    vle32.v v1, (a1)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetivli x0, 4, e32, m1, ta, ma
+    # vsm4r does not reshuffle its operands, move the byte-loaded block
+    # to the EEW=32 layout with an in-lane op first.
+    vmv.v.v v1, v1
 
     vsm4r.vv v1, v11    # with round key rk[0:3]
     vsm4r.vv v1, v12    # with round key rk[4:7]
@@ -95,10 +100,12 @@ zvksed_sm4_encode_vv:
 
     
     # Save the ciphertext.
-    vse32.v v10, (a0)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     add a2, a2, -16
     add a1, a1, 16
+    add a0, a0, 16
     bnez a2, 1b
 
     ret
@@ -140,40 +147,47 @@ zvksed_sm4_decode_vv:
 
     # Generate round keys.
     vle32.v v11, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v12, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v13, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v14, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v15, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v16, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v17, (a3)
-    add a3, a3, 128
+    add a3, a3, 16
     vle32.v v18, (a3)
 
 1:
     # Load encoded text from 'src', 4B * 4 at a time
-    vle32.v v1, (a1)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetivli x0, 4, e32, m1, ta, ma
+    # vsm4r does not reshuffle its operands, move the byte-loaded block
+    # to the EEW=32 layout with an in-lane op first.
+    vmv.v.v v1, v1
 
     vsm4r.vv v1, v11    # with round key rk[31:28]
-    vsm4r.vv v1, v10    # with round key rk[27:24]
-    vsm4r.vv v1, v9     # with round key rk[23:20]
-    vsm4r.vv v1, v8     # with round key rk[19:16]
-    vsm4r.vv v1, v7     # with round key rk[15:11]
-    vsm4r.vv v1, v6     # with round key rk[11:8]
-    vsm4r.vv v1, v5     # with round key rk[7:4]
-    vsm4r.vv v1, v4     # with round key rk[3:0]
+    vsm4r.vv v1, v12    # with round key rk[27:24]
+    vsm4r.vv v1, v13    # with round key rk[23:20]
+    vsm4r.vv v1, v14    # with round key rk[19:16]
+    vsm4r.vv v1, v15    # with round key rk[15:11]
+    vsm4r.vv v1, v16    # with round key rk[11:8]
+    vsm4r.vv v1, v17    # with round key rk[7:4]
+    vsm4r.vv v1, v18    # with round key rk[3:0]
 
 
     # Save the plaintext.
-    vse32.v v10, (a0)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     add a2, a2, -16
     add a1, a1, 16
+    add a0, a0, 16
     bnez a2, 1b
     ret
 
@@ -234,7 +248,12 @@ zvksed_sm4_encode_vv_full:
 
 1:
     # Load a 16B block of data to process.
-    vle32.v v1, (a1)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vle8.v v1, (a1)
+    vsetivli x0, 4, e32, m1, ta, ma
+    # vsm4r does not reshuffle its operands, move the byte-loaded block
+    # to the EEW=32 layout with an in-lane op first.
+    vmv.v.v v1, v1
 
     vsm4r.vv v1, v11    # with round key rk[0:3]
     vsm4r.vv v1, v12    # with round key rk[4:7]
@@ -248,10 +267,12 @@ zvksed_sm4_encode_vv_full:
     #FIXME removed reversal of indeces because of bugs in the operations used.
 
     # Save the ciphertext.
-    vse32.v v10, (a0)
+    vsetivli x0, 16, e8, m1, ta, ma
+    vse8.v v1, (a0)
 
     add a2, a2, -16
     add a1, a1, 16
+    add a0, a0, 16
     bnez a2, 1b
 
     ret
\ No newline at end of file
@@ -0,0 +1,27 @@
+/*
+ * File      : zvksed_iov.c
+ * Test      : sm4_benchmark
+ * Date      : 19-oct-2026
+ * Description: Scatter-gather SM4 on top of the zvksed kernels.
+ */
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include "crypto/sm4/zvksed.h"
+
+#define SM4_BLOCK_BYTES 16
+
+int zvksed_sm4_encode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                          const crypto_iovec_t* src, size_t src_cnt,
+                          const void* round_keys) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, SM4_BLOCK_BYTES,
+                        zvksed_sm4_encode_vv, round_keys);
+}
+
+int zvksed_sm4_decode_iov(const crypto_iovec_t* dst, size_t dst_cnt,
+                          const crypto_iovec_t* src, size_t src_cnt,
+                          const void* round_keys) {
+  return crypto_iov_ecb(dst, dst_cnt, src, src_cnt, SM4_BLOCK_BYTES,
+                        zvksed_sm4_decode_vv, round_keys);
+}
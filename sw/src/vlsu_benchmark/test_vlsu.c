@@ -0,0 +1,440 @@
+/*
+ * File      : test_vlsu.c
+ * Test      : vlsu_benchmark
+ * Date      : 19-oct-2026
+ * Description: Bandwidth of the vector load/store unit, the memory roof of
+ * the vector crypto kernels. Unit-stride, strided (every other element),
+ * indexed (vluxei/vsuxei, a permutation within each strip) and two field
+ * segment (vlseg2/vsseg2) accesses are timed read only, write only and as a
+ * copy, at SEW 8 to 64 and LMUL 1 to 8, over buffers from VLSU_MIN_BYTES to
+ * BENCH_MAX_BYTES. Every pattern gets a table of payload bytes per cycle,
+ * and the summary the best configuration of each pattern at the longest
+ * buffer.
+ */
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include "printf.h"
+#include "runtime.h"
+
+#include "crypto/share/arena.h"
+#include "crypto/share/benchmarks.h"
+
+//! Shortest buffer of the sweep
+#ifndef VLSU_MIN_BYTES
+#define VLSU_MIN_BYTES   256
+#endif
+
+//! Buffer of the copy checks, holds a whole strip of every configuration
+#define VLSU_CHECK_BYTES (VLEN > 1024 ? VLEN : 1024)
+
+//! Odd, so i * VLSU_INDEX_MUL modulo vlmax permutes a strip
+#define VLSU_INDEX_MUL   37
+
+#define VLSU_SEWS        4  // 8, 16, 32, 64
+#define VLSU_LMULS       4  // 1, 2, 4, 8
+
+//! vtype of SEW and LMUL, tail and mask agnostic
+#define VLSU_VTYPE(sew, lmul) \
+  ((3u << 6) | ((uint64_t)__builtin_ctz((sew) / 8) << 3) | (uint64_t)__builtin_ctz(lmul))
+
+typedef enum {
+  VLSU_UNIT = 0,
+  VLSU_STRIDED,
+  VLSU_INDEXED,
+  VLSU_SEG2,
+  VLSU_PATTERNS
+} vlsu_pattern_t;
+
+typedef enum {
+  VLSU_READ = 0,
+  VLSU_WRITE,
+  VLSU_COPY,
+  VLSU_OPS
+} vlsu_op_t;
+
+static const char* const vlsu_pattern_names[VLSU_PATTERNS] = {
+  "unit", "strided", "indexed", "seg2"
+};
+
+static const char* const vlsu_op_names[VLSU_OPS] = {
+  "read", "write", "copy"
+};
+
+//! Configuration of one kernel, its bench_kernel_t.arg
+typedef struct {
+  uint64_t vtype;
+  uint64_t idx_vtype;  //!< of the index load, vtype for the other patterns
+  size_t   vlmax;
+  size_t   esize;      //!< element bytes
+  size_t   ieew;       //!< index element bytes
+  size_t   advance;    //!< buffer bytes per element (segment)
+  size_t   stride;     //!< of vlse/vsse
+  unsigned sparse;     //!< log2 of buffer bytes per payload byte
+} vlsu_kernel_t;
+
+static uint8_t vlsu_index     [VLEN] __attribute__((aligned(64)));
+static uint8_t vlsu_check_in  [VLSU_CHECK_BYTES] __attribute__((aligned(64)));
+static uint8_t vlsu_check_out [VLSU_CHECK_BYTES] __attribute__((aligned(64)));
+
+static vlsu_kernel_t  vlsu_args    [VLSU_SEWS * VLSU_LMULS];
+static bench_kernel_t vlsu_kernels [VLSU_SEWS * VLSU_LMULS];
+static char           vlsu_names   [VLSU_SEWS][32];
+
+// best payload bytes per cycle (x100) at the longest buffer, and its kernel
+static uint64_t       vlsu_roof     [VLSU_PATTERNS][VLSU_OPS];
+static const vlsu_kernel_t* vlsu_roof_at [VLSU_PATTERNS][VLSU_OPS];
+
+static crypto_arena_t arena;
+
+//
+// Kernels
+// ----------------------------------------------------------------------
+
+// the data is in v8 (up to v15 for seg2 at LMUL 4), the indices in v16
+#define VLSU_VREGS \
+  "v8", "v9", "v10", "v11", "v12", "v13", "v14", "v15", \
+  "v16", "v17", "v18", "v19", "v20", "v21", "v22", "v23"
+
+#define VLSU_SETVL(vl, n, vtype) \
+  asm volatile("vsetvl %0, %1, %2" : "=r"(vl) : "r"(n), "r"(vtype))
+
+// loads the index vector ahead of the strips, a no-op for the other patterns
+#define VLSU_PRELOAD(k, pre)                                                  \
+  do {                                                                        \
+    asm volatile("vsetvl zero, %0, %1" :: "r"((k)->vlmax), "r"((k)->idx_vtype)); \
+    asm volatile(pre :: [x] "r"(vlsu_index) : "memory", VLSU_VREGS);          \
+  } while (0)
+
+/*
+One read, write and copy kernel of a pattern at one SEW, LMUL comes with
+vtype. Each strip is one load and/or store of vl elements.
+*/
+#define VLSU_RUN_FNS(pat, sew, ld, st, pre)                                   \
+static void vlsu_##pat##_read_e##sew(const bench_io_t* io) {                  \
+  const vlsu_kernel_t* k = io->arg;                                           \
+  const uint8_t* src = io->in;                                                \
+  size_t vl;                                                                  \
+                                                                              \
+  VLSU_PRELOAD(k, pre);                                                       \
+  for (size_t n = io->len / k->advance; n; n -= vl) {                         \
+    VLSU_SETVL(vl, n, k->vtype);                                              \
+    asm volatile(ld :: [s] "r"(src), [t] "r"(k->stride) : "memory", VLSU_VREGS); \
+    src += vl * k->advance;                                                   \
+  }                                                                           \
+}                                                                             \
+                                                                              \
+static void vlsu_##pat##_write_e##sew(const bench_io_t* io) {                 \
+  const vlsu_kernel_t* k = io->arg;                                           \
+  uint8_t* dst = io->out;                                                     \
+  size_t vl;                                                                  \
+                                                                              \
+  VLSU_PRELOAD(k, pre);                                                       \
+  for (size_t n = io->len / k->advance; n; n -= vl) {                         \
+    VLSU_SETVL(vl, n, k->vtype);                                              \
+    asm volatile(st :: [d] "r"(dst), [t] "r"(k->stride) : "memory");          \
+    dst += vl * k->advance;                                                   \
+  }                                                                           \
+}                                                                             \
+                                                                              \
+static void vlsu_##pat##_copy_e##sew(const bench_io_t* io) {                  \
+  const vlsu_kernel_t* k = io->arg;                                           \
+  const uint8_t* src = io->in;                                                \
+  uint8_t* dst = io->out;                                                     \
+  size_t vl;                                                                  \
+                                                                              \
+  VLSU_PRELOAD(k, pre);                                                       \
+  for (size_t n = io->len / k->advance; n; n -= vl) {                         \
+    VLSU_SETVL(vl, n, k->vtype);                                              \
+    asm volatile(ld :: [s] "r"(src), [t] "r"(k->stride) : "memory", VLSU_VREGS); \
+    asm volatile(st :: [d] "r"(dst), [t] "r"(k->stride) : "memory");          \
+    src += vl * k->advance;                                                   \
+    dst += vl * k->advance;                                                   \
+  }                                                                           \
+}
+
+#define VLSU_UNIT_FNS(sew)                                                    \
+  VLSU_RUN_FNS(unit, sew, "vle" #sew ".v v8, (%[s])", "vse" #sew ".v v8, (%[d])", "")
+
+#define VLSU_STRIDED_FNS(sew)                                                 \
+  VLSU_RUN_FNS(strided, sew, "vlse" #sew ".v v8, (%[s]), %[t]",               \
+               "vsse" #sew ".v v8, (%[d]), %[t]", "")
+
+// 8-bit indices cannot reach across a strip, SEW 8 takes 16-bit ones
+#define VLSU_INDEXED_FNS(sew, ieew)                                           \
+  VLSU_RUN_FNS(indexed, sew, "vluxei" #ieew ".v v8, (%[s]), v16",             \
+               "vsuxei" #ieew ".v v8, (%[d]), v16", "vle" #ieew ".v v16, (%[x])")
+
+#define VLSU_SEG2_FNS(sew)                                                    \
+  VLSU_RUN_FNS(seg2, sew, "vlseg2e" #sew ".v v8, (%[s])", "vsseg2e" #sew ".v v8, (%[d])", "")
+
+VLSU_UNIT_FNS(8)
+VLSU_UNIT_FNS(16)
+VLSU_UNIT_FNS(32)
+VLSU_UNIT_FNS(64)
+VLSU_STRIDED_FNS(8)
+VLSU_STRIDED_FNS(16)
+VLSU_STRIDED_FNS(32)
+VLSU_STRIDED_FNS(64)
+VLSU_INDEXED_FNS(8, 16)
+VLSU_INDEXED_FNS(16, 16)
+VLSU_INDEXED_FNS(32, 32)
+VLSU_INDEXED_FNS(64, 64)
+VLSU_SEG2_FNS(8)
+VLSU_SEG2_FNS(16)
+VLSU_SEG2_FNS(32)
+VLSU_SEG2_FNS(64)
+
+typedef void (*vlsu_fn_t)(const bench_io_t* io);
+
+#define VLSU_FN_ROW(pat) {                                                                \
+  { vlsu_##pat##_read_e8,  vlsu_##pat##_read_e16,  vlsu_##pat##_read_e32,  vlsu_##pat##_read_e64  }, \
+  { vlsu_##pat##_write_e8, vlsu_##pat##_write_e16, vlsu_##pat##_write_e32, vlsu_##pat##_write_e64 }, \
+  { vlsu_##pat##_copy_e8,  vlsu_##pat##_copy_e16,  vlsu_##pat##_copy_e32,  vlsu_##pat##_copy_e64  }, \
+}
+
+static const vlsu_fn_t vlsu_fns[VLSU_PATTERNS][VLSU_OPS][VLSU_SEWS] = {
+  VLSU_FN_ROW(unit),
+  VLSU_FN_ROW(strided),
+  VLSU_FN_ROW(indexed),
+  VLSU_FN_ROW(seg2),
+};
+
+// byte offsets of a strip permutation, ieew wide
+static void vlsu_setup_index(const bench_io_t* io) {
+  const vlsu_kernel_t* k = io->arg;
+
+  for (size_t i = 0; i < k->vlmax; i++) {
+    uint64_t off = ((i * VLSU_INDEX_MUL) & (k->vlmax - 1)) * k->esize;
+
+    switch (k->ieew) {
+      case 2:  ((uint16_t*)vlsu_index)[i] = (uint16_t)off; break;
+      case 4:  ((uint32_t*)vlsu_index)[i] = (uint32_t)off; break;
+      default: ((uint64_t*)vlsu_index)[i] = off;           break;
+    }
+  }
+}
+
+//
+// Registration, checks and tables
+// ----------------------------------------------------------------------
+
+// kernels of one pattern and access, in SEW then LMUL order; the number
+// registered, configurations without a legal encoding are left out
+static size_t vlsu_register(vlsu_pattern_t pat, vlsu_op_t op) {
+  size_t n = 0;
+
+  bench_reset();
+
+  for (unsigned si = 0; si < VLSU_SEWS; si++) {
+    unsigned sew  = 8u << si;
+    size_t   ieew = sew == 8 ? 2 : sew / 8;
+
+    snprintf(vlsu_names[si], sizeof(vlsu_names[si]), "vlsu %s %s e%u",
+             vlsu_pattern_names[pat], vlsu_op_names[op], sew);
+
+    for (unsigned li = 0; li < VLSU_LMULS; li++) {
+      unsigned lmul = 1u << li;
+      unsigned iemul = lmul * ieew * 8 / sew;
+      vlsu_kernel_t*  a = &vlsu_args[n];
+      bench_kernel_t* b = &vlsu_kernels[n];
+
+      // EMUL of the indices, or fields * EMUL, above 8
+      if ((pat == VLSU_INDEXED && iemul > 8) || (pat == VLSU_SEG2 && 2 * lmul > 8)) {
+        continue;
+      }
+
+      a->vtype     = VLSU_VTYPE(sew, lmul);
+      a->idx_vtype = pat == VLSU_INDEXED ? VLSU_VTYPE(8 * ieew, iemul) : a->vtype;
+      a->esize     = sew / 8;
+      a->ieew      = ieew;
+      a->advance   = pat == VLSU_STRIDED || pat == VLSU_SEG2 ? 2 * a->esize : a->esize;
+      a->stride    = 2 * a->esize;
+      a->sparse    = pat == VLSU_STRIDED;
+      VLSU_SETVL(a->vlmax, SIZE_MAX, a->vtype);
+
+      if (pat == VLSU_INDEXED && a->vlmax * ieew > sizeof(vlsu_index)) {
+        continue;
+      }
+
+      b->name      = vlsu_names[si];
+      b->lmul      = lmul;
+      // indexed strips are whole permutations
+      b->granule   = pat == VLSU_INDEXED ? a->vlmax * a->esize : a->advance;
+      b->fixed_len = 0;
+      b->setup     = pat == VLSU_INDEXED ? vlsu_setup_index : NULL;
+      b->run       = vlsu_fns[pat][op][si];
+      b->arg       = a;
+
+      bench_register(b);
+      n++;
+    }
+  }
+  return n;
+}
+
+// a copy moves every payload byte to the same offset
+static uint32_t vlsu_check_copy(const bench_kernel_t* b) {
+  const vlsu_kernel_t* a = b->arg;
+  size_t len = VLSU_CHECK_BYTES / b->granule * b->granule;
+  bench_io_t io = { vlsu_check_in, vlsu_check_out, len, b->arg };
+
+  for (size_t i = 0; i < len; i++) {
+    vlsu_check_out[i] = 0;
+  }
+  if (b->setup) {
+    b->setup(&io);
+  }
+  b->run(&io);
+
+  for (size_t i = 0; i < len; i++) {
+    // strided copies leave every other element
+    if (a->sparse && (i % a->stride) >= a->esize) {
+      continue;
+    }
+    if (vlsu_check_out[i] != vlsu_check_in[i]) {
+      printf("# VLSU: %s (lmul = %u) copy differs at byte %lu\n", b->name, b->lmul, i);
+      return 1;
+    }
+  }
+  return 0;
+}
+
+// e<SEW>m<LMUL>
+static const char* vlsu_label(const vlsu_kernel_t* a) {
+  static char label [8];
+
+  snprintf(label, sizeof(label), "e%lum%lu", 8 * a->esize, 1ul << (a->vtype & 7));
+  return label;
+}
+
+// payload bytes per cycle, x100
+static uint64_t vlsu_bpc(const vlsu_kernel_t* a, size_t len, uint64_t median) {
+  return median ? 100 * (len >> a->sparse) / median : 0;
+}
+
+static void vlsu_print_table(vlsu_pattern_t pat, vlsu_op_t op, size_t nk,
+                             const bench_config_t* c) {
+  size_t last = 0;
+
+  printf("\n# VLSU %s %s (payload bytes/cycle, median):\n", vlsu_pattern_names[pat],
+         vlsu_op_names[op]);
+  printf("#\t%8s", "bytes");
+  for (size_t k = 0; k < nk; k++) {
+    printf("  %6s", vlsu_label(&vlsu_args[k]));
+  }
+  printf("\n");
+
+  for (size_t len = c->min_len; len && len <= c->max_len; len <<= 1) {
+    printf("#\t%8lu", len);
+    for (size_t k = 0; k < nk; k++) {
+      size_t n;
+      const bench_stats_t* s = bench_results(k, &n);
+      uint64_t bpc = 0;
+      int      ran = 0;
+
+      for (size_t i = 0; i < n; i++) {
+        if (s[i].len == len) {
+          bpc = vlsu_bpc(&vlsu_args[k], len, s[i].median);
+          ran = 1;
+        }
+      }
+      if (ran) {
+        printf("  %3lu.%02lu", bpc / 100, bpc % 100);
+      } else {
+        printf("  %6s", "-");
+      }
+    }
+    printf("\n");
+    last = len;
+  }
+
+  // roof at the longest buffer every kernel ran
+  vlsu_roof[pat][op]    = 0;
+  vlsu_roof_at[pat][op] = NULL;
+  for (size_t k = 0; k < nk; k++) {
+    size_t n;
+    const bench_stats_t* s = bench_results(k, &n);
+
+    if (n && s[n - 1].len == last) {
+      uint64_t bpc = vlsu_bpc(&vlsu_args[k], last, s[n - 1].median);
+      if (bpc > vlsu_roof[pat][op]) {
+        vlsu_roof[pat][op]    = bpc;
+        vlsu_roof_at[pat][op] = &vlsu_args[k];
+      }
+    }
+  }
+}
+
+static void vlsu_print_roof(size_t len) {
+  printf("\n# VLSU roof (best payload bytes/cycle at %lu B):\n", len);
+  printf("#\t%8s", "");
+  for (unsigned op = 0; op < VLSU_OPS; op++) {
+    printf("  %14s", vlsu_op_names[op]);
+  }
+  printf("\n");
+
+  for (unsigned pat = 0; pat < VLSU_PATTERNS; pat++) {
+    printf("#\t%8s", vlsu_pattern_names[pat]);
+    for (unsigned op = 0; op < VLSU_OPS; op++) {
+      const vlsu_kernel_t* a = vlsu_roof_at[pat][op];
+      uint64_t bpc = vlsu_roof[pat][op];
+
+      if (a) {
+        printf("  %3lu.%02lu %7s", bpc / 100, bpc % 100, vlsu_label(a));
+      } else {
+        printf("  %14s", "-");
+      }
+    }
+    printf("\n");
+  }
+}
+
+int main(void) {
+
+  volatile uint32_t fail = 0;
+  bench_config_t    config;
+
+  init_vrf();
+
+  crypto_arena_init_l2(&arena);
+  if (bench_init(&arena) != BENCH_OK) {
+    printf("# VLSU: the benchmark buffers do not fit the L2 arena!\n");
+    return 1;
+  }
+  test_rdrandom(vlsu_check_in, sizeof(vlsu_check_in));
+
+  bench_config_default(&config);
+  config.min_len = VLSU_MIN_BYTES < config.max_len ? VLSU_MIN_BYTES : config.max_len;
+  // Ara reaches L2 over its own AXI port, not through the CVA6 D-cache, so
+  // evicting the caches ahead of a run tells nothing about the VLSU
+  config.cold    = 0;
+
+  printf("\nVLSU bandwidth with %u lanes and VLEN = %u over %lu to %lu Byte buffers\n",
+         NR_LANES, VLEN, config.min_len, config.max_len);
+
+  for (unsigned pat = 0; pat < VLSU_PATTERNS; pat++) {
+    for (unsigned op = 0; op < VLSU_OPS; op++) {
+      size_t nk = vlsu_register(pat, op);
+
+      if (op == VLSU_COPY) {
+        for (size_t k = 0; k < nk; k++) {
+          fail += vlsu_check_copy(&vlsu_kernels[k]);
+        }
+      }
+
+      bench_run(&config);
+      vlsu_print_table(pat, op, nk, &config);
+    }
+  }
+
+  vlsu_print_roof(config.max_len);
+
+  if(fail) {
+    printf("\n %u Failures!\n\n", fail);
+    return fail;
+  } else {
+    return 0;
+  }
+}
@@ -0,0 +1,268 @@
+# ------------------------------------------------------------------------------
+# bench_collect.py
+#
+# Date     : 19-oct-2026
+#
+# Description: Collects the result records of the benchmarks from simulator or
+#              UART logs into a table and compares it against a stored
+#              baseline.
+#
+#              The benchmarks print every result as a tagged CSV line (see
+#              bench_record() in inc/crypto/share/benchmarks.h):
+#
+#                @bench,<kernel>,<len>,<lmul>,<icount>,<ccount>
+#
+#              and, when the benchmark framework ran the kernel, the mean
+#              counts of the core's event counters per run (see
+#              inc/crypto/share/hpm.h), in the order of HPM_EVENTS below:
+#
+#                @hpm,<kernel>,<len>,<lmul>,<count>,...
+#
+#              The tag may follow other text on the line (simulator time
+#              stamps, transcript prefixes), everything else in the log is
+#              ignored. Records are keyed by test, kernel, len and lmul; the
+#              test is the log file name without extension unless given as
+#              <test>=<log>.
+#
+#              The script is called with the following options:
+#              python3 bench_collect.py [options] <log> [<log> ...]
+#
+#              --csv <file>        write the collected table to <file>
+#              --baseline <file>   compare against a table written by --csv
+#              --tolerance <pct>   allowed cycle count increase (default 5)
+#              --icount-tolerance <pct>
+#                                  allowed instruction count increase
+#                                  (default: same as --tolerance)
+#              --hpm-csv <file>    write the event counts to <file>
+#              --side-by-side      print the cycle counts of the logs next
+#                                  to each other instead of the table, one
+#                                  row per kernel, len and lmul, with the
+#                                  change against the first log (e.g. the
+#                                  GCC and LLVM builds of one benchmark)
+#              --allow-missing     baseline entries missing from the logs are
+#                                  not an error
+#              --update            write the collected table to the baseline
+#                                  file instead of comparing
+#
+#              The exit status is 1 if a result regressed beyond the
+#              tolerance, a baseline entry is missing or a log holds no
+#              records, 0 otherwise.
+# ------------------------------------------------------------------------------
+import argparse
+import csv
+import os
+import re
+import sys
+
+RECORD_TAG = "@bench"
+FIELDS = ["test", "kernel", "len", "lmul", "icount", "ccount"]
+
+HPM_TAG = "@hpm"
+HPM_EVENTS = ["icache_miss", "dcache_miss", "itlb_miss", "dtlb_miss", "load", "store",
+              "exception", "exception_ret", "branch_jump", "call", "ret", "mis_predict",
+              "sb_full", "if_empty"]
+
+# kernel names may contain spaces but no commas
+RECORD_RE = re.compile(re.escape(RECORD_TAG) + r",([^,\r\n]+),(\d+),(\d+),(\d+),(\d+)")
+HPM_RE = re.compile(re.escape(HPM_TAG) + r",([^,\r\n]+),(\d+),(\d+)((?:,\d+)+)")
+
+
+# Results of one run, keyed by (test, kernel, len, lmul)
+class ResultTable:
+    def __init__(self):
+        self.rows = {}
+        self.hpm = {}
+
+    def add(self, test, kernel, length, lmul, icount, ccount):
+        key = (test, kernel, length, lmul)
+        if key in self.rows:
+            print(f"warning: {test}: repeated record for {kernel} ({length} B, lmul {lmul}), "
+                  f"keeping the last one", file=sys.stderr)
+        self.rows[key] = (icount, ccount)
+
+    def parse_log(self, test, path):
+        count = 0
+        with open(path, errors="replace") as f:
+            for line in f:
+                m = HPM_RE.search(line)
+                if m:
+                    kernel, length, lmul, counts = m.groups()
+                    key = (test, kernel.strip(), int(length), int(lmul))
+                    self.hpm[key] = [int(c) for c in counts[1:].split(",")]
+                    continue
+                m = RECORD_RE.search(line)
+                if not m:
+                    continue
+                kernel, length, lmul, icount, ccount = m.groups()
+                self.add(test, kernel.strip(), int(length), int(lmul), int(icount), int(ccount))
+                count += 1
+        return count
+
+    def read_csv(self, path):
+        with open(path, newline="") as f:
+            for row in csv.DictReader(f):
+                self.add(row["test"], row["kernel"], int(row["len"]), int(row["lmul"]),
+                         int(row["icount"]), int(row["ccount"]))
+
+    def write_csv(self, path):
+        with open(path, "w", newline="") as f:
+            w = csv.writer(f)
+            w.writerow(FIELDS)
+            for key in sorted(self.rows):
+                w.writerow(list(key) + list(self.rows[key]))
+
+    def write_hpm_csv(self, path):
+        with open(path, "w", newline="") as f:
+            w = csv.writer(f)
+            w.writerow(FIELDS[:4] + HPM_EVENTS)
+            for key in sorted(self.hpm):
+                counts = self.hpm[key]
+                if len(counts) != len(HPM_EVENTS):
+                    print(f"warning: {key[0]}: {len(counts)} event counts for {key[1]}, "
+                          f"expected {len(HPM_EVENTS)}", file=sys.stderr)
+                w.writerow(list(key) + counts)
+
+    def print_table(self):
+        print(f"{'test':<20} {'kernel':<36} {'len':>8} {'lmul':>4} {'icount':>12} "
+              f"{'ccount':>12} {'c/B':>8}")
+        for key in sorted(self.rows):
+            test, kernel, length, lmul = key
+            icount, ccount = self.rows[key]
+            cpb = f"{ccount / length:.2f}" if length else "-"
+            print(f"{test:<20} {kernel:<36} {length:>8} {lmul:>4} {icount:>12} {ccount:>12} "
+                  f"{cpb:>8}")
+
+
+    # one cycle count column per test, in the given order
+    def print_side_by_side(self, tests):
+        cells = {}
+        for (test, kernel, length, lmul), (_, ccount) in self.rows.items():
+            cells.setdefault((kernel, length, lmul), {})[test] = ccount
+
+        head = f"{'kernel':<36} {'len':>8} {'lmul':>4}"
+        for i, test in enumerate(tests):
+            head += f" {test:>16}" + (f" {'':>8}" if i else "")
+        print(head + f" {'best':>16}")
+
+        wins = {test: 0 for test in tests}
+        for key in sorted(cells):
+            kernel, length, lmul = key
+            row = cells[key]
+            line = f"{kernel:<36} {length:>8} {lmul:>4}"
+            first = row.get(tests[0])
+            for i, test in enumerate(tests):
+                ccount = row.get(test)
+                line += f" {ccount if ccount is not None else '-':>16}"
+                if i:
+                    d = f"{change(ccount, first):+.1f}%" if ccount is not None and first else "-"
+                    line += f" {d:>8}"
+            present = [t for t in tests if t in row]
+            best = min(present, key=lambda t: row[t])
+            if len(present) > 1:
+                wins[best] += 1
+            print(line + f" {best:>16}")
+
+        print("\nfastest: " + ", ".join(f"{t} {wins[t]}" for t in tests))
+
+
+def change(new, old):
+    if old == 0:
+        return 0.0 if new == 0 else float("inf")
+    return 100.0 * (new - old) / old
+
+
+# Compare against the baseline, return the number of failures
+def compare(current, baseline, tolerance, icount_tolerance, allow_missing):
+    failures = 0
+    improved = 0
+
+    for key in sorted(baseline.rows):
+        test, kernel, length, lmul = key
+        name = f"{test}: {kernel} ({length} B, lmul {lmul})"
+        old_icount, old_ccount = baseline.rows[key]
+
+        if key not in current.rows:
+            if not allow_missing:
+                print(f"MISSING   {name}")
+                failures += 1
+            continue
+
+        new_icount, new_ccount = current.rows[key]
+        dc = change(new_ccount, old_ccount)
+        di = change(new_icount, old_icount)
+
+        if dc > tolerance or di > icount_tolerance:
+            print(f"REGRESSED {name}: ccount {old_ccount} -> {new_ccount} ({dc:+.1f}%), "
+                  f"icount {old_icount} -> {new_icount} ({di:+.1f}%)")
+            failures += 1
+        elif dc < -tolerance:
+            print(f"IMPROVED  {name}: ccount {old_ccount} -> {new_ccount} ({dc:+.1f}%)")
+            improved += 1
+
+    new = [key for key in current.rows if key not in baseline.rows]
+    for test, kernel, length, lmul in sorted(new):
+        print(f"NEW       {test}: {kernel} ({length} B, lmul {lmul})")
+
+    print(f"\n{len(baseline.rows)} baseline results, {failures} failures, {improved} improved, "
+          f"{len(new)} new (tolerance {tolerance}% cycles, {icount_tolerance}% instructions)")
+    return failures
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Collect and compare benchmark results")
+    parser.add_argument("logs", nargs="+", metavar="[test=]log")
+    parser.add_argument("--csv", metavar="file")
+    parser.add_argument("--baseline", metavar="file")
+    parser.add_argument("--tolerance", type=float, default=5.0, metavar="pct")
+    parser.add_argument("--icount-tolerance", type=float, metavar="pct")
+    parser.add_argument("--hpm-csv", metavar="file")
+    parser.add_argument("--side-by-side", action="store_true")
+    parser.add_argument("--allow-missing", action="store_true")
+    parser.add_argument("--update", action="store_true")
+    args = parser.parse_args()
+
+    if args.update and not args.baseline:
+        parser.error("--update needs --baseline")
+    if args.icount_tolerance is None:
+        args.icount_tolerance = args.tolerance
+
+    current = ResultTable()
+    failures = 0
+    tests = []
+
+    for arg in args.logs:
+        test, sep, path = arg.partition("=")
+        if not sep:
+            path = arg
+            test = os.path.splitext(os.path.basename(arg))[0]
+        tests.append(test)
+        if current.parse_log(test, path) == 0:
+            print(f"error: no {RECORD_TAG} records in {path}", file=sys.stderr)
+            failures += 1
+
+    if args.side_by_side:
+        current.print_side_by_side(tests)
+    else:
+        current.print_table()
+
+    if args.csv:
+        current.write_csv(args.csv)
+    if args.hpm_csv:
+        current.write_hpm_csv(args.hpm_csv)
+
+    if args.baseline:
+        if args.update:
+            current.write_csv(args.baseline)
+            print(f"\nbaseline {args.baseline} updated with {len(current.rows)} results")
+        else:
+            baseline = ResultTable()
+            baseline.read_csv(args.baseline)
+            print()
+            failures += compare(current, baseline, args.tolerance, args.icount_tolerance,
+                                args.allow_missing)
+
+    return 1 if failures else 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,196 @@
+# ------------------------------------------------------------------------------
+# trace_decode.py
+#
+# Date     : 19-oct-2026
+#
+# Description: Turns the binary event trace of inc/trace.h into a timeline.
+#
+#              The trace is read from one of:
+#              - a simulator or UART log holding the records printed by
+#                trace_drain():
+#
+#                  @trace,head,<events>,<records>
+#                  @trace,<cycle>,<id>,<arg>
+#
+#              - a memory dump of L2, either raw binary or a readmemh/
+#                writememh hex file with rows in the layout of dump2hex.py
+#                (lowest address in the rightmost byte). The trace header is
+#                found by its magic and points at the ring buffer.
+#
+#              Event names are taken from the TRACE_EV_ defines of trace.h.
+#              For every event the timeline prints the cycle relative to the
+#              first event, the distance to the previous event, the name and
+#              the argument. An exit event (_EXIT, matched to the last open
+#              _ENTER of the same name and argument) also prints the cycles
+#              since its entry.
+#
+#              The script is called with the following options:
+#              python3 trace_decode.py [options] <log or dump>
+#
+#              --dump              the input is a memory dump
+#              --base <addr>       address of the first byte of the dump
+#                                  (default 0x80000000)
+#              --width <bits>      row width of a hex dump (default 128)
+#              --header <file>     trace.h to take the event names from
+#                                  (default ../inc/trace.h)
+#              --csv <file>        also write the events to <file>
+# ------------------------------------------------------------------------------
+import argparse
+import csv
+import os
+import re
+import struct
+import sys
+
+TRACE_TAG = "@trace"
+TRACE_MAGIC = 0x45435254
+
+RECORD_RE = re.compile(TRACE_TAG + r",(\d+),(\d+),(0x[0-9a-fA-F]+|\d+)\s*$")
+HEAD_RE = re.compile(TRACE_TAG + r",head,(\d+),(\d+)")
+EVENT_RE = re.compile(r"^\s*#define\s+TRACE_EV_(\w+)\s+(0x[0-9a-fA-F]+|\d+)")
+
+DEFAULT_HEADER = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "inc", "trace.h")
+
+
+def event_names(header):
+    names = {}
+    user = None
+    try:
+        with open(header, "rt") as f:
+            for line in f:
+                m = EVENT_RE.match(line)
+                if m:
+                    if m.group(1) == "USER":
+                        user = int(m.group(2), 0)
+                    else:
+                        names[int(m.group(2), 0)] = m.group(1).lower()
+    except OSError:
+        print(f"[WARNING] - cannot read {header}, events are printed by id", file=sys.stderr)
+    return names, user
+
+
+def read_log(path):
+    events = []
+    head = None
+    with open(path, "rt", errors="replace") as f:
+        for line in f:
+            m = HEAD_RE.search(line)
+            if m:
+                # a new drain replaces an earlier one
+                head = (int(m.group(1)), int(m.group(2)))
+                events = []
+                continue
+            m = RECORD_RE.search(line)
+            if m:
+                events.append((int(m.group(1)), int(m.group(2)), int(m.group(3), 0)))
+    if head and head[0] > head[1]:
+        print(f"[WARNING] - {head[0] - head[1]} older events were overwritten", file=sys.stderr)
+    return events
+
+
+def read_hex_dump(path, width):
+    row_bytes = width // 8
+    data = bytearray()
+    addr = 0
+    with open(path, "rt") as f:
+        for line in f:
+            line = line.split("//")[0].strip()
+            if not line:
+                continue
+            if line.startswith("@"):
+                addr = int(line[1:], 16) * row_bytes
+                continue
+            for word in line.split():
+                row = bytes.fromhex(word.rjust(2 * row_bytes, "0"))[::-1]
+                if len(data) < addr:
+                    data.extend(bytes(addr - len(data)))
+                data[addr:addr + row_bytes] = row
+                addr += row_bytes
+    return bytes(data)
+
+
+def read_dump(path, base, width):
+    with open(path, "rb") as f:
+        data = f.read()
+    # a hex dump is plain text, a binary dump of code and data is not
+    if all(32 <= b < 127 or b in b"\t\r\n" for b in data):
+        data = read_hex_dump(path, width)
+
+    end = base + len(data)
+    for off in range(0, len(data) - 24, 8):
+        magic, records, buffer, head = struct.unpack_from("<IIQQ", data, off)
+        if magic != TRACE_MAGIC or records == 0 or records & (records - 1):
+            continue
+        if buffer < base or buffer + 16 * records > end:
+            continue
+        first = head - records if head > records else 0
+        if head > records:
+            print(f"[WARNING] - {head - records} older events were overwritten", file=sys.stderr)
+        events = []
+        for i in range(first, head):
+            pos = buffer - base + 16 * (i & (records - 1))
+            events.append(struct.unpack_from("<QII", data, pos))
+        return events
+    sys.exit(f"[ERROR] - no trace header found in {path}")
+
+
+def timeline(events, names, user):
+    def name(i):
+        if i in names:
+            return names[i]
+        if user is not None and i >= user:
+            return f"user+{i - user}"
+        return f"0x{i:x}"
+
+    rows = []
+    open_events = {}
+    t0 = events[0][0] if events else 0
+    prev = t0
+    for cycle, ev, arg in events:
+        n = name(ev)
+        span = ""
+        if n.endswith("_enter"):
+            open_events.setdefault((n[:-6], arg), []).append(cycle)
+        elif n.endswith("_exit"):
+            entries = open_events.get((n[:-5], arg))
+            if entries:
+                span = cycle - entries.pop()
+        rows.append((cycle - t0, cycle - prev, n, f"0x{arg:x}", span))
+        prev = cycle
+    return rows
+
+
+def main():
+    parser = argparse.ArgumentParser(description="Decodes the event trace of trace.h into a timeline.")
+    parser.add_argument("input", help="simulator/UART log or memory dump")
+    parser.add_argument("--dump", action="store_true", help="the input is a memory dump")
+    parser.add_argument("--base", type=lambda s: int(s, 0), default=0x80000000,
+                        help="address of the first byte of the dump")
+    parser.add_argument("--width", type=int, default=128, help="row width of a hex dump in bits")
+    parser.add_argument("--header", default=DEFAULT_HEADER, help="trace.h with the event ids")
+    parser.add_argument("--csv", help="also write the events to this file")
+    args = parser.parse_args()
+
+    names, user = event_names(args.header)
+    if args.dump:
+        events = read_dump(args.input, args.base, args.width)
+    else:
+        events = read_log(args.input)
+
+    if not events:
+        sys.exit(f"[ERROR] - no trace events in {args.input}")
+
+    rows = timeline(events, names, user)
+    print(f"{'cycle':>12} {'delta':>10}  {'event':<14} {'arg':>10} {'span':>10}")
+    for t, d, n, a, s in rows:
+        print(f"{t:>12} {d:>10}  {n:<14} {a:>10} {s!s:>10}")
+
+    if args.csv:
+        with open(args.csv, "wt", newline="") as f:
+            w = csv.writer(f)
+            w.writerow(["cycle", "delta", "event", "arg", "span"])
+            w.writerows(rows)
+
+
+if __name__ == "__main__":
+    main()